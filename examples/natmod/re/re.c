@@ -26,6 +26,14 @@ void *memcpy(void *dst, const void *src, size_t n) {
 void *memset(void *s, int c, size_t n) {
     return mp_fun_table.memset_(s, c, n);
 }
+void *memchr(const void *s, int c, size_t n) {
+    for (const unsigned char *p = s; n--; p++) {
+        if (*p == (unsigned char)c) {
+            return (void *)p;
+        }
+    }
+    return NULL;
+}
 #endif
 
 void *memmove(void *dest, const void *src, size_t n) {
@@ -24,10 +24,13 @@
  * THE SOFTWARE.
  */
 
+// CIRCUITPY-CHANGE
+#include "py/objint.h"
 #include "py/runtime.h"
 #include "py/smallint.h"
 #include "py/pairheap.h"
 #include "py/mphal.h"
+#include "py/stream.h"
 
 #if MICROPY_PY_ASYNCIO
 
@@ -179,7 +182,8 @@ STATIC MP_DEFINE_CONST_OBJ_TYPE(
 // Task class
 
 // This is the core asyncio context with cur_task, _task_queue and CancelledError.
-STATIC mp_obj_t asyncio_context = MP_OBJ_NULL;
+// CIRCUITPY-CHANGE: kept as a root pointer so it is traced and reset with the VM.
+#define asyncio_context MP_STATE_VM(asyncio_core_context)
 
 STATIC mp_obj_t task_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     mp_arg_check_num(n_args, n_kw, 1, 2, false);
@@ -340,6 +344,451 @@ STATIC MP_DEFINE_CONST_OBJ_TYPE(
     iter, &task_getiter_iternext
     );
 
+/******************************************************************************/
+// CIRCUITPY-CHANGE: native event loop core
+//
+// These implement the hot paths of the Python asyncio core (sleep_ms, IOQueue
+// and run_until_complete) against the same context dict that Task uses, so
+// the Python package can import them in place of its own versions.
+
+STATIC mp_obj_t context_get(qstr name) {
+    if (asyncio_context == MP_OBJ_NULL) {
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("no running event loop"));
+    }
+    return mp_obj_dict_get(asyncio_context, MP_OBJ_NEW_QSTR(name));
+}
+
+STATIC void context_store(qstr name, mp_obj_t value) {
+    mp_obj_dict_store(asyncio_context, MP_OBJ_NEW_QSTR(name), value);
+}
+
+STATIC void task_queue_push_now(mp_obj_t task_queue, mp_obj_t task) {
+    mp_obj_t args[2] = { task_queue, task };
+    task_queue_push(2, args);
+}
+
+// sleep_ms() hands out a single statically allocated awaitable, as the
+// Python version does, so sleeping doesn't allocate.  The IOQueue uses a
+// second one that yields without rescheduling: the poller wakes the task.
+
+typedef struct _mp_obj_sleep_t {
+    mp_obj_base_t base;
+    // Small int deadline, mp_const_none to wait for a wakeup, or MP_OBJ_NULL when spent.
+    mp_obj_t deadline;
+} mp_obj_sleep_t;
+
+STATIC const mp_obj_type_t sleep_type;
+
+STATIC mp_obj_sleep_t asyncio_sleep_gen = { { &sleep_type }, MP_OBJ_NULL };
+#if MICROPY_PY_SELECT
+STATIC mp_obj_sleep_t asyncio_never_gen = { { &sleep_type }, MP_OBJ_NULL };
+#endif
+
+// Deadlines are compared as ticks, which wrap, so a sleep can be at most half
+// the ticks period (about three days) long.  Longer ones are shortened to that.
+#define SLEEP_MAX_MS ((mp_int_t)_TICKS_HALFPERIOD - 1)
+
+// Convert t, in units of ms_per_unit milliseconds, to a sleep in milliseconds.
+STATIC mp_int_t sleep_to_ms(mp_obj_t t_in, mp_int_t ms_per_unit) {
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (mp_obj_is_float(t_in)) {
+        mp_float_t ms = mp_obj_get_float(t_in) * ms_per_unit;
+        if (!(ms > 0)) {
+            return 0;
+        }
+        return ms < SLEEP_MAX_MS ? (mp_int_t)ms : SLEEP_MAX_MS;
+    }
+    #endif
+    if (mp_obj_is_int(t_in) && !mp_obj_is_small_int(t_in)) {
+        // A big int is far outside the range either way.
+        return mp_obj_int_sign(t_in) < 0 ? 0 : SLEEP_MAX_MS;
+    }
+    mp_int_t t = mp_obj_get_int(t_in);
+    if (t <= 0) {
+        return 0;
+    }
+    return t < SLEEP_MAX_MS / ms_per_unit ? t * ms_per_unit : SLEEP_MAX_MS;
+}
+
+STATIC mp_obj_t asyncio_sleep_ms(mp_obj_t t_in) {
+    mp_int_t t = sleep_to_ms(t_in, 1);
+    asyncio_sleep_gen.deadline = MP_OBJ_NEW_SMALL_INT((MP_OBJ_SMALL_INT_VALUE(ticks()) + t) & _TICKS_MAX);
+    return MP_OBJ_FROM_PTR(&asyncio_sleep_gen);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(asyncio_sleep_ms_obj, asyncio_sleep_ms);
+
+STATIC mp_obj_t asyncio_sleep(mp_obj_t t_in) {
+    return asyncio_sleep_ms(MP_OBJ_NEW_SMALL_INT(sleep_to_ms(t_in, 1000)));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(asyncio_sleep_obj, asyncio_sleep);
+
+STATIC mp_obj_t sleep_getiter(mp_obj_t self_in, mp_obj_iter_buf_t *iter_buf) {
+    (void)iter_buf;
+    return self_in;
+}
+
+STATIC mp_obj_t sleep_iternext(mp_obj_t self_in) {
+    mp_obj_sleep_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->deadline == MP_OBJ_NULL) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    if (self->deadline == mp_const_none) {
+        self->deadline = MP_OBJ_NULL;
+        return mp_const_none;
+    }
+    // Reschedule the current task and yield to the loop.
+    mp_obj_t args[3] = { context_get(MP_QSTR__task_queue), context_get(MP_QSTR_cur_task), self->deadline };
+    self->deadline = MP_OBJ_NULL;
+    task_queue_push(3, args);
+    return mp_const_none;
+}
+
+STATIC mp_obj_t sleep_await(mp_obj_t self_in) {
+    return self_in;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(sleep_await_obj, sleep_await);
+
+STATIC void sleep_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
+    if (dest[0] == MP_OBJ_NULL && attr == MP_QSTR___await__) {
+        dest[0] = MP_OBJ_FROM_PTR(&sleep_await_obj);
+        dest[1] = self_in;
+    }
+}
+
+STATIC const mp_getiter_iternext_custom_t sleep_getiter_iternext = {
+    .getiter = sleep_getiter,
+    .iternext = sleep_iternext,
+};
+
+STATIC MP_DEFINE_CONST_OBJ_TYPE(
+    sleep_type,
+    MP_QSTR_SingletonGenerator,
+    MP_TYPE_FLAG_ITER_IS_CUSTOM,
+    attr, sleep_attr,
+    iter, &sleep_getiter_iternext
+    );
+
+#if MICROPY_PY_SELECT
+
+// IOQueue maps id(stream) to [reader_task, writer_task, stream] and keeps a
+// select.poll object registered with the events those tasks wait for.
+
+typedef struct _mp_obj_io_queue_t {
+    mp_obj_base_t base;
+    mp_obj_t poller;
+    mp_obj_t map;
+} mp_obj_io_queue_t;
+
+STATIC const mp_obj_type_t io_queue_type;
+
+extern const mp_obj_module_t mp_module_select;
+
+STATIC mp_obj_t io_queue_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    (void)args;
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    mp_obj_io_queue_t *self = mp_obj_malloc(mp_obj_io_queue_t, type);
+    self->poller = mp_call_function_0(mp_load_attr(MP_OBJ_FROM_PTR(&mp_module_select), MP_QSTR_poll));
+    self->map = mp_obj_new_dict(0);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC void io_queue_poller_call(mp_obj_io_queue_t *self, qstr method, size_t n_args, mp_obj_t arg0, mp_obj_t arg1) {
+    mp_obj_t dest[4];
+    mp_load_method(self->poller, method, dest);
+    dest[2] = arg0;
+    dest[3] = arg1;
+    mp_call_method_n_kw(n_args, 0, dest);
+}
+
+STATIC void io_queue_enqueue(mp_obj_io_queue_t *self, mp_obj_t s, size_t idx) {
+    mp_obj_t cur_task = context_get(MP_QSTR_cur_task);
+    mp_obj_t key = mp_obj_id(s);
+    mp_map_elem_t *elem = mp_map_lookup(mp_obj_dict_get_map(self->map), key, MP_MAP_LOOKUP);
+    if (elem == NULL) {
+        mp_obj_t entry[3] = { mp_const_none, mp_const_none, s };
+        entry[idx] = cur_task;
+        mp_obj_dict_store(self->map, key, mp_obj_new_list(3, entry));
+        io_queue_poller_call(self, MP_QSTR_register, 2, s,
+            MP_OBJ_NEW_SMALL_INT(idx == 0 ? MP_STREAM_POLL_RD : MP_STREAM_POLL_WR));
+    } else {
+        mp_obj_list_t *entry = MP_OBJ_TO_PTR(elem->value);
+        assert(entry->items[idx] == mp_const_none);
+        assert(entry->items[1 - idx] != mp_const_none);
+        entry->items[idx] = cur_task;
+        io_queue_poller_call(self, MP_QSTR_modify, 2, s, MP_OBJ_NEW_SMALL_INT(MP_STREAM_POLL_RD | MP_STREAM_POLL_WR));
+    }
+    // Link task to this IOQueue so it can be removed if needed.
+    ((mp_obj_task_t *)MP_OBJ_TO_PTR(cur_task))->data = MP_OBJ_FROM_PTR(self);
+}
+
+STATIC void io_queue_dequeue(mp_obj_io_queue_t *self, mp_obj_t s) {
+    mp_obj_dict_delete(self->map, mp_obj_id(s));
+    io_queue_poller_call(self, MP_QSTR_unregister, 1, s, MP_OBJ_NULL);
+}
+
+// queue_read() and queue_write() return an awaitable that suspends the
+// task until the poller reschedules it.
+STATIC mp_obj_t io_queue_queue_read(mp_obj_t self_in, mp_obj_t s) {
+    io_queue_enqueue(MP_OBJ_TO_PTR(self_in), s, 0);
+    asyncio_never_gen.deadline = mp_const_none;
+    return MP_OBJ_FROM_PTR(&asyncio_never_gen);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(io_queue_queue_read_obj, io_queue_queue_read);
+
+STATIC mp_obj_t io_queue_queue_write(mp_obj_t self_in, mp_obj_t s) {
+    io_queue_enqueue(MP_OBJ_TO_PTR(self_in), s, 1);
+    asyncio_never_gen.deadline = mp_const_none;
+    return MP_OBJ_FROM_PTR(&asyncio_never_gen);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(io_queue_queue_write_obj, io_queue_queue_write);
+
+STATIC mp_obj_t io_queue_remove(mp_obj_t self_in, mp_obj_t task) {
+    mp_obj_io_queue_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_map_t *map = mp_obj_dict_get_map(self->map);
+    for (;;) {
+        mp_obj_t del_s = MP_OBJ_NULL;
+        for (size_t i = 0; i < map->alloc; ++i) {
+            if (!mp_map_slot_is_filled(map, i)) {
+                continue;
+            }
+            mp_obj_list_t *entry = MP_OBJ_TO_PTR(map->table[i].value);
+            if (entry->items[0] == task || entry->items[1] == task) {
+                del_s = entry->items[2];
+                break;
+            }
+        }
+        if (del_s == MP_OBJ_NULL) {
+            break;
+        }
+        io_queue_dequeue(self, del_s);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(io_queue_remove_obj, io_queue_remove);
+
+STATIC void io_queue_wait_io_event_internal(mp_obj_io_queue_t *self, mp_int_t dt) {
+    mp_obj_t task_queue = context_get(MP_QSTR__task_queue);
+    mp_obj_t dest[3];
+    mp_load_method(self->poller, MP_QSTR_ipoll, dest);
+    dest[2] = MP_OBJ_NEW_SMALL_INT(dt);
+    mp_obj_t iter = mp_getiter(mp_call_method_n_kw(1, 0, dest), NULL);
+    mp_obj_t item;
+    while ((item = mp_iternext(iter)) != MP_OBJ_STOP_ITERATION) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_get_array(item, &len, &items);
+        mp_obj_t s = items[0];
+        mp_int_t ev = mp_obj_get_int(items[1]);
+        mp_obj_list_t *entry = MP_OBJ_TO_PTR(mp_obj_dict_get(self->map, mp_obj_id(s)));
+        if ((ev & ~MP_STREAM_POLL_WR) && entry->items[0] != mp_const_none) {
+            // POLLIN or error
+            task_queue_push_now(task_queue, entry->items[0]);
+            entry->items[0] = mp_const_none;
+        }
+        if ((ev & ~MP_STREAM_POLL_RD) && entry->items[1] != mp_const_none) {
+            // POLLOUT or error
+            task_queue_push_now(task_queue, entry->items[1]);
+            entry->items[1] = mp_const_none;
+        }
+        if (entry->items[0] == mp_const_none && entry->items[1] == mp_const_none) {
+            // Task(s) complete so remove object from the poller.
+            io_queue_dequeue(self, s);
+        } else if (entry->items[0] == mp_const_none) {
+            // Only a writer is still waiting.
+            io_queue_poller_call(self, MP_QSTR_modify, 2, s, MP_OBJ_NEW_SMALL_INT(MP_STREAM_POLL_WR));
+        } else {
+            // Only a reader is still waiting.
+            io_queue_poller_call(self, MP_QSTR_modify, 2, s, MP_OBJ_NEW_SMALL_INT(MP_STREAM_POLL_RD));
+        }
+    }
+}
+
+STATIC mp_obj_t io_queue_wait_io_event(mp_obj_t self_in, mp_obj_t dt_in) {
+    io_queue_wait_io_event_internal(MP_OBJ_TO_PTR(self_in), mp_obj_get_int(dt_in));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(io_queue_wait_io_event_obj, io_queue_wait_io_event);
+
+STATIC void io_queue_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
+    mp_obj_io_queue_t *self = MP_OBJ_TO_PTR(self_in);
+    if (dest[0] == MP_OBJ_NULL) {
+        if (attr == MP_QSTR_map) {
+            dest[0] = self->map;
+        } else if (attr == MP_QSTR_poller) {
+            dest[0] = self->poller;
+        } else {
+            // Continue lookup in locals_dict.
+            dest[1] = MP_OBJ_SENTINEL;
+        }
+    }
+}
+
+STATIC const mp_rom_map_elem_t io_queue_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_queue_read), MP_ROM_PTR(&io_queue_queue_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_queue_write), MP_ROM_PTR(&io_queue_queue_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_remove), MP_ROM_PTR(&io_queue_remove_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wait_io_event), MP_ROM_PTR(&io_queue_wait_io_event_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(io_queue_locals_dict, io_queue_locals_dict_table);
+
+STATIC MP_DEFINE_CONST_OBJ_TYPE(
+    io_queue_type,
+    MP_QSTR_IOQueue,
+    MP_TYPE_FLAG_NONE,
+    make_new, io_queue_make_new,
+    attr, io_queue_attr,
+    locals_dict, &io_queue_locals_dict
+    );
+
+#endif // MICROPY_PY_SELECT
+
+STATIC bool io_queue_is_empty(mp_obj_t io_queue) {
+    #if MICROPY_PY_SELECT
+    if (mp_obj_is_type(io_queue, &io_queue_type)) {
+        return mp_obj_dict_len(((mp_obj_io_queue_t *)MP_OBJ_TO_PTR(io_queue))->map) == 0;
+    }
+    #endif
+    return !mp_obj_is_true(mp_load_attr(io_queue, MP_QSTR_map));
+}
+
+STATIC void io_queue_wait(mp_obj_t io_queue, mp_int_t dt) {
+    #if MICROPY_PY_SELECT
+    if (mp_obj_is_type(io_queue, &io_queue_type)) {
+        io_queue_wait_io_event_internal(MP_OBJ_TO_PTR(io_queue), dt);
+        return;
+    }
+    #endif
+    mp_obj_t dest[3];
+    mp_load_method(io_queue, MP_QSTR_wait_io_event, dest);
+    dest[2] = MP_OBJ_NEW_SMALL_INT(dt);
+    mp_call_method_n_kw(1, 0, dest);
+}
+
+STATIC bool exc_is(mp_obj_t exc, const void *type) {
+    return mp_obj_is_subclass_fast(MP_OBJ_FROM_PTR(mp_obj_get_type(exc)), MP_OBJ_FROM_PTR(type));
+}
+
+// run_until_complete(main_task=None)
+STATIC mp_obj_t asyncio_run_until_complete(size_t n_args, const mp_obj_t *args) {
+    mp_obj_t main_task = n_args > 0 ? args[0] : mp_const_none;
+    mp_obj_t task_queue_in = context_get(MP_QSTR__task_queue);
+    mp_obj_t io_queue = context_get(MP_QSTR__io_queue);
+    mp_obj_t cancelled_error = context_get(MP_QSTR_CancelledError);
+    mp_obj_task_queue_t *task_queue = MP_OBJ_TO_PTR(task_queue_in);
+
+    for (;;) {
+        // Wait until the head of _task_queue is ready to run, servicing I/O meanwhile.
+        mp_int_t dt = 1;
+        while (dt > 0) {
+            dt = -1;
+            if (task_queue->heap != NULL) {
+                // "ph_key" is the time to schedule the task at.
+                dt = MAX(0, ticks_diff(task_queue->heap->ph_key, ticks()));
+            } else if (io_queue_is_empty(io_queue)) {
+                // No tasks can be woken so finished running.
+                context_store(MP_QSTR_cur_task, mp_const_none);
+                return mp_const_none;
+            }
+            io_queue_wait(io_queue, dt);
+        }
+
+        // Get next task to run and continue it.
+        mp_obj_t t_in = task_queue_pop(task_queue_in);
+        mp_obj_task_t *t = MP_OBJ_TO_PTR(t_in);
+        context_store(MP_QSTR_cur_task, t_in);
+
+        mp_obj_t exc = t->data;
+        mp_obj_t ret;
+        mp_vm_return_kind_t kind;
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            if (!mp_obj_is_true(exc)) {
+                kind = mp_resume(t->coro, mp_const_none, MP_OBJ_NULL, &ret);
+            } else {
+                // The task finished with an exception that nothing awaited;
+                // throwing it in now ends the coroutine and the exception
+                // handler is called below.
+                t->data = mp_const_none;
+                kind = mp_resume(t->coro, MP_OBJ_NULL, exc, &ret);
+            }
+            nlr_pop();
+        } else {
+            kind = MP_VM_RETURN_EXCEPTION;
+            ret = MP_OBJ_FROM_PTR(nlr.ret_val);
+        }
+        if (kind == MP_VM_RETURN_YIELD) {
+            // The coroutine has rescheduled itself.
+            continue;
+        }
+
+        mp_obj_t er;
+        if (kind == MP_VM_RETURN_NORMAL) {
+            if (t_in == main_task) {
+                context_store(MP_QSTR_cur_task, mp_const_none);
+                return ret;
+            }
+            er = mp_obj_new_exception_arg1(&mp_type_StopIteration, ret);
+        } else {
+            er = ret;
+            if (!exc_is(er, &mp_type_Exception) && !exc_is(er, MP_OBJ_TO_PTR(cancelled_error))) {
+                nlr_raise(er);
+            }
+            if (t_in == main_task) {
+                context_store(MP_QSTR_cur_task, mp_const_none);
+                if (exc_is(er, &mp_type_StopIteration)) {
+                    return mp_obj_exception_get_value(er);
+                }
+                nlr_raise(er);
+            }
+        }
+
+        // Check the task is not on any event queue.
+        assert(t->data == mp_const_none);
+        if (mp_obj_is_true(t->state)) {
+            // Task was running but is now finished.
+            bool waiting = false;
+            if (t->state == TASK_STATE_RUNNING_NOT_WAITED_ON) {
+                t->state = TASK_STATE_DONE_NOT_WAITED_ON;
+            } else if (mp_obj_is_callable(t->state)) {
+                // The task has a callback registered to be called on completion.
+                mp_call_function_2(t->state, t_in, er);
+                t->state = TASK_STATE_DONE_WAS_WAITED_ON;
+                waiting = true;
+            } else {
+                // Schedule any other tasks waiting on the completion of this task.
+                mp_obj_task_queue_t *waiters = MP_OBJ_TO_PTR(t->state);
+                while (waiters->heap != NULL) {
+                    task_queue_push_now(task_queue_in, task_queue_pop(t->state));
+                    waiting = true;
+                }
+                t->state = TASK_STATE_DONE_WAS_WAITED_ON;
+            }
+            if (!waiting && !exc_is(er, &mp_type_StopIteration) && !exc_is(er, MP_OBJ_TO_PTR(cancelled_error))) {
+                // An exception ended this detached task, so queue it for later
+                // execution to handle the uncaught exception if no other task
+                // retrieves the exception in the meantime.
+                task_queue_push_now(task_queue_in, t_in);
+            }
+            // Save return value of coro to pass up to caller.
+            t->data = er;
+        } else if (t->state == TASK_STATE_DONE_NOT_WAITED_ON) {
+            // Task is already finished and nothing await'ed on the task,
+            // so call the exception handler.
+            t->data = exc;
+            mp_obj_t exc_context = context_get(MP_QSTR__exc_context);
+            mp_obj_dict_store(exc_context, MP_OBJ_NEW_QSTR(MP_QSTR_exception), exc);
+            mp_obj_dict_store(exc_context, MP_OBJ_NEW_QSTR(MP_QSTR_future), t_in);
+            mp_obj_t dest[3];
+            mp_load_method(context_get(MP_QSTR_Loop), MP_QSTR_call_exception_handler, dest);
+            dest[2] = exc_context;
+            mp_call_method_n_kw(1, 0, dest);
+        }
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(asyncio_run_until_complete_obj, 0, 1, asyncio_run_until_complete);
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t asyncio_core_context);
+
 /******************************************************************************/
 // C-level asyncio module
 
@@ -347,6 +796,13 @@ STATIC const mp_rom_map_elem_t mp_module_asyncio_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR__asyncio) },
     { MP_ROM_QSTR(MP_QSTR_TaskQueue), MP_ROM_PTR(&task_queue_type) },
     { MP_ROM_QSTR(MP_QSTR_Task), MP_ROM_PTR(&task_type) },
+    // CIRCUITPY-CHANGE: native event loop core
+    #if MICROPY_PY_SELECT
+    { MP_ROM_QSTR(MP_QSTR_IOQueue), MP_ROM_PTR(&io_queue_type) },
+    #endif
+    { MP_ROM_QSTR(MP_QSTR_sleep), MP_ROM_PTR(&asyncio_sleep_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sleep_ms), MP_ROM_PTR(&asyncio_sleep_ms_obj) },
+    { MP_ROM_QSTR(MP_QSTR_run_until_complete), MP_ROM_PTR(&asyncio_run_until_complete_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(mp_module_asyncio_globals, mp_module_asyncio_globals_table);
 
@@ -29,7 +29,7 @@
 #include "py/binary.h"
 #include "py/objarray.h"
 #include "py/objlist.h"
-#include "py/objstringio.h"
+#include "py/objtuple.h"
 #include "py/parsenum.h"
 #include "py/runtime.h"
 #include "py/stream.h"
@@ -115,7 +115,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_json_dumps_obj, mod_json_dumps);
 // #define JSON_DEBUG(...) mp_printf(&mp_plat_print __VA_OPT__(,) __VA_ARGS__)
 
 
-// The function below implements a simple non-recursive JSON parser.
+// The functions below implement a simple non-recursive JSON parser.
 //
 // The JSON specification is at http://www.ietf.org/rfc/rfc4627.txt
 // The parser here will parse any valid JSON and return the correct
@@ -127,6 +127,10 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_json_dumps_obj, mod_json_dumps);
 // Most of the work is parsing the primitives (null, false, true, numbers,
 // strings).  It does 1 pass over the input stream.  It tries to be fast and
 // small in code size, while not using more RAM than necessary.
+//
+// CIRCUITPY-CHANGE: json_next_token splits the input into tokens, which
+// json_build assembles into objects.  iterload uses the same tokenizer to
+// walk a document without building the parts it doesn't need.
 
 typedef struct _json_stream_t {
     mp_obj_t stream_obj;
@@ -135,24 +139,35 @@ typedef struct _json_stream_t {
     // CIRCUITPY-CHANGE
     mp_obj_t python_readinto[2 + 1];
     mp_obj_array_t bytearray_obj;
-    size_t start;
-    size_t end;
+    // Input is read in chunks of up to chunk_size bytes into buf.  The
+    // unread part of the current chunk is pos..end.  When parsing from
+    // memory, buf is NULL and pos..end is the rest of the caller's buffer.
+    byte *buf;
+    size_t chunk_size;
+    const byte *pos;
+    const byte *end;
     byte cur;
 } json_stream_t;
 
 #define S_EOF (0) // null is not allowed in json stream so is ok as EOF marker
-#define S_END(s) ((s).cur == S_EOF)
-#define S_CUR(s) ((s).cur)
-#define S_NEXT(s) (json_stream_next(&(s)))
+#define S_END(s) ((s)->cur == S_EOF)
+#define S_CUR(s) ((s)->cur)
+#define S_NEXT(s) ((s)->pos != (s)->end ? ((s)->cur = *(s)->pos++) : json_stream_next(s))
 
 STATIC byte json_stream_next(json_stream_t *s) {
-    mp_uint_t ret = s->read(s->stream_obj, &s->cur, 1, &s->errcode);
-    JSON_DEBUG("  usjon_stream_next err:%2d cur: %c \n", s->errcode, s->cur);
+    s->cur = S_EOF;
+    if (s->buf == NULL) {
+        return S_EOF;
+    }
+    mp_uint_t ret = s->read(s->stream_obj, s->buf, s->chunk_size, &s->errcode);
+    JSON_DEBUG("  usjon_stream_next err:%2d ret: %d \n", s->errcode, (int)ret);
     if (s->errcode != 0) {
         mp_raise_OSError(s->errcode);
     }
-    if (ret == 0) {
-        s->cur = S_EOF;
+    s->pos = s->buf;
+    s->end = s->buf + ret;
+    if (ret != 0) {
+        s->cur = *s->pos++;
     }
     return s->cur;
 }
@@ -160,74 +175,92 @@ STATIC byte json_stream_next(json_stream_t *s) {
 // CIRCUITPY-CHANGE
 
 // We read from an object's `readinto` method in chunks larger than the json
-// parser needs to reduce the number of function calls done.
+// parser needs to reduce the number of function calls done.  Native streams
+// that can seek are read in chunks too, and are then rewound to just after
+// the parsed object.  Other native streams are read a byte at a time, so
+// that anything following the object stays in the stream.
 
 #define CIRCUITPY_JSON_READ_CHUNK_SIZE 64
 
 STATIC mp_uint_t json_python_readinto(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode) {
-    (void)size;  // Ignore size because we know it's always 1.
     json_stream_t *s = obj;
+    s->bytearray_obj.items = buf;
+    s->bytearray_obj.len = size;
+    *errcode = 0;
+    mp_obj_t ret = mp_call_method_n_kw(1, 0, s->python_readinto);
+    if (ret == mp_const_none) {
+        *errcode = MP_EAGAIN;
+        return MP_STREAM_ERROR;
+    }
+    return mp_obj_get_int(ret);
+}
 
-    if (s->start == s->end) {
-        *errcode = 0;
-        mp_obj_t ret = mp_call_method_n_kw(1, 0, s->python_readinto);
-        if (ret == mp_const_none) {
-            *errcode = MP_EAGAIN;
-            return MP_STREAM_ERROR;
-        }
-        s->start = 0;
-        s->end = mp_obj_get_int(ret);
-        if (s->end == 0) {
-            return 0;
+// Set up s to read from obj, which is a native stream, an object with a
+// readinto method, or (if allow_buffer) a buffer.  Returns true if obj is
+// a native stream that can seek, so that it can be rewound with
+// json_stream_rewind once parsing is done.
+STATIC bool json_stream_init(json_stream_t *s, mp_obj_t obj, byte *buf, bool allow_buffer) {
+    s->buf = buf;
+    s->chunk_size = CIRCUITPY_JSON_READ_CHUNK_SIZE;
+    s->pos = s->end = buf;
+    s->errcode = 0;
+    const mp_stream_p_t *stream_p = mp_proto_get(0, obj);
+    mp_buffer_info_t bufinfo;
+    if (stream_p == NULL && allow_buffer && mp_get_buffer(obj, &bufinfo, MP_BUFFER_READ)) {
+        s->buf = NULL;
+        s->pos = bufinfo.buf;
+        s->end = s->pos + bufinfo.len;
+    } else if (stream_p == NULL) {
+        mp_load_method(obj, MP_QSTR_readinto, s->python_readinto);
+        s->bytearray_obj.base.type = &mp_type_bytearray;
+        s->bytearray_obj.typecode = BYTEARRAY_TYPECODE;
+        s->bytearray_obj.free = 0;
+        s->python_readinto[2] = MP_OBJ_FROM_PTR(&s->bytearray_obj);
+        s->stream_obj = s;
+        s->read = json_python_readinto;
+    } else {
+        stream_p = mp_get_stream_raise(obj, MP_STREAM_OP_READ);
+        s->stream_obj = obj;
+        s->read = stream_p->read;
+        if (mp_stream_seek_relative(obj, 0)) {
+            return true;
         }
+        s->chunk_size = 1;
     }
-
-    *((uint8_t *)buf) = ((uint8_t *)s->bytearray_obj.items)[s->start];
-    s->start++;
-    return 1;
+    return false;
 }
 
-STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
-    const mp_stream_p_t *stream_p = mp_proto_get(0, stream_obj);
-    json_stream_t s;
-    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
-    if (stream_p == NULL) {
-        s.start = 0;
-        s.end = 0;
-        mp_load_method(stream_obj, MP_QSTR_readinto, s.python_readinto);
-        s.bytearray_obj.base.type = &mp_type_bytearray;
-        s.bytearray_obj.typecode = BYTEARRAY_TYPECODE;
-        s.bytearray_obj.len = CIRCUITPY_JSON_READ_CHUNK_SIZE;
-        s.bytearray_obj.free = 0;
-        s.bytearray_obj.items = character_buffer;
-        s.python_readinto[2] = MP_OBJ_FROM_PTR(&s.bytearray_obj);
-        s.stream_obj = &s;
-        s.read = json_python_readinto;
-    } else {
-        stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
-        s.stream_obj = stream_obj;
-        s.read = stream_p->read;
-        s.errcode = 0;
-        s.cur = 0;
+// Give back to a seekable stream what was read past the current character.
+STATIC void json_stream_rewind(json_stream_t *s, bool seekable) {
+    size_t unused = (s->end - s->pos) + (S_END(s) ? 0 : 1);
+    if (seekable && unused != 0) {
+        mp_stream_seek_relative(s->stream_obj, -(mp_off_t)unused);
     }
+}
 
-    JSON_DEBUG("got JSON stream\n");
-    vstr_t vstr;
-    vstr_init(&vstr, 8);
-    mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
-    stack.len = 0;
-    stack.items = NULL;
-    mp_obj_t stack_top = MP_OBJ_NULL;
-    const mp_obj_type_t *stack_top_type = NULL;
-    mp_obj_t stack_key = MP_OBJ_NULL;
-    S_NEXT(s);
+STATIC NORETURN void json_syntax_error(void) {
+    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+}
+
+// Tokens returned by json_next_token, besides the bracket characters.
+#define JSON_TOK_EOF (0)
+#define JSON_TOK_VALUE ('v')
+
+// What json_next_token does with a primitive: make an object of it, or
+// just step over it.
+enum {
+    JSON_MODE_VALUE,
+    JSON_MODE_SKIP,
+};
+
+// Read the next token.  For JSON_TOK_VALUE, *value is set to the primitive
+// read, or to None in JSON_MODE_SKIP.  vstr is scratch space.
+STATIC byte json_next_token(json_stream_t *s, vstr_t *vstr, mp_obj_t *value, int mode) {
+    bool keep = mode != JSON_MODE_SKIP;
     for (;;) {
-    cont:
         if (S_END(s)) {
-            break;
+            return JSON_TOK_EOF;
         }
-        mp_obj_t next = MP_OBJ_NULL;
-        bool enter = false;
         byte cur = S_CUR(s);
         S_NEXT(s);
         switch (cur) {
@@ -237,33 +270,56 @@ STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
             case '\t':
             case '\n':
             case '\r':
-                goto cont;
+                continue;
             case 'n':
                 if (S_CUR(s) == 'u' && S_NEXT(s) == 'l' && S_NEXT(s) == 'l') {
                     S_NEXT(s);
-                    next = mp_const_none;
-                } else {
-                    goto fail;
+                    *value = mp_const_none;
+                    return JSON_TOK_VALUE;
                 }
-                break;
+                json_syntax_error();
             case 'f':
                 if (S_CUR(s) == 'a' && S_NEXT(s) == 'l' && S_NEXT(s) == 's' && S_NEXT(s) == 'e') {
                     S_NEXT(s);
-                    next = mp_const_false;
-                } else {
-                    goto fail;
+                    *value = mp_const_false;
+                    return JSON_TOK_VALUE;
                 }
-                break;
+                json_syntax_error();
             case 't':
                 if (S_CUR(s) == 'r' && S_NEXT(s) == 'u' && S_NEXT(s) == 'e') {
                     S_NEXT(s);
-                    next = mp_const_true;
-                } else {
-                    goto fail;
+                    *value = mp_const_true;
+                    return JSON_TOK_VALUE;
+                }
+                json_syntax_error();
+            case '"': {
+                vstr_reset(vstr);
+                *value = mp_const_none;
+                if (!S_END(s)) {
+                    // Scan the rest of the string in the current chunk; S_CUR
+                    // is the byte just before pos.
+                    const byte *start = s->pos - 1;
+                    const byte *p = start;
+                    while (p < s->end && *p != '"' && *p != '\\' && *p != S_EOF) {
+                        p++;
+                    }
+                    if (p < s->end && *p == '"') {
+                        // whole string with no escapes; make it before
+                        // moving on, which may refill the chunk
+                        if (keep) {
+                            *value = mp_obj_new_str((const char *)start, p - start);
+                        }
+                        s->pos = p + 1;
+                        S_NEXT(s);
+                        return JSON_TOK_VALUE;
+                    }
+                    // continue byte by byte from p
+                    if (keep) {
+                        vstr_add_strn(vstr, (const char *)start, p - start);
+                    }
+                    s->pos = p;
+                    S_NEXT(s);
                 }
-                break;
-            case '"':
-                vstr_reset(&vstr);
                 for (; !S_END(s) && S_CUR(s) != '"';) {
                     byte c = S_CUR(s);
                     if (c == '\\') {
@@ -293,21 +349,28 @@ STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
                                     }
                                     num = (num << 4) | c;
                                 }
-                                vstr_add_char(&vstr, num);
+                                if (keep) {
+                                    vstr_add_char(vstr, num);
+                                }
                                 goto str_cont;
                             }
                         }
                     }
-                    vstr_add_byte(&vstr, c);
+                    if (keep) {
+                        vstr_add_byte(vstr, c);
+                    }
                 str_cont:
                     S_NEXT(s);
                 }
                 if (S_END(s)) {
-                    goto fail;
+                    json_syntax_error();
                 }
                 S_NEXT(s);
-                next = mp_obj_new_str(vstr.buf, vstr.len);
-                break;
+                if (keep) {
+                    *value = mp_obj_new_str(vstr->buf, vstr->len);
+                }
+                return JSON_TOK_VALUE;
+            }
             case '-':
             case '0':
             case '1':
@@ -320,9 +383,29 @@ STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
             case '8':
             case '9': {
                 bool flt = false;
-                vstr_reset(&vstr);
+                vstr_reset(vstr);
+                // take the rest of the number in the current chunk in one go
+                if (!S_END(s)) {
+                    const byte *start = s->pos - 1;
+                    const byte *p = start;
+                    while (p < s->end && (unichar_isdigit(*p) || *p == '.' || *p == 'E' || *p == 'e' || *p == '+' || *p == '-')) {
+                        flt |= *p == '.' || *p == 'E' || *p == 'e';
+                        p++;
+                    }
+                    if (p != start) {
+                        if (keep) {
+                            vstr_add_byte(vstr, cur);
+                            vstr_add_strn(vstr, (const char *)start, p - 1 - start);
+                        }
+                        cur = p[-1];
+                        s->pos = p;
+                        S_NEXT(s);
+                    }
+                }
                 for (;;) {
-                    vstr_add_byte(&vstr, cur);
+                    if (keep) {
+                        vstr_add_byte(vstr, cur);
+                    }
                     cur = S_CUR(s);
                     if (cur == '.' || cur == 'E' || cur == 'e') {
                         flt = true;
@@ -333,13 +416,52 @@ STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
                     }
                     S_NEXT(s);
                 }
-                if (flt) {
-                    next = mp_parse_num_float(vstr.buf, vstr.len, false, NULL);
+                if (!keep) {
+                    *value = mp_const_none;
+                } else if (flt) {
+                    *value = mp_parse_num_float(vstr->buf, vstr->len, false, NULL);
                 } else {
-                    next = mp_parse_num_integer(vstr.buf, vstr.len, 10, NULL);
+                    *value = mp_parse_num_integer(vstr->buf, vstr->len, 10, NULL);
                 }
-                break;
+                return JSON_TOK_VALUE;
             }
+            case '[':
+            case '{':
+            case ']':
+            case '}':
+                return cur;
+            default:
+                json_syntax_error();
+        }
+    }
+}
+
+// Build the object that starts with token tok (and value, for a primitive).
+STATIC mp_obj_t json_build(json_stream_t *s, vstr_t *vstr, byte tok, mp_obj_t value) {
+    if (tok == JSON_TOK_VALUE) {
+        // single primitive only
+        return value;
+    }
+    if (tok != '[' && tok != '{') {
+        // no object at all
+        json_syntax_error();
+    }
+    mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
+    stack.len = 0;
+    stack.items = NULL;
+    mp_obj_t stack_top = tok == '[' ? mp_obj_new_list(0, NULL) : mp_obj_new_dict(0);
+    const mp_obj_type_t *stack_top_type = mp_obj_get_type(stack_top);
+    mp_obj_t stack_key = MP_OBJ_NULL;
+    for (;;) {
+        mp_obj_t next = MP_OBJ_NULL;
+        bool enter = false;
+        switch (json_next_token(s, vstr, &next, JSON_MODE_VALUE)) {
+            case JSON_TOK_EOF:
+                if (stack.len != 0) {
+                    // not exactly 1 object
+                    json_syntax_error();
+                }
+                return stack_top;
             case '[':
                 next = mp_obj_new_list(0, NULL);
                 enter = true;
@@ -350,57 +472,55 @@ STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
                 break;
             case '}':
             case ']': {
-                if (stack_top == MP_OBJ_NULL) {
-                    // no object at all
-                    goto fail;
-                }
                 if (stack.len == 0) {
                     // finished; compound object
-                    goto success;
+                    return stack_top;
                 }
                 stack.len -= 1;
                 stack_top = stack.items[stack.len];
                 stack_top_type = mp_obj_get_type(stack_top);
-                goto cont;
+                continue;
             }
-            default:
-                goto fail;
         }
-        if (stack_top == MP_OBJ_NULL) {
-            stack_top = next;
-            stack_top_type = mp_obj_get_type(stack_top);
-            if (!enter) {
-                // finished; single primitive only
-                goto success;
-            }
+        // append to list or dict
+        if (stack_top_type == &mp_type_list) {
+            mp_obj_list_append(stack_top, next);
         } else {
-            // append to list or dict
-            if (stack_top_type == &mp_type_list) {
-                mp_obj_list_append(stack_top, next);
-            } else {
-                if (stack_key == MP_OBJ_NULL) {
-                    stack_key = next;
-                    if (enter) {
-                        goto fail;
-                    }
-                } else {
-                    mp_obj_dict_store(stack_top, stack_key, next);
-                    stack_key = MP_OBJ_NULL;
+            if (stack_key == MP_OBJ_NULL) {
+                stack_key = next;
+                if (enter) {
+                    json_syntax_error();
                 }
+            } else {
+                mp_obj_dict_store(stack_top, stack_key, next);
+                stack_key = MP_OBJ_NULL;
             }
-            if (enter) {
-                if (stack.items == NULL) {
-                    mp_obj_list_init(&stack, 1);
-                    stack.items[0] = stack_top;
-                } else {
-                    mp_obj_list_append(MP_OBJ_FROM_PTR(&stack), stack_top);
-                }
-                stack_top = next;
-                stack_top_type = mp_obj_get_type(stack_top);
+        }
+        if (enter) {
+            if (stack.items == NULL) {
+                mp_obj_list_init(&stack, 1);
+                stack.items[0] = stack_top;
+            } else {
+                mp_obj_list_append(MP_OBJ_FROM_PTR(&stack), stack_top);
             }
+            stack_top = next;
+            stack_top_type = mp_obj_get_type(stack_top);
         }
     }
-success:
+}
+
+STATIC mp_obj_t json_parse(json_stream_t *s, bool return_first_json) {
+    JSON_DEBUG("got JSON stream\n");
+    vstr_t vstr;
+    vstr_init(&vstr, 8);
+    S_NEXT(s);
+    mp_obj_t value = MP_OBJ_NULL;
+    byte tok = json_next_token(s, &vstr, &value, JSON_MODE_VALUE);
+    if (tok == JSON_TOK_EOF) {
+        json_syntax_error();
+    }
+    mp_obj_t obj = json_build(s, &vstr, tok, value);
+
     // CIRCUITPY-CHANGE
 
     // It is legal for a stream to have contents after JSON.
@@ -413,40 +533,239 @@ success:
         }
         if (!S_END(s)) {
             // unexpected chars
-            goto fail;
+            json_syntax_error();
         }
     }
-    if (stack_top == MP_OBJ_NULL || stack.len != 0) {
-        // not exactly 1 object
-        goto fail;
-    }
     vstr_clear(&vstr);
-    return stack_top;
-
-fail:
-    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+    return obj;
 }
 
 STATIC mp_obj_t mod_json_load(mp_obj_t stream_obj) {
-    return _mod_json_load(stream_obj, true);
+    json_stream_t s;
+    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
+    bool seekable = json_stream_init(&s, stream_obj, character_buffer, false);
+    mp_obj_t obj = json_parse(&s, true);
+    json_stream_rewind(&s, seekable);
+    return obj;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_json_load_obj, mod_json_load);
 
 STATIC mp_obj_t mod_json_loads(mp_obj_t obj) {
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(obj, &bufinfo, MP_BUFFER_READ);
-    vstr_t vstr = {bufinfo.len, bufinfo.len, (char *)bufinfo.buf, true};
-    mp_obj_stringio_t sio = {{&mp_type_stringio}, &vstr, 0, MP_OBJ_NULL};
-    return _mod_json_load(MP_OBJ_FROM_PTR(&sio), false);
+    // CIRCUITPY-CHANGE: parse straight from the buffer
+    json_stream_t s;
+    s.buf = NULL;
+    s.pos = bufinfo.buf;
+    s.end = s.pos + bufinfo.len;
+    return json_parse(&s, false);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_json_loads_obj, mod_json_loads);
 
+// CIRCUITPY-CHANGE: iterload(source, paths=None) walks a document and yields
+// (path, value) pairs.  Only the current path is held in memory, plus the
+// value being yielded.
+
+typedef struct _mod_json_iter_t {
+    mp_obj_base_t base;
+    mp_fun_1_t iternext;
+    json_stream_t s;
+    bool seekable;
+    mp_obj_t source;
+    // Tuple of path patterns, or MP_OBJ_NULL to yield every primitive.
+    mp_obj_t paths;
+    // Path to the current position.  An element is a dict key, a list
+    // index, or None for a dict whose next key hasn't been read yet.
+    mp_obj_list_t path;
+    vstr_t vstr;
+    bool need_key;
+    bool done;
+    byte buf[CIRCUITPY_JSON_READ_CHUNK_SIZE];
+} mod_json_iter_t;
+
+enum {
+    JSON_PATH_NONE,
+    JSON_PATH_PREFIX,
+    JSON_PATH_MATCH,
+};
+
+// Compare the current path with the patterns.
+STATIC int json_iter_match(mod_json_iter_t *self) {
+    if (self->paths == MP_OBJ_NULL) {
+        return JSON_PATH_PREFIX;
+    }
+    int result = JSON_PATH_NONE;
+    size_t n_paths;
+    mp_obj_t *paths;
+    mp_obj_tuple_get(self->paths, &n_paths, &paths);
+    for (size_t i = 0; i < n_paths; i++) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_tuple_get(paths[i], &len, &items);
+        if (len < self->path.len) {
+            continue;
+        }
+        size_t j = 0;
+        while (j < self->path.len && (items[j] == mp_const_none || mp_obj_equal(items[j], self->path.items[j]))) {
+            j++;
+        }
+        if (j == self->path.len) {
+            if (len == j) {
+                return JSON_PATH_MATCH;
+            }
+            result = JSON_PATH_PREFIX;
+        }
+    }
+    return result;
+}
+
+// Step over the rest of a container whose opening bracket has been read.
+STATIC void json_iter_skip(mod_json_iter_t *self) {
+    size_t depth = 1;
+    mp_obj_t value;
+    while (depth > 0) {
+        switch (json_next_token(&self->s, &self->vstr, &value, JSON_MODE_SKIP)) {
+            case JSON_TOK_EOF:
+                json_syntax_error();
+            case '[':
+            case '{':
+                depth++;
+                break;
+            case ']':
+            case '}':
+                depth--;
+                break;
+        }
+    }
+}
+
+STATIC mp_obj_t json_iter_finish(mod_json_iter_t *self) {
+    self->done = true;
+    json_stream_rewind(&self->s, self->seekable);
+    vstr_clear(&self->vstr);
+    return MP_OBJ_STOP_ITERATION;
+}
+
+STATIC mp_obj_t json_iter_iternext(mp_obj_t self_in) {
+    mod_json_iter_t *self = MP_OBJ_TO_PTR(self_in);
+    json_stream_t *s = &self->s;
+    if (self->done) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    for (;;) {
+        mp_obj_t *top = self->path.len == 0 ? NULL : &self->path.items[self->path.len - 1];
+        mp_obj_t value = MP_OBJ_NULL;
+        byte tok;
+        if (top != NULL && !mp_obj_is_small_int(*top) && self->need_key) {
+            tok = json_next_token(s, &self->vstr, &value, JSON_MODE_VALUE);
+            if (tok == JSON_TOK_VALUE && mp_obj_is_str(value)) {
+                *top = value;
+                self->need_key = false;
+                continue;
+            }
+            if (tok != '}') {
+                json_syntax_error();
+            }
+        } else {
+            if (top != NULL && mp_obj_is_small_int(*top)) {
+                *top = MP_OBJ_NEW_SMALL_INT(MP_OBJ_SMALL_INT_VALUE(*top) + 1);
+            }
+            int match = json_iter_match(self);
+            bool wanted = match == JSON_PATH_MATCH || (match == JSON_PATH_PREFIX && self->paths == MP_OBJ_NULL);
+            tok = json_next_token(s, &self->vstr, &value, wanted ? JSON_MODE_VALUE : JSON_MODE_SKIP);
+            if (tok == JSON_TOK_EOF) {
+                json_syntax_error();
+            }
+            if (tok == '[' || tok == '{') {
+                if (match == JSON_PATH_PREFIX) {
+                    // descend
+                    mp_obj_list_append(MP_OBJ_FROM_PTR(&self->path), tok == '[' ? MP_OBJ_NEW_SMALL_INT(-1) : mp_const_none);
+                    self->need_key = tok == '{';
+                    continue;
+                }
+                if (match == JSON_PATH_NONE) {
+                    json_iter_skip(self);
+                } else {
+                    value = json_build(s, &self->vstr, tok, value);
+                }
+                tok = JSON_TOK_VALUE;
+            }
+            if (tok == JSON_TOK_VALUE) {
+                self->need_key = true;
+                if (self->path.len == 0) {
+                    self->done = true;
+                }
+                mp_obj_t result = MP_OBJ_NULL;
+                if (wanted) {
+                    mp_obj_t items[2] = { mp_obj_new_tuple(self->path.len, self->path.items), value };
+                    result = mp_obj_new_tuple(2, items);
+                }
+                if (self->done) {
+                    json_iter_finish(self);
+                }
+                if (result != MP_OBJ_NULL) {
+                    return result;
+                }
+                continue;
+            }
+        }
+        // closing bracket
+        if (self->path.len == 0) {
+            json_syntax_error();
+        }
+        self->path.len--;
+        self->need_key = true;
+        if (self->path.len == 0) {
+            return json_iter_finish(self);
+        }
+    }
+}
+
+STATIC mp_obj_t mod_json_iterload(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_source, ARG_paths };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_source, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_paths, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mod_json_iter_t *self = mp_obj_malloc(mod_json_iter_t, &mp_type_polymorph_iter);
+    self->iternext = json_iter_iternext;
+    self->source = args[ARG_source].u_obj;
+    self->seekable = json_stream_init(&self->s, self->source, self->buf, true);
+    self->paths = MP_OBJ_NULL;
+    if (args[ARG_paths].u_obj != mp_const_none) {
+        // keep our own copy of the patterns as a tuple of tuples
+        size_t n_paths;
+        mp_obj_t *paths;
+        mp_obj_get_array(args[ARG_paths].u_obj, &n_paths, &paths);
+        mp_obj_tuple_t *t = MP_OBJ_TO_PTR(mp_obj_new_tuple(n_paths, NULL));
+        for (size_t i = 0; i < n_paths; i++) {
+            size_t len;
+            mp_obj_t *items;
+            mp_obj_get_array(paths[i], &len, &items);
+            t->items[i] = mp_obj_new_tuple(len, items);
+        }
+        self->paths = MP_OBJ_FROM_PTR(t);
+    }
+    mp_obj_list_init(&self->path, 0);
+    vstr_init(&self->vstr, 8);
+    self->need_key = false;
+    self->done = false;
+    S_NEXT(&self->s);
+    return MP_OBJ_FROM_PTR(self);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mod_json_iterload_obj, 1, mod_json_iterload);
+
 STATIC const mp_rom_map_elem_t mp_module_json_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_json) },
     { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&mod_json_dump_obj) },
     { MP_ROM_QSTR(MP_QSTR_dumps), MP_ROM_PTR(&mod_json_dumps_obj) },
     { MP_ROM_QSTR(MP_QSTR_load), MP_ROM_PTR(&mod_json_load_obj) },
     { MP_ROM_QSTR(MP_QSTR_loads), MP_ROM_PTR(&mod_json_loads_obj) },
+    // CIRCUITPY-CHANGE
+    { MP_ROM_QSTR(MP_QSTR_iterload), MP_ROM_PTR(&mod_json_iterload_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_json_globals, mp_module_json_globals_table);
@@ -45,8 +45,20 @@
 
 #define FLAG_DEBUG 0x1000
 
+// CIRCUITPY-CHANGE: longest required literal prefix kept for searching
+#define RE_PREFIX_MAX 7
+
+// Subjects shorter than this are cheap enough to backtrack over directly.
+#define RE_DFA_MIN_LEN 16
+
 typedef struct _mp_obj_re_t {
     mp_obj_base_t base;
+    // CIRCUITPY-CHANGE: accelerators used to skip start positions that can't match
+    #if MICROPY_PY_RE_DFA_STATES
+    ReDfa *dfa;
+    #endif
+    byte prefix_len;
+    char prefix[RE_PREFIX_MAX];
     ByteProg re;
 } mp_obj_re_t;
 
@@ -62,6 +74,95 @@ STATIC mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args);
 STATIC const mp_obj_type_t re_type;
 #endif
 
+// CIRCUITPY-CHANGE: module-level functions reuse recently compiled patterns
+#if MICROPY_PY_RE_CACHE && !MICROPY_ENABLE_DYNRUNTIME
+STATIC mp_obj_re_t *re_get(mp_obj_t pattern) {
+    if (mp_obj_is_type(pattern, (mp_obj_type_t *)&re_type)) {
+        return MP_OBJ_TO_PTR(pattern);
+    }
+    // Entries are (pattern, compiled) pairs, most recently used first.
+    mp_obj_t *cache = MP_STATE_VM(re_cache);
+    size_t i = 0;
+    mp_obj_t re;
+    for (; i < MICROPY_PY_RE_CACHE; i++) {
+        mp_obj_t key = cache[i * 2];
+        if (key == MP_OBJ_NULL) {
+            break;
+        }
+        if (key == pattern
+            || (mp_obj_get_type(key) == mp_obj_get_type(pattern) && mp_obj_str_equal(key, pattern))) {
+            re = cache[i * 2 + 1];
+            goto found;
+        }
+    }
+    re = mod_re_compile(1, &pattern);
+    if (i == MICROPY_PY_RE_CACHE) {
+        // Drop the least recently used entry.
+        i--;
+    }
+found:
+    memmove(&cache[2], &cache[0], i * 2 * sizeof(mp_obj_t));
+    cache[0] = pattern;
+    cache[1] = re;
+    return MP_OBJ_TO_PTR(re);
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t re_cache[MICROPY_PY_RE_CACHE * 2]);
+#else
+STATIC mp_obj_re_t *re_get(mp_obj_t pattern) {
+    if (mp_obj_is_type(pattern, (mp_obj_type_t *)&re_type)) {
+        return MP_OBJ_TO_PTR(pattern);
+    }
+    return MP_OBJ_TO_PTR(mod_re_compile(1, &pattern));
+}
+#endif
+
+// CIRCUITPY-CHANGE: run the backtracking matcher only where a match can start
+STATIC int re_run(mp_obj_re_t *self, Subject *subj, const char **caps, int caps_num, bool is_anchored) {
+    size_t prefix_len = self->prefix_len;
+    if (prefix_len > 0) {
+        if ((size_t)(subj->end - subj->begin) < prefix_len) {
+            return 0;
+        }
+        if (is_anchored) {
+            if (memcmp(subj->begin, self->prefix, prefix_len) != 0) {
+                return 0;
+            }
+            return re1_5_recursiveloopprog(&self->re, subj, caps, caps_num, true);
+        }
+        // Every match starts with the prefix, so only try positions that have it.
+        Subject at = *subj;
+        const char *last = subj->end - prefix_len;
+        while (at.begin <= last) {
+            const char *p = memchr(at.begin, self->prefix[0], last - at.begin + 1);
+            if (p == NULL) {
+                break;
+            }
+            at.begin = p;
+            if (memcmp(p + 1, self->prefix + 1, prefix_len - 1) == 0
+                && re1_5_recursiveloopprog(&self->re, &at, caps, caps_num, true)) {
+                return 1;
+            }
+            at.begin = p + 1;
+        }
+        return 0;
+    }
+    #if MICROPY_PY_RE_DFA_STATES
+    if (!is_anchored && subj->end - subj->begin >= RE_DFA_MIN_LEN) {
+        if (self->dfa == NULL) {
+            byte classmap[256];
+            int nclasses = re1_5_dfaclasses(&self->re, classmap);
+            self->dfa = m_malloc(re1_5_dfasize(&self->re, nclasses, MICROPY_PY_RE_DFA_STATES));
+            re1_5_dfainit(self->dfa, &self->re, classmap, nclasses, MICROPY_PY_RE_DFA_STATES);
+        }
+        if (re1_5_lazydfa(self->dfa, &self->re, subj, false) == 0) {
+            return 0;
+        }
+    }
+    #endif
+    return re1_5_recursiveloopprog(&self->re, subj, caps, caps_num, is_anchored);
+}
+
 STATIC void match_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     (void)kind;
     mp_obj_match_t *self = MP_OBJ_TO_PTR(self_in);
@@ -196,12 +297,8 @@ STATIC void re_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t
 
 STATIC mp_obj_t re_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     (void)n_args;
-    mp_obj_re_t *self;
-    if (mp_obj_is_type(args[0], (mp_obj_type_t *)&re_type)) {
-        self = MP_OBJ_TO_PTR(args[0]);
-    } else {
-        self = MP_OBJ_TO_PTR(mod_re_compile(1, args));
-    }
+    // CIRCUITPY-CHANGE: cached compile
+    mp_obj_re_t *self = re_get(args[0]);
     Subject subj;
     size_t len;
     subj.begin_line = subj.begin = mp_obj_str_get_data(args[1], &len);
@@ -241,7 +338,8 @@ STATIC mp_obj_t re_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     mp_obj_match_t *match = m_new_obj_var(mp_obj_match_t, char *, caps_num);
     // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
     memset((char *)match->caps, 0, caps_num * sizeof(char *));
-    int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, is_anchored);
+    // CIRCUITPY-CHANGE
+    int res = re_run(self, &subj, match->caps, caps_num, is_anchored);
     if (res == 0) {
         m_del_var(mp_obj_match_t, char *, caps_num, match);
         return mp_const_none;
@@ -282,7 +380,8 @@ STATIC mp_obj_t re_split(size_t n_args, const mp_obj_t *args) {
     while (true) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char **)caps, 0, caps_num * sizeof(char *));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, caps, caps_num, false);
+        // CIRCUITPY-CHANGE
+        int res = re_run(self, &subj, caps, caps_num, false);
 
         // if we didn't have a match, or had an empty match, it's time to stop
         if (!res || caps[0] == caps[1]) {
@@ -311,12 +410,8 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(re_split_obj, 2, 3, re_split);
 #if MICROPY_PY_RE_SUB
 
 STATIC mp_obj_t re_sub_helper(size_t n_args, const mp_obj_t *args) {
-    mp_obj_re_t *self;
-    if (mp_obj_is_type(args[0], (mp_obj_type_t *)&re_type)) {
-        self = MP_OBJ_TO_PTR(args[0]);
-    } else {
-        self = MP_OBJ_TO_PTR(mod_re_compile(1, args));
-    }
+    // CIRCUITPY-CHANGE: cached compile
+    mp_obj_re_t *self = re_get(args[0]);
     mp_obj_t replace = args[1];
     mp_obj_t where = args[2];
     mp_int_t count = 0;
@@ -342,7 +437,8 @@ STATIC mp_obj_t re_sub_helper(size_t n_args, const mp_obj_t *args) {
     for (;;) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char *)match->caps, 0, caps_num * sizeof(char *));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, false);
+        // CIRCUITPY-CHANGE
+        int res = re_run(self, &subj, match->caps, caps_num, false);
 
         // If we didn't have a match, or had an empty match, it's time to stop
         if (!res || match->caps[0] == match->caps[1]) {
@@ -476,6 +572,24 @@ STATIC mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args) {
         re1_5_dumpcode(&o->re);
     }
     #endif
+    // CIRCUITPY-CHANGE: collect the literal that every match must start
+    // with.  Anything that branches (alternation, optional or repeated
+    // terms) inserts a jump ahead of the term, so stopping at the first
+    // non-Char keeps the prefix exact; Save doesn't consume input.
+    #if MICROPY_PY_RE_DFA_STATES
+    o->dfa = NULL;
+    #endif
+    o->prefix_len = 0;
+    for (const char *pc = o->re.insts + NON_ANCHORED_PREFIX; o->prefix_len < RE_PREFIX_MAX;) {
+        if (*pc == Save) {
+            pc += 2;
+        } else if (*pc == Char) {
+            o->prefix[o->prefix_len++] = pc[1];
+            pc += 2;
+        } else {
+            break;
+        }
+    }
     return MP_OBJ_FROM_PTR(o);
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_re_compile_obj, 1, 2, mod_re_compile);
@@ -512,6 +626,10 @@ MP_REGISTER_EXTENSIBLE_MODULE(MP_QSTR_re, mp_module_re);
 #include "lib/re1.5/compilecode.c"
 #include "lib/re1.5/recursiveloop.c"
 #include "lib/re1.5/charclass.c"
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_RE_DFA_STATES
+#include "lib/re1.5/lazydfa.c"
+#endif
 
 #if MICROPY_PY_RE_DEBUG
 // Make sure the output print statements go to the same output as other Python output.
@@ -29,6 +29,8 @@
 #include "py/runtime.h"
 #include "py/obj.h"
 #include "py/objlist.h"
+// CIRCUITPY-CHANGE
+#include "py/objtype.h"
 #include "py/stream.h"
 #include "py/mperrno.h"
 #include "py/mphal.h"
@@ -59,6 +61,24 @@
 
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_SELECT_NOTIFY
+// How to sleep for up to the given number of ms while every polled object can
+// notify readiness and none has.  The wait is split into slices of at most
+// MICROPY_PY_SELECT_NOTIFY_IDLE_MAX_MS so that a notification racing with the
+// start of the sleep is not missed for long.
+#ifndef MICROPY_PY_SELECT_NOTIFY_IDLE
+#ifdef MICROPY_EVENT_POLL_HOOK
+#define MICROPY_PY_SELECT_NOTIFY_IDLE(ms) MICROPY_EVENT_POLL_HOOK
+#else
+#define MICROPY_PY_SELECT_NOTIFY_IDLE(ms) (void)(ms)
+#endif
+#endif
+#ifndef MICROPY_PY_SELECT_NOTIFY_IDLE_MAX_MS
+#define MICROPY_PY_SELECT_NOTIFY_IDLE_MAX_MS (10)
+#endif
+#endif
+
 // Flags for ipoll()
 #define FLAG_ONESHOT (1)
 
@@ -80,6 +100,13 @@ typedef struct _poll_obj_t {
     mp_uint_t events;
     mp_uint_t revents;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_SELECT_NOTIFY
+    // The object's readiness counter (NULL if it can't notify), and its value
+    // when the object was last polled.
+    mp_stream_notify_t *notify;
+    uint32_t notify_seen;
+    #endif
 } poll_obj_t;
 
 // A set of pollable objects.
@@ -94,6 +121,12 @@ typedef struct _poll_set_t {
     unsigned short used; // actual number of used entries in pollfds
     struct pollfd *pollfds;
     #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_SELECT_NOTIFY
+    // Set by poll_set_poll_once() if every non-fd object can notify.
+    bool all_notify;
+    #endif
 } poll_set_t;
 
 STATIC void poll_set_init(poll_set_t *poll_set, size_t n) {
@@ -195,6 +228,19 @@ static inline void poll_obj_set_revents(poll_obj_t *poll_obj, mp_uint_t revents)
 
 #endif
 
+// CIRCUITPY-CHANGE
+// Make sure the object is polled on the next pass even if it hasn't notified,
+// because it is new or the events it is polled for have changed.
+static inline void poll_obj_mark_changed(poll_obj_t *poll_obj) {
+    #if MICROPY_PY_SELECT_NOTIFY
+    if (poll_obj->notify != NULL) {
+        poll_obj->notify_seen = *poll_obj->notify - 1;
+    }
+    #else
+    (void)poll_obj;
+    #endif
+}
+
 STATIC void poll_set_add_obj(poll_set_t *poll_set, const mp_obj_t *obj, mp_uint_t obj_len, mp_uint_t events, bool or_events) {
     for (mp_uint_t i = 0; i < obj_len; i++) {
         mp_map_elem_t *elem = mp_map_lookup(&poll_set->map, mp_obj_id(obj[i]), MP_MAP_LOOKUP_ADD_IF_NOT_FOUND);
@@ -238,6 +284,20 @@ STATIC void poll_set_add_obj(poll_set_t *poll_set, const mp_obj_t *obj, mp_uint_
             poll_obj->ioctl = stream_p->ioctl;
             #endif
 
+            // CIRCUITPY-CHANGE
+            #if MICROPY_PY_SELECT_NOTIFY
+            // Streams implemented in Python can't notify, so don't show them the request.
+            poll_obj->notify = NULL;
+            if (poll_obj->ioctl != NULL && !mp_obj_is_instance_type(mp_obj_get_type(obj[i]))) {
+                int err;
+                mp_uint_t res = poll_obj->ioctl(obj[i], MP_STREAM_POLL_NOTIFY, (uintptr_t)&poll_obj->notify, &err);
+                if (res == MP_STREAM_ERROR) {
+                    poll_obj->notify = NULL;
+                }
+            }
+            poll_obj_mark_changed(poll_obj);
+            #endif
+
             poll_obj_set_events(poll_obj, events);
             poll_obj_set_revents(poll_obj, 0);
             elem->value = MP_OBJ_FROM_PTR(poll_obj);
@@ -252,13 +312,23 @@ STATIC void poll_set_add_obj(poll_set_t *poll_set, const mp_obj_t *obj, mp_uint_
             (void)or_events;
             #endif
             poll_obj_set_events(poll_obj, events);
+            // CIRCUITPY-CHANGE
+            poll_obj_mark_changed(poll_obj);
         }
     }
 }
 
 // For each object in the poll set, poll it once.
-STATIC mp_uint_t poll_set_poll_once(poll_set_t *poll_set, size_t *rwx_num) {
+// CIRCUITPY-CHANGE: if only_changed is true then objects that can notify are
+// skipped unless they have notified since they were last polled.  This is only
+// valid if none of them was ready last time, so their revents are still 0.
+STATIC mp_uint_t poll_set_poll_once(poll_set_t *poll_set, size_t *rwx_num, bool only_changed) {
     mp_uint_t n_ready = 0;
+    #if MICROPY_PY_SELECT_NOTIFY
+    poll_set->all_notify = true;
+    #else
+    (void)only_changed;
+    #endif
     for (mp_uint_t i = 0; i < poll_set->map.alloc; ++i) {
         if (!mp_map_slot_is_filled(&poll_set->map, i)) {
             continue;
@@ -273,6 +343,21 @@ STATIC mp_uint_t poll_set_poll_once(poll_set_t *poll_set, size_t *rwx_num) {
         }
         #endif
 
+        // CIRCUITPY-CHANGE
+        #if MICROPY_PY_SELECT_NOTIFY
+        if (poll_obj->notify != NULL) {
+            uint32_t seq = *poll_obj->notify;
+            if (only_changed && seq == poll_obj->notify_seen) {
+                continue;
+            }
+            // Record the counter before polling, so that a notification arriving
+            // during the ioctl causes another poll.
+            poll_obj->notify_seen = seq;
+        } else {
+            poll_set->all_notify = false;
+        }
+        #endif
+
         int errcode;
         mp_int_t ret = poll_obj->ioctl(poll_obj->obj, MP_STREAM_POLL, poll_obj_get_events(poll_obj), &errcode);
         poll_obj_set_revents(poll_obj, ret);
@@ -307,6 +392,8 @@ STATIC mp_uint_t poll_set_poll_once(poll_set_t *poll_set, size_t *rwx_num) {
 
 STATIC mp_uint_t poll_set_poll_until_ready_or_timeout(poll_set_t *poll_set, size_t *rwx_num, mp_uint_t timeout) {
     mp_uint_t start_ticks = mp_hal_ticks_ms();
+    // CIRCUITPY-CHANGE
+    bool only_changed = false;
 
     #if MICROPY_PY_SELECT_POSIX_OPTIMISATIONS
 
@@ -347,7 +434,9 @@ STATIC mp_uint_t poll_set_poll_until_ready_or_timeout(poll_set_t *poll_set, size
 
         // Explicitly poll any objects that do not have a file descriptor.
         if (!poll_set_all_are_fds(poll_set)) {
-            n_ready += poll_set_poll_once(poll_set, rwx_num);
+            // CIRCUITPY-CHANGE
+            n_ready += poll_set_poll_once(poll_set, rwx_num, only_changed);
+            only_changed = true;
         }
 
         // Return if an object is ready, or if the timeout expired.
@@ -362,8 +451,13 @@ STATIC mp_uint_t poll_set_poll_until_ready_or_timeout(poll_set_t *poll_set, size
     #else
 
     for (;;) {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_PY_SELECT_NOTIFY
+        uint32_t seq = mp_stream_notify_seq;
+        #endif
         // poll the objects
-        mp_uint_t n_ready = poll_set_poll_once(poll_set, rwx_num);
+        mp_uint_t n_ready = poll_set_poll_once(poll_set, rwx_num, only_changed);
+        only_changed = true;
         if (n_ready > 0 || (timeout != (mp_uint_t)-1 && mp_hal_ticks_ms() - start_ticks >= timeout)) {
             return n_ready;
         }
@@ -372,6 +466,28 @@ STATIC mp_uint_t poll_set_poll_until_ready_or_timeout(poll_set_t *poll_set, size
         if (mp_hal_is_interrupted()) {
             return 0;
         }
+        #if MICROPY_PY_SELECT_NOTIFY
+        if (poll_set->all_notify) {
+            // Nothing can become ready without notifying, so sleep until something
+            // notifies rather than calling every ioctl again.
+            while (mp_stream_notify_seq == seq) {
+                mp_uint_t idle = MICROPY_PY_SELECT_NOTIFY_IDLE_MAX_MS;
+                if (timeout != (mp_uint_t)-1) {
+                    mp_uint_t delta = mp_hal_ticks_ms() - start_ticks;
+                    if (delta >= timeout) {
+                        return 0;
+                    }
+                    idle = MIN(idle, timeout - delta);
+                }
+                MICROPY_PY_SELECT_NOTIFY_IDLE(idle);
+                RUN_BACKGROUND_TASKS;
+                if (mp_hal_is_interrupted()) {
+                    return 0;
+                }
+            }
+            continue;
+        }
+        #endif
         #ifdef MICROPY_EVENT_POLL_HOOK
         MICROPY_EVENT_POLL_HOOK;
         #endif
@@ -501,6 +617,8 @@ STATIC mp_obj_t poll_modify(mp_obj_t self_in, mp_obj_t obj_in, mp_obj_t eventmas
         mp_raise_OSError(MP_ENOENT);
     }
     poll_obj_set_events((poll_obj_t *)MP_OBJ_TO_PTR(elem->value), mp_obj_get_int(eventmask_in));
+    // CIRCUITPY-CHANGE
+    poll_obj_mark_changed((poll_obj_t *)MP_OBJ_TO_PTR(elem->value));
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_3(poll_modify_obj, poll_modify);
@@ -95,6 +95,11 @@ STATIC mp_obj_t fat_vfs_make_new(const mp_obj_type_t *type, size_t n_args, size_
         mp_raise_OSError_fresult(res);
     }
 
+    #if MICROPY_FATFS_SECTOR_CACHE_LINES
+    // CIRCUITPY-CHANGE: The cache lives and dies with this object on the VM heap.
+    fat_vfs_sector_cache_init(vfs, m_malloc_maybe);
+    #endif
+
     return MP_OBJ_FROM_PTR(vfs);
 }
 
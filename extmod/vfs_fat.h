@@ -38,6 +38,11 @@ typedef struct _fs_user_mount_t {
     // CIRCUITPY-CHANGE: Count the users that are manipulating the blockdev via
     // native fatfs so we can lock and unlock the blockdev.
     int8_t lock_count;
+
+    #if MICROPY_FATFS_SECTOR_CACHE_LINES
+    // CIRCUITPY-CHANGE: Recently used sectors, below FatFs's own window.
+    struct _fat_vfs_sector_cache_t *sector_cache;
+    #endif
 } fs_user_mount_t;
 
 extern const byte fresult_to_errno_table[20];
@@ -47,6 +52,14 @@ extern const mp_obj_type_t mp_type_vfs_fat_textio;
 
 MP_DECLARE_CONST_FUN_OBJ_3(fat_vfs_open_obj);
 
+#if MICROPY_FATFS_SECTOR_CACHE_LINES
+// CIRCUITPY-CHANGE: Attach a sector cache to a mounted filesystem. Memory comes
+// from alloc, which returns NULL on failure; fewer lines are used if the full
+// cache doesn't fit, and none at all if a single line doesn't.
+void fat_vfs_sector_cache_init(fs_user_mount_t *vfs, void *(*alloc)(size_t size));
+void fat_vfs_sector_cache_invalidate(fs_user_mount_t *vfs);
+#endif
+
 typedef struct _pyb_file_obj_t {
     mp_obj_base_t base;
     FIL fp;
@@ -32,6 +32,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "py/mphal.h"
 
@@ -48,6 +49,171 @@ STATIC fs_user_mount_t *disk_get_device(void *bdev) {
     return (fs_user_mount_t *)bdev;
 }
 
+#if MICROPY_FATFS_SECTOR_CACHE_LINES
+
+// CIRCUITPY-CHANGE: A small LRU cache of sectors below FatFs. FatFs reads the
+// FAT, directories and partial file sectors one sector at a time through its
+// single window (and, with FF_FS_TINY, all file data too), so interleaved
+// access to two files re-reads the same sectors over and over. Single-sector
+// reads are served from here; larger transfers go straight to the device.
+// Writes are passed through and update any cached copy, so the cache never
+// holds anything the device doesn't and needs no flushing.
+
+enum {
+    SECTOR_CACHE_FAT,
+    SECTOR_CACHE_DIR,
+    SECTOR_CACHE_DATA,
+    SECTOR_CACHE_NUM_KINDS,
+};
+
+#define SECTOR_CACHE_EMPTY ((DWORD)-1)
+
+typedef struct {
+    DWORD sector;
+    uint32_t last_used;
+} fat_vfs_sector_cache_line_t;
+
+typedef struct _fat_vfs_sector_cache_t {
+    uint8_t *data;
+    uint32_t use_count;
+    uint16_t line_size;
+    uint8_t n_lines;
+    // Filesystem type the lines were last split for, 0 when not mounted.
+    uint8_t fs_type;
+    // Lines first_line[k] up to first_line[k + 1] hold sectors of kind k.
+    uint8_t first_line[SECTOR_CACHE_NUM_KINDS + 1];
+    fat_vfs_sector_cache_line_t line[];
+} fat_vfs_sector_cache_t;
+
+STATIC size_t sector_cache_sector_size(fs_user_mount_t *vfs) {
+    #if FF_MAX_SS == FF_MIN_SS
+    (void)vfs;
+    return FF_MAX_SS;
+    #else
+    return vfs->fatfs.ssize;
+    #endif
+}
+
+STATIC uint8_t *sector_cache_line_data(fat_vfs_sector_cache_t *cache, size_t i) {
+    return cache->data + i * cache->line_size;
+}
+
+void fat_vfs_sector_cache_invalidate(fs_user_mount_t *vfs) {
+    fat_vfs_sector_cache_t *cache = vfs->sector_cache;
+    if (cache == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < cache->n_lines; i++) {
+        cache->line[i].sector = SECTOR_CACHE_EMPTY;
+        cache->line[i].last_used = 0;
+    }
+}
+
+// Share the lines out between FAT, directory and data sectors. FAT32 and exFAT
+// directories are ordinary clusters that can't be told apart from file data,
+// so only FAT12/16 get directory lines, for their fixed root directory.
+STATIC void sector_cache_split(fs_user_mount_t *vfs, fat_vfs_sector_cache_t *cache) {
+    BYTE fs_type = vfs->fatfs.fs_type;
+    size_t n_fat = 0;
+    size_t n_dir = 0;
+    if (fs_type != 0 && cache->n_lines >= 3) {
+        n_fat = MAX(cache->n_lines / 4, 1);
+        if (fs_type == FS_FAT12 || fs_type == FS_FAT16) {
+            n_dir = n_fat;
+        }
+    }
+    cache->first_line[SECTOR_CACHE_FAT] = 0;
+    cache->first_line[SECTOR_CACHE_DIR] = n_fat;
+    cache->first_line[SECTOR_CACHE_DATA] = n_fat + n_dir;
+    cache->first_line[SECTOR_CACHE_NUM_KINDS] = cache->n_lines;
+    cache->fs_type = fs_type;
+    fat_vfs_sector_cache_invalidate(vfs);
+}
+
+STATIC size_t sector_cache_kind(const FATFS *fs, DWORD sector) {
+    // Boot and reserved sectors are read about as often as the FAT, so share its lines.
+    if (sector < fs->fatbase + fs->fsize * fs->n_fats) {
+        return SECTOR_CACHE_FAT;
+    }
+    // On FAT12/16 the root directory sits between the FATs and the data area.
+    if (sector < fs->database) {
+        return SECTOR_CACHE_DIR;
+    }
+    return SECTOR_CACHE_DATA;
+}
+
+STATIC DRESULT sector_cache_read(fs_user_mount_t *vfs, fat_vfs_sector_cache_t *cache, BYTE *buff, DWORD sector) {
+    if (cache->fs_type != vfs->fatfs.fs_type) {
+        sector_cache_split(vfs, cache);
+    }
+
+    size_t found = cache->n_lines;
+    for (size_t i = 0; i < cache->n_lines; i++) {
+        if (cache->line[i].sector == sector) {
+            found = i;
+            break;
+        }
+    }
+
+    if (found == cache->n_lines) {
+        size_t kind = sector_cache_kind(&vfs->fatfs, sector);
+        if (cache->first_line[kind] == cache->first_line[kind + 1]) {
+            kind = SECTOR_CACHE_DATA;
+        }
+        // Replace the least recently used line of this kind.
+        found = cache->first_line[kind];
+        for (size_t i = found + 1; i < cache->first_line[kind + 1]; i++) {
+            if (cache->line[i].last_used < cache->line[found].last_used) {
+                found = i;
+            }
+        }
+        cache->line[found].sector = SECTOR_CACHE_EMPTY;
+        if (mp_vfs_blockdev_read(&vfs->blockdev, sector, 1, sector_cache_line_data(cache, found)) != 0) {
+            return RES_ERROR;
+        }
+        cache->line[found].sector = sector;
+    }
+
+    cache->line[found].last_used = ++cache->use_count;
+    memcpy(buff, sector_cache_line_data(cache, found), cache->line_size);
+    return RES_OK;
+}
+
+STATIC void sector_cache_written(fat_vfs_sector_cache_t *cache, const BYTE *buff, DWORD sector, UINT count) {
+    for (size_t i = 0; i < cache->n_lines; i++) {
+        DWORD offset = cache->line[i].sector - sector;
+        if (cache->line[i].sector != SECTOR_CACHE_EMPTY && offset < count) {
+            memcpy(sector_cache_line_data(cache, i), buff + offset * cache->line_size, cache->line_size);
+        }
+    }
+}
+
+void fat_vfs_sector_cache_init(fs_user_mount_t *vfs, void *(*alloc)(size_t size)) {
+    if (vfs->sector_cache != NULL) {
+        fat_vfs_sector_cache_invalidate(vfs);
+        return;
+    }
+    size_t line_size = sector_cache_sector_size(vfs);
+    if (line_size == 0) {
+        return;
+    }
+    for (size_t n_lines = MIN(MICROPY_FATFS_SECTOR_CACHE_LINES, 255); n_lines > 0; n_lines /= 2) {
+        size_t header_size = sizeof(fat_vfs_sector_cache_t) + n_lines * sizeof(fat_vfs_sector_cache_line_t);
+        fat_vfs_sector_cache_t *cache = alloc(header_size + n_lines * line_size);
+        if (cache != NULL) {
+            cache->data = (uint8_t *)cache + header_size;
+            cache->use_count = 0;
+            cache->line_size = line_size;
+            cache->n_lines = n_lines;
+            vfs->sector_cache = cache;
+            sector_cache_split(vfs, cache);
+            return;
+        }
+    }
+}
+
+#endif
+
 /*-----------------------------------------------------------------------*/
 /* Read Sector(s)                                                        */
 /*-----------------------------------------------------------------------*/
@@ -63,6 +229,13 @@ DRESULT disk_read(
         return RES_PARERR;
     }
 
+    #if MICROPY_FATFS_SECTOR_CACHE_LINES
+    fat_vfs_sector_cache_t *cache = vfs->sector_cache;
+    if (cache != NULL && count == 1 && sector_cache_sector_size(vfs) == cache->line_size) {
+        return sector_cache_read(vfs, cache, buff, sector);
+    }
+    #endif
+
     int ret = mp_vfs_blockdev_read(&vfs->blockdev, sector, count, buff);
 
     return ret == 0 ? RES_OK : RES_ERROR;
@@ -85,6 +258,18 @@ DRESULT disk_write(
 
     int ret = mp_vfs_blockdev_write(&vfs->blockdev, sector, count, buff);
 
+    #if MICROPY_FATFS_SECTOR_CACHE_LINES
+    fat_vfs_sector_cache_t *cache = vfs->sector_cache;
+    if (cache != NULL) {
+        if (ret == 0 && sector_cache_sector_size(vfs) == cache->line_size) {
+            sector_cache_written(cache, buff, sector, count);
+        } else {
+            // Unknown what reached the device, so don't trust any of it.
+            fat_vfs_sector_cache_invalidate(vfs);
+        }
+    }
+    #endif
+
     if (ret == -MP_EROFS) {
         // read-only block device
         return RES_WRPRT;
@@ -148,6 +333,11 @@ DRESULT disk_ioctl(
             return RES_OK;
 
         case IOCTL_INIT:
+            #if MICROPY_FATFS_SECTOR_CACHE_LINES
+            // The medium may have been changed since it was last mounted.
+            fat_vfs_sector_cache_invalidate(vfs);
+            #endif
+            MP_FALLTHROUGH
         case IOCTL_STATUS: {
             DSTATUS stat;
             if (ret != mp_const_none && MP_OBJ_SMALL_INT_VALUE(ret) != 0) {
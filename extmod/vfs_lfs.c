@@ -33,7 +33,9 @@
 #include "extmod/vfs.h"
 #include "extmod/vfs_lfs.h"
 
-enum { LFS_MAKE_ARG_bdev, LFS_MAKE_ARG_readsize, LFS_MAKE_ARG_progsize, LFS_MAKE_ARG_lookahead, LFS_MAKE_ARG_mtime };
+// CIRCUITPY-CHANGE: cachesize, blockcycles and metadatamax are only used by VfsLfs2.
+enum { LFS_MAKE_ARG_bdev, LFS_MAKE_ARG_readsize, LFS_MAKE_ARG_progsize, LFS_MAKE_ARG_lookahead, LFS_MAKE_ARG_mtime,
+       LFS_MAKE_ARG_cachesize, LFS_MAKE_ARG_blockcycles, LFS_MAKE_ARG_metadatamax };
 
 static const mp_arg_t lfs_make_allowed_args[] = {
     { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
@@ -41,6 +43,9 @@ static const mp_arg_t lfs_make_allowed_args[] = {
     { MP_QSTR_progsize, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 32} },
     { MP_QSTR_lookahead, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 32} },
     { MP_QSTR_mtime, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+    { MP_QSTR_cachesize, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    { MP_QSTR_blockcycles, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 100} },
+    { MP_QSTR_metadatamax, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
 };
 
 #if MICROPY_VFS_LFS1
@@ -62,6 +67,9 @@ typedef struct _mp_obj_vfs_lfs1_t {
     vstr_t cur_dir;
     struct lfs1_config config;
     lfs1_t lfs;
+    #if MICROPY_VFS_LFS_PORT_HEAP
+    void *port_heap_buffers;
+    #endif
 } mp_obj_vfs_lfs1_t;
 
 typedef struct _mp_obj_vfs_lfs1_file_t {
@@ -112,6 +120,9 @@ typedef struct _mp_obj_vfs_lfs2_t {
     vstr_t cur_dir;
     struct lfs2_config config;
     lfs2_t lfs;
+    #if MICROPY_VFS_LFS_PORT_HEAP
+    void *port_heap_buffers;
+    #endif
 } mp_obj_vfs_lfs2_t;
 
 typedef struct _mp_obj_vfs_lfs2_file_t {
@@ -68,9 +68,39 @@ STATIC int MP_VFS_LFSx(dev_sync)(const struct LFSx_API (config) * c) {
     return MP_VFS_LFSx(dev_ioctl)(c, MP_BLOCKDEV_IOCTL_SYNC, 0, false);
 }
 
-STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size_t read_size, size_t prog_size, size_t lookahead) {
+// CIRCUITPY-CHANGE: The read, prog and lookahead buffers are one allocation, taken
+// from the port's heap if it has one and room, else from the GC heap. The
+// lookahead buffer goes first because littlefs needs it word aligned.
+STATIC void MP_VFS_LFSx(alloc_buffers)(MP_OBJ_VFS_LFSx * self, size_t lookahead_size, size_t read_size, size_t prog_size) {
+    struct LFSx_API (config) * config = &self->config;
+    size_t total = lookahead_size + read_size + prog_size;
+    uint8_t *buf = NULL;
+    #if MICROPY_VFS_LFS_PORT_HEAP
+    buf = MICROPY_VFS_LFS_PORT_HEAP_ALLOC(total);
+    self->port_heap_buffers = buf;
+    #endif
+    if (buf == NULL) {
+        buf = m_new(uint8_t, total);
+    }
+    config->lookahead_buffer = buf;
+    config->read_buffer = buf + lookahead_size;
+    config->prog_buffer = buf + lookahead_size + read_size;
+}
+
+STATIC void MP_VFS_LFSx(free_buffers)(MP_OBJ_VFS_LFSx * self) {
+    #if MICROPY_VFS_LFS_PORT_HEAP
+    if (self->port_heap_buffers != NULL) {
+        MICROPY_VFS_LFS_PORT_HEAP_FREE(self->port_heap_buffers);
+        self->port_heap_buffers = NULL;
+    }
+    #else
+    (void)self;
+    #endif
+}
+
+STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, const mp_arg_val_t *args) {
     self->blockdev.flags = MP_BLOCKDEV_FLAG_FREE_OBJ;
-    mp_vfs_blockdev_init(&self->blockdev, bdev);
+    mp_vfs_blockdev_init(&self->blockdev, args[LFS_MAKE_ARG_bdev].u_obj);
 
     struct LFSx_API (config) * config = &self->config;
     memset(config, 0, sizeof(*config));
@@ -87,23 +117,47 @@ STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size
     int bc = MP_VFS_LFSx(dev_ioctl)(config, MP_BLOCKDEV_IOCTL_BLOCK_COUNT, 0, true); // get block count
     self->blockdev.block_size = bs;
 
+    size_t read_size = mp_arg_validate_int_min(args[LFS_MAKE_ARG_readsize].u_int, 1, MP_QSTR_readsize);
+    size_t prog_size = mp_arg_validate_int_min(args[LFS_MAKE_ARG_progsize].u_int, 1, MP_QSTR_progsize);
+    mp_int_t lookahead = args[LFS_MAKE_ARG_lookahead].u_int;
+
     config->read_size = read_size;
     config->prog_size = prog_size;
     config->block_size = bs;
     config->block_count = bc;
 
     #if LFS_BUILD_VERSION == 1
+    // The lookahead is counted in blocks, one bit each, and scanned a word at a time.
+    if (lookahead <= 0 || lookahead % 32 != 0) {
+        mp_arg_error_invalid(MP_QSTR_lookahead);
+    }
     config->lookahead = lookahead;
-    config->read_buffer = m_new(uint8_t, config->read_size);
-    config->prog_buffer = m_new(uint8_t, config->prog_size);
-    config->lookahead_buffer = m_new(uint8_t, config->lookahead / 8);
+    MP_VFS_LFSx(alloc_buffers)(self, config->lookahead / 8, config->read_size, config->prog_size);
     #else
-    config->block_cycles = 100;
-    config->cache_size = 4 * MAX(read_size, prog_size);
+    // The lookahead is counted in bytes and scanned 64 bits at a time.
+    if (lookahead <= 0 || lookahead % 8 != 0) {
+        mp_arg_error_invalid(MP_QSTR_lookahead);
+    }
+    // A bigger cache and lookahead mean fewer device reads when walking
+    // directories and scanning for free blocks, at the cost of RAM.
+    mp_int_t cache_size = args[LFS_MAKE_ARG_cachesize].u_int;
+    if (cache_size == 0) {
+        cache_size = 4 * MAX(read_size, prog_size);
+    } else if (cache_size < 0 || cache_size % read_size != 0 || cache_size % prog_size != 0 || bs % cache_size != 0) {
+        mp_arg_error_invalid(MP_QSTR_cachesize);
+    }
+    // -1 disables wear levelling of metadata, which makes it cheaper to update.
+    mp_int_t block_cycles = args[LFS_MAKE_ARG_blockcycles].u_int;
+    if (block_cycles == 0) {
+        mp_arg_error_invalid(MP_QSTR_blockcycles);
+    }
+    // Capping metadata pairs below the block size makes compacting them
+    // quicker on devices with large erase blocks.
+    config->metadata_max = mp_arg_validate_int_range(args[LFS_MAKE_ARG_metadatamax].u_int, 0, bs, MP_QSTR_metadatamax);
+    config->block_cycles = block_cycles;
+    config->cache_size = cache_size;
     config->lookahead_size = lookahead;
-    config->read_buffer = m_new(uint8_t, config->cache_size);
-    config->prog_buffer = m_new(uint8_t, config->cache_size);
-    config->lookahead_buffer = m_new(uint8_t, config->lookahead_size);
+    MP_VFS_LFSx(alloc_buffers)(self, config->lookahead_size, config->cache_size, config->cache_size);
     #endif
 }
 
@@ -124,30 +178,52 @@ STATIC mp_obj_t MP_VFS_LFSx(make_new)(const mp_obj_type_t * type, size_t n_args,
     mp_arg_val_t args[MP_ARRAY_SIZE(lfs_make_allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(lfs_make_allowed_args), lfs_make_allowed_args, args);
 
+    #if MICROPY_VFS_LFS_PORT_HEAP
+    // CIRCUITPY-CHANGE: The finaliser gives back buffers on the port heap.
+    MP_OBJ_VFS_LFSx *self = m_new_obj_with_finaliser(MP_OBJ_VFS_LFSx);
+    memset(self, 0, sizeof(*self));
+    #else
     MP_OBJ_VFS_LFSx *self = m_new0(MP_OBJ_VFS_LFSx, 1);
+    #endif
     self->base.type = type;
     vstr_init(&self->cur_dir, 16);
     vstr_add_byte(&self->cur_dir, '/');
     #if LFS_BUILD_VERSION == 2
     self->enable_mtime = args[LFS_MAKE_ARG_mtime].u_bool;
     #endif
-    MP_VFS_LFSx(init_config)(self, args[LFS_MAKE_ARG_bdev].u_obj,
-        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int);
+    MP_VFS_LFSx(init_config)(self, args);
     int ret = LFSx_API(mount)(&self->lfs, &self->config);
     if (ret < 0) {
+        MP_VFS_LFSx(free_buffers)(self);
         mp_raise_OSError(-ret);
     }
     return MP_OBJ_FROM_PTR(self);
 }
 
+#if MICROPY_VFS_LFS_PORT_HEAP
+STATIC mp_obj_t MP_VFS_LFSx(del)(mp_obj_t self_in) {
+    MP_OBJ_VFS_LFSx *self = MP_OBJ_TO_PTR(self_in);
+    MP_VFS_LFSx(free_buffers)(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(MP_VFS_LFSx(del_obj), MP_VFS_LFSx(del));
+#endif
+
 STATIC mp_obj_t MP_VFS_LFSx(mkfs)(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     mp_arg_val_t args[MP_ARRAY_SIZE(lfs_make_allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(lfs_make_allowed_args), lfs_make_allowed_args, args);
 
     MP_OBJ_VFS_LFSx self;
-    MP_VFS_LFSx(init_config)(&self, args[LFS_MAKE_ARG_bdev].u_obj,
-        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int);
+    MP_VFS_LFSx(init_config)(&self, args);
+    // self has no finaliser, so give its buffers back if the block device raises.
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) != 0) {
+        MP_VFS_LFSx(free_buffers)(&self);
+        nlr_jump(nlr.ret_val);
+    }
     int ret = LFSx_API(format)(&self.lfs, &self.config);
+    nlr_pop();
+    MP_VFS_LFSx(free_buffers)(&self);
     if (ret < 0) {
         mp_raise_OSError(-ret);
     }
@@ -469,6 +545,9 @@ STATIC mp_obj_t MP_VFS_LFSx(umount)(mp_obj_t self_in) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(MP_VFS_LFSx(umount_obj), MP_VFS_LFSx(umount));
 
 STATIC const mp_rom_map_elem_t MP_VFS_LFSx(locals_dict_table)[] = {
+    #if MICROPY_VFS_LFS_PORT_HEAP
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&MP_VFS_LFSx(del_obj)) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_mkfs), MP_ROM_PTR(&MP_VFS_LFSx(mkfs_obj)) },
     { MP_ROM_QSTR(MP_QSTR_open), MP_ROM_PTR(&MP_VFS_LFSx(open_obj)) },
     { MP_ROM_QSTR(MP_QSTR_ilistdir), MP_ROM_PTR(&MP_VFS_LFSx(ilistdir_obj)) },
@@ -0,0 +1,301 @@
+// Copyright 2024 Adafruit Industries LLC.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// CIRCUITPY-CHANGE: lazily built DFA over the bytecode program.
+//
+// A DFA state is the set of instructions (consumers, Eol and Match) that
+// live threads are waiting on.  States and transitions are only created
+// the first time they are needed, so memory use is bounded by max_states
+// regardless of the pattern.  Input bytes are first mapped to equivalence
+// classes (bytes no instruction can tell apart), which keeps each state's
+// transition row short.
+//
+// The DFA can only tell whether a match exists, not which one the
+// backtracking matcher would report, so callers use it to reject subjects
+// quickly and still run re1_5_recursiveloopprog() to fill in captures.
+
+#include "re1.5.h"
+
+// State ids are unsigned chars, and the top two values are reserved.
+#define DFA_UNKNOWN 0xff
+#define DFA_DEAD 0xfe
+
+#if MICROPY_PY_RE_DFA_STATES >= DFA_DEAD
+#error "MICROPY_PY_RE_DFA_STATES must be less than 254"
+#endif
+#define DFA_MAX_FLUSHES 8
+
+#define DFA_FLAG_MATCH 1
+#define DFA_FLAG_EOL_MATCH 2
+
+#define BIT_TEST(set, i) ((set)[(i) >> 3] & (1 << ((i) & 7)))
+#define BIT_SET(set, i) ((set)[(i) >> 3] |= (1 << ((i) & 7)))
+
+#define DFA_TRANS(dfa) ((dfa)->data)
+#define DFA_FLAGS(dfa) (DFA_TRANS(dfa) + (dfa)->max_states * (dfa)->nclasses)
+#define DFA_SET(dfa, s) (DFA_FLAGS(dfa) + (dfa)->max_states + (s) * (dfa)->setbytes)
+// Scratch sets live after the last state.
+#define DFA_NEXT(dfa) DFA_SET(dfa, (dfa)->max_states)
+#define DFA_VISITED(dfa) DFA_SET(dfa, (dfa)->max_states + 1)
+#define DFA_EOLSET(dfa) DFA_SET(dfa, (dfa)->max_states + 2)
+
+static int inst_len(const char *pc)
+{
+	switch (*pc) {
+	case Any:
+	case Bol:
+	case Eol:
+	case Match:
+		return 1;
+	case Class:
+	case ClassNot:
+		return 2 + *(unsigned char*)(pc + 1) * 2;
+	default:
+		return 2;
+	}
+}
+
+static int consumer_match(const char *pc, char c)
+{
+	switch (*pc) {
+	case Char:
+		return pc[1] == c;
+	case Any:
+		return 1;
+	case Class:
+	case ClassNot:
+		return _re1_5_classmatch(pc + 1, &c);
+	default:
+		return _re1_5_namedclassmatch(pc + 1, &c);
+	}
+}
+
+int re1_5_dfaclasses(ByteProg *prog, unsigned char *classmap)
+{
+	unsigned char in[32], has_in[32], has_out[32], assigned[32];
+	unsigned char newid[256];
+	int nclasses = 1;
+	int pc, b;
+
+	memset(classmap, 0, 256);
+	for (pc = 0; pc < prog->bytelen; pc += inst_len(prog->insts + pc)) {
+		const char *inst = prog->insts + pc;
+		if (!inst_is_consumer(*inst) || *inst == Any)
+			continue;
+		// Split every class that this instruction only partly matches.
+		memset(in, 0, sizeof(in));
+		memset(has_in, 0, sizeof(has_in));
+		memset(has_out, 0, sizeof(has_out));
+		memset(assigned, 0, sizeof(assigned));
+		for (b = 0; b < 256; b++) {
+			if (consumer_match(inst, (char)b)) {
+				BIT_SET(in, b);
+				BIT_SET(has_in, classmap[b]);
+			} else {
+				BIT_SET(has_out, classmap[b]);
+			}
+		}
+		for (b = 0; b < 256; b++) {
+			int k = classmap[b];
+			if (!BIT_TEST(in, b) || !BIT_TEST(has_out, k))
+				continue;
+			if (!BIT_TEST(assigned, k)) {
+				BIT_SET(assigned, k);
+				newid[k] = nclasses++;
+			}
+			classmap[b] = newid[k];
+		}
+	}
+	return nclasses;
+}
+
+size_t re1_5_dfasize(ByteProg *prog, int nclasses, int max_states)
+{
+	size_t setbytes = (prog->bytelen + 7) / 8;
+	return sizeof(ReDfa) + max_states * (nclasses + 1) + (max_states + 3) * setbytes;
+}
+
+static void dfa_reset(ReDfa *dfa)
+{
+	dfa->nstates = 0;
+	memset(dfa->start, DFA_UNKNOWN, sizeof(dfa->start));
+}
+
+void re1_5_dfainit(ReDfa *dfa, ByteProg *prog, const unsigned char *classmap, int nclasses, int max_states)
+{
+	int b;
+	assert(max_states < DFA_DEAD);
+	dfa->setbytes = (prog->bytelen + 7) / 8;
+	dfa->nclasses = nclasses;
+	dfa->max_states = max_states;
+	dfa->failed = 0;
+	memcpy(dfa->classmap, classmap, 256);
+	for (b = 255; b >= 0; b--)
+		dfa->rep[classmap[b]] = b;
+	dfa_reset(dfa);
+}
+
+// Add the instructions reachable from pc without consuming input to set.
+static void addthread(const char *insts, unsigned char *set, unsigned char *visited, int pc, int at_bol, int at_eol)
+{
+	re1_5_stack_chk();
+
+	for(;;) {
+		if (BIT_TEST(visited, pc))
+			return;
+		BIT_SET(visited, pc);
+		switch (insts[pc]) {
+		case Jmp:
+			pc += 2 + (signed char)insts[pc + 1];
+			continue;
+		case Split:
+		case RSplit:
+			addthread(insts, set, visited, pc + 2 + (signed char)insts[pc + 1], at_bol, at_eol);
+			pc += 2;
+			continue;
+		case Save:
+			pc += 2;
+			continue;
+		case Bol:
+			if (!at_bol)
+				return;
+			pc++;
+			continue;
+		case Eol:
+			if (at_eol) {
+				pc++;
+				continue;
+			}
+			// Kept in the state so the end of input can be checked later.
+			BIT_SET(set, pc);
+			return;
+		default:
+			BIT_SET(set, pc);
+			return;
+		}
+	}
+}
+
+// Intern the set in DFA_NEXT as a state.  Returns DFA_DEAD for the empty
+// set and DFA_UNKNOWN if there is no room left.
+static int dfa_addstate(ReDfa *dfa, ByteProg *prog)
+{
+	unsigned char *set = DFA_NEXT(dfa);
+	int s, pc, flags = 0;
+
+	for (pc = 0; pc < dfa->setbytes && !set[pc]; pc++) {
+	}
+	if (pc == dfa->setbytes)
+		return DFA_DEAD;
+	for (s = 0; s < dfa->nstates; s++) {
+		if (memcmp(DFA_SET(dfa, s), set, dfa->setbytes) == 0)
+			return s;
+	}
+	if (dfa->nstates == dfa->max_states)
+		return DFA_UNKNOWN;
+
+	// Match is always the last instruction of the program.
+	if (BIT_TEST(set, prog->bytelen - 1)) {
+		flags = DFA_FLAG_MATCH;
+	} else {
+		unsigned char *eolset = DFA_EOLSET(dfa);
+		unsigned char *visited = DFA_VISITED(dfa);
+		memset(eolset, 0, dfa->setbytes);
+		memset(visited, 0, dfa->setbytes);
+		for (pc = 0; pc < prog->bytelen; pc++) {
+			if (BIT_TEST(set, pc) && prog->insts[pc] == Eol)
+				addthread(prog->insts, eolset, visited, pc + 1, 0, 1);
+		}
+		if (BIT_TEST(eolset, prog->bytelen - 1))
+			flags = DFA_FLAG_EOL_MATCH;
+	}
+
+	s = dfa->nstates++;
+	memcpy(DFA_SET(dfa, s), set, dfa->setbytes);
+	DFA_FLAGS(dfa)[s] = flags;
+	memset(DFA_TRANS(dfa) + s * dfa->nclasses, DFA_UNKNOWN, dfa->nclasses);
+	return s;
+}
+
+// Build the set of state s after consuming a byte of class c in DFA_NEXT.
+static void dfa_step(ReDfa *dfa, ByteProg *prog, int s, int c)
+{
+	const unsigned char *cur = DFA_SET(dfa, s);
+	unsigned char *next = DFA_NEXT(dfa);
+	unsigned char *visited = DFA_VISITED(dfa);
+	char ch = dfa->rep[c];
+	int pc;
+
+	memset(next, 0, dfa->setbytes);
+	memset(visited, 0, dfa->setbytes);
+	for (pc = 0; pc < prog->bytelen; pc++) {
+		const char *inst = prog->insts + pc;
+		if (BIT_TEST(cur, pc) && inst_is_consumer(*inst) && consumer_match(inst, ch))
+			addthread(prog->insts, next, visited, pc + inst_len(inst), 0, 0);
+	}
+}
+
+// Intern DFA_NEXT, flushing all states if the DFA is full.  Returns
+// DFA_UNKNOWN if it has been flushed too often to be worth using.
+static int dfa_addstate_flush(ReDfa *dfa, ByteProg *prog, int *flushes)
+{
+	int s = dfa_addstate(dfa, prog);
+	if (s == DFA_UNKNOWN) {
+		if (++*flushes > DFA_MAX_FLUSHES) {
+			dfa->failed = 1;
+			return DFA_UNKNOWN;
+		}
+		dfa_reset(dfa);
+		s = dfa_addstate(dfa, prog);
+	}
+	return s;
+}
+
+int re1_5_lazydfa(ReDfa *dfa, ByteProg *prog, Subject *input, int is_anchored)
+{
+	const char *sp;
+	int at_bol = input->begin == input->begin_line;
+	int flushes = 0;
+	int s, t;
+
+	// At the end of a non-empty subject Bol can never hold, which is what
+	// the Eol flags assume.
+	if (dfa->failed || input->begin >= input->end)
+		return -1;
+
+	s = dfa->start[is_anchored * 2 + at_bol];
+	if (s == DFA_UNKNOWN) {
+		int pc = HANDLE_ANCHORED(prog->insts, is_anchored) - prog->insts;
+		memset(DFA_NEXT(dfa), 0, dfa->setbytes);
+		memset(DFA_VISITED(dfa), 0, dfa->setbytes);
+		addthread(prog->insts, DFA_NEXT(dfa), DFA_VISITED(dfa), pc, at_bol, 0);
+		s = dfa_addstate_flush(dfa, prog, &flushes);
+		if (s == DFA_UNKNOWN)
+			return -1;
+		dfa->start[is_anchored * 2 + at_bol] = s;
+	}
+	if (s == DFA_DEAD)
+		return 0;
+
+	for (sp = input->begin; sp < input->end; sp++) {
+		if (DFA_FLAGS(dfa)[s] & DFA_FLAG_MATCH)
+			return 1;
+		int c = dfa->classmap[(unsigned char)*sp];
+		t = DFA_TRANS(dfa)[s * dfa->nclasses + c];
+		if (t == DFA_UNKNOWN) {
+			dfa_step(dfa, prog, s, c);
+			int old_flushes = flushes;
+			t = dfa_addstate_flush(dfa, prog, &flushes);
+			if (t == DFA_UNKNOWN)
+				return -1;
+			// A flush discarded s, so there is no row to record the edge in.
+			if (flushes == old_flushes)
+				DFA_TRANS(dfa)[s * dfa->nclasses + c] = t;
+		}
+		if (t == DFA_DEAD)
+			return 0;
+		s = t;
+	}
+	return (DFA_FLAGS(dfa)[s] & (DFA_FLAG_MATCH | DFA_FLAG_EOL_MATCH)) != 0;
+}
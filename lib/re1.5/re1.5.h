@@ -148,6 +148,26 @@ int re1_5_recursiveloopprog(ByteProg*, Subject*, const char**, int, int);
 int re1_5_recursiveprog(ByteProg*, Subject*, const char**, int, int);
 int re1_5_thompsonvm(ByteProg*, Subject*, const char**, int, int);
 
+// CIRCUITPY-CHANGE: lazily built DFA, see lazydfa.c
+typedef struct ReDfa ReDfa;
+
+struct ReDfa {
+	unsigned short setbytes;
+	unsigned short nclasses;
+	unsigned char max_states;
+	unsigned char nstates;
+	unsigned char failed;
+	unsigned char start[4];
+	unsigned char classmap[256];
+	unsigned char rep[256];
+	unsigned char data[];
+};
+
+int re1_5_dfaclasses(ByteProg *prog, unsigned char *classmap);
+size_t re1_5_dfasize(ByteProg *prog, int nclasses, int max_states);
+void re1_5_dfainit(ReDfa *dfa, ByteProg *prog, const unsigned char *classmap, int nclasses, int max_states);
+int re1_5_lazydfa(ReDfa *dfa, ByteProg *prog, Subject *input, int is_anchored);
+
 int re1_5_sizecode(const char *re);
 int re1_5_compilecode(ByteProg *prog, const char *re);
 void re1_5_dumpcode(ByteProg *prog);
@@ -700,7 +700,8 @@ static void block_idct (
 /*-----------------------------------------------------------------------*/
 
 static JRESULT mcu_load (
-	JDEC* jd		/* Pointer to the decompressor object */
+	JDEC* jd,		/* Pointer to the decompressor object */
+	int skip		/* CIRCUITPY-CHANGE: only advance through the huffman coded data */
 )
 {
 	int32_t *tmp = (int32_t*)jd->workbuf;	/* Block working buffer for de-quantize and IDCT */
@@ -739,7 +740,7 @@ static JRESULT mcu_load (
 			tmp[0] = d * dqf[0] >> 8;				/* De-quantize, apply scale factor of Arai algorithm and descale 8 bits */
 
 			/* Extract following 63 AC elements from input stream */
-			memset(&tmp[1], 0, 63 * sizeof (int32_t));	/* Initialize all AC elements */
+			if (!skip) memset(&tmp[1], 0, 63 * sizeof (int32_t));	/* Initialize all AC elements */
 			z = 1;		/* Top of the AC elements (in zigzag-order) */
 			do {
 				d = huffext(jd, id, 1);				/* Extract a huffman coded value (zero runs and bit length) */
@@ -753,12 +754,14 @@ static JRESULT mcu_load (
 					if (d < 0) return (JRESULT)(0 - d);	/* Err: input device */
 					bc = 1 << (bc - 1);				/* MSB position */
 					if (!(d & bc)) d -= (bc << 1) - 1;	/* Restore negative value if needed */
-					i = Zig[z];						/* Get raster-order index */
-					tmp[i] = d * dqf[i] >> 8;		/* De-quantize, apply scale factor of Arai algorithm and descale 8 bits */
+					if (!skip) {					/* CIRCUITPY-CHANGE */
+						i = Zig[z];					/* Get raster-order index */
+						tmp[i] = d * dqf[i] >> 8;	/* De-quantize, apply scale factor of Arai algorithm and descale 8 bits */
+					}
 				}
 			} while (++z < 64);		/* Next AC element */
 
-			if (JD_FORMAT != 2 || !cmp) {	/* C components may not be processed if in grayscale output */
+			if (!skip && (JD_FORMAT != 2 || !cmp)) {	/* C components may not be processed if in grayscale output */
 				if (z == 1 || (JD_USE_SCALE && jd->scale == 3)) {	/* If no AC element or scale ratio is 1/8, IDCT can be ommited and the block is filled with DC value */
 					d = (jd_yuv_t)((*tmp / 256) + 128);
 					if (JD_FASTDECODE >= 1) {
@@ -956,6 +959,659 @@ static JRESULT mcu_output (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* CIRCUITPY-CHANGE: Parse the header of a scan                          */
+/*-----------------------------------------------------------------------*/
+
+static JRESULT scan_header (	/* 0:OK, !0:Failed */
+	JDEC* jd,				/* Pointer to the decompressor object */
+	const uint8_t* seg,		/* Pointer to the SOS segment data */
+	size_t len				/* Size of the segment data */
+)
+{
+	unsigned int n, i, c;
+
+
+	n = seg[0];								/* Number of components in the scan */
+	if (!n || n > jd->ncomp || len != 4 + 2 * n) return JDR_FMT1;
+	jd->nscomp = n;
+	for (i = 0; i < n; i++) {
+		for (c = 0; c < jd->ncomp && jd->compid[c] != seg[1 + 2 * i]; c++) ;
+		if (c == jd->ncomp) return JDR_FMT1;		/* Err: Unknown component */
+		if (seg[2 + 2 * i] & 0xEE) return JDR_FMT3;	/* Err: Only huffman table 0 and 1 are supported */
+		jd->scomp[i] = c;
+		jd->stbl[i] = seg[2 + 2 * i];
+	}
+	seg += 1 + 2 * n;
+	jd->ss = seg[0]; jd->se = seg[1];		/* Spectral selection */
+	jd->ah = seg[2] >> 4; jd->al = seg[2] & 15;	/* Successive approximation */
+	if (jd->ss ? (jd->se < jd->ss || jd->se > 63 || n != 1) : jd->se != 0) return JDR_FMT1;
+	if (jd->al > 13) return JDR_FMT1;
+
+	return JDR_OK;
+}
+
+
+
+#if JD_FASTDECODE >= 1
+
+/*-----------------------------------------------------------------------*/
+/* CIRCUITPY-CHANGE: Get a byte from the input stream                    */
+/*-----------------------------------------------------------------------*/
+
+static int getbyte (	/* >=0: read data, <0: error code */
+	JDEC* jd			/* Pointer to the decompressor object */
+)
+{
+	if (!jd->dctr) {	/* Buffer empty, re-fill input buffer */
+		jd->dptr = jd->inbuf;
+		jd->dctr = jd->infunc(jd, jd->inbuf, JD_SZBUF);
+		if (!jd->dctr) return 0 - (int)JDR_INP;	/* Err: read error or wrong stream termination */
+	}
+	jd->dctr--;
+	return *jd->dptr++;
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* CIRCUITPY-CHANGE: Skip the entropy coded data up to the next marker   */
+/*-----------------------------------------------------------------------*/
+
+static int next_marker (	/* >=0: marker code (second byte), <0: error code */
+	JDEC* jd,				/* Pointer to the decompressor object */
+	int skip_rst			/* 1: Skip RSTn markers too */
+)
+{
+	int d = jd->marker;		/* The bit reader may have hit the marker already */
+
+
+	jd->marker = 0;
+	jd->dbit = 0;			/* Discard stuff bits */
+	for (;;) {
+		if (!d) {
+			do {	/* Search a flag sequence without huffman decoding */
+				d = getbyte(jd);
+				if (d < 0) return d;
+			} while (d != 0xFF);
+			do {	/* Fill bytes may precede the marker */
+				d = getbyte(jd);
+				if (d < 0) return d;
+			} while (d == 0xFF);
+			if (!d) continue;	/* Escape of a data 0xFF */
+		}
+		if (!skip_rst || (d & 0xF8) != 0xD0) return d;
+		d = 0;
+	}
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* CIRCUITPY-CHANGE: Check if a restart interval overlaps the roi        */
+/*-----------------------------------------------------------------------*/
+
+static int interval_in_roi (	/* 1:Overlaps, 0:Does not overlap */
+	JDEC* jd,				/* Pointer to the decompressor object */
+	unsigned int x,			/* Location of the first MCU in the interval */
+	unsigned int y,
+	const JRECT* roi		/* Region to output in image pixels */
+)
+{
+	unsigned int mx = jd->msx * 8, my = jd->msy * 8, n;
+
+
+	for (n = jd->nrst; n && y < jd->height && y <= roi->bottom; n--) {
+		if (y + my - 1 >= roi->top && x <= roi->right && x + mx - 1 >= roi->left) return 1;
+		x += mx;
+		if (x >= jd->width) {	/* Intervals may span MCU rows */
+			x = 0; y += my;
+		}
+	}
+
+	return 0;
+}
+
+#endif
+
+
+
+#if JD_FASTDECODE == 1
+
+/*-----------------------------------------------------------------------*/
+/* CIRCUITPY-CHANGE: Progressive JPEG                                    */
+/*-----------------------------------------------------------------------*/
+
+/* The coefficients of all scans are accumulated in the progbuf given by the
+   application before anything can be output. To keep it small, only the
+   low frequency coefficients of each block that are visible at the output
+   scale are kept (the top-left 8 >> scale square for Y, wider or taller for
+   subsampled Cb/Cr), and only for the blocks of the MCUs overlapping the roi. A map of the non-zero coefficients of every
+   block is needed to parse AC refinement scans, but not at 1/8 scale where
+   the AC scans are skipped without huffman decoding. */
+
+#define HUFF_SLOT	(16 + 256 * 3)	/* Size of a huffman table defined between scans (bits, codes and data) */
+
+typedef struct {
+	uint64_t* nzmap;			/* Non-zero coefficients of each block in zigzag order (NULL:not needed) */
+	int16_t* coef;				/* Kept coefficients of each block in raster order */
+	uint8_t kw[2], kh[2];		/* Size of the kept coefficients of Y and C blocks */
+	uint8_t nkeep[2];			/* Number of coefficients kept in Y and C blocks */
+	int8_t keep[2][64];			/* Index in the kept coefficients of each zigzag position (-1:dropped) */
+	uint16_t mcux, mcuy;		/* Number of MCUs in the image */
+	uint16_t bw[3];				/* Number of blocks of each component in an MCU padded row */
+	uint32_t mbase[3];			/* Index of the first block of each component in the nzmap */
+	size_t nblk;				/* Number of blocks in the nzmap */
+	uint16_t cx[3], cy[3];		/* First block of each component whose coefficients are kept */
+	uint16_t cw[3], ch[3];		/* Number of blocks of each component whose coefficients are kept */
+	uint32_t cbase[3];			/* Index of the first kept coefficient of each component */
+} JPROG;
+
+
+static size_t prog_layout (	/* Size of the progbuf needed */
+	JDEC* jd,				/* Pointer to the decompressor object */
+	JPROG* p,				/* Coefficient store to lay out */
+	uint8_t scale,			/* Output de-scaling factor */
+	const JRECT* roi		/* Region to output in image pixels, NULL for all */
+)
+{
+	unsigned int c, n, i, z, h, v, mx, my, x0, y0, x1, y1;
+	size_t nk = 0;
+
+
+	for (c = 0; c < 2; c++) {	/* C blocks cover msx * msy as many pixels as Y blocks, only DC is used at 1/8 */
+		n = (scale == 3) ? 1 : (8 >> scale) * (c ? jd->msx : 1);
+		p->kw[c] = n < 8 ? n : 8;
+		n = (scale == 3) ? 1 : (8 >> scale) * (c ? jd->msy : 1);
+		p->kh[c] = n < 8 ? n : 8;
+		p->nkeep[c] = p->kw[c] * p->kh[c];
+		for (z = 0; z < 64; z++) {
+			i = Zig[z];
+			p->keep[c][z] = ((i >> 3) < p->kh[c] && (i & 7) < p->kw[c]) ? (int8_t)((i >> 3) * p->kw[c] + (i & 7)) : -1;
+		}
+	}
+
+	mx = jd->msx * 8; my = jd->msy * 8;		/* Size of the MCU (pixel) */
+	p->mcux = (jd->width + mx - 1) / mx;
+	p->mcuy = (jd->height + my - 1) / my;
+	x0 = y0 = 0; x1 = p->mcux; y1 = p->mcuy;	/* MCUs to keep the coefficients of */
+	if (roi) {
+		if (roi->right / mx + 1 < x1) x1 = roi->right / mx + 1;
+		if (roi->bottom / my + 1 < y1) y1 = roi->bottom / my + 1;
+		x0 = roi->left / mx; y0 = roi->top / my;
+		if (x0 > x1) x0 = x1;
+		if (y0 > y1) y0 = y1;
+	}
+
+	p->nblk = 0;
+	for (c = 0; c < jd->ncomp; c++) {
+		h = c ? 1 : jd->msx; v = c ? 1 : jd->msy;	/* Blocks of this component in an MCU */
+		p->bw[c] = p->mcux * h;
+		p->mbase[c] = p->nblk;
+		p->nblk += (size_t)p->mcux * h * p->mcuy * v;
+		p->cx[c] = x0 * h; p->cy[c] = y0 * v;
+		p->cw[c] = (x1 - x0) * h; p->ch[c] = (y1 - y0) * v;
+		p->cbase[c] = nk;
+		nk += (size_t)p->cw[c] * p->ch[c] * p->nkeep[c ? 1 : 0];
+	}
+
+	return 4 * HUFF_SLOT + (scale < 3 ? p->nblk * sizeof (uint64_t) : 0) + nk * sizeof (int16_t);
+}
+
+
+static int16_t* prog_coef (	/* Kept coefficients of the block (NULL:not kept) */
+	JPROG* p,				/* Coefficient store */
+	unsigned int c,			/* Component */
+	unsigned int bx,		/* Block location in the component */
+	unsigned int by
+)
+{
+	bx -= p->cx[c]; by -= p->cy[c];
+	if (bx >= p->cw[c] || by >= p->ch[c]) return 0;
+	return p->coef + p->cbase[c] + ((size_t)by * p->cw[c] + bx) * p->nkeep[c ? 1 : 0];
+}
+
+
+static JRESULT prog_dc (	/* Decode the DC element of a block */
+	JDEC* jd,				/* Pointer to the decompressor object */
+	JPROG* p,				/* Coefficient store */
+	unsigned int i,			/* Component index in the scan */
+	unsigned int bx,		/* Block location in the component */
+	unsigned int by
+)
+{
+	unsigned int c = jd->scomp[i];
+	int16_t *cf = prog_coef(p, c, bx, by);
+	int d, e;
+
+
+	if (!jd->ah) {	/* First scan: difference from the previous block */
+		d = huffext(jd, jd->stbl[i] >> 4, 0);
+		if (d < 0) return (JRESULT)(0 - d);
+		if (d) {
+			e = bitext(jd, d);
+			if (e < 0) return (JRESULT)(0 - e);
+			if (!(e & (1 << (d - 1)))) e -= (1 << d) - 1;	/* Restore negative value if needed */
+			jd->dcv[c] = (int16_t)(jd->dcv[c] + e);
+		}
+		if (cf) cf[0] = (int16_t)(jd->dcv[c] * (1 << jd->al));
+	} else {		/* Refinement scan: one more bit */
+		e = bitext(jd, 1);
+		if (e < 0) return (JRESULT)(0 - e);
+		if (e && cf) cf[0] |= 1 << jd->al;
+	}
+
+	return JDR_OK;
+}
+
+
+static JRESULT prog_ac_first (	/* Decode the first scan of a band of AC elements of a block */
+	JDEC* jd,				/* Pointer to the decompressor object */
+	JPROG* p,				/* Coefficient store */
+	unsigned int bx,		/* Block location in the component */
+	unsigned int by
+)
+{
+	unsigned int c = jd->scomp[0], id = jd->stbl[0] & 15, z, r, s;
+	const int8_t *kp = p->keep[c ? 1 : 0];
+	int16_t *cf;
+	uint64_t *nz;
+	int d, e;
+
+
+	if (jd->eobrun) {	/* Nothing in this band of the block */
+		jd->eobrun--;
+		return JDR_OK;
+	}
+	cf = prog_coef(p, c, bx, by);
+	nz = &p->nzmap[p->mbase[c] + (size_t)by * p->bw[c] + bx];
+
+	for (z = jd->ss; z <= jd->se; z++) {
+		d = huffext(jd, id, 1);				/* Zero run and bit length */
+		if (d < 0) return (JRESULT)(0 - d);
+		r = (unsigned int)d >> 4; s = d & 15;
+		if (!s) {
+			if (r < 15) {	/* EOBn: this and the following 2^r + n - 1 blocks end here */
+				jd->eobrun = (1 << r) - 1;
+				if (r) {
+					e = bitext(jd, r);
+					if (e < 0) return (JRESULT)(0 - e);
+					jd->eobrun += e;
+				}
+				break;
+			}
+			z += 15;	/* ZRL: 16 zeros */
+		} else {
+			z += r;
+			if (z > jd->se) return JDR_FMT1;	/* Too long zero run */
+			e = bitext(jd, s);
+			if (e < 0) return (JRESULT)(0 - e);
+			if (!(e & (1 << (s - 1)))) e -= (1 << s) - 1;	/* Restore negative value if needed */
+			*nz |= (uint64_t)1 << z;
+			if (cf && kp[z] >= 0) cf[kp[z]] = (int16_t)(e * (1 << jd->al));
+		}
+	}
+
+	return JDR_OK;
+}
+
+
+static int prog_refine (	/* Apply a correction bit to a non-zero AC element. 0:OK, <0:error code */
+	JDEC* jd,				/* Pointer to the decompressor object */
+	const int8_t* kp,		/* Index of each zigzag position in the kept coefficients */
+	int16_t* cf,			/* Kept coefficients of the block */
+	unsigned int z			/* Zigzag position of the element */
+)
+{
+	int e = bitext(jd, 1);
+
+
+	if (e < 0) return e;
+	if (e && cf && kp[z] >= 0) {
+		cf += kp[z];
+		if (!(*cf & (1 << jd->al))) *cf += (*cf >= 0) ? (1 << jd->al) : -(1 << jd->al);
+	}
+
+	return 0;
+}
+
+
+static JRESULT prog_ac_refine (	/* Decode a refinement scan of a band of AC elements of a block */
+	JDEC* jd,				/* Pointer to the decompressor object */
+	JPROG* p,				/* Coefficient store */
+	unsigned int bx,		/* Block location in the component */
+	unsigned int by
+)
+{
+	unsigned int c = jd->scomp[0], id = jd->stbl[0] & 15, z = jd->ss, r, s;
+	const int8_t *kp = p->keep[c ? 1 : 0];
+	int16_t *cf = prog_coef(p, c, bx, by);
+	uint64_t *nz = &p->nzmap[p->mbase[c] + (size_t)by * p->bw[c] + bx];
+	int d, e, v;
+
+
+	while (z <= jd->se && !jd->eobrun) {
+		d = huffext(jd, id, 1);				/* Zero run and bit length */
+		if (d < 0) return (JRESULT)(0 - d);
+		r = (unsigned int)d >> 4; s = d & 15; v = 0;
+		if (!s) {
+			if (r < 15) {	/* EOBn: no new elements in this and the following 2^r + n - 1 blocks */
+				jd->eobrun = 1 << r;
+				if (r) {
+					e = bitext(jd, r);
+					if (e < 0) return (JRESULT)(0 - e);
+					jd->eobrun += e;
+				}
+				break;
+			}
+		} else {			/* A new element of +/-1 at this bit position */
+			if (s != 1) return JDR_FMT1;
+			e = bitext(jd, 1);
+			if (e < 0) return (JRESULT)(0 - e);
+			v = e ? (1 << jd->al) : -(1 << jd->al);
+		}
+		for ( ; z <= jd->se; z++) {	/* Skip r zero elements, refining the non-zero ones on the way */
+			if (*nz & ((uint64_t)1 << z)) {
+				e = prog_refine(jd, kp, cf, z);
+				if (e < 0) return (JRESULT)(0 - e);
+			} else {
+				if (!r) break;
+				r--;
+			}
+		}
+		if (v && z <= jd->se) {
+			*nz |= (uint64_t)1 << z;
+			if (cf && kp[z] >= 0) cf[kp[z]] = (int16_t)v;
+		}
+		z++;
+	}
+
+	if (jd->eobrun) {	/* Refine the rest of the non-zero elements in the band */
+		for ( ; z <= jd->se; z++) {
+			if (*nz & ((uint64_t)1 << z)) {
+				e = prog_refine(jd, kp, cf, z);
+				if (e < 0) return (JRESULT)(0 - e);
+			}
+		}
+		jd->eobrun--;
+	}
+
+	return JDR_OK;
+}
+
+
+static JRESULT prog_scan (	/* Decode a scan into the coefficient store */
+	JDEC* jd,				/* Pointer to the decompressor object */
+	JPROG* p				/* Coefficient store */
+)
+{
+	unsigned int i, c, n, x, y, bx, by, h, v, nx, ny;
+	uint16_t rst, rsc;
+	JRESULT rc;
+
+
+	for (i = 0; i < jd->nscomp; i++) {	/* Check if the huffman tables used in this scan have been loaded */
+		if (!jd->ss && jd->ah) continue;	/* DC refinement has no huffman coded data */
+		n = jd->ss ? (jd->stbl[i] & 15) : (jd->stbl[i] >> 4);
+		if (!jd->huffbits[n][jd->ss ? 1 : 0]) return JDR_FMT1;	/* Err: not loaded */
+	}
+
+	jd->dcv[2] = jd->dcv[1] = jd->dcv[0] = 0;	/* Initialize DC values */
+	jd->eobrun = 0;
+	rst = rsc = 0;
+
+	if (jd->nscomp > 1) {	/* Interleaved scan (DC elements only) in MCU order */
+		for (y = 0; y < p->mcuy; y++) {
+			for (x = 0; x < p->mcux; x++) {
+				if (jd->nrst && rst++ == jd->nrst) {	/* Process restart interval if enabled */
+					rc = restart(jd, rsc++);
+					if (rc != JDR_OK) return rc;
+					rst = 1;
+				}
+				for (i = 0; i < jd->nscomp; i++) {
+					c = jd->scomp[i];
+					h = c ? 1 : jd->msx; v = c ? 1 : jd->msy;
+					for (by = 0; by < v; by++) {
+						for (bx = 0; bx < h; bx++) {
+							rc = prog_dc(jd, p, i, x * h + bx, y * v + by);
+							if (rc != JDR_OK) return rc;
+						}
+					}
+				}
+			}
+		}
+	} else {				/* Non-interleaved scan in block order of the component */
+		c = jd->scomp[0];
+		n = c ? (jd->width + jd->msx - 1) / jd->msx : jd->width;	/* Size of the component (pixel) */
+		nx = (n + 7) / 8;
+		n = c ? (jd->height + jd->msy - 1) / jd->msy : jd->height;
+		ny = (n + 7) / 8;
+		for (by = 0; by < ny; by++) {
+			for (bx = 0; bx < nx; bx++) {
+				if (jd->nrst && rst++ == jd->nrst) {	/* Process restart interval if enabled */
+					rc = restart(jd, rsc++);
+					if (rc != JDR_OK) return rc;
+					rst = 1;
+					jd->eobrun = 0;
+				}
+				if (!jd->ss) {
+					rc = prog_dc(jd, p, 0, bx, by);
+				} else if (!jd->ah) {
+					rc = prog_ac_first(jd, p, bx, by);
+				} else {
+					rc = prog_ac_refine(jd, p, bx, by);
+				}
+				if (rc != JDR_OK) return rc;
+			}
+		}
+	}
+
+	return JDR_OK;
+}
+
+
+static JRESULT prog_segment (	/* Process a segment between scans */
+	JDEC* jd,				/* Pointer to the decompressor object */
+	uint8_t marker			/* Marker code of the segment */
+)
+{
+	uint8_t seg[10], *pb, *pd;
+	uint16_t hc, *ph;
+	int32_t *pq;
+	unsigned int i, j, b, cls, num, np;
+	size_t len;
+	int d, e;
+
+
+	d = getbyte(jd);
+	e = getbyte(jd);
+	if (d < 0 || e < 0) return JDR_INP;
+	len = (size_t)(d << 8 | e);				/* Length field */
+	if (len < 2) return JDR_FMT1;
+	len -= 2;
+
+	switch (marker) {
+	case 0xDA:	/* SOS - Start of Scan */
+		if (len > sizeof seg) return JDR_FMT1;
+		for (i = 0; i < len; i++) {
+			d = getbyte(jd);
+			if (d < 0) return (JRESULT)(0 - d);
+			seg[i] = (uint8_t)d;
+		}
+		return scan_header(jd, seg, len);
+
+	case 0xC4:	/* DHT - Define Huffman Tables: load into the slot in progbuf */
+		while (len) {
+			if (len < 17) return JDR_FMT1;	/* Err: wrong data size */
+			len -= 17;
+			d = getbyte(jd);				/* Get table number and class */
+			if (d < 0) return (JRESULT)(0 - d);
+			if (d & 0xEE) return JDR_FMT1;	/* Err: invalid class/number */
+			cls = d >> 4; num = d & 0x0F;
+			pb = (uint8_t*)jd->progbuf + (num * 2 + cls) * HUFF_SLOT;
+			for (np = i = 0; i < 16; i++) {	/* Load number of patterns for 1 to 16-bit code */
+				d = getbyte(jd);
+				if (d < 0) return (JRESULT)(0 - d);
+				np += (pb[i] = (uint8_t)d);
+			}
+			if (np > 256 || len < np) return JDR_FMT1;	/* Err: wrong data size */
+			len -= np;
+			ph = (uint16_t*)(pb + 16);
+			hc = 0;
+			for (j = i = 0; i < 16; i++) {	/* Re-build huffman code word table */
+				b = pb[i];
+				while (b--) ph[j++] = hc++;
+				hc <<= 1;
+			}
+			pd = pb + 16 + 256 * sizeof (uint16_t);
+			for (i = 0; i < np; i++) {		/* Load decoded data corresponds to each code word */
+				d = getbyte(jd);
+				if (d < 0) return (JRESULT)(0 - d);
+				if (!cls && d > 11) return JDR_FMT1;
+				pd[i] = (uint8_t)d;
+			}
+			jd->huffbits[num][cls] = pb;
+			jd->huffcode[num][cls] = ph;
+			jd->huffdata[num][cls] = pd;
+		}
+		return JDR_OK;
+
+	case 0xDB:	/* DQT - Define Quaitizer Tables */
+		while (len) {
+			if (len < 65) return JDR_FMT1;	/* Err: table size is unaligned */
+			len -= 65;
+			d = getbyte(jd);				/* Get table property */
+			if (d < 0) return (JRESULT)(0 - d);
+			if (d & 0xF0) return JDR_FMT1;	/* Err: not 8-bit resolution */
+			pq = jd->qttbl[d & 3];
+			if (!pq) {
+				pq = alloc_pool(jd, 64 * sizeof (int32_t));
+				if (!pq) return JDR_MEM1;	/* Err: not enough memory */
+				jd->qttbl[d & 3] = pq;
+			}
+			for (i = 0; i < 64; i++) {
+				d = getbyte(jd);
+				if (d < 0) return (JRESULT)(0 - d);
+				pq[Zig[i]] = (int32_t)((uint32_t)d * Ipsf[Zig[i]]);
+			}
+		}
+		return JDR_OK;
+
+	case 0xDD:	/* DRI - Define Restart Interval */
+		if (len != 2) return JDR_FMT1;
+		d = getbyte(jd);
+		e = getbyte(jd);
+		if (d < 0 || e < 0) return JDR_INP;
+		jd->nrst = (uint16_t)(d << 8 | e);
+		return JDR_OK;
+
+	default:	/* Skip the segment */
+		while (len--) {
+			d = getbyte(jd);
+			if (d < 0) return (JRESULT)(0 - d);
+		}
+		return JDR_OK;
+	}
+}
+
+
+static JRESULT prog_decomp (
+	JDEC* jd,								/* Initialized decompression object */
+	int (*outfunc)(JDEC*, void*, JRECT*),	/* RGB output function */
+	const JRECT* roi						/* Region to output in image pixels, NULL for all */
+)
+{
+	JPROG p;
+	int32_t *tmp = (int32_t*)jd->workbuf;
+	const int32_t *dqf;
+	const int16_t *cf;
+	jd_yuv_t *bp;
+	unsigned int x, y, mx, my, nby, blk, cmp, i, k, bx, by;
+	size_t sz;
+	int d;
+	JRESULT rc;
+
+
+	sz = prog_layout(jd, &p, jd->scale, roi);
+	if (!jd->progbuf || jd->sz_progbuf < sz) return JDR_MEM1;	/* Err: not enough memory */
+	p.nzmap = (jd->scale < 3) ? (uint64_t*)((uint8_t*)jd->progbuf + 4 * HUFF_SLOT) : 0;
+	p.coef = (int16_t*)((uint8_t*)jd->progbuf + 4 * HUFF_SLOT + (p.nzmap ? p.nblk * sizeof (uint64_t) : 0));
+	memset((uint8_t*)jd->progbuf + 4 * HUFF_SLOT, 0, sz - 4 * HUFF_SLOT);
+
+	/* Decode the scans. A truncated stream outputs the scans received so far */
+	d = 0xDA;
+	while (d == 0xDA) {
+		rc = JDR_OK;
+		if (!jd->ss || p.nzmap) {	/* AC elements are not needed at 1/8 scale */
+			rc = prog_scan(jd, &p);
+		}
+		if (rc == JDR_OK) {
+			d = next_marker(jd, 1);
+			while (d >= 0 && d != 0xD9) {	/* Process segments up to the next scan or EOI */
+				rc = prog_segment(jd, (uint8_t)d);
+				if (rc != JDR_OK || d == 0xDA) break;
+				d = next_marker(jd, 0);
+			}
+			if (d < 0) rc = (JRESULT)(0 - d);
+		}
+		if (rc == JDR_INP) break;
+		if (rc != JDR_OK) return rc;
+	}
+
+	/* Output the MCUs overlapping roi */
+	mx = jd->msx * 8; my = jd->msy * 8;		/* Size of the MCU (pixel) */
+	nby = jd->msx * jd->msy;				/* Number of Y blocks (1, 2 or 4) */
+	for (y = 0; y < p.mcuy; y++) {
+		if (roi && y * my > roi->bottom) break;
+		if (roi && y * my + my - 1 < roi->top) continue;
+		for (x = 0; x < p.mcux; x++) {
+			if (roi && (x * mx > roi->right || x * mx + mx - 1 < roi->left)) continue;
+			bp = jd->mcubuf;
+			for (blk = 0; blk < nby + 2; blk++, bp += 64) {
+				cmp = (blk < nby) ? 0 : blk - nby + 1;	/* Component number 0:Y, 1:Cb, 2:Cr */
+				if (cmp && jd->ncomp != 3) {	/* Clear C blocks if not exist (monochrome image) */
+					for (i = 0; i < 64; bp[i++] = 128) ;
+					continue;
+				}
+				if (cmp) {
+					cf = prog_coef(&p, cmp, x, y);
+				} else {
+					cf = prog_coef(&p, 0, x * jd->msx + blk % jd->msx, y * jd->msy + blk / jd->msx);
+				}
+				if (!cf) return JDR_PAR;
+				dqf = jd->qttbl[jd->qtid[cmp]];		/* De-quantizer table for this component */
+				k = cmp ? 1 : 0;
+				tmp[0] = cf[0] * dqf[0] >> 8;
+				for (i = 1; i < p.nkeep[k] && !cf[i]; i++) ;
+				if (i == p.nkeep[k] || (JD_USE_SCALE && jd->scale == 3)) {	/* If no AC element, IDCT can be ommited and the block is filled with DC value */
+					d = (jd_yuv_t)((*tmp / 256) + 128);
+					for (i = 0; i < 64; bp[i++] = d) ;
+				} else {
+					memset(&tmp[1], 0, 63 * sizeof (int32_t));
+					for (by = 0; by < p.kh[k]; by++) {
+						for (bx = 0; bx < p.kw[k]; bx++) {
+							i = by * 8 + bx;
+							tmp[i] = cf[by * p.kw[k] + bx] * dqf[i] >> 8;	/* De-quantize, apply scale factor of Arai algorithm and descale 8 bits */
+						}
+					}
+					block_idct(tmp, bp);
+				}
+			}
+			rc = mcu_output(jd, outfunc, x * mx, y * my);
+			if (rc != JDR_OK) return rc;
+		}
+	}
+
+	return JDR_OK;
+}
+
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Analyze the JPEG image and Initialize decompressor object             */
 /*-----------------------------------------------------------------------*/
@@ -1004,6 +1660,13 @@ JRESULT jd_prepare (
 		ofs += 4 + len;		/* Number of bytes loaded */
 
 		switch (marker & 0xFF) {
+		case 0xC2:	/* CIRCUITPY-CHANGE: SOF2 (progressive JPEG) */
+#if JD_FASTDECODE == 1
+			jd->progressive = 1;
+#else
+			return JDR_FMT3;
+#endif
+			/* fall through */
 		case 0xC0:	/* SOF0 (baseline JPEG) */
 			if (len > JD_SZBUF) return JDR_MEM2;
 			if (jd->infunc(jd, seg, len) != len) return JDR_INP;	/* Load segment data */
@@ -1024,6 +1687,7 @@ JRESULT jd_prepare (
 				} else {		/* Cb/Cr component */
 					if (b != 0x11) return JDR_FMT3;			/* Err: Sampling factor of Cb/Cr must be 1 */
 				}
+				jd->compid[i] = seg[6 + 3 * i];				/* CIRCUITPY-CHANGE: Get component ID referred to by scans */
 				jd->qtid[i] = seg[8 + 3 * i];				/* Get dequantizer table ID for this component */
 				if (jd->qtid[i] > 3) return JDR_FMT3;		/* Err: Invalid ID */
 			}
@@ -1057,15 +1721,20 @@ JRESULT jd_prepare (
 			if (jd->infunc(jd, seg, len) != len) return JDR_INP;	/* Load segment data */
 
 			if (!jd->width || !jd->height) return JDR_FMT1;	/* Err: Invalid image size */
-			if (seg[0] != jd->ncomp) return JDR_FMT3;		/* Err: Wrong color components */
+			if (jd->progressive) {	/* CIRCUITPY-CHANGE: the huffman tables are checked at each scan */
+				rc = scan_header(jd, seg, len);
+				if (rc) return rc;
+			} else if (seg[0] != jd->ncomp) return JDR_FMT3;		/* Err: Wrong color components */
 
 			/* Check if all tables corresponding to each components have been loaded */
 			for (i = 0; i < jd->ncomp; i++) {
 				b = seg[2 + 2 * i];	/* Get huffman table ID */
-				if (b != 0x00 && b != 0x11)	return JDR_FMT3;	/* Err: Different table number for DC/AC element */
-				n = i ? 1 : 0;							/* Component class */
-				if (!jd->huffbits[n][0] || !jd->huffbits[n][1]) {	/* Check huffman table for this component */
-					return JDR_FMT1;					/* Err: Nnot loaded */
+				if (!jd->progressive) {					/* CIRCUITPY-CHANGE */
+					if (b != 0x00 && b != 0x11)	return JDR_FMT3;	/* Err: Different table number for DC/AC element */
+					n = i ? 1 : 0;							/* Component class */
+					if (!jd->huffbits[n][0] || !jd->huffbits[n][1]) {	/* Check huffman table for this component */
+						return JDR_FMT1;					/* Err: Nnot loaded */
+					}
 				}
 				if (!jd->qttbl[jd->qtid[i]]) {			/* Check dequantizer table for this component */
 					return JDR_FMT1;					/* Err: Not loaded */
@@ -1091,7 +1760,6 @@ JRESULT jd_prepare (
 			return JDR_OK;		/* Initialization succeeded. Ready to decompress the JPEG image. */
 
 		case 0xC1:	/* SOF1 */
-		case 0xC2:	/* SOF2 */
 		case 0xC3:	/* SOF3 */
 		case 0xC5:	/* SOF5 */
 		case 0xC6:	/* SOF6 */
@@ -1124,14 +1792,33 @@ JRESULT jd_decomp (
 	int (*outfunc)(JDEC*, void*, JRECT*),	/* RGB output function */
 	uint8_t scale							/* Output de-scaling factor (0 to 3) */
 )
+{
+	return jd_decomp_roi(jd, outfunc, scale, NULL);
+}
+
+/* CIRCUITPY-CHANGE: MCUs outside of roi are huffman decoded, which is needed
+   to find the next one, but neither IDCT'd nor output. Restart intervals
+   entirely outside of roi are not huffman decoded at all but skipped up to
+   the next RSTn marker. Decoding stops after the last MCU row overlapping
+   roi. Progressive images are decoded into jd->progbuf first. */
+JRESULT jd_decomp_roi (
+	JDEC* jd,								/* Initialized decompression object */
+	int (*outfunc)(JDEC*, void*, JRECT*),	/* RGB output function */
+	uint8_t scale,							/* Output de-scaling factor (0 to 3) */
+	const JRECT* roi						/* Region to output in image pixels, NULL for all */
+)
 {
 	unsigned int x, y, mx, my;
 	uint16_t rst, rsc;
+	int skipint = 0;
 	JRESULT rc;
 
 
 	if (scale > (JD_USE_SCALE ? 3 : 0)) return JDR_PAR;
 	jd->scale = scale;
+#if JD_FASTDECODE == 1
+	if (jd->progressive) return prog_decomp(jd, outfunc, roi);
+#endif
 
 	mx = jd->msx * 8; my = jd->msy * 8;			/* Size of the MCU (pixel) */
 
@@ -1140,14 +1827,28 @@ JRESULT jd_decomp (
 
 	rc = JDR_OK;
 	for (y = 0; y < jd->height; y += my) {		/* Vertical loop of MCUs */
+		if (roi && y > roi->bottom) break;		/* Nothing more to output */
 		for (x = 0; x < jd->width; x += mx) {	/* Horizontal loop of MCUs */
 			if (jd->nrst && rst++ == jd->nrst) {	/* Process restart interval if enabled */
 				rc = restart(jd, rsc++);
 				if (rc != JDR_OK) return rc;
 				rst = 1;
 			}
-			rc = mcu_load(jd);					/* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
+#if JD_FASTDECODE >= 1
+			if (roi && jd->nrst && rst == 1) {	/* Skip the entire interval if it is outside of roi */
+				skipint = !interval_in_roi(jd, x, y, roi);
+				if (skipint) {
+					int d = next_marker(jd, 0);
+					if (d < 0) return (JRESULT)(0 - d);
+					jd->marker = (uint8_t)d;	/* RSTn is checked by restart() */
+				}
+			}
+			if (skipint) continue;
+#endif
+			int skip = roi && (y + my - 1 < roi->top || x > roi->right || x + mx - 1 < roi->left);
+			rc = mcu_load(jd, skip);			/* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
 			if (rc != JDR_OK) return rc;
+			if (skip) continue;
 			rc = mcu_output(jd, outfunc, x, y);	/* Output the MCU (YCbCr to RGB, scaling and output) */
 			if (rc != JDR_OK) return rc;
 		}
@@ -1155,3 +1856,22 @@ JRESULT jd_decomp (
 
 	return rc;
 }
+
+
+
+/* CIRCUITPY-CHANGE: size of the coefficient buffer the application has to
+   give in jd->progbuf before decompressing a progressive image with the same
+   scale and roi, 0 for baseline images */
+size_t jd_progressive_size (
+	JDEC* jd,								/* Initialized decompression object */
+	uint8_t scale,							/* Output de-scaling factor (0 to 3) */
+	const JRECT* roi						/* Region to output in image pixels, NULL for all */
+)
+{
+#if JD_FASTDECODE == 1
+	JPROG p;
+
+	if (jd->progressive && scale <= 3) return prog_layout(jd, &p, scale, roi);
+#endif
+	return 0;
+}
@@ -86,6 +86,16 @@ struct JDEC {
 	size_t sz_pool;				/* Size of momory pool (bytes available) */
 	size_t (*infunc)(JDEC*, uint8_t*, size_t);	/* Pointer to jpeg stream input function */
 	void* device;				/* Pointer to I/O device identifiler for the session */
+	/* CIRCUITPY-CHANGE: progressive JPEG */
+	uint8_t progressive;		/* 1:Progressive (SOF2) image */
+	uint8_t compid[3];			/* Component ID of each component given in SOF */
+	uint8_t nscomp;				/* Number of components in the current scan */
+	uint8_t scomp[3];			/* Components in the current scan */
+	uint8_t stbl[3];			/* Huffman table IDs of each component in the current scan (DC << 4 | AC) */
+	uint8_t ss, se, ah, al;		/* Spectral selection and successive approximation of the current scan */
+	uint16_t eobrun;			/* Remaining end-of-band run */
+	void* progbuf;				/* Coefficient buffer given by the application (see jd_progressive_size) */
+	size_t sz_progbuf;			/* Size of the coefficient buffer */
 };
 
 
@@ -93,6 +103,10 @@ struct JDEC {
 /* TJpgDec API functions */
 JRESULT jd_prepare (JDEC* jd, size_t (*infunc)(JDEC*,uint8_t*,size_t), void* pool, size_t sz_pool, void* dev);
 JRESULT jd_decomp (JDEC* jd, int (*outfunc)(JDEC*,void*,JRECT*), uint8_t scale);
+// CIRCUITPY-CHANGE: only output the MCUs overlapping roi (in unscaled image pixels)
+JRESULT jd_decomp_roi (JDEC* jd, int (*outfunc)(JDEC*,void*,JRECT*), uint8_t scale, const JRECT* roi);
+// CIRCUITPY-CHANGE: size of the progbuf needed to decompress a progressive image, 0 for baseline
+size_t jd_progressive_size (JDEC* jd, uint8_t scale, const JRECT* roi);
 
 
 #ifdef __cplusplus
@@ -39,6 +39,7 @@
 #include "py/repl.h"
 #include "py/gc.h"
 #include "py/stackctrl.h"
+#include "py/profile.h"
 
 #include "shared/readline/readline.h"
 #include "shared/runtime/pyexec.h"
@@ -364,6 +365,11 @@ STATIC void cleanup_after_vm(mp_obj_t exception) {
     atexit_reset();
     #endif
 
+    // Stop a profile that the code left running, so the tick can turn off while idle.
+    #if MICROPY_PROF_SAMPLING
+    mp_prof_sampling_stop();
+    #endif
+
     // Turn off the display and flush the filesystem before the heap disappears.
     #if CIRCUITPY_DISPLAYIO
     reset_displays();
@@ -0,0 +1,590 @@
+// This file was automatically generated by makeqstrdata.py
+
+QDEF(MP_QSTRnull, 0, 0, "")
+QDEF(MP_QSTR_, 5381, 0, "")
+QDEF(MP_QSTR___dir__, 36730, 7, "__dir__")
+QDEF(MP_QSTR__0x0a_, 46511, 1, "\x0a")
+QDEF(MP_QSTR__space_, 46469, 1, " ")
+QDEF(MP_QSTR__star_, 46479, 1, "*")
+QDEF(MP_QSTR__slash_, 46474, 1, "/")
+QDEF(MP_QSTR__lt_module_gt_, 38077, 8, "<module>")
+QDEF(MP_QSTR__, 46586, 1, "_")
+QDEF(MP_QSTR___call__, 63911, 8, "__call__")
+QDEF(MP_QSTR___class__, 50475, 9, "__class__")
+QDEF(MP_QSTR___delitem__, 13821, 11, "__delitem__")
+QDEF(MP_QSTR___enter__, 47725, 9, "__enter__")
+QDEF(MP_QSTR___exit__, 63557, 8, "__exit__")
+QDEF(MP_QSTR___getattr__, 63552, 11, "__getattr__")
+QDEF(MP_QSTR___getitem__, 14630, 11, "__getitem__")
+QDEF(MP_QSTR___hash__, 51447, 8, "__hash__")
+QDEF(MP_QSTR___init__, 42335, 8, "__init__")
+QDEF(MP_QSTR___int__, 6934, 7, "__int__")
+QDEF(MP_QSTR___iter__, 13007, 8, "__iter__")
+QDEF(MP_QSTR___len__, 45282, 7, "__len__")
+QDEF(MP_QSTR___main__, 5006, 8, "__main__")
+QDEF(MP_QSTR___module__, 12543, 10, "__module__")
+QDEF(MP_QSTR___name__, 14562, 8, "__name__")
+QDEF(MP_QSTR___new__, 5497, 7, "__new__")
+QDEF(MP_QSTR___next__, 29442, 8, "__next__")
+QDEF(MP_QSTR___qualname__, 107, 12, "__qualname__")
+QDEF(MP_QSTR___repr__, 2832, 8, "__repr__")
+QDEF(MP_QSTR___setitem__, 15922, 11, "__setitem__")
+QDEF(MP_QSTR___str__, 52688, 7, "__str__")
+QDEF(MP_QSTR_ArithmeticError, 35885, 15, "ArithmeticError")
+QDEF(MP_QSTR_AssertionError, 23191, 14, "AssertionError")
+QDEF(MP_QSTR_AttributeError, 56865, 14, "AttributeError")
+QDEF(MP_QSTR_BaseException, 37383, 13, "BaseException")
+QDEF(MP_QSTR_EOFError, 49041, 8, "EOFError")
+QDEF(MP_QSTR_Ellipsis, 57584, 8, "Ellipsis")
+QDEF(MP_QSTR_Exception, 10738, 9, "Exception")
+QDEF(MP_QSTR_GeneratorExit, 25110, 13, "GeneratorExit")
+QDEF(MP_QSTR_ImportError, 39968, 11, "ImportError")
+QDEF(MP_QSTR_IndentationError, 8284, 16, "IndentationError")
+QDEF(MP_QSTR_IndexError, 44419, 10, "IndexError")
+QDEF(MP_QSTR_KeyError, 234, 8, "KeyError")
+QDEF(MP_QSTR_KeyboardInterrupt, 58031, 17, "KeyboardInterrupt")
+QDEF(MP_QSTR_LookupError, 27135, 11, "LookupError")
+QDEF(MP_QSTR_MemoryError, 33756, 11, "MemoryError")
+QDEF(MP_QSTR_NameError, 11706, 9, "NameError")
+QDEF(MP_QSTR_NoneType, 26647, 8, "NoneType")
+QDEF(MP_QSTR_NotImplementedError, 39110, 19, "NotImplementedError")
+QDEF(MP_QSTR_OSError, 26017, 7, "OSError")
+QDEF(MP_QSTR_OverflowError, 57729, 13, "OverflowError")
+QDEF(MP_QSTR_RuntimeError, 61793, 12, "RuntimeError")
+QDEF(MP_QSTR_StopIteration, 7402, 13, "StopIteration")
+QDEF(MP_QSTR_SyntaxError, 36756, 11, "SyntaxError")
+QDEF(MP_QSTR_SystemExit, 65312, 10, "SystemExit")
+QDEF(MP_QSTR_TypeError, 38437, 9, "TypeError")
+QDEF(MP_QSTR_ValueError, 34710, 10, "ValueError")
+QDEF(MP_QSTR_ZeroDivisionError, 10166, 17, "ZeroDivisionError")
+QDEF(MP_QSTR_abs, 12949, 3, "abs")
+QDEF(MP_QSTR_all, 13124, 3, "all")
+QDEF(MP_QSTR_any, 13075, 3, "any")
+QDEF(MP_QSTR_append, 38763, 6, "append")
+QDEF(MP_QSTR_args, 50882, 4, "args")
+QDEF(MP_QSTR_bool, 15595, 4, "bool")
+QDEF(MP_QSTR_builtins, 12791, 8, "builtins")
+QDEF(MP_QSTR_bytearray, 41846, 9, "bytearray")
+QDEF(MP_QSTR_bytecode, 32034, 8, "bytecode")
+QDEF(MP_QSTR_bytes, 45660, 5, "bytes")
+QDEF(MP_QSTR_callable, 28685, 8, "callable")
+QDEF(MP_QSTR_chr, 19676, 3, "chr")
+QDEF(MP_QSTR_classmethod, 36020, 11, "classmethod")
+QDEF(MP_QSTR_clear, 41084, 5, "clear")
+QDEF(MP_QSTR_close, 26419, 5, "close")
+QDEF(MP_QSTR_const, 65472, 5, "const")
+QDEF(MP_QSTR_copy, 56288, 4, "copy")
+QDEF(MP_QSTR_count, 19878, 5, "count")
+QDEF(MP_QSTR_dict, 64575, 4, "dict")
+QDEF(MP_QSTR_dir, 7930, 3, "dir")
+QDEF(MP_QSTR_divmod, 1208, 6, "divmod")
+QDEF(MP_QSTR_end, 8970, 3, "end")
+QDEF(MP_QSTR_endswith, 41755, 8, "endswith")
+QDEF(MP_QSTR_eval, 42651, 4, "eval")
+QDEF(MP_QSTR_exec, 49182, 4, "exec")
+QDEF(MP_QSTR_extend, 59491, 6, "extend")
+QDEF(MP_QSTR_find, 13312, 4, "find")
+QDEF(MP_QSTR_format, 13094, 6, "format")
+QDEF(MP_QSTR_from_bytes, 29749, 10, "from_bytes")
+QDEF(MP_QSTR_get, 15155, 3, "get")
+QDEF(MP_QSTR_getattr, 6080, 7, "getattr")
+QDEF(MP_QSTR_globals, 18845, 7, "globals")
+QDEF(MP_QSTR_hasattr, 45196, 7, "hasattr")
+QDEF(MP_QSTR_hash, 28855, 4, "hash")
+QDEF(MP_QSTR_id, 28456, 2, "id")
+QDEF(MP_QSTR_index, 10363, 5, "index")
+QDEF(MP_QSTR_insert, 21522, 6, "insert")
+QDEF(MP_QSTR_int, 21270, 3, "int")
+QDEF(MP_QSTR_isalpha, 14315, 7, "isalpha")
+QDEF(MP_QSTR_isdigit, 39592, 7, "isdigit")
+QDEF(MP_QSTR_isinstance, 48822, 10, "isinstance")
+QDEF(MP_QSTR_islower, 33020, 7, "islower")
+QDEF(MP_QSTR_isspace, 63579, 7, "isspace")
+QDEF(MP_QSTR_issubclass, 32693, 10, "issubclass")
+QDEF(MP_QSTR_isupper, 42973, 7, "isupper")
+QDEF(MP_QSTR_items, 21475, 5, "items")
+QDEF(MP_QSTR_iter, 8591, 4, "iter")
+QDEF(MP_QSTR_join, 23719, 4, "join")
+QDEF(MP_QSTR_key, 27954, 3, "key")
+QDEF(MP_QSTR_keys, 4865, 4, "keys")
+QDEF(MP_QSTR_len, 16482, 3, "len")
+QDEF(MP_QSTR_list, 7463, 4, "list")
+QDEF(MP_QSTR_little, 27273, 6, "little")
+QDEF(MP_QSTR_locals, 41275, 6, "locals")
+QDEF(MP_QSTR_lower, 52166, 5, "lower")
+QDEF(MP_QSTR_lstrip, 47589, 6, "lstrip")
+QDEF(MP_QSTR_main, 47054, 4, "main")
+QDEF(MP_QSTR_map, 17337, 3, "map")
+QDEF(MP_QSTR_micropython, 31755, 11, "micropython")
+QDEF(MP_QSTR_next, 34882, 4, "next")
+QDEF(MP_QSTR_object, 36240, 6, "object")
+QDEF(MP_QSTR_open, 15057, 4, "open")
+QDEF(MP_QSTR_ord, 24092, 3, "ord")
+QDEF(MP_QSTR_pop, 29482, 3, "pop")
+QDEF(MP_QSTR_popitem, 11455, 7, "popitem")
+QDEF(MP_QSTR_pow, 29485, 3, "pow")
+QDEF(MP_QSTR_print, 50772, 5, "print")
+QDEF(MP_QSTR_range, 24090, 5, "range")
+QDEF(MP_QSTR_read, 63927, 4, "read")
+QDEF(MP_QSTR_readinto, 48971, 8, "readinto")
+QDEF(MP_QSTR_readline, 6649, 8, "readline")
+QDEF(MP_QSTR_remove, 35427, 6, "remove")
+QDEF(MP_QSTR_replace, 9545, 7, "replace")
+QDEF(MP_QSTR_repr, 63440, 4, "repr")
+QDEF(MP_QSTR_reverse, 10789, 7, "reverse")
+QDEF(MP_QSTR_rfind, 40146, 5, "rfind")
+QDEF(MP_QSTR_rindex, 11241, 6, "rindex")
+QDEF(MP_QSTR_round, 9703, 5, "round")
+QDEF(MP_QSTR_rsplit, 165, 6, "rsplit")
+QDEF(MP_QSTR_rstrip, 38203, 6, "rstrip")
+QDEF(MP_QSTR_self, 30585, 4, "self")
+QDEF(MP_QSTR_send, 30393, 4, "send")
+QDEF(MP_QSTR_sep, 36643, 3, "sep")
+QDEF(MP_QSTR_set, 36647, 3, "set")
+QDEF(MP_QSTR_setattr, 43220, 7, "setattr")
+QDEF(MP_QSTR_setdefault, 41836, 10, "setdefault")
+QDEF(MP_QSTR_sort, 40383, 4, "sort")
+QDEF(MP_QSTR_sorted, 5470, 6, "sorted")
+QDEF(MP_QSTR_split, 13239, 5, "split")
+QDEF(MP_QSTR_start, 61317, 5, "start")
+QDEF(MP_QSTR_startswith, 59508, 10, "startswith")
+QDEF(MP_QSTR_staticmethod, 44898, 12, "staticmethod")
+QDEF(MP_QSTR_step, 13911, 4, "step")
+QDEF(MP_QSTR_stop, 13981, 4, "stop")
+QDEF(MP_QSTR_str, 36176, 3, "str")
+QDEF(MP_QSTR_strip, 7721, 5, "strip")
+QDEF(MP_QSTR_sum, 36142, 3, "sum")
+QDEF(MP_QSTR_super, 45764, 5, "super")
+QDEF(MP_QSTR_throw, 17587, 5, "throw")
+QDEF(MP_QSTR_to_bytes, 16088, 8, "to_bytes")
+QDEF(MP_QSTR_tuple, 16893, 5, "tuple")
+QDEF(MP_QSTR_type, 32669, 4, "type")
+QDEF(MP_QSTR_update, 30388, 6, "update")
+QDEF(MP_QSTR_upper, 37927, 5, "upper")
+QDEF(MP_QSTR_utf_hyphen_8, 33463, 5, "utf-8")
+QDEF(MP_QSTR_value, 13390, 5, "value")
+QDEF(MP_QSTR_values, 48765, 6, "values")
+QDEF(MP_QSTR_write, 43160, 5, "write")
+QDEF(MP_QSTR_zip, 44262, 3, "zip")
+QDEF(MP_QSTR___add__, 33476, 7, "__add__")
+QDEF(MP_QSTR___bool__, 25899, 8, "__bool__")
+QDEF(MP_QSTR___complex__, 58053, 11, "__complex__")
+QDEF(MP_QSTR___contains__, 24518, 12, "__contains__")
+QDEF(MP_QSTR___eq__, 15985, 6, "__eq__")
+QDEF(MP_QSTR___float__, 28725, 9, "__float__")
+QDEF(MP_QSTR___ge__, 18087, 6, "__ge__")
+QDEF(MP_QSTR___gt__, 33462, 6, "__gt__")
+QDEF(MP_QSTR___iadd__, 19053, 8, "__iadd__")
+QDEF(MP_QSTR___isub__, 30728, 8, "__isub__")
+QDEF(MP_QSTR___le__, 5068, 6, "__le__")
+QDEF(MP_QSTR___lt__, 26717, 6, "__lt__")
+QDEF(MP_QSTR___ne__, 2830, 6, "__ne__")
+QDEF(MP_QSTR___sub__, 2337, 7, "__sub__")
+QDEF(MP_QSTR__percent__hash_o, 6764, 3, "%#o")
+QDEF(MP_QSTR__percent__hash_x, 6779, 3, "%#x")
+QDEF(MP_QSTR__brace_open__colon__hash_b_brace_close_, 14168, 5, "{:#b}")
+QDEF(MP_QSTR__lt_lambda_gt_, 35968, 8, "<lambda>")
+QDEF(MP_QSTR__lt_listcomp_gt_, 5588, 10, "<listcomp>")
+QDEF(MP_QSTR__lt_dictcomp_gt_, 36300, 10, "<dictcomp>")
+QDEF(MP_QSTR__lt_setcomp_gt_, 20820, 9, "<setcomp>")
+QDEF(MP_QSTR__lt_genexpr_gt_, 27188, 9, "<genexpr>")
+QDEF(MP_QSTR__lt_string_gt_, 21330, 8, "<string>")
+QDEF(MP_QSTR__lt_stdin_gt_, 25571, 7, "<stdin>")
+QDEF(MP_QSTR_BrokenPipeError, 25902, 15, "BrokenPipeError")
+QDEF(MP_QSTR_ConnectionError, 4427, 15, "ConnectionError")
+QDEF(MP_QSTR_None, 53615, 4, "None")
+QDEF(MP_QSTR_ReloadException, 49667, 15, "ReloadException")
+QDEF(MP_QSTR_StopAsyncIteration, 61676, 18, "StopAsyncIteration")
+QDEF(MP_QSTR_TimeoutError, 19302, 12, "TimeoutError")
+QDEF(MP_QSTR_True, 5907, 4, "True")
+QDEF(MP_QSTR_UnicodeError, 53538, 12, "UnicodeError")
+QDEF(MP_QSTR_ViperTypeError, 1501, 14, "ViperTypeError")
+QDEF(MP_QSTR___aenter__, 33868, 10, "__aenter__")
+QDEF(MP_QSTR___aexit__, 53188, 9, "__aexit__")
+QDEF(MP_QSTR___aiter__, 11086, 9, "__aiter__")
+QDEF(MP_QSTR___anext__, 46211, 9, "__anext__")
+QDEF(MP_QSTR___await__, 64079, 9, "__await__")
+QDEF(MP_QSTR___bases__, 12291, 9, "__bases__")
+QDEF(MP_QSTR___build_class__, 34882, 15, "__build_class__")
+QDEF(MP_QSTR___bytes__, 33244, 9, "__bytes__")
+QDEF(MP_QSTR___context__, 26234, 11, "__context__")
+QDEF(MP_QSTR___dict__, 21631, 8, "__dict__")
+QDEF(MP_QSTR___import__, 15928, 10, "__import__")
+QDEF(MP_QSTR___path__, 9160, 8, "__path__")
+QDEF(MP_QSTR___repl_print__, 47872, 14, "__repl_print__")
+QDEF(MP_QSTR___reversed__, 65377, 12, "__reversed__")
+QDEF(MP_QSTR___traceback__, 53071, 13, "__traceback__")
+QDEF(MP_QSTR_add, 12868, 3, "add")
+QDEF(MP_QSTR_addi, 31405, 4, "addi")
+QDEF(MP_QSTR_align, 64424, 5, "align")
+QDEF(MP_QSTR_and_, 38033, 4, "and_")
+QDEF(MP_QSTR_asm_thumb, 27971, 9, "asm_thumb")
+QDEF(MP_QSTR_asm_xtensa, 4784, 10, "asm_xtensa")
+QDEF(MP_QSTR_asr, 13669, 3, "asr")
+QDEF(MP_QSTR_b, 46535, 1, "b")
+QDEF(MP_QSTR_ball, 17734, 4, "ball")
+QDEF(MP_QSTR_bany, 17553, 4, "bany")
+QDEF(MP_QSTR_base, 18160, 4, "base")
+QDEF(MP_QSTR_bbc, 18182, 3, "bbc")
+QDEF(MP_QSTR_bbs, 18198, 3, "bbs")
+QDEF(MP_QSTR_beq, 18291, 3, "beq")
+QDEF(MP_QSTR_beqz, 13737, 4, "beqz")
+QDEF(MP_QSTR_bge, 18085, 3, "bge")
+QDEF(MP_QSTR_bgeu, 6960, 4, "bgeu")
+QDEF(MP_QSTR_big, 18665, 3, "big")
+QDEF(MP_QSTR_bin, 18656, 3, "bin")
+QDEF(MP_QSTR_bit_length, 6841, 10, "bit_length")
+QDEF(MP_QSTR_bl, 28363, 2, "bl")
+QDEF(MP_QSTR_blt, 18527, 3, "blt")
+QDEF(MP_QSTR_bnall, 21768, 5, "bnall")
+QDEF(MP_QSTR_bne, 18316, 3, "bne")
+QDEF(MP_QSTR_bnez, 14710, 4, "bnez")
+QDEF(MP_QSTR_bnone, 15693, 5, "bnone")
+QDEF(MP_QSTR_bound_method, 41623, 12, "bound_method")
+QDEF(MP_QSTR_bx, 28383, 2, "bx")
+QDEF(MP_QSTR_byteorder, 39265, 9, "byteorder")
+QDEF(MP_QSTR_calcsize, 14413, 8, "calcsize")
+QDEF(MP_QSTR_callx0, 46639, 6, "callx0")
+QDEF(MP_QSTR_closure, 51828, 7, "closure")
+QDEF(MP_QSTR_clz, 19536, 3, "clz")
+QDEF(MP_QSTR_cmp, 19515, 3, "cmp")
+QDEF(MP_QSTR_complex, 40389, 7, "complex")
+QDEF(MP_QSTR_coroutine, 32279, 9, "coroutine")
+QDEF(MP_QSTR_cpsid, 51176, 5, "cpsid")
+QDEF(MP_QSTR_cpsie, 51177, 5, "cpsie")
+QDEF(MP_QSTR_data, 56341, 4, "data")
+QDEF(MP_QSTR_decode, 22953, 6, "decode")
+QDEF(MP_QSTR_default, 32206, 7, "default")
+QDEF(MP_QSTR_delattr, 51419, 7, "delattr")
+QDEF(MP_QSTR_deleter, 56174, 7, "deleter")
+QDEF(MP_QSTR_dict_view, 43309, 9, "dict_view")
+QDEF(MP_QSTR_difference, 9330, 10, "difference")
+QDEF(MP_QSTR_difference_update, 64156, 17, "difference_update")
+QDEF(MP_QSTR_discard, 28943, 7, "discard")
+QDEF(MP_QSTR_doc, 7981, 3, "doc")
+QDEF(MP_QSTR_encode, 51779, 6, "encode")
+QDEF(MP_QSTR_enumerate, 47729, 9, "enumerate")
+QDEF(MP_QSTR_errno, 4545, 5, "errno")
+QDEF(MP_QSTR_filename, 21732, 8, "filename")
+QDEF(MP_QSTR_filename2, 61782, 9, "filename2")
+QDEF(MP_QSTR_filter, 48677, 6, "filter")
+QDEF(MP_QSTR_float, 17461, 5, "float")
+QDEF(MP_QSTR_flush, 49505, 5, "flush")
+QDEF(MP_QSTR_fromkeys, 48439, 8, "fromkeys")
+QDEF(MP_QSTR_function, 551, 8, "function")
+QDEF(MP_QSTR_generator, 50070, 9, "generator")
+QDEF(MP_QSTR_getter, 45712, 6, "getter")
+QDEF(MP_QSTR_hex, 20592, 3, "hex")
+QDEF(MP_QSTR_imag, 46919, 4, "imag")
+QDEF(MP_QSTR_intersection, 10792, 12, "intersection")
+QDEF(MP_QSTR_intersection_update, 56582, 19, "intersection_update")
+QDEF(MP_QSTR_isdisjoint, 26871, 10, "isdisjoint")
+QDEF(MP_QSTR_issubset, 49593, 8, "issubset")
+QDEF(MP_QSTR_issuperset, 60668, 10, "issuperset")
+QDEF(MP_QSTR_iterable, 37413, 8, "iterable")
+QDEF(MP_QSTR_iterator, 48711, 8, "iterator")
+QDEF(MP_QSTR_j, 46543, 1, "j")
+QDEF(MP_QSTR_jx, 28631, 2, "jx")
+QDEF(MP_QSTR_l16si, 33556, 5, "l16si")
+QDEF(MP_QSTR_l16ui, 33618, 5, "l16ui")
+QDEF(MP_QSTR_l32i, 36673, 4, "l32i")
+QDEF(MP_QSTR_l8ui, 22893, 4, "l8ui")
+QDEF(MP_QSTR_label, 59203, 5, "label")
+QDEF(MP_QSTR_ldr, 16479, 3, "ldr")
+QDEF(MP_QSTR_ldrb, 19549, 4, "ldrb")
+QDEF(MP_QSTR_ldrex, 55266, 5, "ldrex")
+QDEF(MP_QSTR_ldrh, 19543, 4, "ldrh")
+QDEF(MP_QSTR_length, 34649, 6, "length")
+QDEF(MP_QSTR_lsl, 16822, 3, "lsl")
+QDEF(MP_QSTR_lsr, 16808, 3, "lsr")
+QDEF(MP_QSTR_max, 17329, 3, "max")
+QDEF(MP_QSTR_min, 17071, 3, "min")
+QDEF(MP_QSTR_module, 39359, 6, "module")
+QDEF(MP_QSTR_mov, 17393, 3, "mov")
+QDEF(MP_QSTR_mov_n, 3168, 5, "mov_n")
+QDEF(MP_QSTR_movi, 49784, 4, "movi")
+QDEF(MP_QSTR_movt, 49765, 4, "movt")
+QDEF(MP_QSTR_movw, 49766, 4, "movw")
+QDEF(MP_QSTR_movwt, 3922, 5, "movwt")
+QDEF(MP_QSTR_mrs, 17801, 3, "mrs")
+QDEF(MP_QSTR_mull, 3133, 4, "mull")
+QDEF(MP_QSTR_native, 2948, 6, "native")
+QDEF(MP_QSTR_nop, 22452, 3, "nop")
+QDEF(MP_QSTR_oct, 23805, 3, "oct")
+QDEF(MP_QSTR_or_, 24103, 3, "or_")
+QDEF(MP_QSTR_pack, 53692, 4, "pack")
+QDEF(MP_QSTR_pack_into, 43295, 9, "pack_into")
+QDEF(MP_QSTR_pend_throw, 29939, 10, "pend_throw")
+QDEF(MP_QSTR_property, 10690, 8, "property")
+QDEF(MP_QSTR_ptr, 28755, 3, "ptr")
+QDEF(MP_QSTR_ptr16, 51956, 5, "ptr16")
+QDEF(MP_QSTR_ptr32, 51890, 5, "ptr32")
+QDEF(MP_QSTR_ptr8, 31371, 4, "ptr8")
+QDEF(MP_QSTR_push, 32443, 4, "push")
+QDEF(MP_QSTR_rbit, 61160, 4, "rbit")
+QDEF(MP_QSTR_real, 63935, 4, "real")
+QDEF(MP_QSTR_ret_n, 2039, 5, "ret_n")
+QDEF(MP_QSTR_reversed, 28321, 8, "reversed")
+QDEF(MP_QSTR_s16i, 15288, 4, "s16i")
+QDEF(MP_QSTR_s32i, 13374, 4, "s32i")
+QDEF(MP_QSTR_s8i, 34311, 3, "s8i")
+QDEF(MP_QSTR_sdiv, 31437, 4, "sdiv")
+QDEF(MP_QSTR_setter, 22788, 6, "setter")
+QDEF(MP_QSTR_signed, 311, 6, "signed")
+QDEF(MP_QSTR_slice, 62645, 5, "slice")
+QDEF(MP_QSTR_strb, 14130, 4, "strb")
+QDEF(MP_QSTR_strerror, 29000, 8, "strerror")
+QDEF(MP_QSTR_strex, 7597, 5, "strex")
+QDEF(MP_QSTR_strh, 14136, 4, "strh")
+QDEF(MP_QSTR_struct, 36882, 6, "struct")
+QDEF(MP_QSTR_sub, 36129, 3, "sub")
+QDEF(MP_QSTR_symmetric_difference, 26574, 20, "symmetric_difference")
+QDEF(MP_QSTR_symmetric_difference_update, 63584, 27, "symmetric_difference_update")
+QDEF(MP_QSTR_traceback, 45775, 9, "traceback")
+QDEF(MP_QSTR_udiv, 12683, 4, "udiv")
+QDEF(MP_QSTR_uint, 15843, 4, "uint")
+QDEF(MP_QSTR_union, 31990, 5, "union")
+QDEF(MP_QSTR_unpack, 15367, 6, "unpack")
+QDEF(MP_QSTR_unpack_from, 27918, 11, "unpack_from")
+QDEF(MP_QSTR_vcmp, 49581, 4, "vcmp")
+QDEF(MP_QSTR_vcvt_f32_s32, 51527, 12, "vcvt_f32_s32")
+QDEF(MP_QSTR_vcvt_s32_f32, 13063, 12, "vcvt_s32_f32")
+QDEF(MP_QSTR_viper, 9053, 5, "viper")
+QDEF(MP_QSTR_vldr, 1993, 4, "vldr")
+QDEF(MP_QSTR_vmov, 2791, 4, "vmov")
+QDEF(MP_QSTR_vmrs, 2463, 4, "vmrs")
+QDEF(MP_QSTR_vneg, 61183, 4, "vneg")
+QDEF(MP_QSTR_vsqrt, 17143, 5, "vsqrt")
+QDEF(MP_QSTR_vstr, 32454, 4, "vstr")
+QDEF(MP_QSTR_wfi, 32413, 3, "wfi")
+QDEF(MP_QSTR_xor, 37664, 3, "xor")
+// Enumerate translated texts but don't actually include translations. Instead, the linker will link them in.
+TRANSLATION("  File \"%q\", line %d", 0)
+TRANSLATION("%%c requires int or char", 1)
+TRANSLATION("%q in %q must be of type %q, not %q", 2)
+TRANSLATION("%q index out of range", 3)
+TRANSLATION("%q indices must be integers, not %s", 4)
+TRANSLATION("%q length must be %d", 5)
+TRANSLATION("%q length must be %d-%d", 6)
+TRANSLATION("%q length must be <= %d", 7)
+TRANSLATION("%q length must be >= %d", 8)
+TRANSLATION("%q must be %d", 9)
+TRANSLATION("%q must be %d-%d", 10)
+TRANSLATION("%q must be <= %d", 11)
+TRANSLATION("%q must be >= %d", 12)
+TRANSLATION("%q must be of type %q or %q, not %q", 13)
+TRANSLATION("%q must be of type %q, not %q", 14)
+TRANSLATION("%q out of range", 15)
+TRANSLATION("%q step cannot be zero", 16)
+TRANSLATION("%q() takes %d positional arguments but %d were given", 17)
+TRANSLATION("%q=%q", 18)
+TRANSLATION("%s", 19)
+TRANSLATION("'%q' argument required", 20)
+TRANSLATION("'%q' object does not support '%q'", 21)
+TRANSLATION("'%q' object is not an iterator", 22)
+TRANSLATION("'%q' object is not callable", 23)
+TRANSLATION("'%q' object is not iterable", 24)
+TRANSLATION("'%s' expects a label", 25)
+TRANSLATION("'%s' expects a register", 26)
+TRANSLATION("'%s' expects a special register", 27)
+TRANSLATION("'%s' expects an FPU register", 28)
+TRANSLATION("'%s' expects an address of the form [a, b]", 29)
+TRANSLATION("'%s' expects an integer", 30)
+TRANSLATION("'%s' expects at most r%d", 31)
+TRANSLATION("'%s' expects {r0, r1, ...}", 32)
+TRANSLATION("'%s' integer %d isn't within range %d..%d", 33)
+TRANSLATION("'%s' integer 0x%x doesn't fit in mask 0x%x", 34)
+TRANSLATION("'%s' object doesn't support item assignment", 35)
+TRANSLATION("'%s' object doesn't support item deletion", 36)
+TRANSLATION("'%s' object has no attribute '%q'", 37)
+TRANSLATION("'%s' object isn't subscriptable", 38)
+TRANSLATION("'=' alignment not allowed in string format specifier", 39)
+TRANSLATION("'align' requires 1 argument", 40)
+TRANSLATION("'await' outside function", 41)
+TRANSLATION("'break'/'continue' outside loop", 42)
+TRANSLATION("'data' requires at least 2 arguments", 43)
+TRANSLATION("'data' requires integer arguments", 44)
+TRANSLATION("'label' requires 1 argument", 45)
+TRANSLATION("'return' outside function", 46)
+TRANSLATION("'yield from' inside async function", 47)
+TRANSLATION("'yield' outside function", 48)
+TRANSLATION("* arg after **", 49)
+TRANSLATION("*x must be assignment target", 50)
+TRANSLATION(", in %q\n", 51)
+TRANSLATION("0.0 to a complex power", 52)
+TRANSLATION("3-arg pow() not supported", 53)
+TRANSLATION("Call super().__init__() before accessing native object.", 54)
+TRANSLATION("Invalid %q", 55)
+TRANSLATION("LHS of keyword arg must be an id", 56)
+TRANSLATION("Name too long", 57)
+TRANSLATION("Traceback (most recent call last):\n", 58)
+TRANSLATION("Unable to init parser", 59)
+TRANSLATION("__init__() should return None, not '%s'", 60)
+TRANSLATION("__new__ arg must be a user-type", 61)
+TRANSLATION("a bytes-like object is required", 62)
+TRANSLATION("abort() called", 63)
+TRANSLATION("annotation must be an identifier", 64)
+TRANSLATION("arg is an empty sequence", 65)
+TRANSLATION("argument name reused", 66)
+TRANSLATION("asm overflow", 67)
+TRANSLATION("async for/with outside async function", 68)
+TRANSLATION("attributes not supported", 69)
+TRANSLATION("bad typecode", 70)
+TRANSLATION("binary op %q not implemented", 71)
+TRANSLATION("branch not in range", 72)
+TRANSLATION("buffer too small", 73)
+TRANSLATION("bytecode overflow", 74)
+TRANSLATION("bytes length not a multiple of item size", 75)
+TRANSLATION("bytes value out of range", 76)
+TRANSLATION("can only have up to 4 parameters to Thumb assembly", 77)
+TRANSLATION("can only have up to 4 parameters to Xtensa assembly", 78)
+TRANSLATION("can't add special method to already-subclassed class", 79)
+TRANSLATION("can't assign to expression", 80)
+TRANSLATION("can't convert %s to complex", 81)
+TRANSLATION("can't convert %s to float", 82)
+TRANSLATION("can't convert %s to int", 83)
+TRANSLATION("can't convert '%q' object to %q implicitly", 84)
+TRANSLATION("can't declare nonlocal in outer code", 85)
+TRANSLATION("can't delete expression", 86)
+TRANSLATION("can't do binary op between '%q' and '%q'", 87)
+TRANSLATION("can't implicitly convert '%q' to 'bool'", 88)
+TRANSLATION("can't import name %q", 89)
+TRANSLATION("can't load from '%q'", 90)
+TRANSLATION("can't load with '%q' index", 91)
+TRANSLATION("can't perform relative import", 92)
+TRANSLATION("can't send non-None value to a just-started generator", 93)
+TRANSLATION("can't set attribute", 94)
+TRANSLATION("can't set attribute '%q'", 95)
+TRANSLATION("can't store '%q'", 96)
+TRANSLATION("can't store to '%q'", 97)
+TRANSLATION("can't store with '%q' index", 98)
+TRANSLATION("can't switch from automatic field numbering to manual field specification", 99)
+TRANSLATION("can't switch from manual field specification to automatic field numbering", 100)
+TRANSLATION("can't truncate-divide a complex number", 101)
+TRANSLATION("cannot create '%q' instances", 102)
+TRANSLATION("casting", 103)
+TRANSLATION("chr() arg not in range(0x110000)", 104)
+TRANSLATION("comparison of int and uint", 105)
+TRANSLATION("complex divide by zero", 106)
+TRANSLATION("conversion to object", 107)
+TRANSLATION("default 'except' must be last", 108)
+TRANSLATION("dict update sequence has wrong length", 109)
+TRANSLATION("div/mod not implemented for uint", 110)
+TRANSLATION("division by zero", 111)
+TRANSLATION("empty separator", 112)
+TRANSLATION("end of format while looking for conversion specifier", 113)
+TRANSLATION("exceptions must derive from BaseException", 114)
+TRANSLATION("expected ':' after format specifier", 115)
+TRANSLATION("expecting an assembler instruction", 116)
+TRANSLATION("expecting just a value for set", 117)
+TRANSLATION("expecting key:value for dict", 118)
+TRANSLATION("extra keyword arguments given", 119)
+TRANSLATION("extra positional arguments given", 120)
+TRANSLATION("first argument to super() must be type", 121)
+TRANSLATION("format requires a dict", 122)
+TRANSLATION("function doesn't take keyword arguments", 123)
+TRANSLATION("function expected at most %d arguments, got %d", 124)
+TRANSLATION("function got multiple values for argument '%q'", 125)
+TRANSLATION("function missing %d required positional arguments", 126)
+TRANSLATION("function missing keyword-only argument", 127)
+TRANSLATION("function missing required keyword argument '%q'", 128)
+TRANSLATION("function missing required positional argument #%d", 129)
+TRANSLATION("function takes %d positional arguments but %d were given", 130)
+TRANSLATION("generator already executing", 131)
+TRANSLATION("generator ignored GeneratorExit", 132)
+TRANSLATION("generator raised StopIteration", 133)
+TRANSLATION("identifier redefined as global", 134)
+TRANSLATION("identifier redefined as nonlocal", 135)
+TRANSLATION("import * not at module level", 136)
+TRANSLATION("incomplete format", 137)
+TRANSLATION("incomplete format key", 138)
+TRANSLATION("inline assembler must be a function", 139)
+TRANSLATION("invalid arch", 140)
+TRANSLATION("invalid format specifier", 141)
+TRANSLATION("invalid micropython decorator", 142)
+TRANSLATION("invalid syntax", 143)
+TRANSLATION("invalid syntax for number", 144)
+TRANSLATION("issubclass() arg 1 must be a class", 145)
+TRANSLATION("issubclass() arg 2 must be a class or a tuple of classes", 146)
+TRANSLATION("join expects a list of str/bytes objects consistent with self object", 147)
+TRANSLATION("keyword argument(s) not implemented - use normal args instead", 148)
+TRANSLATION("label '%q' not defined", 149)
+TRANSLATION("label redefined", 150)
+TRANSLATION("local '%q' has type '%q' but source is '%q'", 151)
+TRANSLATION("local '%q' used before type known", 152)
+TRANSLATION("local variable referenced before assignment", 153)
+TRANSLATION("malformed f-string", 154)
+TRANSLATION("maximum recursion depth exceeded", 155)
+TRANSLATION("memory allocation failed, allocating %u bytes", 156)
+TRANSLATION("memory allocation failed, heap is locked", 157)
+TRANSLATION("multiple *x in assignment", 158)
+TRANSLATION("multiple bases have instance lay-out conflict", 159)
+TRANSLATION("must raise an object", 160)
+TRANSLATION("must use keyword argument for key function", 161)
+TRANSLATION("name '%q' is not defined", 162)
+TRANSLATION("native method too big", 163)
+TRANSLATION("native yield", 164)
+TRANSLATION("need more than %d values to unpack", 165)
+TRANSLATION("negative shift count", 166)
+TRANSLATION("no active exception to reraise", 167)
+TRANSLATION("no binding for nonlocal found", 168)
+TRANSLATION("no module named '%q'", 169)
+TRANSLATION("non-default argument follows default argument", 170)
+TRANSLATION("not a constant", 171)
+TRANSLATION("not all arguments converted during string formatting", 172)
+TRANSLATION("not enough arguments for format string", 173)
+TRANSLATION("object '%s' isn't a tuple or list", 174)
+TRANSLATION("object not in sequence", 175)
+TRANSLATION("object of type '%s' has no len()", 176)
+TRANSLATION("object with buffer protocol required", 177)
+TRANSLATION("only slices with step=1 (aka None) are supported", 178)
+TRANSLATION("opcode", 179)
+TRANSLATION("ord() expected a character, but string of length %d found", 180)
+TRANSLATION("overflow converting long int to machine word", 181)
+TRANSLATION("pack expected %d items for packing (got %d)", 182)
+TRANSLATION("parameters must be registers in sequence a2 to a5", 183)
+TRANSLATION("parameters must be registers in sequence r0 to r3", 184)
+TRANSLATION("pop from empty %q", 185)
+TRANSLATION("positional arg after **", 186)
+TRANSLATION("positional arg after keyword arg", 187)
+TRANSLATION("raw f-strings are not supported", 188)
+TRANSLATION("requested length %d but object has length %d", 189)
+TRANSLATION("return annotation must be an identifier", 190)
+TRANSLATION("return expected '%q' but got '%q'", 191)
+TRANSLATION("rsplit(None,n)", 192)
+TRANSLATION("sign not allowed in string format specifier", 193)
+TRANSLATION("sign not allowed with integer format specifier 'c'", 194)
+TRANSLATION("small int overflow", 195)
+TRANSLATION("start/end indices", 196)
+TRANSLATION("stream operation not supported", 197)
+TRANSLATION("string argument without an encoding", 198)
+TRANSLATION("string index out of range", 199)
+TRANSLATION("string indices must be integers, not %s", 200)
+TRANSLATION("substring not found", 201)
+TRANSLATION("super() can't find self", 202)
+TRANSLATION("too many args", 203)
+TRANSLATION("too many locals for native method", 204)
+TRANSLATION("too many values to unpack (expected %d)", 205)
+TRANSLATION("type '%q' is not an acceptable base type", 206)
+TRANSLATION("type object '%q' has no attribute '%q'", 207)
+TRANSLATION("type takes 1 or 3 arguments", 208)
+TRANSLATION("unary op %q not implemented", 209)
+TRANSLATION("unexpected indent", 210)
+TRANSLATION("unexpected keyword argument '%q'", 211)
+TRANSLATION("unicode name escapes", 212)
+TRANSLATION("unindent doesn't match any outer indent level", 213)
+TRANSLATION("unknown conversion specifier %c", 214)
+TRANSLATION("unknown format code '%c' for object of type '%q'", 215)
+TRANSLATION("unknown type", 216)
+TRANSLATION("unknown type '%q'", 217)
+TRANSLATION("unmatched '%c' in format", 218)
+TRANSLATION("unreadable attribute", 219)
+TRANSLATION("unsupported Thumb instruction '%s' with %d arguments", 220)
+TRANSLATION("unsupported Xtensa instruction '%s' with %d arguments", 221)
+TRANSLATION("unsupported format character '%c' (0x%x) at index %d", 222)
+TRANSLATION("unsupported type for %q: '%s'", 223)
+TRANSLATION("unsupported types for %q: '%q', '%q'", 224)
+TRANSLATION("value must fit in %d byte(s)", 225)
+TRANSLATION("wrong number of arguments", 226)
+
+// 2378 bytes worth of qstr
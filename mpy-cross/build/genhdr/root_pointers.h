@@ -0,0 +1,3 @@
+// Automatically generated by make_root_pointers.py.
+
+mp_obj_t track_reloc_code_list;
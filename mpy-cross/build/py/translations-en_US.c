@@ -0,0 +1,234 @@
+// This file was automatically generated by maketranslatedata.py
+#include "supervisor/shared/translate/compressed_string.h"
+
+const struct compressed_string translation0 = { .data = 40, .tail = { 7, 251, 37, 204, 127, 118, 221, 127, 119, 192, 186, 41, 141, 172 } }; //   File \"%q\", line %d
+const struct compressed_string translation1 = { .data = 49, .tail = { 182, 213, 14, 125, 105, 28, 224, 34, 200, 103, 21, 236, 78 } }; // %%c requires int or char
+const struct compressed_string translation2 = { .data = 71, .tail = { 183, 65, 20, 109, 208, 198, 162, 70, 230, 27, 129, 62, 178, 99, 110, 190, 2, 180, 141, 186 } }; // %q in %q must be of type %q, not %q
+const struct compressed_string translation3 = { .data = 43, .tail = { 183, 65, 22, 199, 228, 54, 164, 55, 1, 201, 121, 48 } }; // %q index out of range
+const struct compressed_string translation4 = { .data = 71, .tail = { 183, 65, 22, 201, 83, 129, 141, 68, 141, 204, 34, 201, 242, 111, 31, 1, 90, 70, 208 } }; // %q indices must be integers, not %s
+const struct compressed_string translation5 = { .data = 41, .tail = { 183, 66, 230, 188, 207, 97, 141, 68, 141, 204, 109, 96 } }; // %q length must be %d
+const struct compressed_string translation6 = { .data = 47, .tail = { 183, 66, 230, 188, 207, 97, 141, 68, 141, 204, 109, 111, 182, 214 } }; // %q length must be %d-%d
+const struct compressed_string translation7 = { .data = 47, .tail = { 183, 66, 230, 188, 207, 97, 141, 68, 141, 204, 127, 151, 238, 54, 176 } }; // %q length must be <= %d
+const struct compressed_string translation8 = { .data = 47, .tail = { 183, 66, 230, 188, 207, 97, 141, 68, 141, 204, 127, 159, 238, 54, 176 } }; // %q length must be >= %d
+const struct compressed_string translation9 = { .data = 27, .tail = { 183, 67, 26, 137, 27, 152, 218, 192 } }; // %q must be %d
+const struct compressed_string translation10 = { .data = 33, .tail = { 183, 67, 26, 137, 27, 152, 218, 223, 109, 172 } }; // %q must be %d-%d
+const struct compressed_string translation11 = { .data = 33, .tail = { 183, 67, 26, 137, 27, 152, 255, 47, 220, 109, 96 } }; // %q must be <= %d
+const struct compressed_string translation12 = { .data = 33, .tail = { 183, 67, 26, 137, 27, 152, 255, 63, 220, 109, 96 } }; // %q must be >= %d
+const struct compressed_string translation13 = { .data = 71, .tail = { 183, 67, 26, 137, 27, 152, 110, 4, 250, 201, 141, 186, 12, 227, 110, 190, 2, 180, 141, 186 } }; // %q must be of type %q or %q, not %q
+const struct compressed_string translation14 = { .data = 59, .tail = { 183, 67, 26, 137, 27, 152, 110, 4, 250, 201, 141, 186, 248, 10, 210, 54, 232 } }; // %q must be of type %q, not %q
+const struct compressed_string translation15 = { .data = 31, .tail = { 183, 65, 181, 33, 184, 14, 75, 201, 128 } }; // %q out of range
+const struct compressed_string translation16 = { .data = 45, .tail = { 183, 66, 36, 242, 42, 74, 173, 35, 115, 31, 212, 221, 128 } }; // %q step cannot be zero
+const struct compressed_string translation17 = { .data = 105, .tail = { 183, 94, 222, 226, 75, 232, 224, 109, 97, 150, 132, 148, 101, 43, 130, 126, 117, 131, 89, 129, 190, 164, 109, 97, 224, 220, 199, 41, 220, 212 } }; // %q() takes %d positional arguments but %d were given
+const struct compressed_string translation18 = { .data = 11, .tail = { 183, 95, 190, 221, 0 } }; // %q=%q
+const struct compressed_string translation19 = { .data = 5, .tail = { 180, 0 } }; // %s
+const struct compressed_string translation20 = { .data = 45, .tail = { 77, 186, 160, 39, 231, 88, 53, 144, 231, 214, 145, 206, 192 } }; // '%q' argument required
+const struct compressed_string translation21 = { .data = 67, .tail = { 77, 186, 160, 109, 254, 78, 178, 44, 199, 1, 90, 68, 107, 57, 103, 145, 77, 186, 160 } }; // '%q' object does not support '%q'
+const struct compressed_string translation22 = { .data = 61, .tail = { 77, 186, 160, 109, 254, 78, 178, 18, 2, 180, 130, 80, 146, 110, 82, 206 } }; // '%q' object is not an iterator
+const struct compressed_string translation23 = { .data = 55, .tail = { 77, 186, 160, 109, 254, 78, 178, 18, 2, 180, 138, 149, 238, 91, 220, 192 } }; // '%q' object is not callable
+const struct compressed_string translation24 = { .data = 55, .tail = { 77, 186, 160, 109, 254, 78, 178, 18, 2, 180, 132, 147, 114, 222, 230 } }; // '%q' object is not iterable
+const struct compressed_string translation25 = { .data = 41, .tail = { 77, 162, 128, 252, 228, 235, 48, 8, 92, 183, 59, 128 } }; // '%s' expects a label
+const struct compressed_string translation26 = { .data = 47, .tail = { 77, 162, 128, 252, 228, 235, 48, 8, 57, 242, 145, 38, 224 } }; // '%s' expects a register
+const struct compressed_string translation27 = { .data = 63, .tail = { 77, 162, 128, 252, 228, 235, 48, 8, 70, 78, 168, 87, 14, 124, 164, 73, 184 } }; // '%s' expects a special register
+const struct compressed_string translation28 = { .data = 57, .tail = { 77, 162, 128, 252, 228, 235, 48, 9, 71, 251, 127, 239, 254, 131, 159, 41, 18, 110 } }; // '%s' expects an FPU register
+const struct compressed_string translation29 = { .data = 85, .tail = { 77, 162, 128, 252, 228, 235, 48, 9, 65, 90, 206, 113, 1, 184, 19, 216, 199, 12, 248, 31, 252, 47, 129, 191, 255, 64 } }; // '%s' expects an address of the form [a, b]
+const struct compressed_string translation30 = { .data = 47, .tail = { 77, 162, 128, 252, 228, 235, 48, 9, 66, 44, 159, 38, 224 } }; // '%s' expects an integer
+const struct compressed_string translation31 = { .data = 49, .tail = { 77, 162, 128, 252, 228, 235, 48, 10, 70, 26, 36, 62, 214 } }; // '%s' expects at most r%d
+const struct compressed_string translation32 = { .data = 53, .tail = { 77, 162, 128, 252, 228, 235, 48, 63, 252, 255, 127, 128, 255, 175, 192, 252, 255, 63, 207, 255, 224 } }; // '%s' expects {r0, r1, ...}
+const struct compressed_string translation33 = { .data = 83, .tail = { 77, 162, 129, 22, 79, 147, 113, 181, 130, 66, 210, 71, 132, 158, 200, 161, 201, 121, 49, 181, 191, 63, 207, 107, 0 } }; // '%s' integer %d isn't within range %d..%d
+const struct compressed_string translation34 = { .data = 85, .tail = { 77, 162, 129, 22, 79, 147, 113, 247, 243, 183, 145, 102, 56, 90, 72, 225, 36, 34, 140, 20, 125, 15, 191, 157, 188, 128 } }; // '%s' integer 0x%x doesn't fit in mask 0x%x
+const struct compressed_string translation35 = { .data = 87, .tail = { 77, 162, 129, 183, 249, 58, 200, 179, 28, 45, 36, 70, 179, 150, 121, 9, 39, 128, 81, 9, 202, 224, 214, 64 } }; // '%s' object doesn't support item assignment
+const struct compressed_string translation36 = { .data = 83, .tail = { 77, 162, 129, 183, 249, 58, 200, 179, 28, 45, 36, 70, 179, 150, 121, 9, 39, 129, 99, 185, 202, 50, 128 } }; // '%s' object doesn't support item deletion
+const struct compressed_string translation37 = { .data = 67, .tail = { 77, 162, 129, 183, 249, 58, 200, 236, 80, 21, 129, 76, 186, 111, 169, 49, 77, 186, 160 } }; // '%s' object has no attribute '%q'
+const struct compressed_string translation38 = { .data = 63, .tail = { 77, 162, 129, 183, 249, 58, 200, 72, 90, 72, 141, 111, 21, 116, 204, 150, 247, 48 } }; // '%s' object isn't subscriptable
+const struct compressed_string translation39 = { .data = 105, .tail = { 79, 222, 128, 174, 156, 174, 13, 100, 43, 72, 43, 221, 188, 29, 130, 40, 137, 116, 94, 71, 12, 248, 41, 17, 147, 170, 112, 134, 224 } }; // '=' alignment not allowed in string format specifier
+const struct compressed_string translation40 = { .data = 55, .tail = { 66, 186, 114, 180, 14, 125, 105, 28, 224, 126, 160, 159, 157, 96, 214, 64 } }; // 'align' requires 1 argument
+const struct compressed_string translation41 = { .data = 49, .tail = { 66, 240, 73, 52, 13, 169, 132, 177, 142, 52, 181, 148, 101 } }; // 'await' outside function
+const struct compressed_string translation42 = { .data = 63, .tail = { 77, 220, 203, 234, 159, 165, 42, 203, 40, 186, 58, 6, 212, 194, 88, 197, 217, 178 } }; // 'break'/'continue' outside loop
+const struct compressed_string translation43 = { .data = 73, .tail = { 75, 20, 149, 3, 159, 90, 71, 56, 5, 34, 230, 81, 35, 249, 2, 126, 117, 131, 89, 128 } }; // 'data' requires at least 2 arguments
+const struct compressed_string translation44 = { .data = 67, .tail = { 75, 20, 149, 3, 159, 90, 71, 56, 8, 178, 124, 155, 130, 126, 117, 131, 89, 128 } }; // 'data' requires integer arguments
+const struct compressed_string translation45 = { .data = 55, .tail = { 75, 150, 231, 122, 7, 62, 180, 142, 112, 63, 80, 79, 206, 176, 107, 32 } }; // 'label' requires 1 argument
+const struct compressed_string translation46 = { .data = 51, .tail = { 71, 57, 211, 173, 3, 106, 97, 44, 99, 141, 45, 101, 25, 64 } }; // 'return' outside function
+const struct compressed_string translation47 = { .data = 69, .tail = { 79, 72, 119, 176, 225, 219, 20, 8, 176, 150, 48, 81, 233, 106, 56, 210, 214, 81, 148 } }; // 'yield from' inside async function
+const struct compressed_string translation48 = { .data = 49, .tail = { 79, 72, 119, 181, 3, 106, 97, 44, 99, 141, 45, 101, 25, 64 } }; // 'yield' outside function
+const struct compressed_string translation49 = { .data = 29, .tail = { 249, 2, 126, 65, 113, 38, 227, 242, 252, 128 } }; // * arg after **
+const struct compressed_string translation50 = { .data = 57, .tail = { 249, 121, 24, 212, 72, 220, 193, 68, 39, 43, 131, 89, 18, 79, 201, 200 } }; // *x must be assignment target
+const struct compressed_string translation51 = { .data = 19, .tail = { 240, 17, 70, 221, 127, 111, 246, 0 } }; // , in %q\n
+const struct compressed_string translation52 = { .data = 45, .tail = { 247, 252, 254, 226, 88, 16, 171, 99, 55, 63, 35, 45, 224, 220 } }; // 0.0 to a complex power
+const struct compressed_string translation53 = { .data = 51, .tail = { 252, 254, 196, 252, 140, 183, 143, 111, 112, 173, 34, 53, 156, 179, 201, 216 } }; // 3-arg pow() not supported
+const struct compressed_string translation54 = { .data = 111, .tail = { 255, 130, 189, 196, 107, 38, 254, 222, 255, 159, 227, 240, 138, 147, 248, 252, 123, 123, 141, 207, 134, 115, 5, 90, 156, 66, 47, 33, 74, 83, 185, 134, 223, 228, 235, 63, 152 } }; // Call super().__init__() before accessing native object.
+const struct compressed_string translation55 = { .data = 21, .tail = { 255, 11, 220, 174, 150, 27, 116 } }; // Invalid %q
+const struct compressed_string translation56 = { .data = 65, .tail = { 255, 175, 252, 255, 200, 110, 7, 209, 250, 240, 207, 96, 79, 200, 198, 162, 70, 230, 9, 66, 88 } }; // LHS of keyword arg must be an id
+const struct compressed_string translation57 = { .data = 27, .tail = { 252, 22, 12, 75, 48, 187, 47, 32 } }; // Name too long
+const struct compressed_string translation58 = { .data = 73, .tail = { 253, 28, 170, 123, 149, 126, 135, 182, 26, 36, 57, 212, 214, 69, 74, 247, 23, 40, 159, 127, 219, 251, 127, 176 } }; // Traceback (most recent call last):\n
+const struct compressed_string translation59 = { .data = 43, .tail = { 255, 74, 91, 220, 196, 176, 69, 73, 25, 39, 131, 112 } }; // Unable to init parser
+const struct compressed_string translation60 = { .data = 79, .tail = { 248, 252, 34, 164, 254, 63, 30, 222, 226, 59, 54, 175, 96, 231, 58, 117, 31, 195, 41, 252, 5, 105, 20, 218, 40 } }; // __init__() should return None, not '%s'
+const struct compressed_string translation61 = { .data = 63, .tail = { 248, 252, 41, 248, 252, 126, 1, 63, 35, 26, 137, 27, 152, 33, 168, 55, 251, 79, 172, 152 } }; // __new__ arg must be a user-type
+const struct compressed_string translation62 = { .data = 62, .tail = { 67, 127, 82, 113, 246, 186, 125, 24, 109, 254, 78, 178, 18, 3, 159, 90, 71, 59, 0 } }; // a bytes-like object is required
+const struct compressed_string translation63 = { .data = 28, .tail = { 91, 179, 207, 183, 184, 169, 94, 231, 96 } }; // abort() called
+const struct compressed_string translation64 = { .data = 64, .tail = { 74, 173, 37, 40, 202, 49, 168, 145, 185, 130, 80, 150, 53, 148, 225, 13, 192 } }; // annotation must be an identifier
+const struct compressed_string translation65 = { .data = 48, .tail = { 79, 200, 72, 4, 160, 241, 153, 244, 32, 250, 209, 173, 76 } }; // arg is an empty sequence
+const struct compressed_string translation66 = { .data = 40, .tail = { 79, 206, 176, 107, 33, 75, 6, 28, 245, 7, 96 } }; // argument name reused
+const struct compressed_string translation67 = { .data = 24, .tail = { 81, 128, 221, 205, 248, 187, 120 } }; // asm overflow
+const struct compressed_string translation68 = { .data = 74, .tail = { 81, 233, 106, 56, 103, 253, 60, 36, 246, 13, 169, 132, 177, 130, 143, 75, 81, 198, 150, 178, 140, 160 } }; // async for/with outside async function
+const struct compressed_string translation69 = { .data = 48, .tail = { 83, 46, 155, 234, 78, 2, 180, 136, 214, 114, 207, 39, 96 } }; // attributes not supported
+const struct compressed_string translation70 = { .data = 25, .tail = { 185, 88, 79, 172, 157, 90, 198 } }; // bad typecode
+const struct compressed_string translation71 = { .data = 57, .tail = { 186, 41, 63, 160, 217, 27, 116, 21, 164, 38, 51, 115, 193, 172, 157, 128 } }; // binary op %q not implemented
+const struct compressed_string translation72 = { .data = 39, .tail = { 187, 146, 215, 176, 86, 144, 138, 28, 151, 147 } }; // branch not in range
+const struct compressed_string translation73 = { .data = 33, .tail = { 190, 184, 224, 220, 75, 48, 140, 21, 238 } }; // buffer too small
+const struct compressed_string translation74 = { .data = 35, .tail = { 191, 169, 58, 181, 140, 55, 115, 126, 46, 222, 0 } }; // bytecode overflow
+const struct compressed_string translation75 = { .data = 81, .tail = { 191, 169, 56, 23, 53, 230, 123, 5, 105, 4, 49, 171, 202, 102, 230, 27, 128, 146, 120, 16, 159, 212, 192 } }; // bytes length not a multiple of item size
+const struct compressed_string translation76 = { .data = 49, .tail = { 191, 169, 56, 29, 202, 250, 48, 218, 144, 220, 7, 37, 228, 192 } }; // bytes value out of range
+const struct compressed_string translation77 = { .data = 101, .tail = { 82, 80, 203, 127, 67, 177, 119, 49, 172, 137, 97, 254, 3, 36, 229, 131, 147, 120, 18, 195, 250, 118, 214, 55, 5, 16, 120, 222, 254, 128 } }; // can only have up to 4 parameters to Thumb assembly
+const struct compressed_string translation78 = { .data = 103, .tail = { 82, 80, 203, 127, 67, 177, 119, 49, 172, 137, 97, 254, 3, 36, 229, 131, 147, 120, 18, 195, 254, 228, 214, 8, 20, 65, 227, 123, 250 } }; // can only have up to 4 parameters to Xtensa assembly
+const struct compressed_string translation79 = { .data = 105, .tail = { 82, 90, 72, 43, 88, 70, 78, 168, 87, 24, 57, 236, 214, 18, 192, 174, 230, 86, 245, 246, 141, 111, 91, 148, 65, 216, 86, 229, 16 } }; // can't add special method to already-subclassed class
+const struct compressed_string translation80 = { .data = 53, .tail = { 82, 90, 72, 40, 132, 229, 68, 176, 63, 57, 115, 136, 70, 80 } }; // can't assign to expression
+const struct compressed_string translation81 = { .data = 55, .tail = { 82, 90, 72, 171, 47, 115, 121, 27, 64, 150, 21, 108, 102, 231, 228 } }; // can't convert %s to complex
+const struct compressed_string translation82 = { .data = 51, .tail = { 82, 90, 72, 171, 47, 115, 121, 27, 64, 150, 28, 93, 138, 64 } }; // can't convert %s to float
+const struct compressed_string translation83 = { .data = 47, .tail = { 82, 90, 72, 171, 47, 115, 121, 27, 64, 150, 8, 178 } }; // can't convert %s to int
+const struct compressed_string translation84 = { .data = 85, .tail = { 82, 90, 72, 171, 47, 115, 121, 20, 219, 170, 6, 223, 228, 235, 34, 88, 109, 208, 76, 102, 233, 84, 155, 250 } }; // can't convert '%q' object to %q implicitly
+const struct compressed_string translation85 = { .data = 73, .tail = { 82, 90, 72, 177, 214, 228, 230, 21, 150, 237, 82, 184, 69, 13, 169, 55, 21, 107, 24 } }; // can't declare nonlocal in outer code
+const struct compressed_string translation86 = { .data = 47, .tail = { 82, 90, 72, 177, 220, 228, 193, 249, 203, 156, 66, 50, 128 } }; // can't delete expression
+const struct compressed_string translation87 = { .data = 81, .tail = { 82, 90, 72, 179, 13, 209, 73, 253, 6, 200, 220, 231, 193, 154, 138, 109, 213, 1, 45, 133, 54, 234, 128 } }; // can't do binary op between '%q' and '%q'
+const struct compressed_string translation88 = { .data = 79, .tail = { 82, 90, 72, 76, 102, 233, 84, 155, 250, 21, 101, 238, 111, 34, 155, 117, 65, 44, 41, 187, 53, 232 } }; // can't implicitly convert '%q' to 'bool'
+const struct compressed_string translation89 = { .data = 41, .tail = { 82, 90, 72, 76, 101, 158, 66, 150, 12, 109, 208 } }; // can't import name %q
+const struct compressed_string translation90 = { .data = 41, .tail = { 82, 90, 72, 187, 21, 135, 14, 216, 20, 219, 170, 0 } }; // can't load from '%q'
+const struct compressed_string translation91 = { .data = 53, .tail = { 82, 90, 72, 187, 21, 135, 132, 158, 194, 155, 117, 64, 139, 99, 242 } }; // can't load with '%q' index
+const struct compressed_string translation92 = { .data = 59, .tail = { 82, 90, 72, 201, 191, 12, 248, 14, 119, 41, 78, 230, 19, 25, 103, 144 } }; // can't perform relative import
+const struct compressed_string translation93 = { .data = 107, .tail = { 82, 90, 72, 131, 91, 5, 101, 251, 127, 12, 166, 59, 149, 244, 98, 88, 16, 249, 212, 79, 218, 36, 158, 78, 195, 147, 83, 114, 150, 112 } }; // can't send non-None value to a just-started generator
+const struct compressed_string translation94 = { .data = 39, .tail = { 82, 90, 72, 131, 144, 83, 46, 155, 234, 76 } }; // can't set attribute
+const struct compressed_string translation95 = { .data = 49, .tail = { 82, 90, 72, 131, 144, 83, 46, 155, 234, 76, 83, 110, 168 } }; // can't set attribute '%q'
+const struct compressed_string translation96 = { .data = 33, .tail = { 82, 90, 72, 137, 103, 49, 77, 186, 160 } }; // can't store '%q'
+const struct compressed_string translation97 = { .data = 39, .tail = { 82, 90, 72, 137, 103, 49, 44, 41, 183, 84 } }; // can't store to '%q'
+const struct compressed_string translation98 = { .data = 55, .tail = { 82, 90, 72, 137, 103, 49, 225, 39, 176, 166, 221, 80, 34, 216, 252, 128 } }; // can't store with '%q' index
+const struct compressed_string translation99 = { .data = 147, .tail = { 82, 90, 72, 143, 9, 53, 236, 56, 118, 192, 45, 75, 96, 165, 42, 56, 67, 189, 130, 235, 27, 155, 162, 242, 37, 134, 9, 116, 87, 28, 33, 222, 194, 50, 117, 78, 18, 165, 40, 202 } }; // can't switch from automatic field numbering to manual field specification
+const struct compressed_string translation100 = { .data = 147, .tail = { 82, 90, 72, 143, 9, 53, 236, 56, 118, 192, 193, 46, 138, 227, 132, 59, 216, 70, 78, 169, 194, 84, 165, 25, 68, 176, 45, 75, 96, 165, 42, 56, 67, 189, 130, 235, 27, 155, 162, 242 } }; // can't switch from manual field specification to automatic field numbering
+const struct compressed_string translation101 = { .data = 77, .tail = { 82, 90, 72, 151, 210, 212, 164, 254, 214, 78, 233, 99, 4, 42, 216, 205, 207, 200, 93, 99, 115, 112 } }; // can't truncate-divide a complex number
+const struct compressed_string translation102 = { .data = 57, .tail = { 82, 85, 105, 21, 115, 41, 49, 77, 186, 160, 69, 137, 37, 169, 192 } }; // cannot create '%q' instances
+const struct compressed_string translation103 = { .data = 15, .tail = { 82, 137, 69, 228 } }; // casting
+const struct compressed_string translation104 = { .data = 65, .tail = { 94, 207, 237, 238, 9, 249, 10, 210, 17, 67, 146, 242, 126, 223, 127, 63, 175, 235, 247, 251, 253, 254, 254, 224 } }; // chr() arg not in range(0x110000)
+const struct compressed_string translation105 = { .data = 53, .tail = { 86, 198, 73, 210, 25, 67, 112, 17, 100, 18, 216, 105, 22, 64 } }; // comparison of int and uint
+const struct compressed_string translation106 = { .data = 45, .tail = { 86, 198, 110, 126, 69, 147, 186, 88, 198, 254, 135, 245, 55, 96 } }; // complex divide by zero
+const struct compressed_string translation107 = { .data = 41, .tail = { 86, 94, 230, 240, 140, 162, 88, 54, 255, 39, 89 } }; // conversion to object
+const struct compressed_string translation108 = { .data = 59, .tail = { 99, 224, 181, 121, 20, 63, 53, 60, 205, 6, 53, 18, 55, 49, 114, 137 } }; // default 'except' must be last
+const struct compressed_string translation109 = { .data = 75, .tail = { 100, 172, 141, 102, 197, 38, 32, 250, 209, 173, 76, 118, 40, 30, 29, 151, 145, 115, 94, 103, 176 } }; // dict update sequence has wrong length
+const struct compressed_string translation110 = { .data = 65, .tail = { 100, 239, 250, 97, 172, 21, 164, 38, 51, 115, 193, 172, 157, 135, 12, 227, 72, 178 } }; // div/mod not implemented for uint
+const struct compressed_string translation111 = { .data = 33, .tail = { 100, 238, 144, 140, 163, 127, 67, 250, 155, 176 } }; // division by zero
+const struct compressed_string translation112 = { .data = 30, .tail = { 120, 204, 250, 16, 121, 39, 41, 103 } }; // empty separator
+const struct compressed_string translation113 = { .data = 104, .tail = { 107, 96, 220, 14, 25, 240, 82, 60, 118, 75, 152, 187, 55, 210, 47, 35, 134, 113, 86, 94, 230, 240, 140, 162, 50, 117, 78, 16, 220 } }; // end of format while looking for conversion specifier
+const struct compressed_string translation114 = { .data = 82, .tail = { 126, 106, 121, 148, 101, 129, 141, 68, 139, 27, 167, 115, 28, 59, 96, 127, 161, 65, 255, 175, 154, 158, 101, 25, 64 } }; // exceptions must derive from BaseException
+const struct compressed_string translation115 = { .data = 70, .tail = { 126, 114, 117, 147, 176, 167, 237, 64, 92, 73, 184, 225, 159, 5, 34, 50, 117, 78, 16, 220 } }; // expected ':' after format specifier
+const struct compressed_string translation116 = { .data = 68, .tail = { 126, 114, 117, 148, 94, 65, 40, 40, 131, 198, 247, 55, 8, 177, 47, 170, 202, 50, 128 } }; // expecting an assembler instruction
+const struct compressed_string translation117 = { .data = 60, .tail = { 126, 114, 117, 148, 94, 71, 206, 162, 65, 14, 229, 125, 24, 225, 156, 65, 200 } }; // expecting just a value for set
+const struct compressed_string translation118 = { .data = 56, .tail = { 126, 114, 117, 148, 94, 71, 209, 250, 253, 187, 149, 244, 99, 134, 113, 100, 172, 128 } }; // expecting key:value for dict
+const struct compressed_string translation119 = { .data = 58, .tail = { 126, 101, 200, 125, 31, 175, 12, 246, 4, 252, 235, 6, 179, 3, 148, 238, 106 } }; // extra keyword arguments given
+const struct compressed_string translation120 = { .data = 64, .tail = { 126, 101, 200, 101, 161, 37, 25, 74, 224, 159, 157, 96, 214, 96, 114, 157, 205, 64 } }; // extra positional arguments given
+const struct compressed_string translation121 = { .data = 77, .tail = { 194, 60, 72, 39, 231, 88, 53, 145, 44, 35, 89, 55, 246, 247, 24, 212, 72, 220, 196, 250, 201, 128 } }; // first argument to super() must be type
+const struct compressed_string translation122 = { .data = 45, .tail = { 195, 62, 10, 67, 159, 90, 71, 56, 4, 44, 149, 144 } }; // format requires a dict
+const struct compressed_string translation123 = { .data = 79, .tail = { 198, 150, 178, 140, 162, 204, 112, 180, 145, 37, 244, 99, 232, 253, 120, 103, 176, 39, 231, 88, 53, 152 } }; // function doesn't take keyword arguments
+const struct compressed_string translation124 = { .data = 93, .tail = { 198, 150, 178, 140, 160, 252, 228, 235, 39, 96, 82, 48, 209, 35, 107, 2, 126, 117, 131, 89, 143, 129, 203, 72, 218, 192 } }; // function expected at most %d arguments, got %d
+const struct compressed_string translation125 = { .data = 93, .tail = { 198, 150, 178, 140, 163, 150, 145, 141, 94, 83, 55, 49, 220, 175, 163, 129, 195, 56, 39, 231, 88, 53, 145, 77, 186, 160 } }; // function got multiple values for argument '%q'
+const struct compressed_string translation126 = { .data = 99, .tail = { 198, 150, 178, 140, 163, 9, 16, 139, 200, 218, 193, 207, 173, 35, 157, 134, 90, 18, 81, 148, 174, 9, 249, 214, 13, 102, 0 } }; // function missing %d required positional arguments
+const struct compressed_string translation127 = { .data = 77, .tail = { 198, 150, 178, 140, 163, 9, 16, 139, 200, 250, 63, 94, 25, 237, 246, 101, 191, 160, 79, 206, 176, 107, 32 } }; // function missing keyword-only argument
+const struct compressed_string translation128 = { .data = 95, .tail = { 198, 150, 178, 140, 163, 9, 16, 139, 200, 115, 235, 72, 231, 97, 244, 126, 188, 51, 216, 19, 243, 172, 26, 200, 166, 221, 80 } }; // function missing required keyword argument '%q'
+const struct compressed_string translation129 = { .data = 99, .tail = { 198, 150, 178, 140, 163, 9, 16, 139, 200, 115, 235, 72, 231, 97, 150, 132, 148, 101, 43, 130, 126, 117, 131, 89, 31, 223, 181, 128 } }; // function missing required positional argument #%d
+const struct compressed_string translation130 = { .data = 113, .tail = { 198, 150, 178, 140, 162, 75, 232, 224, 109, 97, 150, 132, 148, 101, 43, 130, 126, 117, 131, 89, 129, 190, 164, 109, 97, 224, 220, 199, 41, 220, 212 } }; // function takes %d positional arguments but %d were given
+const struct compressed_string translation131 = { .data = 55, .tail = { 201, 169, 185, 75, 56, 43, 185, 149, 189, 3, 242, 117, 212, 162, 242 } }; // generator already executing
+const struct compressed_string translation132 = { .data = 63, .tail = { 201, 169, 185, 75, 56, 78, 85, 156, 236, 63, 220, 212, 220, 165, 159, 253, 124, 164, 128 } }; // generator ignored GeneratorExit
+const struct compressed_string translation133 = { .data = 61, .tail = { 201, 169, 185, 75, 56, 114, 72, 59, 15, 249, 150, 207, 252, 73, 185, 74, 50, 128 } }; // generator raised StopIteration
+const struct compressed_string translation134 = { .data = 60, .tail = { 150, 53, 148, 225, 13, 195, 157, 143, 132, 83, 176, 40, 28, 221, 183, 43, 128 } }; // identifier redefined as global
+const struct compressed_string translation135 = { .data = 64, .tail = { 150, 53, 148, 225, 13, 195, 157, 143, 132, 83, 176, 40, 10, 203, 118, 169, 92 } }; // identifier redefined as nonlocal
+const struct compressed_string translation136 = { .data = 56, .tail = { 152, 203, 60, 143, 200, 43, 72, 41, 24, 107, 106, 230, 46, 125, 206, 224 } }; // import * not at module level
+const struct compressed_string translation137 = { .data = 34, .tail = { 139, 86, 198, 110, 114, 99, 134, 124, 20, 128 } }; // incomplete format
+const struct compressed_string translation138 = { .data = 42, .tail = { 139, 86, 198, 110, 114, 99, 134, 124, 20, 143, 163, 244 } }; // incomplete format key
+const struct compressed_string translation139 = { .data = 70, .tail = { 139, 116, 83, 5, 16, 120, 222, 230, 227, 26, 137, 27, 152, 33, 198, 150, 178, 140, 160 } }; // inline assembler must be a function
+const struct compressed_string translation140 = { .data = 24, .tail = { 139, 220, 174, 150, 4, 245, 236 } }; // invalid arch
+const struct compressed_string translation141 = { .data = 48, .tail = { 139, 220, 174, 150, 28, 51, 224, 164, 70, 78, 169, 194, 27, 128 } }; // invalid format specifier
+const struct compressed_string translation142 = { .data = 58, .tail = { 139, 220, 174, 150, 24, 74, 187, 103, 212, 246, 101, 22, 58, 179, 148, 179, 128 } }; // invalid micropython decorator
+const struct compressed_string translation143 = { .data = 28, .tail = { 139, 220, 174, 150, 17, 233, 100, 188, 128 } }; // invalid syntax
+const struct compressed_string translation144 = { .data = 50, .tail = { 139, 220, 174, 150, 17, 233, 100, 188, 142, 25, 194, 235, 27, 155, 128 } }; // invalid syntax for number
+const struct compressed_string translation145 = { .data = 68, .tail = { 145, 26, 222, 183, 40, 143, 111, 112, 79, 200, 253, 70, 53, 18, 55, 48, 66, 183, 40, 128 } }; // issubclass() arg 1 must be a class
+const struct compressed_string translation146 = { .data = 112, .tail = { 145, 26, 222, 183, 40, 143, 111, 112, 79, 200, 254, 67, 26, 137, 27, 152, 33, 91, 148, 64, 103, 4, 39, 89, 185, 134, 224, 86, 229, 16, 112 } }; // issubclass() arg 2 must be a class or a tuple of classes
+const struct compressed_string translation147 = { .data = 137, .tail = { 242, 200, 160, 252, 228, 235, 48, 8, 93, 34, 67, 112, 34, 95, 244, 223, 212, 156, 6, 223, 228, 235, 48, 42, 203, 9, 18, 107, 35, 194, 79, 97, 7, 126, 3, 111, 242, 117, 144 } }; // join expects a list of str/bytes objects consistent with self object
+const struct compressed_string translation148 = { .data = 123, .tail = { 244, 126, 188, 51, 216, 19, 243, 172, 26, 207, 180, 123, 133, 105, 9, 140, 220, 240, 107, 39, 97, 246, 26, 131, 10, 207, 130, 184, 39, 230, 2, 44, 73, 149, 128 } }; // keyword argument(s) not implemented - use normal args instead
+const struct compressed_string translation149 = { .data = 45, .tail = { 114, 220, 238, 41, 183, 84, 10, 210, 44, 124, 34, 157, 128 } }; // label '%q' not defined
+const struct compressed_string translation150 = { .data = 31, .tail = { 114, 220, 238, 28, 236, 124, 34, 157, 128 } }; // label redefined
+const struct compressed_string translation151 = { .data = 87, .tail = { 118, 169, 92, 83, 110, 168, 59, 20, 9, 245, 147, 20, 219, 170, 13, 245, 34, 27, 79, 83, 9, 2, 155, 117, 64 } }; // local '%q' has type '%q' but source is '%q'
+const struct compressed_string translation152 = { .data = 67, .tail = { 118, 169, 92, 83, 110, 168, 53, 7, 97, 185, 240, 206, 98, 125, 100, 199, 210, 183, 133 } }; // local '%q' used before type known
+const struct compressed_string translation153 = { .data = 87, .tail = { 118, 169, 92, 119, 39, 66, 222, 230, 28, 248, 55, 53, 169, 216, 110, 124, 51, 152, 40, 132, 229, 112, 107, 32 } }; // local variable referenced before assignment
+const struct compressed_string translation154 = { .data = 37, .tail = { 130, 191, 12, 248, 59, 14, 62, 209, 46, 139, 200 } }; // malformed f-string
+const struct compressed_string translation155 = { .data = 65, .tail = { 130, 242, 152, 214, 3, 157, 116, 240, 140, 162, 199, 153, 236, 15, 205, 76, 236, 118 } }; // maximum recursion depth exceeded
+const struct compressed_string translation156 = { .data = 91, .tail = { 131, 195, 63, 160, 87, 187, 84, 165, 25, 71, 4, 151, 59, 124, 2, 189, 218, 165, 40, 188, 141, 180, 55, 245, 39, 0 } }; // memory allocation failed, allocating %u bytes
+const struct compressed_string translation157 = { .data = 81, .tail = { 131, 195, 63, 160, 87, 187, 84, 165, 25, 71, 4, 151, 59, 124, 14, 198, 89, 9, 2, 237, 95, 163, 176 } }; // memory allocation failed, heap is locked
+const struct compressed_string translation158 = { .data = 51, .tail = { 141, 94, 83, 55, 49, 249, 121, 8, 160, 162, 19, 149, 193, 172, 128 } }; // multiple *x in assignment
+const struct compressed_string translation159 = { .data = 91, .tail = { 141, 94, 83, 55, 49, 185, 65, 192, 236, 93, 204, 34, 196, 146, 212, 197, 203, 215, 217, 181, 34, 172, 188, 93, 43, 32 } }; // multiple bases have instance lay-out conflict
+const struct compressed_string translation160 = { .data = 41, .tail = { 141, 68, 135, 36, 131, 4, 161, 183, 249, 58, 200 } }; // must raise an object
+const struct compressed_string translation161 = { .data = 85, .tail = { 141, 68, 141, 65, 143, 163, 245, 225, 158, 192, 159, 157, 96, 214, 71, 12, 227, 232, 253, 14, 52, 181, 148, 101 } }; // must use keyword argument for key function
+const struct compressed_string translation162 = { .data = 48, .tail = { 165, 131, 20, 219, 170, 4, 128, 173, 34, 199, 194, 41, 216 } }; // name '%q' is not defined
+const struct compressed_string translation163 = { .data = 42, .tail = { 165, 41, 220, 198, 14, 123, 53, 132, 179, 13, 211, 144 } }; // native method too big
+const struct compressed_string translation164 = { .data = 24, .tail = { 165, 41, 220, 199, 164, 59, 216 } }; // native yield
+const struct compressed_string translation165 = { .data = 68, .tail = { 166, 118, 24, 103, 49, 61, 137, 70, 214, 29, 202, 250, 56, 18, 195, 75, 146, 175, 208 } }; // need more than %d values to unpack
+const struct compressed_string translation166 = { .data = 40, .tail = { 167, 201, 74, 119, 49, 29, 147, 137, 21, 109, 44, 128 } }; // negative shift count
+const struct compressed_string translation167 = { .data = 60, .tail = { 172, 10, 178, 157, 204, 31, 154, 158, 101, 25, 68, 176, 115, 114, 72, 48 } }; // no active exception to reraise
+const struct compressed_string translation168 = { .data = 58, .tail = { 172, 55, 69, 178, 47, 35, 134, 112, 172, 183, 106, 149, 199, 13, 165, 176 } }; // no binding for nonlocal found
+const struct compressed_string translation169 = { .data = 40, .tail = { 172, 48, 214, 213, 204, 41, 96, 236, 41, 183, 84 } }; // no module named '%q'
+const struct compressed_string translation170 = { .data = 90, .tail = { 172, 191, 107, 31, 5, 171, 200, 39, 231, 88, 53, 145, 195, 94, 237, 226, 5, 143, 130, 213, 228, 19, 243, 172, 26, 200 } }; // non-default argument follows default argument
+const struct compressed_string translation171 = { .data = 28, .tail = { 173, 32, 133, 89, 98, 73, 100 } }; // not a constant
+const struct compressed_string translation172 = { .data = 104, .tail = { 173, 32, 175, 112, 79, 206, 176, 107, 48, 42, 203, 220, 222, 78, 194, 218, 116, 94, 68, 75, 162, 242, 56, 103, 193, 76, 162, 242 } }; // not all arguments converted during string formatting
+const struct compressed_string translation173 = { .data = 76, .tail = { 173, 32, 213, 181, 207, 96, 79, 206, 176, 107, 48, 56, 103, 28, 51, 224, 164, 68, 186, 47, 32 } }; // not enough arguments for format string
+const struct compressed_string translation174 = { .data = 66, .tail = { 219, 252, 157, 100, 83, 104, 160, 72, 90, 72, 33, 58, 205, 204, 51, 139, 164, 72 } }; // object '%s' isn't a tuple or list
+const struct compressed_string translation175 = { .data = 44, .tail = { 219, 252, 157, 100, 43, 72, 69, 16, 125, 104, 214, 166 } }; // object not in sequence
+const struct compressed_string translation176 = { .data = 64, .tail = { 219, 252, 157, 100, 55, 2, 125, 100, 197, 54, 138, 14, 197, 1, 88, 92, 215, 219, 220 } }; // object of type '%s' has no len()
+const struct compressed_string translation177 = { .data = 72, .tail = { 219, 252, 157, 100, 120, 73, 236, 55, 215, 28, 27, 140, 187, 75, 85, 174, 28, 250, 210, 57, 216 } }; // object with buffer protocol required
+const struct compressed_string translation178 = { .data = 96, .tail = { 203, 127, 66, 46, 149, 56, 30, 18, 123, 8, 147, 207, 239, 250, 143, 98, 250, 33, 252, 50, 159, 184, 39, 49, 26, 206, 89, 228, 236 } }; // only slices with step=1 (aka None) are supported
+const struct compressed_string translation179 = { .data = 12, .tail = { 217, 171, 88, 192 } }; // opcode
+const struct compressed_string translation180 = { .data = 114, .tail = { 207, 111, 111, 112, 126, 114, 117, 147, 176, 33, 94, 196, 229, 89, 55, 248, 27, 234, 68, 75, 162, 242, 27, 129, 115, 94, 103, 176, 218, 195, 134, 210, 216 } }; // ord() expected a character, but string of length %d found
+const struct compressed_string translation181 = { .data = 88, .tail = { 221, 205, 248, 187, 120, 21, 101, 238, 111, 40, 188, 139, 178, 242, 17, 100, 75, 12, 21, 123, 34, 152, 240, 207, 96 } }; // overflow converting long int to machine word
+const struct compressed_string translation182 = { .data = 87, .tail = { 146, 175, 208, 63, 57, 58, 201, 216, 109, 96, 146, 120, 129, 195, 56, 201, 87, 233, 23, 145, 237, 203, 72, 218, 222, 224 } }; // pack expected %d items for packing (got %d)
+const struct compressed_string translation183 = { .data = 99, .tail = { 146, 114, 193, 201, 188, 12, 106, 36, 110, 97, 207, 148, 137, 55, 128, 138, 32, 250, 209, 173, 76, 23, 242, 18, 192, 191, 196 } }; // parameters must be registers in sequence a2 to a5
+const struct compressed_string translation184 = { .data = 99, .tail = { 146, 114, 193, 201, 188, 12, 106, 36, 110, 97, 207, 148, 137, 55, 128, 138, 32, 250, 209, 173, 76, 63, 220, 75, 7, 254, 96 } }; // parameters must be registers in sequence r0 to r3
+const struct compressed_string translation185 = { .data = 35, .tail = { 150, 200, 225, 219, 0, 241, 153, 244, 54, 232 } }; // pop from empty %q
+const struct compressed_string translation186 = { .data = 47, .tail = { 150, 132, 148, 101, 43, 130, 126, 65, 113, 38, 227, 242, 252, 128 } }; // positional arg after **
+const struct compressed_string translation187 = { .data = 65, .tail = { 150, 132, 148, 101, 43, 130, 126, 65, 113, 38, 227, 232, 253, 120, 103, 176, 39, 228 } }; // positional arg after keyword arg
+const struct compressed_string translation188 = { .data = 62, .tail = { 229, 224, 113, 246, 137, 116, 94, 96, 19, 152, 86, 145, 26, 206, 89, 228, 236 } }; // raw f-strings are not supported
+const struct compressed_string translation189 = { .data = 88, .tail = { 231, 214, 142, 36, 236, 46, 107, 204, 246, 27, 88, 111, 169, 13, 191, 201, 214, 71, 98, 129, 115, 94, 103, 176, 218, 192 } }; // requested length %d but object has length %d
+const struct compressed_string translation190 = { .data = 78, .tail = { 231, 58, 117, 4, 170, 210, 82, 140, 163, 26, 137, 27, 152, 37, 9, 99, 89, 78, 16, 220 } }; // return annotation must be an identifier
+const struct compressed_string translation191 = { .data = 66, .tail = { 231, 58, 117, 7, 231, 39, 89, 59, 10, 109, 213, 6, 250, 145, 203, 72, 166, 221, 80 } }; // return expected '%q' but got '%q'
+const struct compressed_string translation192 = { .data = 28, .tail = { 241, 155, 164, 251, 127, 12, 167, 240, 190, 224 } }; // rsplit(None,n)
+const struct compressed_string translation193 = { .data = 87, .tail = { 9, 202, 133, 105, 5, 123, 183, 131, 176, 69, 17, 46, 139, 200, 225, 159, 5, 34, 50, 117, 78, 16, 220 } }; // sign not allowed in string format specifier
+const struct compressed_string translation194 = { .data = 101, .tail = { 9, 202, 133, 105, 5, 123, 183, 131, 176, 240, 147, 216, 34, 201, 242, 110, 56, 103, 193, 72, 140, 157, 83, 132, 55, 20, 173, 0 } }; // sign not allowed with integer format specifier 'c'
+const struct compressed_string translation195 = { .data = 37, .tail = { 24, 43, 220, 34, 200, 110, 230, 252, 93, 188, 0 } }; // small int overflow
+const struct compressed_string translation196 = { .data = 35, .tail = { 18, 79, 63, 161, 173, 130, 45, 146, 167, 0 } }; // start/end indices
+const struct compressed_string translation197 = { .data = 61, .tail = { 18, 230, 88, 13, 147, 114, 148, 101, 10, 210, 35, 89, 203, 60, 157, 128 } }; // stream operation not supported
+const struct compressed_string translation198 = { .data = 71, .tail = { 18, 232, 188, 130, 126, 117, 131, 89, 30, 18, 123, 54, 164, 18, 131, 90, 181, 145, 121 } }; // string argument without an encoding
+const struct compressed_string translation199 = { .data = 51, .tail = { 18, 232, 188, 132, 91, 31, 144, 218, 144, 220, 7, 37, 228, 192 } }; // string index out of range
+const struct compressed_string translation200 = { .data = 79, .tail = { 18, 232, 188, 132, 91, 37, 78, 6, 53, 18, 55, 48, 139, 39, 201, 188, 124, 5, 105, 27, 64 } }; // string indices must be integers, not %s
+const struct compressed_string translation201 = { .data = 39, .tail = { 26, 222, 37, 209, 121, 10, 210, 56, 109, 45, 128 } }; // substring not found
+const struct compressed_string translation202 = { .data = 47, .tail = { 26, 201, 191, 183, 184, 169, 45, 36, 112, 139, 97, 7, 126, 0 } }; // super() can't find self
+const struct compressed_string translation203 = { .data = 27, .tail = { 44, 195, 4, 190, 129, 63, 48 } }; // too many args
+const struct compressed_string translation204 = { .data = 67, .tail = { 44, 195, 4, 190, 133, 218, 165, 120, 28, 51, 133, 41, 78, 230, 48, 115, 217, 172 } }; // too many locals for native method
+const struct compressed_string translation205 = { .data = 79, .tail = { 44, 195, 4, 190, 135, 114, 190, 142, 4, 176, 210, 228, 171, 244, 61, 143, 206, 78, 178, 118, 27, 91, 220 } }; // too many values to unpack (expected %d)
+const struct compressed_string translation206 = { .data = 81, .tail = { 62, 178, 98, 155, 117, 64, 144, 21, 164, 18, 130, 173, 79, 50, 91, 220, 198, 229, 6, 39, 214, 76 } }; // type '%q' is not an acceptable base type
+const struct compressed_string translation207 = { .data = 77, .tail = { 62, 178, 97, 183, 249, 58, 200, 166, 221, 80, 118, 40, 10, 192, 166, 93, 55, 212, 152, 166, 221, 80 } }; // type object '%q' has no attribute '%q'
+const struct compressed_string translation208 = { .data = 55, .tail = { 62, 178, 98, 75, 232, 224, 126, 161, 156, 127, 48, 79, 206, 176, 107, 48 } }; // type takes 1 or 3 arguments
+const struct compressed_string translation209 = { .data = 55, .tail = { 165, 39, 244, 27, 35, 110, 130, 180, 132, 198, 110, 120, 53, 147, 176 } }; // unary op %q not implemented
+const struct compressed_string translation210 = { .data = 35, .tail = { 165, 63, 57, 58, 201, 216, 34, 216, 214, 64 } }; // unexpected indent
+const struct compressed_string translation211 = { .data = 65, .tail = { 165, 63, 57, 58, 201, 216, 125, 31, 175, 12, 246, 4, 252, 235, 6, 178, 41, 183, 84 } }; // unexpected keyword argument '%q'
+const struct compressed_string translation212 = { .data = 41, .tail = { 165, 74, 181, 140, 41, 96, 193, 197, 75, 39, 0 } }; // unicode name escapes
+const struct compressed_string translation213 = { .data = 91, .tail = { 165, 69, 177, 172, 139, 49, 194, 210, 70, 10, 107, 216, 18, 250, 13, 169, 55, 8, 182, 53, 145, 115, 238, 119 } }; // unindent doesn't match any outer indent level
+const struct compressed_string translation214 = { .data = 63, .tail = { 165, 250, 86, 240, 162, 172, 189, 205, 225, 25, 68, 100, 234, 156, 33, 184, 218, 160 } }; // unknown conversion specifier %c
+const struct compressed_string translation215 = { .data = 97, .tail = { 165, 250, 86, 240, 163, 134, 124, 20, 138, 181, 140, 83, 106, 208, 112, 206, 27, 127, 147, 172, 134, 224, 79, 172, 152, 166, 221, 80 } }; // unknown format code '%c' for object of type '%q'
+const struct compressed_string translation216 = { .data = 25, .tail = { 165, 250, 86, 240, 162, 125, 100, 192 } }; // unknown type
+const struct compressed_string translation217 = { .data = 35, .tail = { 165, 250, 86, 240, 162, 125, 100, 197, 54, 234, 128 } }; // unknown type '%q'
+const struct compressed_string translation218 = { .data = 49, .tail = { 165, 193, 77, 123, 29, 133, 54, 173, 2, 40, 225, 159, 5, 32 } }; // unmatched '%c' in format
+const struct compressed_string translation219 = { .data = 41, .tail = { 165, 115, 43, 22, 247, 48, 83, 46, 155, 234, 76 } }; // unreadable attribute
+const struct compressed_string translation220 = { .data = 105, .tail = { 165, 141, 103, 44, 242, 118, 31, 211, 182, 177, 184, 69, 137, 125, 86, 81, 148, 83, 104, 160, 240, 147, 216, 109, 96, 79, 206, 176, 107, 48 } }; // unsupported Thumb instruction '%s' with %d arguments
+const struct compressed_string translation221 = { .data = 107, .tail = { 165, 141, 103, 44, 242, 118, 31, 247, 38, 176, 65, 22, 37, 245, 89, 70, 81, 77, 162, 131, 194, 79, 97, 181, 129, 63, 58, 193, 172, 192 } }; // unsupported Xtensa instruction '%s' with %d arguments
+const struct compressed_string translation222 = { .data = 105, .tail = { 165, 141, 103, 44, 242, 118, 28, 51, 224, 164, 87, 177, 57, 86, 77, 197, 54, 173, 7, 183, 223, 206, 222, 125, 193, 72, 69, 177, 249, 27, 88 } }; // unsupported format character '%c' (0x%x) at index %d
+const struct compressed_string translation223 = { .data = 59, .tail = { 165, 141, 103, 44, 242, 118, 19, 235, 38, 56, 103, 27, 117, 251, 10, 109, 20 } }; // unsupported type for %q: '%s'
+const struct compressed_string translation224 = { .data = 73, .tail = { 165, 141, 103, 44, 242, 118, 19, 235, 39, 3, 134, 113, 183, 95, 176, 166, 221, 83, 224, 83, 110, 168 } }; // unsupported types for %q: '%q', '%q'
+const struct compressed_string translation225 = { .data = 57, .tail = { 220, 175, 163, 24, 212, 72, 225, 36, 34, 141, 172, 55, 245, 39, 237, 30, 224 } }; // value must fit in %d byte(s)
+const struct compressed_string translation226 = { .data = 51, .tail = { 225, 217, 121, 11, 172, 110, 110, 27, 128, 79, 206, 176, 107, 48 } }; // wrong number of arguments
+
+// 6921 bytes worth of translations
+// 4232 bytes worth of translations compressed
+// 2689 bytes saved
@@ -86,6 +86,10 @@
 #define MICROPY_PY_BUILTINS_NOTIMPLEMENTED          (1)
 #define MICROPY_PY_FUNCTION_ATTRS                   (1)
 //      MICROPY_PY_ERRNO_LIST - Use the default
+// Enough RAM to batch writes to several SPI flash sectors and erase less often.
+#ifndef CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS      (4)
+#endif
 
 #endif // SAM_D5X_E5X
 
@@ -48,6 +48,10 @@
 // Special RAM area for SPIM3 transmit buffer, to work around hardware bug.
 // See common.template.ld.
 #define SPIM3_BUFFER_RAM_SIZE       (8 * 1024)     // 8 KiB
+// Enough RAM to batch writes to several SPI flash sectors and erase less often.
+#ifndef CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS (4)
+#endif
 #endif
 
 #ifdef NRF52833
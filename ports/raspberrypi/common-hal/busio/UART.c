@@ -87,6 +87,14 @@ static void shared_callback(busio_uart_obj_t *self) {
     // We always clear the interrupt so it doesn't continue to fire because we
     // may not have read everything available.
     uart_get_hw(self->uart)->icr = UART_UARTICR_RXIC_BITS | UART_UARTICR_RTIC_BITS;
+    #if MICROPY_PY_SELECT_NOTIFY
+    // The TX interrupt is only enabled by write() when it leaves the FIFO full,
+    // so that a poller waiting for the UART to be writable is told when it drains.
+    if (uart_get_hw(self->uart)->mis & UART_UARTMIS_TXMIS_BITS) {
+        hw_clear_bits(&uart_get_hw(self->uart)->imsc, UART_UARTIMSC_TXIM_BITS);
+    }
+    mp_stream_notify(&self->notify);
+    #endif
 }
 
 static void uart0_callback(void) {
@@ -227,6 +235,16 @@ size_t common_hal_busio_uart_write(busio_uart_obj_t *self, const uint8_t *data,
         uart_tx_wait_blocking(self->uart);
         gpio_put(self->rs485_dir_pin, self->rs485_invert);
     }
+    #if MICROPY_PY_SELECT_NOTIFY
+    if (!uart_is_writable(self->uart)) {
+        hw_set_bits(&uart_get_hw(self->uart)->imsc, UART_UARTIMSC_TXIM_BITS);
+        // The interrupt fires as the FIFO drains past its trigger level, which
+        // may already have happened.
+        if (uart_is_writable(self->uart)) {
+            mp_stream_notify(&self->notify);
+        }
+    }
+    #endif
     return len;
 }
 
@@ -334,6 +352,12 @@ bool common_hal_busio_uart_ready_to_tx(busio_uart_obj_t *self) {
     return uart_is_writable(self->uart);
 }
 
+#if MICROPY_PY_SELECT_NOTIFY
+mp_stream_notify_t *common_hal_busio_uart_get_notify(busio_uart_obj_t *self) {
+    return &self->notify;
+}
+#endif
+
 STATIC void pin_never_reset(uint8_t pin) {
     if (pin != NO_PIN) {
         never_reset_pin_number(pin);
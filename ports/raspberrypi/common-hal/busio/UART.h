@@ -29,6 +29,7 @@
 
 #include "py/obj.h"
 #include "py/ringbuf.h"
+#include "py/stream.h"
 
 #include "src/rp2_common/hardware_uart/include/hardware/uart.h"
 
@@ -46,6 +47,9 @@ typedef struct {
     uint32_t timeout_ms;
     uart_inst_t *uart;
     ringbuf_t ringbuf;
+    #if MICROPY_PY_SELECT_NOTIFY
+    mp_stream_notify_t notify;
+    #endif
 } busio_uart_obj_t;
 
 extern void reset_uart(void);
@@ -168,6 +168,9 @@ static inline void exec_user_callback(socketpool_socket_obj_t *socket) {
         mp_sched_schedule(socket->callback, MP_OBJ_FROM_PTR(socket));
     }
     #endif
+    #if MICROPY_PY_SELECT_NOTIFY
+    mp_stream_notify(&socket->notify);
+    #endif
     supervisor_workflow_request_background();
 }
 
@@ -186,6 +189,7 @@ STATIC u8_t _lwip_raw_incoming(void *arg, struct raw_pcb *pcb, struct pbuf *p, c
     } else {
         socket->incoming.pbuf = p;
         memcpy(&socket->peer, addr, sizeof(socket->peer));
+        exec_user_callback(socket);
     }
     return 1; // we ate the packet
 }
@@ -208,6 +212,7 @@ STATIC void _lwip_udp_incoming(void *arg, struct udp_pcb *upcb, struct pbuf *p,
         socket->incoming.pbuf = p;
         socket->peer_port = (mp_uint_t)port;
         memcpy(&socket->peer, addr, sizeof(socket->peer));
+        exec_user_callback(socket);
     }
 }
 
@@ -221,6 +226,7 @@ STATIC void _lwip_tcp_error(void *arg, err_t err) {
     socket->state = err;
     // If we got here, the lwIP stack either has deallocated or will deallocate the pcb.
     socket->pcb.tcp = NULL;
+    exec_user_callback(socket);
 }
 
 // Callback for tcp connection requests. Error code err is unused. (See tcp.h)
@@ -228,6 +234,15 @@ STATIC err_t _lwip_tcp_connected(void *arg, struct tcp_pcb *tpcb, err_t err) {
     socketpool_socket_obj_t *socket = (socketpool_socket_obj_t *)arg;
 
     socket->state = STATE_CONNECTED;
+    exec_user_callback(socket);
+    return ERR_OK;
+}
+
+// Callback for acknowledged tcp data, which frees up space in the send buffer.
+STATIC err_t _lwip_tcp_sent(void *arg, struct tcp_pcb *tpcb, u16_t len) {
+    socketpool_socket_obj_t *socket = (socketpool_socket_obj_t *)arg;
+
+    exec_user_callback(socket);
     return ERR_OK;
 }
 
@@ -822,6 +837,7 @@ int socketpool_socket_accept(socketpool_socket_obj_t *self, uint8_t *ip, uint32_
     tcp_arg(accepted->pcb.tcp, (void *)accepted);
     tcp_err(accepted->pcb.tcp, _lwip_tcp_error);
     tcp_recv(accepted->pcb.tcp, _lwip_tcp_recv);
+    tcp_sent(accepted->pcb.tcp, _lwip_tcp_sent);
 
     tcp_accepted(listener);
 
@@ -920,6 +936,7 @@ void socketpool_socket_close(socketpool_socket_obj_t *socket) {
             if (socket->pcb.tcp->state != LISTEN) {
                 tcp_err(socket->pcb.tcp, NULL);
                 tcp_recv(socket->pcb.tcp, NULL);
+                tcp_sent(socket->pcb.tcp, NULL);
 
                 // Schedule a callback to abort the connection if it's not cleanly closed after
                 // the given timeout.  The callback must be set before calling tcp_close since
@@ -979,6 +996,7 @@ void common_hal_socketpool_socket_connect(socketpool_socket_obj_t *socket,
             MICROPY_PY_LWIP_ENTER
             tcp_recv(socket->pcb.tcp, _lwip_tcp_recv);
             tcp_err(socket->pcb.tcp, _lwip_tcp_error);
+            tcp_sent(socket->pcb.tcp, _lwip_tcp_sent);
             socket->state = STATE_CONNECTING;
             err = tcp_connect(socket->pcb.tcp, &dest, port, _lwip_tcp_connected);
             if (err != ERR_OK) {
@@ -1218,6 +1236,12 @@ bool common_hal_socketpool_readable(socketpool_socket_obj_t *self) {
     return result;
 }
 
+#if MICROPY_PY_SELECT_NOTIFY
+mp_stream_notify_t *common_hal_socketpool_socket_get_notify(socketpool_socket_obj_t *self) {
+    return &self->notify;
+}
+#endif
+
 bool common_hal_socketpool_writable(socketpool_socket_obj_t *self) {
     bool result = false;
 
@@ -1251,12 +1275,14 @@ void socketpool_socket_move(socketpool_socket_obj_t *self, socketpool_socket_obj
     tcp_arg(self->pcb.tcp, NULL);
     tcp_err(self->pcb.tcp, NULL);
     tcp_recv(self->pcb.tcp, NULL);
+    tcp_sent(self->pcb.tcp, NULL);
 
     self->pcb.tcp = NULL;
 
     tcp_arg(sock->pcb.tcp, (void *)sock);
     tcp_err(sock->pcb.tcp, _lwip_tcp_error);
     tcp_recv(sock->pcb.tcp, _lwip_tcp_recv);
+    tcp_sent(sock->pcb.tcp, _lwip_tcp_sent);
 
     MICROPY_PY_LWIP_EXIT;
 }
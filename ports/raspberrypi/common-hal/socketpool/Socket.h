@@ -30,6 +30,7 @@
 #pragma once
 
 #include "py/obj.h"
+#include "py/stream.h"
 
 #include "common-hal/socketpool/SocketPool.h"
 
@@ -73,6 +74,9 @@ typedef struct _lwip_socket_obj_t {
     int8_t state;
 
     socketpool_socketpool_obj_t *pool;
+    #if MICROPY_PY_SELECT_NOTIFY
+    mp_stream_notify_t notify;
+    #endif
 } socketpool_socket_obj_t;
 
 // Not required for RPi socket positive callbacks
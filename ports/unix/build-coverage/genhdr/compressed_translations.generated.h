@@ -0,0 +1,98 @@
+// # words 0
+// words []
+// 32   1382 000 0
+// 97 a 522 0010 2
+// 101 e 932 0011 3
+// 105 i 499 0100 4
+// 110 n 604 0101 5
+// 111 o 624 0110 6
+// 114 r 506 0111 7
+// 115 s 475 1000 8
+// 116 t 790 1001 9
+// 99 c 308 10100 20
+// 100 d 293 10101 21
+// 108 l 302 10110 22
+// 109 m 274 10111 23
+// 112 p 246 11000 24
+// 117 u 348 11001 25
+// 37 % 145 110100 52
+// 39 \' 178 110101 53
+// 98 b 188 110110 54
+// 102 f 217 110111 55
+// 103 g 159 111000 56
+// 121 y 124 111001 57
+// 104 h 116 1110100 116
+// 113 q 106 1110101 117
+// 118 v 84 1110110 118
+// 119 w 62 1110111 119
+// 120 x 64 1111000 120
+// 40 ( 30 11110010 242
+// 41 ) 30 11110011 243
+// 44 , 45 11110100 244
+// 95 _ 29 11110101 245
+// 106 j 29 11110110 246
+// 107 k 40 11110111 247
+// 45 - 22 111110000 496
+// 48 0 19 111110001 497
+// 49 1 15 111110010 498
+// 122 z 15 111110011 499
+// 10 \n 11 1111101000 1000
+// 13 \r 11 1111101001 1001
+// 42 * 9 1111101010 1002
+// 46 . 12 1111101011 1003
+// 47 / 9 1111101100 1004
+// 50 2 11 1111101101 1005
+// 51 3 9 1111101110 1006
+// 54 6 10 1111101111 1007
+// 58 : 12 1111110000 1008
+// 66 B 10 1111110001 1009
+// 67 C 10 1111110010 1010
+// 73 I 14 1111110011 1011
+// 78 N 10 1111110100 1012
+// 83 S 9 1111110101 1013
+// 52 4 5 11111101100 2028
+// 53 5 5 11111101101 2029
+// 56 8 6 11111101110 2030
+// 61 = 7 11111101111 2031
+// 68 D 4 11111110000 2032
+// 69 E 6 11111110001 2033
+// 70 F 5 11111110010 2034
+// 71 G 6 11111110011 2035
+// 79 O 6 11111110100 2036
+// 80 P 5 11111110101 2037
+// 82 R 7 11111110110 2038
+// 84 T 7 11111110111 2039
+// 85 U 4 11111111000 2040
+// 34 \" 4 111111110010 4082
+// 57 9 2 111111110011 4083
+// 60 < 2 111111110100 4084
+// 62 > 2 111111110101 4085
+// 65 A 3 111111110110 4086
+// 72 H 2 111111110111 4087
+// 74 J 2 111111111000 4088
+// 75 K 2 111111111001 4089
+// 76 L 2 111111111010 4090
+// 87 W 2 111111111011 4091
+// 96 ` 2 111111111100 4092
+// 33 ! 1 1111111111010 8186
+// 35 # 1 1111111111011 8187
+// 43 + 1 1111111111100 8188
+// 55 7 1 1111111111101 8189
+// 86 V 1 1111111111110 8190
+// 126 ~ 1 1111111111111 8191
+// length count {3: 1, 4: 8, 5: 6, 6: 6, 7: 5, 8: 6, 9: 4, 10: 14, 11: 13, 12: 11, 13: 6}
+// values [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'm', 'p', 'u', '%', "'", 'b', 'f', 'g', 'y', 'h', 'q', 'v', 'w', 'x', '(', ')', ',', '_', 'j', 'k', '-', '0', '1', 'z', '\n', '\r', '*', '.', '/', '2', '3', '6', ':', 'B', 'C', 'I', 'N', 'S', '4', '5', '8', '=', 'D', 'E', 'F', 'G', 'O', 'P', 'R', 'T', 'U', '"', '9', '<', '>', 'A', 'H', 'J', 'K', 'L', 'W', '`', '!', '#', '+', '7', 'V', '~'] lengths 14 bytearray(b'\x00\x00\x01\x08\x06\x06\x05\x06\x04\x0e\r\x0b\x06\x00')
+// [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'm', 'p', 'u', '%', "'", 'b', 'f', 'g', 'y', 'h', 'q', 'v', 'w', 'x', '(', ')', ',', '_', 'j', 'k', '-', '0', '1', 'z', '\n', '\r', '*', '.', '/', '2', '3', '6', ':', 'B', 'C', 'I', 'N', 'S', '4', '5', '8', '=', 'D', 'E', 'F', 'G', 'O', 'P', 'R', 'T', 'U', '"', '9', '<', '>', 'A', 'H', 'J', 'K', 'L', 'W', '`', '!', '#', '+', '7', 'V', '~'] bytearray(b'\x00\x00\x01\x08\x06\x06\x05\x06\x04\x0e\r\x0b\x06\x00')
+typedef uint8_t mchar_t;
+const uint8_t lengths[] = { 0, 0, 1, 8, 6, 6, 5, 6, 4, 14, 13, 11, 6, 0 };
+const mchar_t values[] = { 32, 97, 101, 105, 110, 111, 114, 115, 116, 99, 100, 108, 109, 112, 117, 37, 39, 98, 102, 103, 121, 104, 113, 118, 119, 120, 40, 41, 44, 95, 106, 107, 45, 48, 49, 122, 10, 13, 42, 46, 47, 50, 51, 54, 58, 66, 67, 73, 78, 83, 52, 53, 56, 61, 68, 69, 70, 71, 79, 80, 82, 84, 85, 34, 57, 60, 62, 65, 72, 74, 75, 76, 87, 96, 33, 35, 43, 55, 86, 126 };
+#define compress_max_length_bits (8)
+const mchar_t words[] = {  };
+const uint8_t wlencount[] = { 0 };
+#define word_start 128
+#define word_end 127
+#define minlen 0
+#define maxlen 0
+#define translation_offstart 0
+#define translation_offset 0
+#define translation_qstr_bits 0
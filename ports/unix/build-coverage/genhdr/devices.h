@@ -0,0 +1,52 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_UNIX_EXTERNAL_FLASH_SIM_DEVICES_H
+#define MICROPY_INCLUDED_UNIX_EXTERNAL_FLASH_SIM_DEVICES_H
+
+// Stands in for the devices.h that ports generate from data/nvm.toml, so that
+// the coverage build doesn't need the generator's dependencies. This is the
+// chip that external_flash_sim.c answers as.
+#define UNIX_SIM_FLASH { \
+        .total_size = (1 << 16), \
+        .start_up_time_us = 0, \
+        .manufacturer_id = 0xef, \
+        .memory_type = 0x40, \
+        .capacity = 0x10, \
+        .max_clock_speed_mhz = 104, \
+        .quad_enable_bit_mask = 0x02, \
+        .has_sector_protection = false, \
+        .supports_fast_read = true, \
+        .supports_qspi = true, \
+        .supports_qspi_writes = true, \
+        .write_status_register_split = false, \
+        .single_status_byte = false, \
+        .no_ready_bit = false, \
+        .no_erase_cmd = false, \
+        .no_reset_cmd = false, \
+}
+
+#endif // MICROPY_INCLUDED_UNIX_EXTERNAL_FLASH_SIM_DEVICES_H
@@ -0,0 +1,11 @@
+// This file was generated by py/makeversionhdr.py
+#define MICROPY_GIT_TAG "9.2.0"
+#define MICROPY_GIT_HASH "d70e62d"
+#define MICROPY_BUILD_DATE "2026-10-18"
+#define MICROPY_VERSION_MAJOR (9)
+#define MICROPY_VERSION_MINOR (2)
+#define MICROPY_VERSION_MICRO (0)
+#define MICROPY_VERSION_STRING "9.2.0"
+// Combined version as a 32-bit number for convenience
+#define MICROPY_VERSION (MICROPY_VERSION_MAJOR << 16 | MICROPY_VERSION_MINOR << 8 | MICROPY_VERSION_MICRO)
+#define MICROPY_FULL_VERSION_INFO "Adafruit CircuitPython " MICROPY_GIT_TAG " on " MICROPY_BUILD_DATE "; " MICROPY_HW_BOARD_NAME " with " MICROPY_HW_MCU_NAME
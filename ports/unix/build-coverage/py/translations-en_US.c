@@ -0,0 +1,338 @@
+// This file was automatically generated by maketranslatedata.py
+#include "supervisor/shared/translate/compressed_string.h"
+
+const struct compressed_string translation0 = { .data = 20, .tail = { 3, 249, 37, 140, 127, 150, 157, 127, 203, 208, 89, 20, 198, 149 } }; //   File \"%q\", line %d
+const struct compressed_string translation1 = { .data = 16, .tail = { 9, 1, 183, 19, 206, 12, 105, 215, 233, 250, 0 } }; //  is of type %q\n
+const struct compressed_string translation2 = { .data = 24, .tail = { 211, 74, 7, 62, 185, 71, 56, 8, 178, 25, 197, 58, 19, 128 } }; // %%c requires int or char
+const struct compressed_string translation3 = { .data = 2, .tail = { 211, 245 } }; // %S
+const struct compressed_string translation4 = { .data = 35, .tail = { 211, 168, 69, 26, 117, 23, 204, 72, 216, 195, 110, 39, 156, 24, 211, 175, 160, 86, 145, 167, 80 } }; // %q in %q must be of type %q, not %q
+const struct compressed_string translation5 = { .data = 21, .tail = { 211, 168, 69, 169, 248, 13, 153, 13, 184, 114, 94, 12 } }; // %q index out of range
+const struct compressed_string translation6 = { .data = 35, .tail = { 211, 168, 69, 170, 80, 224, 95, 49, 35, 99, 8, 178, 124, 27, 199, 160, 86, 145, 164, 0 } }; // %q indices must be integers, not %s
+const struct compressed_string translation7 = { .data = 20, .tail = { 211, 168, 177, 175, 19, 208, 95, 49, 35, 99, 26, 84 } }; // %q length must be %d
+const struct compressed_string translation8 = { .data = 23, .tail = { 211, 168, 177, 175, 19, 208, 95, 49, 35, 99, 26, 87, 225, 165, 64 } }; // %q length must be %d-%d
+const struct compressed_string translation9 = { .data = 23, .tail = { 211, 168, 177, 175, 19, 208, 95, 49, 35, 99, 31, 233, 251, 198, 149 } }; // %q length must be <= %d
+const struct compressed_string translation10 = { .data = 23, .tail = { 211, 168, 177, 175, 19, 208, 95, 49, 35, 99, 31, 235, 251, 198, 149 } }; // %q length must be >= %d
+const struct compressed_string translation11 = { .data = 13, .tail = { 211, 168, 190, 98, 70, 198, 52, 168 } }; // %q must be %d
+const struct compressed_string translation12 = { .data = 16, .tail = { 211, 168, 190, 98, 70, 198, 52, 175, 195, 74, 128 } }; // %q must be %d-%d
+const struct compressed_string translation13 = { .data = 26, .tail = { 211, 168, 190, 98, 70, 198, 52, 175, 195, 110, 100, 193, 89, 56, 83, 168 } }; // %q must be %d-byte aligned
+const struct compressed_string translation14 = { .data = 16, .tail = { 211, 168, 190, 98, 70, 198, 63, 211, 247, 141, 42 } }; // %q must be <= %d
+const struct compressed_string translation15 = { .data = 16, .tail = { 211, 168, 190, 98, 70, 198, 63, 215, 247, 141, 42 } }; // %q must be >= %d
+const struct compressed_string translation16 = { .data = 61, .tail = { 211, 168, 190, 98, 70, 198, 8, 109, 204, 153, 59, 151, 33, 156, 19, 185, 114, 27, 113, 60, 224, 198, 189, 53, 244, 26, 255, 190, 190, 131, 93, 181, 244, 12, 227, 95, 199, 80 } }; // %q must be a bytearray or array of type 'h', 'H', 'b', or 'B'
+const struct compressed_string translation17 = { .data = 28, .tail = { 211, 168, 190, 98, 70, 198, 9, 220, 185, 13, 184, 158, 112, 99, 94, 154, 128 } }; // %q must be array of type 'h'
+const struct compressed_string translation18 = { .data = 35, .tail = { 211, 168, 190, 98, 70, 198, 27, 113, 60, 224, 198, 157, 67, 56, 211, 175, 160, 86, 145, 167, 80 } }; // %q must be of type %q or %q, not %q
+const struct compressed_string translation19 = { .data = 40, .tail = { 211, 168, 190, 98, 70, 198, 27, 113, 60, 224, 198, 157, 125, 6, 157, 125, 3, 56, 211, 175, 160, 86, 145, 167, 80 } }; // %q must be of type %q, %q, or %q, not %q
+const struct compressed_string translation20 = { .data = 29, .tail = { 211, 168, 190, 98, 70, 198, 27, 113, 60, 224, 198, 157, 125, 2, 180, 141, 58, 128 } }; // %q must be of type %q, not %q
+const struct compressed_string translation21 = { .data = 15, .tail = { 211, 168, 108, 200, 109, 195, 146, 240, 96 } }; // %q out of range
+const struct compressed_string translation22 = { .data = 22, .tail = { 211, 168, 137, 60, 10, 18, 171, 72, 216, 199, 204, 221, 128 } }; // %q step cannot be zero
+const struct compressed_string translation23 = { .data = 52, .tail = { 211, 175, 151, 152, 146, 247, 56, 26, 84, 97, 161, 37, 25, 74, 192, 159, 140, 220, 214, 96, 109, 153, 26, 84, 119, 55, 49, 194, 118, 53 } }; // %q() takes %d positional arguments but %d were given
+const struct compressed_string translation24 = { .data = 17, .tail = { 211, 175, 151, 152, 238, 147, 209, 179, 35, 78, 190, 94, 96 } }; // %q() without %q()
+const struct compressed_string translation25 = { .data = 5, .tail = { 211, 175, 239, 211, 168 } }; // %q=%q
+const struct compressed_string translation26 = { .data = 2, .tail = { 210, 0 } }; // %s
+const struct compressed_string translation27 = { .data = 22, .tail = { 215, 78, 186, 130, 126, 51, 115, 89, 14, 125, 114, 142, 117 } }; // '%q' argument required
+const struct compressed_string translation28 = { .data = 33, .tail = { 215, 78, 186, 134, 219, 216, 233, 34, 172, 112, 21, 164, 70, 113, 134, 121, 26, 233, 215, 80 } }; // '%q' object does not support '%q'
+const struct compressed_string translation29 = { .data = 30, .tail = { 215, 78, 186, 134, 219, 216, 233, 33, 32, 43, 72, 37, 9, 38, 229, 44, 224 } }; // '%q' object is not an iterator
+const struct compressed_string translation30 = { .data = 27, .tail = { 215, 78, 186, 134, 219, 216, 233, 33, 32, 43, 72, 161, 90, 197, 181, 140 } }; // '%q' object is not callable
+const struct compressed_string translation31 = { .data = 27, .tail = { 215, 78, 186, 134, 219, 216, 233, 33, 32, 43, 72, 73, 55, 45, 172, 96 } }; // '%q' object is not iterable
+const struct compressed_string translation32 = { .data = 43, .tail = { 215, 72, 212, 54, 222, 199, 73, 21, 99, 133, 214, 68, 103, 24, 103, 144, 146, 119, 5, 16, 156, 45, 205, 100 } }; // '%s' object doesn't support item assignment
+const struct compressed_string translation33 = { .data = 41, .tail = { 215, 72, 212, 54, 222, 199, 73, 21, 99, 133, 214, 68, 103, 24, 103, 144, 146, 119, 21, 59, 28, 163, 40 } }; // '%s' object doesn't support item deletion
+const struct compressed_string translation34 = { .data = 33, .tail = { 215, 72, 212, 54, 222, 199, 73, 29, 10, 2, 176, 41, 151, 77, 179, 38, 53, 211, 174, 160 } }; // '%s' object has no attribute '%q'
+const struct compressed_string translation35 = { .data = 31, .tail = { 215, 72, 212, 54, 222, 199, 73, 9, 11, 172, 136, 206, 209, 71, 76, 73, 109, 99 } }; // '%s' object isn't subscriptable
+const struct compressed_string translation36 = { .data = 52, .tail = { 215, 247, 234, 10, 201, 194, 220, 214, 66, 180, 130, 181, 155, 185, 212, 34, 136, 151, 69, 224, 110, 207, 114, 145, 24, 58, 38, 232, 110 } }; // '=' alignment not allowed in string format specifier
+const struct compressed_string translation37 = { .data = 42, .tail = { 215, 245, 212, 18, 212, 107, 253, 53, 4, 230, 21, 164, 70, 113, 134, 121, 58, 141, 217, 238, 82, 39, 156, 28, 0 } }; // 'S' and 'O' are not supported format types
+const struct compressed_string translation38 = { .data = 24, .tail = { 212, 187, 146, 78, 161, 179, 48, 149, 49, 190, 86, 146, 140, 160 } }; // 'await' outside function
+const struct compressed_string translation39 = { .data = 31, .tail = { 215, 103, 50, 247, 215, 236, 214, 140, 178, 139, 147, 212, 54, 102, 18, 166, 44, 205, 128 } }; // 'break'/'continue' outside loop
+const struct compressed_string translation40 = { .data = 25, .tail = { 213, 206, 114, 235, 168, 108, 204, 37, 76, 111, 149, 164, 163, 40 } }; // 'return' outside function
+const struct compressed_string translation41 = { .data = 34, .tail = { 215, 148, 59, 84, 110, 237, 125, 66, 44, 37, 76, 20, 114, 180, 27, 229, 105, 40, 202 } }; // 'yield from' inside async function
+const struct compressed_string translation42 = { .data = 24, .tail = { 215, 148, 59, 87, 80, 217, 152, 74, 152, 223, 43, 73, 70, 80 } }; // 'yield' outside function
+const struct compressed_string translation43 = { .data = 14, .tail = { 250, 129, 63, 0, 183, 147, 113, 245, 125, 64 } }; // * arg after **
+const struct compressed_string translation44 = { .data = 28, .tail = { 250, 188, 11, 230, 36, 108, 96, 162, 19, 133, 185, 172, 137, 39, 224, 228 } }; // *x must be assignment target
+const struct compressed_string translation45 = { .data = 9, .tail = { 244, 8, 163, 78, 191, 79, 208 } }; // , in %q\n
+const struct compressed_string translation46 = { .data = 22, .tail = { 248, 253, 127, 17, 44, 8, 81, 175, 139, 31, 129, 134, 238, 110 } }; // 0.0 to a complex power
+const struct compressed_string translation47 = { .data = 42, .tail = { 255, 101, 6, 238, 206, 26, 148, 203, 185, 212, 119, 232, 150, 48, 231, 46, 135, 217, 23, 129, 174, 145, 175, 225, 244, 253, 0 } }; // An error occurred while retrieving '%s':\n
+const struct compressed_string translation48 = { .data = 41, .tail = { 252, 82, 110, 88, 16, 159, 51, 4, 181, 27, 36, 192, 193, 184, 236, 86, 201, 139, 230, 36, 92, 166, 157, 0 } }; // Bitmap size and bits per value must match
+const struct compressed_string translation49 = { .data = 16, .tail = { 252, 115, 190, 230, 226, 89, 132, 92, 173, 96 } }; // Buffer too small
+const struct compressed_string translation50 = { .data = 40, .tail = { 252, 191, 31, 200, 109, 102, 167, 188, 11, 230, 36, 108, 98, 249, 180, 166, 44, 112, 27, 113, 242, 251, 198, 220, 201, 192 } }; // CBC blocks must be multiples of 16 bytes
+const struct compressed_string translation51 = { .data = 55, .tail = { 252, 138, 214, 17, 156, 27, 249, 121, 253, 126, 190, 168, 169, 62, 190, 190, 94, 99, 99, 221, 156, 193, 82, 135, 16, 139, 192, 82, 148, 236, 97, 182, 246, 58, 79, 214 } }; // Call super().__init__() before accessing native object.
+const struct compressed_string translation52 = { .data = 20, .tail = { 252, 137, 85, 164, 84, 236, 114, 99, 177, 91, 39, 0 } }; // Cannot delete values
+const struct compressed_string translation53 = { .data = 21, .tail = { 252, 137, 85, 164, 70, 118, 165, 138, 32, 69, 146, 134 } }; // Cannot subclass slice
+const struct compressed_string translation54 = { .data = 40, .tail = { 252, 153, 158, 168, 165, 38, 9, 220, 185, 129, 208, 187, 24, 170, 111, 185, 185, 172, 139, 26, 241, 61, 32 } }; // Coordinate arrays have different lengths
+const struct compressed_string translation55 = { .data = 44, .tail = { 252, 153, 158, 168, 165, 38, 9, 220, 185, 129, 60, 224, 224, 116, 46, 198, 42, 155, 238, 110, 107, 34, 19, 230, 112 } }; // Coordinate arrays types have different sizes
+const struct compressed_string translation56 = { .data = 32, .tail = { 254, 5, 36, 41, 211, 43, 238, 47, 152, 145, 187, 90, 205, 220, 111, 121, 20, 233, 149, 247 } }; // Data chunk must follow fmt chunk
+const struct compressed_string translation57 = { .data = 38, .tail = { 254, 5, 36, 55, 103, 185, 72, 55, 118, 113, 229, 114, 228, 108, 99, 103, 111, 115, 81, 82, 146, 243 } }; // Data format error (may be broken data)
+const struct compressed_string translation58 = { .data = 49, .tail = { 254, 7, 217, 40, 96, 221, 217, 195, 56, 238, 236, 188, 9, 55, 186, 41, 74, 50, 134, 220, 34, 227, 50, 34, 92, 202, 224 } }; // Device error or wrong termination of input stream
+const struct compressed_string translation59 = { .data = 67, .tail = { 254, 25, 116, 94, 7, 66, 90, 217, 23, 128, 219, 137, 232, 96, 182, 110, 198, 15, 197, 15, 18, 140, 190, 128, 149, 167, 161, 184, 63, 20, 60, 74, 50, 134, 165, 50, 238, 117, 252, 0 } }; // During handling of the above exception, another exception occurred:
+const struct compressed_string translation60 = { .data = 39, .tail = { 254, 63, 151, 226, 25, 109, 200, 108, 27, 148, 156, 6, 81, 242, 251, 198, 220, 201, 192, 41, 4, 37, 46, 96 } }; // ECB only operates on 16 bytes at a time
+const struct compressed_string translation61 = { .data = 14, .tail = { 254, 46, 236, 225, 20, 57, 240, 126, 0 } }; // Error in regex
+const struct compressed_string translation62 = { .data = 11, .tail = { 254, 73, 99, 7, 225, 34, 96 } }; // File exists
+const struct compressed_string translation63 = { .data = 14, .tail = { 254, 73, 99, 10, 210, 55, 108, 173, 64 } }; // File not found
+const struct compressed_string translation64 = { .data = 58, .tail = { 254, 76, 227, 254, 191, 112, 163, 89, 158, 48, 84, 63, 64, 139, 140, 200, 217, 38, 229, 129, 124, 196, 142, 133, 216, 199, 238, 27, 36, 192, 193, 184, 194, 120, 59, 0 } }; // For L8 colorspace, input bitmap must have 8 bits per pixel
+const struct compressed_string translation65 = { .data = 61, .tail = { 254, 76, 227, 251, 127, 63, 196, 81, 172, 207, 24, 42, 28, 122, 4, 92, 102, 70, 201, 55, 44, 11, 230, 36, 116, 46, 198, 62, 95, 120, 217, 38, 6, 13, 198, 19, 193, 216 } }; // For RGB colorspaces, input bitmap must have 16 bits per pixel
+const struct compressed_string translation66 = { .data = 28, .tail = { 252, 254, 207, 232, 27, 6, 229, 40, 202, 25, 69, 44, 208, 117, 27, 165, 140 } }; // I/O operation on closed file
+const struct compressed_string translation67 = { .data = 18, .tail = { 252, 215, 25, 159, 177, 179, 56, 204, 131, 119, 103 } }; // Input/output error
+const struct compressed_string translation68 = { .data = 38, .tail = { 252, 214, 51, 190, 233, 68, 53, 145, 115, 187, 63, 35, 12, 214, 27, 179, 137, 232, 97, 46, 92, 24 } }; // Insufficient memory pool for the image
+const struct compressed_string translation69 = { .data = 32, .tail = { 252, 214, 51, 190, 233, 68, 53, 145, 18, 230, 87, 8, 184, 204, 141, 179, 190, 230, 224 } }; // Insufficient stream input buffer
+const struct compressed_string translation70 = { .data = 14, .tail = { 252, 214, 77, 212, 172, 13, 221, 156 } }; // Internal error
+const struct compressed_string translation71 = { .data = 30, .tail = { 252, 214, 77, 223, 56, 147, 168, 219, 144, 217, 156, 102, 70, 249, 90, 74, 50, 128 } }; // Interrupted by output function
+const struct compressed_string translation72 = { .data = 10, .tail = { 252, 215, 177, 89, 42, 52, 234 } }; // Invalid %q
+const struct compressed_string translation73 = { .data = 16, .tail = { 252, 215, 177, 89, 42, 9, 248, 205, 205, 100 } }; // Invalid argument
+const struct compressed_string translation74 = { .data = 22, .tail = { 252, 215, 177, 89, 42, 54, 73, 129, 131, 113, 216, 173, 147 } }; // Invalid bits per value
+const struct compressed_string translation75 = { .data = 17, .tail = { 252, 215, 177, 89, 42, 54, 230, 76, 105, 245, 253, 80 } }; // Invalid byte %.*s
+const struct compressed_string translation76 = { .data = 14, .tail = { 252, 215, 177, 89, 42, 55, 103, 185, 72 } }; // Invalid format
+const struct compressed_string translation77 = { .data = 25, .tail = { 252, 215, 177, 89, 42, 55, 103, 185, 72, 167, 76, 175, 184, 132, 249, 152 } }; // Invalid format chunk size
+const struct compressed_string translation78 = { .data = 22, .tail = { 252, 215, 177, 89, 42, 50, 169, 70, 169, 131, 138, 22, 12 } }; // Invalid unicode escape
+const struct compressed_string translation79 = { .data = 36, .tail = { 255, 147, 228, 95, 49, 35, 99, 31, 47, 191, 208, 125, 191, 179, 208, 51, 143, 187, 237, 27, 115, 39, 2, 204, 188, 0 } }; // Key must be 16, 24, or 32 bytes long
+const struct compressed_string translation80 = { .data = 13, .tail = { 255, 147, 228, 43, 72, 221, 178, 181 } }; // Key not found
+const struct compressed_string translation81 = { .data = 32, .tail = { 255, 175, 247, 253, 67, 110, 61, 207, 158, 236, 245, 4, 252, 11, 230, 36, 108, 96, 148, 37, 64 } }; // LHS of keyword arg must be an id
+const struct compressed_string translation82 = { .data = 13, .tail = { 253, 10, 230, 37, 152, 89, 151, 128 } }; // Name too long
+const struct compressed_string translation83 = { .data = 23, .tail = { 253, 24, 70, 10, 134, 44, 123, 200, 101, 21, 62, 201, 67 } }; // No space left on device
+const struct compressed_string translation84 = { .data = 14, .tail = { 253, 24, 70, 105, 208, 84, 251, 37, 12 } }; // No such device
+const struct compressed_string translation85 = { .data = 22, .tail = { 253, 24, 70, 105, 208, 110, 150, 63, 178, 168, 231, 73, 103, 228 } }; // No such file/directory
+const struct compressed_string translation86 = { .data = 27, .tail = { 253, 26, 68, 103, 24, 103, 147, 168, 255, 143, 235, 252, 127, 152, 137, 37, 169, 61, 64 } }; // Not supported JPEG standard
+const struct compressed_string translation87 = { .data = 77, .tail = { 254, 155, 123, 29, 36, 116, 40, 27, 25, 168, 169, 162, 164, 161, 89, 62, 103, 80, 75, 81, 66, 80, 172, 44, 203, 193, 184, 216, 198, 96, 235, 245, 143, 201, 204, 164, 193, 5, 62, 225, 182, 246, 58, 79, 214 } }; // Object has been deinitialized and can no longer be used. Create a new object.
+const struct compressed_string translation88 = { .data = 43, .tail = { 254, 139, 110, 67, 41, 138, 53, 153, 197, 9, 70, 198, 37, 201, 99, 4, 230, 178, 10, 65, 9, 75, 152 } }; // Only one color can be transparent at a time
+const struct compressed_string translation89 = { .data = 23, .tail = { 254, 152, 55, 41, 70, 80, 173, 35, 6, 247, 73, 147, 168 } }; // Operation not permitted
+const struct compressed_string translation90 = { .data = 15, .tail = { 254, 164, 229, 115, 147, 112, 110, 236, 224 } }; // Parameter error
+const struct compressed_string translation91 = { .data = 17, .tail = { 254, 166, 247, 72, 132, 101, 21, 53, 67, 168 } }; // Permission denied
+const struct compressed_string translation92 = { .data = 36, .tail = { 254, 182, 204, 2, 94, 69, 218, 185, 177, 192, 101, 19, 208, 198, 233, 99, 142, 98, 78, 255, 79, 208 } }; // Plus any modules on the filesystem\n
+const struct compressed_string translation93 = { .data = 9, .tail = { 254, 198, 85, 248, 50, 219, 144 } }; // Read-only
+const struct compressed_string translation94 = { .data = 20, .tail = { 254, 198, 85, 248, 50, 219, 145, 186, 88, 227, 152, 147, 184 } }; // Read-only filesystem
+const struct compressed_string translation95 = { .data = 33, .tail = { 254, 199, 215, 39, 18, 117, 31, 237, 252, 127, 81, 118, 169, 132, 129, 149, 140, 227, 12, 242, 117 } }; // Requested AES mode is unsupported
+const struct compressed_string translation96 = { .data = 30, .tail = { 254, 201, 199, 73, 27, 179, 220, 164, 109, 153, 10, 210, 35, 56, 195, 60, 157, 64 } }; // Right format but not supported
+const struct compressed_string translation97 = { .data = 20, .tail = { 253, 108, 148, 56, 10, 210, 35, 56, 195, 60, 157, 64 } }; // Slices not supported
+const struct compressed_string translation98 = { .data = 54, .tail = { 253, 91, 47, 67, 4, 181, 21, 56, 148, 82, 148, 101, 27, 103, 125, 205, 224, 95, 49, 35, 99, 19, 208, 196, 21, 204, 88, 215, 137, 232 } }; // Source and destination buffers must be the same length
+const struct compressed_string translation99 = { .data = 68, .tail = { 254, 253, 12, 22, 205, 216, 193, 248, 161, 226, 81, 148, 119, 40, 19, 208, 197, 81, 206, 146, 40, 89, 131, 13, 184, 158, 134, 55, 107, 89, 187, 162, 240, 15, 197, 15, 18, 140, 191, 128 } }; // The above exception was the direct cause of the following exception:
+const struct compressed_string translation100 = { .data = 55, .tail = { 254, 253, 12, 65, 95, 22, 61, 96, 108, 147, 30, 184, 55, 245, 130, 190, 44, 98, 172, 112, 21, 164, 92, 166, 157, 4, 244, 49, 116, 240, 111, 172, 0 } }; // The sample's bits_per_sample does not match the mixer's
+const struct compressed_string translation101 = { .data = 53, .tail = { 254, 253, 12, 65, 95, 22, 61, 96, 83, 161, 42, 157, 133, 27, 43, 34, 172, 112, 21, 164, 92, 166, 157, 4, 244, 49, 116, 240, 111, 172, 0 } }; // The sample's channel count does not match the mixer's
+const struct compressed_string translation102 = { .data = 51, .tail = { 254, 253, 12, 65, 95, 22, 61, 96, 65, 95, 22, 48, 229, 38, 42, 199, 1, 90, 69, 202, 105, 208, 79, 67, 23, 79, 6, 250, 192 } }; // The sample's sample rate does not match the mixer's
+const struct compressed_string translation103 = { .data = 50, .tail = { 254, 253, 12, 65, 95, 22, 61, 96, 66, 112, 167, 85, 56, 129, 86, 56, 10, 210, 46, 83, 78, 130, 122, 24, 186, 120, 55, 214, 0 } }; // The sample's signedness does not match the mixer's
+const struct compressed_string translation104 = { .data = 36, .tail = { 254, 238, 84, 61, 138, 158, 227, 202, 237, 18, 28, 232, 107, 34, 133, 107, 11, 20, 79, 159, 225, 244, 253, 0 } }; // Traceback (most recent call last):\n
+const struct compressed_string translation105 = { .data = 21, .tail = { 255, 10, 91, 88, 196, 176, 69, 73, 24, 39, 131, 112 } }; // Unable to init parser
+const struct compressed_string translation106 = { .data = 22, .tail = { 255, 11, 25, 198, 25, 228, 234, 40, 214, 103, 140, 21, 12 } }; // Unsupported colorspace
+const struct compressed_string translation107 = { .data = 18, .tail = { 255, 11, 25, 198, 25, 228, 234, 55, 103, 185, 72 } }; // Unsupported format
+const struct compressed_string translation108 = { .data = 140, .tail = { 255, 179, 181, 26, 230, 37, 135, 251, 84, 183, 124, 164, 143, 201, 30, 153, 73, 254, 188, 207, 70, 81, 164, 127, 235, 233, 250, 62, 159, 163, 255, 201, 9, 34, 136, 244, 202, 78, 57, 158, 140, 191, 91, 63, 3, 118, 113, 118, 115, 8, 187, 179, 220, 165, 25, 126, 191, 167, 232, 250, 126, 143, 238, 194, 201, 18, 54, 202, 90, 126, 8, 162, 237, 92, 216, 224, 79, 56, 49, 255, 157, 14, 216, 242, 255, 43, 181, 115, 99, 143, 242, 243, 255, 207, 175, 233, 250, 0 } }; // Welcome to Adafruit CircuitPython %s!\n\nVisit circuitpython.org for more information.\n\nTo list built-in modules type `help(\"modules\")`.\n
+const struct compressed_string translation109 = { .data = 39, .tail = { 245, 245, 69, 73, 245, 245, 242, 243, 17, 209, 179, 106, 135, 57, 203, 168, 253, 25, 79, 208, 43, 72, 215, 72, 212 } }; // __init__() should return None, not '%s'
+const struct compressed_string translation110 = { .data = 31, .tail = { 245, 245, 83, 239, 235, 234, 9, 248, 23, 204, 72, 216, 193, 12, 193, 191, 194, 121, 193, 128 } }; // __new__ arg must be a user-type
+const struct compressed_string translation111 = { .data = 31, .tail = { 33, 183, 50, 113, 240, 178, 123, 152, 109, 189, 142, 146, 18, 3, 159, 92, 163, 157, 64 } }; // a bytes-like object is required
+const struct compressed_string translation112 = { .data = 14, .tail = { 45, 153, 231, 203, 204, 80, 173, 99, 168 } }; // abort() called
+const struct compressed_string translation113 = { .data = 32, .tail = { 37, 86, 146, 148, 101, 23, 204, 72, 216, 193, 40, 74, 154, 202, 110, 134, 224 } }; // annotation must be an identifier
+const struct compressed_string translation114 = { .data = 24, .tail = { 39, 224, 36, 2, 80, 119, 196, 242, 32, 250, 228, 214, 134 } }; // arg is an empty sequence
+const struct compressed_string translation115 = { .data = 21, .tail = { 39, 224, 95, 49, 35, 99, 25, 131, 127, 132, 243, 131 } }; // arg must be user-type
+const struct compressed_string translation116 = { .data = 20, .tail = { 39, 227, 55, 53, 144, 165, 115, 14, 121, 131, 168 } }; // argument name reused
+const struct compressed_string translation117 = { .data = 34, .tail = { 39, 114, 231, 236, 219, 153, 56, 14, 125, 114, 142, 117, 12, 161, 211, 142, 146, 33, 42, 96 } }; // array/bytes required on right side
+const struct compressed_string translation118 = { .data = 37, .tail = { 40, 229, 104, 55, 103, 251, 59, 164, 244, 13, 153, 132, 169, 130, 142, 86, 131, 124, 173, 37, 25, 64 } }; // async for/with outside async function
+const struct compressed_string translation119 = { .data = 24, .tail = { 41, 151, 77, 179, 39, 1, 90, 68, 103, 24, 103, 147, 168 } }; // attributes not supported
+const struct compressed_string translation120 = { .data = 39, .tail = { 216, 169, 239, 195, 182, 86, 163, 177, 91, 38, 27, 50, 27, 112, 228, 188, 24, 109, 196, 147, 240, 114 } }; // background value out of range of target
+const struct compressed_string translation121 = { .data = 16, .tail = { 216, 170, 40, 215, 194, 88, 197, 218, 166 } }; // bad compile mode
+const struct compressed_string translation122 = { .data = 12, .tail = { 216, 170, 39, 156, 29, 26, 166 } }; // bad typecode
+const struct compressed_string translation123 = { .data = 28, .tail = { 217, 20, 159, 144, 216, 26, 117, 10, 210, 18, 248, 177, 220, 214, 78, 160 } }; // binary op %q not implemented
+const struct compressed_string translation124 = { .data = 32, .tail = { 217, 38, 229, 129, 9, 243, 48, 75, 81, 83, 196, 244, 23, 204, 72, 185, 77, 58, 0 } }; // bitmap size and depth must match
+const struct compressed_string translation125 = { .data = 23, .tail = { 217, 38, 229, 129, 9, 243, 56, 23, 204, 72, 185, 77, 58, 0 } }; // bitmap sizes must match
+const struct compressed_string translation126 = { .data = 23, .tail = { 217, 38, 5, 243, 18, 54, 49, 247, 125, 161, 156, 88, 226, 0 } }; // bits must be 32 or less
+const struct compressed_string translation127 = { .data = 31, .tail = { 217, 38, 61, 112, 111, 235, 5, 124, 88, 197, 243, 18, 54, 49, 251, 131, 56, 249, 125, 224 } }; // bits_per_sample must be 8 or 16
+const struct compressed_string translation128 = { .data = 29, .tail = { 219, 59, 238, 110, 33, 62, 102, 47, 152, 145, 114, 154, 116, 27, 179, 220, 164 } }; // buffer size must match format
+const struct compressed_string translation129 = { .data = 16, .tail = { 219, 59, 238, 110, 37, 152, 69, 202, 214 } }; // buffer too small
+const struct compressed_string translation130 = { .data = 17, .tail = { 219, 153, 58, 53, 76, 55, 99, 125, 236, 221, 192 } }; // bytecode overflow
+const struct compressed_string translation131 = { .data = 40, .tail = { 219, 153, 56, 22, 53, 226, 122, 5, 105, 4, 47, 155, 74, 98, 198, 27, 112, 146, 119, 16, 159, 51 } }; // bytes length not a multiple of item size
+const struct compressed_string translation132 = { .data = 24, .tail = { 219, 153, 56, 29, 138, 217, 48, 217, 144, 219, 135, 37, 224, 192 } }; // bytes value out of range
+const struct compressed_string translation133 = { .data = 52, .tail = { 161, 46, 178, 10, 181, 17, 131, 162, 21, 133, 206, 122, 53, 68, 176, 43, 57, 149, 121, 248, 70, 118, 165, 138, 32, 234, 41, 98, 136 } }; // can't add special method to already-subclassed class
+const struct compressed_string translation134 = { .data = 26, .tail = { 161, 46, 178, 10, 33, 56, 81, 44, 15, 198, 28, 226, 17, 148 } }; // can't assign to expression
+const struct compressed_string translation135 = { .data = 17, .tail = { 161, 46, 178, 40, 75, 67, 176, 131, 182, 224 } }; // can't cancel self
+const struct compressed_string translation136 = { .data = 27, .tail = { 161, 46, 178, 40, 203, 216, 222, 70, 144, 37, 133, 26, 248, 177, 248 } }; // can't convert %s to complex
+const struct compressed_string translation137 = { .data = 25, .tail = { 161, 46, 178, 40, 203, 216, 222, 70, 144, 37, 134, 246, 98, 144 } }; // can't convert %s to float
+const struct compressed_string translation138 = { .data = 23, .tail = { 161, 46, 178, 40, 203, 216, 222, 70, 144, 37, 130, 44, 128 } }; // can't convert %s to int
+const struct compressed_string translation139 = { .data = 42, .tail = { 161, 46, 178, 40, 203, 216, 222, 70, 186, 117, 212, 54, 222, 199, 73, 18, 195, 78, 161, 47, 139, 37, 18, 109, 200 } }; // can't convert '%q' object to %q implicitly
+const struct compressed_string translation140 = { .data = 36, .tail = { 161, 46, 178, 42, 116, 177, 57, 133, 101, 179, 80, 172, 17, 67, 102, 77, 197, 26, 166 } }; // can't declare nonlocal in outer code
+const struct compressed_string translation141 = { .data = 23, .tail = { 161, 46, 178, 42, 118, 57, 48, 126, 48, 231, 16, 140, 160 } }; // can't delete expression
+const struct compressed_string translation142 = { .data = 40, .tail = { 161, 46, 178, 42, 195, 100, 82, 126, 67, 96, 108, 115, 220, 205, 70, 186, 117, 212, 18, 212, 107, 167, 93, 64 } }; // can't do binary op between '%q' and '%q'
+const struct compressed_string translation143 = { .data = 39, .tail = { 161, 46, 178, 18, 248, 178, 81, 38, 220, 138, 50, 246, 55, 145, 174, 157, 117, 18, 195, 93, 153, 173, 168 } }; // can't implicitly convert '%q' to 'bool'
+const struct compressed_string translation144 = { .data = 20, .tail = { 161, 46, 178, 18, 248, 103, 144, 165, 115, 26, 117 } }; // can't import name %q
+const struct compressed_string translation145 = { .data = 20, .tail = { 161, 46, 178, 44, 197, 81, 187, 181, 198, 186, 117, 212 } }; // can't load from '%q'
+const struct compressed_string translation146 = { .data = 26, .tail = { 161, 46, 178, 44, 197, 81, 221, 39, 160, 215, 78, 186, 132, 90, 159, 128 } }; // can't load with '%q' index
+const struct compressed_string translation147 = { .data = 29, .tail = { 161, 46, 178, 48, 111, 187, 61, 195, 157, 138, 83, 177, 132, 190, 25, 228 } }; // can't perform relative import
+const struct compressed_string translation148 = { .data = 53, .tail = { 161, 46, 178, 32, 214, 161, 89, 126, 31, 163, 41, 142, 197, 108, 152, 150, 4, 61, 179, 19, 240, 137, 39, 147, 168, 224, 212, 220, 165, 156 } }; // can't send non-None value to a just-started generator
+const struct compressed_string translation149 = { .data = 19, .tail = { 161, 46, 178, 32, 228, 20, 203, 166, 217, 147 } }; // can't set attribute
+const struct compressed_string translation150 = { .data = 24, .tail = { 161, 46, 178, 32, 228, 20, 203, 166, 217, 147, 26, 233, 215, 80 } }; // can't set attribute '%q'
+const struct compressed_string translation151 = { .data = 16, .tail = { 161, 46, 178, 34, 89, 204, 107, 167, 93, 64 } }; // can't store '%q'
+const struct compressed_string translation152 = { .data = 19, .tail = { 161, 46, 178, 34, 89, 204, 75, 13, 116, 235, 168 } }; // can't store to '%q'
+const struct compressed_string translation153 = { .data = 27, .tail = { 161, 46, 178, 34, 89, 204, 119, 73, 232, 53, 211, 174, 161, 22, 167, 224 } }; // can't store with '%q' index
+const struct compressed_string translation154 = { .data = 73, .tail = { 161, 46, 178, 35, 186, 77, 58, 13, 221, 174, 11, 50, 215, 41, 74, 13, 208, 237, 80, 185, 190, 198, 232, 188, 9, 97, 114, 92, 149, 134, 232, 118, 168, 140, 29, 19, 116, 161, 74, 50, 128 } }; // can't switch from automatic field numbering to manual field specification
+const struct compressed_string translation155 = { .data = 73, .tail = { 161, 46, 178, 35, 186, 77, 58, 13, 221, 174, 46, 75, 146, 176, 221, 14, 213, 17, 131, 162, 110, 148, 41, 70, 81, 44, 11, 50, 215, 41, 74, 13, 208, 237, 80, 185, 190, 198, 232, 188, 0 } }; // can't switch from manual field specification to automatic field numbering
+const struct compressed_string translation156 = { .data = 38, .tail = { 161, 46, 178, 37, 242, 180, 41, 63, 133, 83, 178, 84, 193, 10, 53, 241, 99, 240, 23, 55, 216, 220 } }; // can't truncate-divide a complex number
+const struct compressed_string translation157 = { .data = 37, .tail = { 161, 46, 178, 50, 165, 125, 147, 140, 182, 98, 220, 142, 14, 68, 39, 204, 219, 113, 20, 43, 19, 128 } }; // can't unambiguously get sizeof scalar
+const struct compressed_string translation158 = { .data = 10, .tail = { 161, 46, 178, 59, 146, 72 } }; // can't wait
+const struct compressed_string translation159 = { .data = 28, .tail = { 161, 42, 180, 138, 57, 148, 152, 215, 78, 186, 132, 88, 146, 90, 28, 0 } }; // cannot create '%q' instances
+const struct compressed_string translation160 = { .data = 7, .tail = { 161, 68, 162, 240 } }; // casting
+const struct compressed_string translation161 = { .data = 32, .tail = { 167, 71, 242, 243, 4, 252, 5, 105, 8, 161, 201, 120, 63, 47, 143, 143, 151, 203, 227, 241, 248, 252, 124, 192 } }; // chr() arg not in range(0x110000)
+const struct compressed_string translation162 = { .data = 30, .tail = { 165, 147, 3, 12, 139, 34, 249, 137, 27, 24, 242, 241, 233, 207, 152, 156, 226, 198 } }; // clip point must be (x,y) tuple
+const struct compressed_string translation163 = { .data = 24, .tail = { 163, 84, 195, 102, 97, 42, 97, 201, 120, 49, 241, 255, 255, 203, 237, 255, 232 } }; // code outside range 0~127
+const struct compressed_string translation164 = { .data = 62, .tail = { 163, 89, 156, 109, 157, 247, 55, 23, 204, 72, 216, 199, 220, 54, 230, 78, 7, 151, 246, 254, 127, 143, 152, 103, 31, 176, 109, 204, 156, 15, 47, 237, 252, 255, 17, 255, 193, 130, 168, 219, 153, 63, 48 } }; // color buffer must be 3 bytes (RGB) or 4 bytes (RGB + pad byte)
+const struct compressed_string translation165 = { .data = 50, .tail = { 163, 89, 156, 109, 157, 247, 55, 23, 204, 72, 216, 193, 13, 179, 190, 230, 254, 130, 115, 139, 31, 160, 178, 68, 250, 6, 112, 139, 32 } }; // color buffer must be a buffer, tuple, list, or int
+const struct compressed_string translation166 = { .data = 60, .tail = { 163, 89, 156, 109, 157, 247, 55, 23, 204, 72, 216, 193, 13, 185, 147, 39, 114, 228, 51, 130, 119, 46, 67, 110, 39, 156, 24, 215, 109, 67, 56, 215, 241, 212 } }; // color buffer must be a bytearray or array of type 'b' or 'B'
+const struct compressed_string translation167 = { .data = 43, .tail = { 163, 89, 156, 95, 49, 35, 99, 27, 28, 247, 51, 81, 241, 241, 241, 248, 252, 126, 63, 31, 136, 37, 168, 248, 248, 223, 125, 247, 223, 112 } }; // color must be between 0x000000 and 0xffffff
+const struct compressed_string translation168 = { .data = 26, .tail = { 163, 95, 4, 233, 12, 161, 183, 8, 178, 9, 106, 50, 139, 32 } }; // comparison of int and uint
+const struct compressed_string translation169 = { .data = 22, .tail = { 163, 95, 22, 63, 2, 169, 217, 42, 99, 110, 71, 204, 221, 128 } }; // complex divide by zero
+const struct compressed_string translation170 = { .data = 18, .tail = { 163, 95, 14, 113, 8, 202, 58, 25, 84, 220 } }; // compression header
+const struct compressed_string translation171 = { .data = 20, .tail = { 163, 47, 99, 120, 70, 81, 44, 27, 111, 99, 164, 128 } }; // conversion to object
+const struct compressed_string translation172 = { .data = 29, .tail = { 169, 238, 89, 180, 141, 79, 197, 15, 19, 168, 190, 98, 70, 198, 44, 81, 32 } }; // default 'except' must be last
+const struct compressed_string translation173 = { .data = 25, .tail = { 169, 238, 89, 180, 132, 128, 173, 32, 134, 249, 90, 74, 50, 128 } }; // default is not a function
+const struct compressed_string translation174 = { .data = 37, .tail = { 170, 82, 70, 113, 82, 147, 16, 125, 114, 107, 67, 29, 10, 7, 119, 101, 224, 88, 215, 137, 232 } }; // dict update sequence has wrong length
+const struct compressed_string translation175 = { .data = 32, .tail = { 170, 118, 251, 46, 213, 10, 210, 18, 248, 177, 220, 214, 78, 163, 118, 113, 148, 89 } }; // div/mod not implemented for uint
+const struct compressed_string translation176 = { .data = 16, .tail = { 170, 118, 72, 70, 81, 183, 35, 230, 110, 192 } }; // division by zero
+const struct compressed_string translation177 = { .data = 5, .tail = { 59, 226, 121 } }; // empty
+const struct compressed_string translation178 = { .data = 10, .tail = { 59, 226, 121, 29, 12, 176 } }; // empty heap
+const struct compressed_string translation179 = { .data = 15, .tail = { 59, 226, 121, 16, 120, 39, 41, 103 } }; // empty separator
+const struct compressed_string translation180 = { .data = 5, .tail = { 53, 245, 255, 31, 168 } }; // en_US
+const struct compressed_string translation181 = { .data = 52, .tail = { 53, 168, 109, 198, 236, 247, 41, 29, 250, 37, 140, 89, 155, 221, 23, 129, 187, 56, 163, 47, 99, 120, 70, 81, 24, 58, 38, 232, 110 } }; // end of format while looking for conversion specifier
+const struct compressed_string translation182 = { .data = 41, .tail = { 63, 20, 60, 74, 50, 192, 190, 98, 69, 77, 211, 177, 141, 221, 174, 63, 18, 131, 254, 62, 40, 120, 148, 101 } }; // exceptions must derive from BaseException
+const struct compressed_string translation183 = { .data = 35, .tail = { 63, 24, 58, 73, 212, 107, 248, 106, 11, 121, 55, 27, 179, 220, 164, 70, 14, 137, 186, 27, 128 } }; // expected ':' after format specifier
+const struct compressed_string translation184 = { .data = 33, .tail = { 63, 24, 58, 74, 47, 0, 133, 82, 146, 55, 103, 30, 231, 207, 118, 122, 130, 126, 32 } }; // expecting a dict for keyword args
+const struct compressed_string translation185 = { .data = 30, .tail = { 63, 24, 58, 74, 47, 3, 219, 49, 32, 135, 98, 182, 76, 110, 206, 32, 228 } }; // expecting just a value for set
+const struct compressed_string translation186 = { .data = 28, .tail = { 63, 24, 58, 74, 47, 3, 220, 249, 252, 59, 21, 178, 99, 118, 113, 84, 164, 128 } }; // expecting key:value for dict
+const struct compressed_string translation187 = { .data = 26, .tail = { 63, 19, 235, 209, 155, 220, 36, 5, 105, 4, 55, 202, 210, 81, 148 } }; // ext_hook is not a function
+const struct compressed_string translation188 = { .data = 29, .tail = { 63, 18, 228, 61, 207, 158, 236, 245, 4, 252, 102, 230, 179, 3, 132, 236, 106 } }; // extra keyword arguments given
+const struct compressed_string translation189 = { .data = 32, .tail = { 63, 18, 228, 48, 208, 146, 140, 165, 96, 79, 198, 110, 107, 48, 56, 78, 198, 160 } }; // extra positional arguments given
+const struct compressed_string translation190 = { .data = 39, .tail = { 221, 44, 98, 249, 137, 27, 24, 33, 186, 88, 195, 96, 212, 234, 17, 70, 220, 201, 139, 181, 76 } }; // file must be a file opened in byte mode
+const struct compressed_string translation191 = { .data = 38, .tail = { 221, 30, 36, 19, 241, 155, 154, 200, 150, 17, 156, 27, 249, 121, 139, 230, 36, 108, 98, 121, 193, 128 } }; // first argument to super() must be type
+const struct compressed_string translation192 = { .data = 22, .tail = { 221, 158, 229, 33, 207, 174, 81, 206, 1, 10, 165, 36 } }; // format requires a dict
+const struct compressed_string translation193 = { .data = 4, .tail = { 223, 54, 176 } }; // full
+const struct compressed_string translation194 = { .data = 39, .tail = { 223, 43, 73, 70, 81, 86, 56, 93, 100, 73, 123, 152, 247, 62, 123, 179, 212, 19, 241, 155, 154, 204, 0 } }; // function doesn't take keyword arguments
+const struct compressed_string translation195 = { .data = 46, .tail = { 223, 43, 73, 70, 80, 126, 48, 116, 147, 168, 41, 23, 104, 145, 165, 65, 63, 25, 185, 172, 199, 160, 225, 164, 105, 80 } }; // function expected at most %d arguments, got %d
+const struct compressed_string translation196 = { .data = 46, .tail = { 223, 43, 73, 70, 81, 195, 72, 190, 109, 41, 139, 24, 236, 86, 201, 192, 221, 156, 19, 241, 155, 154, 200, 215, 78, 186, 128 } }; // function got multiple values for argument '%q'
+const struct compressed_string translation197 = { .data = 49, .tail = { 223, 43, 73, 70, 81, 116, 136, 69, 224, 105, 80, 231, 215, 40, 231, 81, 134, 132, 148, 101, 43, 2, 126, 51, 115, 89, 128 } }; // function missing %d required positional arguments
+const struct compressed_string translation198 = { .data = 38, .tail = { 223, 43, 73, 70, 81, 116, 136, 69, 224, 123, 159, 61, 217, 235, 240, 101, 183, 32, 159, 140, 220, 214, 64 } }; // function missing keyword-only argument
+const struct compressed_string translation199 = { .data = 47, .tail = { 223, 43, 73, 70, 81, 116, 136, 69, 224, 57, 245, 202, 57, 212, 123, 159, 61, 217, 234, 9, 248, 205, 205, 100, 107, 167, 93, 64 } }; // function missing required keyword argument '%q'
+const struct compressed_string translation200 = { .data = 49, .tail = { 223, 43, 73, 70, 81, 116, 136, 69, 224, 57, 245, 202, 57, 212, 97, 161, 37, 25, 74, 192, 159, 140, 220, 214, 71, 254, 244, 168 } }; // function missing required positional argument #%d
+const struct compressed_string translation201 = { .data = 56, .tail = { 223, 43, 73, 70, 81, 37, 238, 112, 52, 168, 195, 66, 74, 50, 149, 129, 63, 25, 185, 172, 192, 219, 50, 52, 168, 238, 110, 99, 132, 236, 106 } }; // function takes %d positional arguments but %d were given
+const struct compressed_string translation202 = { .data = 27, .tail = { 224, 212, 220, 165, 156, 21, 156, 202, 188, 131, 240, 116, 204, 162, 240 } }; // generator already executing
+const struct compressed_string translation203 = { .data = 31, .tail = { 224, 212, 220, 165, 156, 39, 10, 206, 117, 31, 204, 212, 220, 165, 159, 248, 248, 73 } }; // generator ignored GeneratorExit
+const struct compressed_string translation204 = { .data = 30, .tail = { 224, 212, 220, 165, 156, 57, 36, 29, 71, 235, 45, 143, 206, 77, 202, 81, 148 } }; // generator raised StopIteration
+const struct compressed_string translation205 = { .data = 19, .tail = { 232, 101, 129, 124, 196, 141, 140, 16, 178, 68, 128 } }; // heap must be a list
+const struct compressed_string translation206 = { .data = 30, .tail = { 74, 154, 202, 110, 134, 225, 206, 167, 186, 41, 212, 20, 14, 44, 219, 21, 128 } }; // identifier redefined as global
+const struct compressed_string translation207 = { .data = 32, .tail = { 74, 154, 202, 110, 134, 225, 206, 167, 186, 41, 212, 20, 5, 101, 179, 80, 172 } }; // identifier redefined as nonlocal
+const struct compressed_string translation208 = { .data = 28, .tail = { 75, 225, 158, 71, 212, 21, 164, 20, 139, 181, 115, 99, 22, 62, 199, 96 } }; // import * not at module level
+const struct compressed_string translation209 = { .data = 22, .tail = { 69, 163, 95, 5, 41, 181, 140, 125, 119, 199, 32, 158, 157, 0 } }; // incompatible .mpy arch
+const struct compressed_string translation210 = { .data = 22, .tail = { 69, 163, 95, 5, 41, 181, 140, 125, 119, 199, 35, 116, 177, 128 } }; // incompatible .mpy file
+const struct compressed_string translation211 = { .data = 17, .tail = { 69, 163, 95, 22, 57, 49, 187, 61, 202, 64 } }; // incomplete format
+const struct compressed_string translation212 = { .data = 21, .tail = { 69, 163, 95, 22, 57, 49, 187, 61, 202, 71, 185, 242 } }; // incomplete format key
+const struct compressed_string translation213 = { .data = 17, .tail = { 69, 163, 59, 157, 36, 96, 171, 84, 94, 0 } }; // incorrect padding
+const struct compressed_string translation214 = { .data = 18, .tail = { 69, 169, 248, 13, 153, 13, 184, 114, 94, 12 } }; // index out of range
+const struct compressed_string translation215 = { .data = 61, .tail = { 69, 236, 86, 74, 141, 146, 99, 215, 6, 254, 184, 79, 7, 97, 165, 125, 5, 243, 18, 54, 63, 65, 242, 244, 31, 111, 160, 253, 158, 131, 247, 122, 15, 151, 223, 232, 62, 223, 217, 232, 25, 199, 221, 246, 128 } }; // invalid bits_per_pixel %d, must be, 1, 2, 4, 8, 16, 24, or 32
+const struct compressed_string translation216 = { .data = 47, .tail = { 69, 236, 86, 74, 131, 177, 220, 214, 68, 39, 204, 198, 149, 27, 179, 141, 146, 99, 215, 6, 254, 184, 79, 7, 97, 165, 126, 159, 160 } }; // invalid element size %d for bits_per_pixel %d\n
+const struct compressed_string translation217 = { .data = 44, .tail = { 69, 236, 86, 74, 131, 177, 220, 214, 125, 97, 62, 102, 52, 175, 160, 190, 98, 70, 199, 232, 62, 94, 131, 237, 244, 12, 227, 246, 0 } }; // invalid element_size %d, must be, 1, 2, or 4
+const struct compressed_string translation218 = { .data = 17, .tail = { 69, 236, 86, 74, 131, 241, 67, 196, 163, 40 } }; // invalid exception
+const struct compressed_string translation219 = { .data = 24, .tail = { 69, 236, 86, 74, 141, 217, 238, 82, 35, 7, 68, 221, 13, 192 } }; // invalid format specifier
+const struct compressed_string translation220 = { .data = 29, .tail = { 69, 236, 86, 74, 139, 165, 29, 177, 204, 244, 101, 21, 58, 51, 148, 179, 128 } }; // invalid micropython decorator
+const struct compressed_string translation221 = { .data = 20, .tail = { 69, 236, 86, 74, 139, 251, 202, 92, 198, 96, 184, 48 } }; // invalid mktime usage
+const struct compressed_string translation222 = { .data = 14, .tail = { 69, 236, 86, 74, 136, 229, 100, 188, 0 } }; // invalid syntax
+const struct compressed_string translation223 = { .data = 25, .tail = { 69, 236, 86, 74, 136, 229, 100, 188, 13, 217, 194, 230, 251, 27, 128 } }; // invalid syntax for number
+const struct compressed_string translation224 = { .data = 34, .tail = { 72, 140, 237, 75, 20, 71, 151, 152, 39, 224, 124, 133, 243, 18, 54, 48, 66, 150, 40, 128 } }; // issubclass() arg 1 must be a class
+const struct compressed_string translation225 = { .data = 56, .tail = { 72, 140, 237, 75, 20, 71, 151, 152, 39, 224, 125, 162, 249, 137, 27, 24, 33, 75, 20, 64, 103, 4, 39, 56, 177, 134, 220, 82, 197, 16, 112 } }; // issubclass() arg 2 must be a class or a tuple of classes
+const struct compressed_string translation226 = { .data = 68, .tail = { 246, 100, 80, 126, 48, 116, 152, 4, 44, 145, 33, 183, 17, 47, 246, 109, 204, 156, 6, 219, 216, 233, 48, 40, 203, 9, 18, 107, 35, 186, 79, 65, 7, 109, 195, 109, 236, 116, 144 } }; // join expects a list of str/bytes objects consistent with self object
+const struct compressed_string translation227 = { .data = 61, .tail = { 247, 62, 123, 179, 212, 19, 241, 155, 154, 207, 148, 121, 133, 105, 9, 124, 88, 238, 107, 39, 81, 240, 25, 131, 10, 207, 114, 176, 39, 226, 2, 44, 73, 149, 64 } }; // keyword argument(s) not implemented - use normal args instead
+const struct compressed_string translation228 = { .data = 29, .tail = { 177, 246, 59, 11, 230, 36, 108, 99, 99, 158, 230, 106, 62, 32, 150, 163, 228 } }; // level must be between 0 and 1
+const struct compressed_string translation229 = { .data = 32, .tail = { 183, 72, 4, 181, 15, 210, 4, 116, 108, 218, 163, 99, 20, 107, 224, 165, 54, 177, 128 } }; // lhs and rhs should be compatible
+const struct compressed_string translation230 = { .data = 43, .tail = { 179, 80, 172, 53, 211, 174, 163, 161, 64, 158, 112, 99, 93, 58, 234, 54, 204, 136, 108, 189, 12, 36, 13, 116, 235, 168 } }; // local '%q' has type '%q' but source is '%q'
+const struct compressed_string translation231 = { .data = 33, .tail = { 179, 80, 172, 53, 211, 174, 163, 48, 117, 27, 30, 236, 230, 39, 156, 24, 247, 86, 238, 160 } }; // local '%q' used before type known
+const struct compressed_string translation232 = { .data = 43, .tail = { 179, 80, 172, 59, 19, 161, 109, 99, 14, 123, 155, 154, 208, 234, 54, 61, 217, 204, 20, 66, 112, 183, 53, 144 } }; // local variable referenced before assignment
+const struct compressed_string translation233 = { .data = 18, .tail = { 185, 91, 118, 123, 157, 70, 255, 8, 151, 69, 224 } }; // malformed f-string
+const struct compressed_string translation234 = { .data = 17, .tail = { 185, 79, 65, 86, 185, 34, 131, 119, 103 } }; // math domain error
+const struct compressed_string translation235 = { .data = 32, .tail = { 185, 120, 75, 230, 225, 206, 153, 120, 70, 81, 83, 196, 244, 7, 226, 134, 117, 58, 128 } }; // maximum recursion depth exceeded
+const struct compressed_string translation236 = { .data = 45, .tail = { 185, 221, 159, 144, 86, 179, 80, 165, 25, 70, 228, 150, 58, 250, 2, 181, 154, 133, 40, 188, 13, 50, 54, 230, 78, 0 } }; // memory allocation failed, allocating %u bytes
+const struct compressed_string translation237 = { .data = 40, .tail = { 185, 221, 159, 144, 86, 179, 80, 165, 25, 70, 228, 150, 58, 250, 14, 134, 88, 9, 2, 205, 79, 115, 168 } }; // memory allocation failed, heap is locked
+const struct compressed_string translation238 = { .data = 27, .tail = { 185, 221, 159, 158, 200, 125, 195, 111, 188, 28, 137, 102, 22, 39, 224, 192 } }; // memoryview offset too large
+const struct compressed_string translation239 = { .data = 48, .tail = { 185, 221, 159, 158, 200, 125, 255, 1, 99, 94, 39, 160, 72, 10, 210, 8, 95, 54, 148, 197, 140, 54, 225, 36, 239, 9, 243, 48 } }; // memoryview: length is not a multiple of itemsize
+const struct compressed_string translation240 = { .data = 37, .tail = { 191, 188, 165, 204, 41, 157, 96, 16, 156, 226, 198, 27, 113, 99, 94, 39, 160, 253, 193, 156, 127, 152 } }; // mktime needs a tuple of length 8 or 9
+const struct compressed_string translation241 = { .data = 25, .tail = { 190, 109, 41, 139, 24, 250, 188, 4, 80, 81, 9, 194, 220, 214, 64 } }; // multiple *x in assignment
+const struct compressed_string translation242 = { .data = 45, .tail = { 190, 109, 41, 139, 24, 216, 160, 224, 116, 46, 198, 17, 98, 73, 104, 98, 197, 207, 193, 179, 34, 140, 187, 217, 41, 32 } }; // multiple bases have instance lay-out conflict
+const struct compressed_string translation243 = { .data = 20, .tail = { 190, 98, 67, 146, 65, 130, 80, 219, 123, 29, 36 } }; // must raise an object
+const struct compressed_string translation244 = { .data = 42, .tail = { 190, 98, 70, 96, 199, 185, 243, 221, 158, 160, 159, 140, 220, 214, 70, 236, 227, 220, 249, 27, 229, 105, 40, 202 } }; // must use keyword argument for key function
+const struct compressed_string translation245 = { .data = 24, .tail = { 82, 185, 141, 116, 235, 168, 72, 10, 210, 42, 123, 162, 157, 64 } }; // name '%q' is not defined
+const struct compressed_string translation246 = { .data = 31, .tail = { 82, 148, 236, 98, 141, 83, 8, 163, 235, 190, 57, 25, 88, 206, 48, 207, 39, 80 } }; // native code in .mpy unsupported
+const struct compressed_string translation247 = { .data = 12, .tail = { 82, 148, 236, 99, 148, 59, 84 } }; // native yield
+const struct compressed_string translation248 = { .data = 34, .tail = { 83, 58, 139, 179, 152, 158, 132, 163, 74, 142, 197, 108, 156, 9, 97, 149, 193, 83, 220 } }; // need more than %d values to unpack
+const struct compressed_string translation249 = { .data = 18, .tail = { 83, 224, 165, 59, 24, 220, 169, 44, 232, 86 } }; // negative factorial
+const struct compressed_string translation250 = { .data = 20, .tail = { 83, 224, 165, 59, 24, 142, 137, 188, 138, 54, 86, 64 } }; // negative shift count
+const struct compressed_string translation251 = { .data = 30, .tail = { 86, 5, 73, 78, 198, 15, 197, 15, 18, 140, 162, 88, 57, 185, 36, 24 } }; // no active exception to reraise
+const struct compressed_string translation252 = { .data = 29, .tail = { 86, 27, 34, 213, 23, 129, 187, 56, 86, 91, 53, 10, 195, 118, 202, 212 } }; // no binding for nonlocal found
+const struct compressed_string translation253 = { .data = 17, .tail = { 86, 21, 61, 203, 54, 145, 130, 167, 185, 184 } }; // no default packer
+const struct compressed_string translation254 = { .data = 20, .tail = { 86, 23, 106, 230, 198, 20, 174, 117, 26, 233, 215, 80 } }; // no module named '%q'
+const struct compressed_string translation255 = { .data = 21, .tail = { 86, 15, 149, 84, 94, 1, 246, 53, 145, 102, 108, 0 } }; // no running event loop
+const struct compressed_string translation256 = { .data = 17, .tail = { 86, 17, 154, 116, 5, 50, 233, 182, 100, 192 } }; // no such attribute
+const struct compressed_string translation257 = { .data = 45, .tail = { 86, 95, 133, 79, 114, 205, 164, 19, 241, 155, 154, 200, 221, 173, 102, 239, 2, 167, 185, 102, 210, 9, 248, 205, 205, 100 } }; // non-default argument follows default argument
+const struct compressed_string translation258 = { .data = 19, .tail = { 86, 95, 135, 67, 240, 42, 156, 36, 141, 219, 43, 80 } }; // non-hex digit found
+const struct compressed_string translation259 = { .data = 14, .tail = { 86, 144, 66, 140, 177, 36, 178 } }; // not a constant
+const struct compressed_string translation260 = { .data = 52, .tail = { 86, 144, 86, 176, 39, 227, 55, 53, 152, 20, 101, 236, 111, 39, 81, 92, 186, 47, 2, 37, 209, 120, 27, 179, 220, 166, 81, 120 } }; // not all arguments converted during string formatting
+const struct compressed_string translation261 = { .data = 38, .tail = { 86, 144, 106, 217, 227, 160, 39, 227, 55, 53, 152, 27, 179, 141, 217, 238, 82, 34, 93, 23, 128 } }; // not enough arguments for format string
+const struct compressed_string translation262 = { .data = 7, .tail = { 109, 189, 142, 146, 0 } }; // object 
+const struct compressed_string translation263 = { .data = 33, .tail = { 109, 189, 142, 146, 53, 210, 53, 9, 11, 172, 130, 19, 156, 88, 195, 56, 178, 68, 128 } }; // object '%s' isn't a tuple or list
+const struct compressed_string translation264 = { .data = 22, .tail = { 109, 189, 142, 146, 21, 164, 34, 136, 62, 185, 53, 161, 128 } }; // object not in sequence
+const struct compressed_string translation265 = { .data = 32, .tail = { 109, 189, 142, 146, 27, 113, 60, 224, 198, 186, 70, 163, 161, 64, 86, 22, 53, 242, 243 } }; // object of type '%s' has no len()
+const struct compressed_string translation266 = { .data = 36, .tail = { 109, 189, 142, 146, 59, 164, 244, 27, 103, 125, 205, 198, 29, 165, 168, 214, 14, 125, 114, 142, 117 } }; // object with buffer protocol required
+const struct compressed_string translation267 = { .data = 17, .tail = { 106, 215, 225, 99, 94, 39, 160, 137, 116, 94, 0 } }; // odd-length string
+const struct compressed_string translation268 = { .data = 48, .tail = { 101, 183, 34, 44, 148, 56, 29, 210, 122, 8, 147, 199, 239, 249, 15, 34, 247, 33, 250, 50, 159, 152, 39, 49, 25, 198, 25, 228, 234 } }; // only slices with step=1 (aka None) are supported
+const struct compressed_string translation269 = { .data = 6, .tail = { 108, 81, 170, 96 } }; // opcode
+const struct compressed_string translation270 = { .data = 57, .tail = { 103, 175, 151, 152, 63, 24, 58, 73, 212, 16, 167, 66, 114, 164, 155, 250, 13, 179, 34, 37, 209, 120, 13, 184, 177, 175, 19, 208, 105, 81, 187, 101, 106 } }; // ord() expected a character, but string of length %d found
+const struct compressed_string translation271 = { .data = 22, .tail = { 108, 200, 109, 195, 146, 240, 97, 183, 18, 79, 193, 200 } }; // out of range of target
+const struct compressed_string translation272 = { .data = 44, .tail = { 110, 198, 251, 217, 187, 138, 50, 246, 55, 148, 94, 5, 153, 120, 8, 178, 37, 133, 202, 157, 17, 76, 119, 103, 168 } }; // overflow converting long int to machine word
+const struct compressed_string translation273 = { .data = 17, .tail = { 195, 96, 110, 237, 112, 119, 196, 242, 52, 234 } }; // pop from empty %q
+const struct compressed_string translation274 = { .data = 23, .tail = { 195, 66, 74, 50, 149, 129, 63, 0, 183, 147, 113, 245, 125, 64 } }; // positional arg after **
+const struct compressed_string translation275 = { .data = 32, .tail = { 195, 66, 74, 50, 149, 129, 63, 0, 183, 147, 113, 238, 124, 247, 103, 168, 39, 224 } }; // positional arg after keyword arg
+const struct compressed_string translation276 = { .data = 30, .tail = { 195, 119, 242, 243, 31, 115, 212, 19, 241, 155, 154, 200, 161, 42, 180, 141, 140, 124, 64 } }; // pow() 3rd argument cannot be 0
+const struct compressed_string translation277 = { .data = 40, .tail = { 195, 119, 242, 243, 29, 210, 122, 15, 184, 19, 241, 155, 154, 204, 7, 62, 185, 71, 56, 8, 178, 124, 27, 192 } }; // pow() with 3 arguments requires integers
+const struct compressed_string translation278 = { .data = 31, .tail = { 114, 238, 55, 248, 68, 186, 47, 16, 9, 204, 43, 72, 140, 227, 12, 242, 117 } }; // raw f-strings are not supported
+const struct compressed_string translation279 = { .data = 44, .tail = { 115, 235, 147, 137, 58, 139, 26, 241, 61, 6, 149, 27, 102, 67, 109, 236, 116, 145, 208, 160, 88, 215, 137, 232, 52, 168 } }; // requested length %d but object has length %d
+const struct compressed_string translation280 = { .data = 33, .tail = { 115, 156, 186, 131, 241, 131, 164, 157, 70, 186, 117, 212, 109, 153, 28, 52, 141, 116, 235, 168 } }; // return expected '%q' but got '%q'
+const struct compressed_string translation281 = { .data = 14, .tail = { 120, 197, 146, 124, 191, 70, 83, 244, 95, 48 } }; // rsplit(None,n)
+const struct compressed_string translation282 = { .data = 19, .tail = { 138, 116, 58, 230, 198, 58, 228, 242, 99, 124, 218, 192 } }; // schedule queue full
+const struct compressed_string translation283 = { .data = 10, .tail = { 142, 140, 242, 28, 202, 160 } }; // short read
+const struct compressed_string translation284 = { .data = 43, .tail = { 132, 225, 66, 180, 130, 181, 155, 185, 212, 34, 136, 151, 69, 224, 110, 207, 114, 145, 24, 58, 38, 232, 110 } }; // sign not allowed in string format specifier
+const struct compressed_string translation285 = { .data = 50, .tail = { 132, 225, 66, 180, 130, 181, 155, 185, 212, 119, 73, 232, 17, 100, 248, 55, 27, 179, 220, 164, 70, 14, 137, 186, 27, 141, 105, 168 } }; // sign not allowed with integer format specifier 'c'
+const struct compressed_string translation286 = { .data = 18, .tail = { 139, 149, 172, 17, 100, 55, 99, 125, 236, 221, 192 } }; // small int overflow
+const struct compressed_string translation287 = { .data = 24, .tail = { 134, 203, 208, 198, 10, 199, 50, 98, 89, 133, 137, 248, 48 } }; // source palette too large
+const struct compressed_string translation288 = { .data = 49, .tail = { 134, 203, 208, 253, 118, 73, 185, 96, 95, 49, 35, 161, 118, 49, 216, 173, 147, 245, 163, 101, 100, 54, 227, 237, 12, 227, 239, 253, 191, 183, 238, 251, 192 } }; // source_bitmap must have value_count of 2 or 65536
+const struct compressed_string translation289 = { .data = 44, .tail = { 134, 203, 208, 253, 118, 73, 185, 96, 95, 49, 35, 161, 118, 49, 216, 173, 147, 245, 163, 101, 100, 54, 227, 239, 253, 191, 183, 238, 251, 192 } }; // source_bitmap must have value_count of 65536
+const struct compressed_string translation290 = { .data = 40, .tail = { 134, 203, 208, 253, 118, 73, 185, 96, 95, 49, 35, 161, 118, 49, 216, 173, 147, 245, 163, 101, 100, 54, 227, 247, 0 } }; // source_bitmap must have value_count of 8
+const struct compressed_string translation291 = { .data = 27, .tail = { 140, 89, 38, 81, 120, 29, 210, 122, 8, 206, 223, 10, 22, 39, 46, 112 } }; // splitting with sub-captures
+const struct compressed_string translation292 = { .data = 17, .tail = { 137, 39, 159, 176, 214, 161, 22, 169, 67, 128 } }; // start/end indices
+const struct compressed_string translation293 = { .data = 30, .tail = { 137, 115, 43, 134, 193, 185, 74, 50, 133, 105, 17, 156, 97, 158, 78, 160 } }; // stream operation not supported
+const struct compressed_string translation294 = { .data = 35, .tail = { 137, 116, 94, 1, 63, 25, 185, 172, 142, 233, 61, 27, 50, 9, 65, 173, 26, 168, 188, 0 } }; // string argument without an encoding
+const struct compressed_string translation295 = { .data = 25, .tail = { 137, 116, 94, 2, 45, 79, 192, 108, 200, 109, 195, 146, 240, 96 } }; // string index out of range
+const struct compressed_string translation296 = { .data = 39, .tail = { 137, 116, 94, 2, 45, 82, 135, 2, 249, 137, 27, 24, 69, 147, 224, 222, 61, 2, 180, 141, 32 } }; // string indices must be integers, not %s
+const struct compressed_string translation297 = { .data = 19, .tail = { 137, 124, 210, 127, 1, 66, 93, 100, 34, 212, 252, 0 } }; // struct: can't index
+const struct compressed_string translation298 = { .data = 26, .tail = { 137, 124, 210, 127, 0, 139, 83, 240, 27, 50, 27, 112, 228, 188, 24 } }; // struct: index out of range
+const struct compressed_string translation299 = { .data = 17, .tail = { 137, 124, 210, 127, 0, 172, 55, 67, 181, 96 } }; // struct: no fields
+const struct compressed_string translation300 = { .data = 19, .tail = { 140, 237, 18, 232, 188, 5, 105, 27, 182, 86, 160 } }; // substring not found
+const struct compressed_string translation301 = { .data = 23, .tail = { 140, 224, 223, 203, 204, 80, 151, 89, 27, 162, 212, 65, 219, 112 } }; // super() can't find self
+const struct compressed_string translation302 = { .data = 20, .tail = { 142, 86, 75, 192, 55, 118, 112, 138, 63, 227, 245, 254, 159, 160 } }; // syntax error in JSON
+const struct compressed_string translation303 = { .data = 34, .tail = { 142, 86, 75, 192, 55, 118, 112, 138, 51, 73, 231, 7, 2, 167, 20, 116, 196, 179, 128 } }; // syntax error in uctypes descriptor
+const struct compressed_string translation304 = { .data = 23, .tail = { 148, 167, 188, 4, 89, 55, 236, 86, 13, 216, 223, 123, 55, 112 } }; // ticks interval overflow
+const struct compressed_string translation305 = { .data = 13, .tail = { 150, 97, 114, 94, 65, 63, 16 } }; // too many args
+const struct compressed_string translation306 = { .data = 39, .tail = { 150, 97, 114, 94, 71, 98, 182, 78, 4, 176, 202, 224, 169, 238, 60, 143, 198, 14, 146, 117, 26, 87, 204 } }; // too many values to unpack (expected %d)
+const struct compressed_string translation307 = { .data = 40, .tail = { 158, 112, 99, 93, 58, 234, 18, 2, 180, 130, 80, 84, 161, 226, 75, 107, 24, 216, 160, 196, 243, 131 } }; // type '%q' is not an acceptable base type
+const struct compressed_string translation308 = { .data = 38, .tail = { 158, 112, 97, 182, 246, 58, 72, 215, 78, 186, 142, 133, 1, 88, 20, 203, 166, 217, 147, 26, 233, 215, 80 } }; // type object '%q' has no attribute '%q'
+const struct compressed_string translation309 = { .data = 27, .tail = { 158, 112, 98, 75, 220, 224, 124, 131, 56, 251, 129, 63, 25, 185, 172, 192 } }; // type takes 1 or 3 arguments
+const struct compressed_string translation310 = { .data = 27, .tail = { 202, 147, 242, 27, 3, 78, 161, 90, 66, 95, 22, 59, 154, 201, 212 } }; // unary op %q not implemented
+const struct compressed_string translation311 = { .data = 17, .tail = { 202, 159, 140, 29, 36, 234, 17, 106, 107, 32 } }; // unexpected indent
+const struct compressed_string translation312 = { .data = 32, .tail = { 202, 159, 140, 29, 36, 234, 61, 207, 158, 236, 245, 4, 252, 102, 230, 178, 53, 211, 174, 160 } }; // unexpected keyword argument '%q'
+const struct compressed_string translation313 = { .data = 20, .tail = { 202, 165, 26, 166, 20, 174, 96, 226, 133, 131, 128 } }; // unicode name escapes
+const struct compressed_string translation314 = { .data = 45, .tail = { 202, 162, 212, 214, 69, 88, 225, 117, 145, 114, 154, 116, 4, 188, 134, 204, 155, 132, 90, 154, 200, 177, 246, 59, 0 } }; // unindent doesn't match any outer indent level
+const struct compressed_string translation315 = { .data = 31, .tail = { 202, 251, 171, 119, 81, 70, 94, 198, 240, 140, 162, 48, 116, 77, 208, 220, 105, 64 } }; // unknown conversion specifier %c
+const struct compressed_string translation316 = { .data = 48, .tail = { 202, 251, 171, 119, 81, 187, 61, 202, 69, 26, 166, 53, 210, 154, 141, 217, 195, 109, 236, 116, 144, 219, 137, 231, 6, 53, 211, 174, 160 } }; // unknown format code '%c' for object of type '%q'
+const struct compressed_string translation317 = { .data = 17, .tail = { 202, 251, 171, 119, 81, 60, 224, 198, 186, 117, 212 } }; // unknown type '%q'
+const struct compressed_string translation318 = { .data = 24, .tail = { 202, 220, 166, 157, 14, 163, 93, 41, 168, 69, 27, 179, 220, 164 } }; // unmatched '%c' in format
+const struct compressed_string translation319 = { .data = 20, .tail = { 202, 185, 149, 75, 107, 24, 41, 151, 77, 179, 38 } }; // unreadable attribute
+const struct compressed_string translation320 = { .data = 24, .tail = { 202, 198, 113, 134, 121, 58, 141, 146, 110, 88, 21, 60, 79, 64 } }; // unsupported bitmap depth
+const struct compressed_string translation321 = { .data = 36, .tail = { 202, 198, 113, 134, 121, 58, 138, 53, 153, 227, 5, 67, 27, 179, 143, 230, 155, 255, 219, 164, 155, 128 } }; // unsupported colorspace for GifWriter
+const struct compressed_string translation322 = { .data = 33, .tail = { 202, 198, 113, 134, 121, 58, 138, 53, 153, 227, 5, 67, 27, 179, 138, 164, 244, 55 } }; // unsupported colorspace for dither
+const struct compressed_string translation323 = { .data = 52, .tail = { 202, 198, 113, 134, 121, 58, 141, 217, 238, 82, 41, 208, 156, 169, 38, 227, 93, 41, 168, 242, 248, 248, 211, 199, 152, 41, 8, 181, 63, 3, 74, 128 } }; // unsupported format character '%c' (0x%x) at index %d
+const struct compressed_string translation324 = { .data = 29, .tail = { 202, 198, 113, 134, 121, 58, 137, 231, 6, 55, 103, 26, 117, 252, 6, 186, 70, 160 } }; // unsupported type for %q: '%s'
+const struct compressed_string translation325 = { .data = 36, .tail = { 202, 198, 113, 134, 121, 58, 137, 231, 7, 3, 118, 113, 167, 95, 192, 107, 167, 93, 125, 6, 186, 117, 212 } }; // unsupported types for %q: '%q', '%q'
+const struct compressed_string translation326 = { .data = 28, .tail = { 236, 86, 201, 139, 230, 36, 110, 146, 17, 70, 149, 27, 115, 39, 229, 30, 96 } }; // value must fit in %d byte(s)
+const struct compressed_string translation327 = { .data = 28, .tail = { 236, 86, 201, 134, 204, 134, 220, 57, 47, 6, 27, 113, 36, 252, 28, 128 } }; // value out of range of target
+const struct compressed_string translation328 = { .data = 82, .tail = { 238, 105, 199, 73, 129, 124, 196, 141, 140, 16, 131, 235, 147, 90, 24, 238, 147, 208, 18, 134, 173, 68, 117, 201, 57, 133, 205, 246, 55, 13, 184, 59, 29, 205, 102, 7, 150, 99, 37, 107, 114, 63, 204, 51, 143, 183, 246, 249, 128 } }; // weights must be a sequence with an odd square number of elements (usually 9 or 25)
+const struct compressed_string translation329 = { .data = 60, .tail = { 238, 105, 199, 73, 129, 124, 196, 141, 140, 18, 134, 219, 216, 233, 33, 183, 19, 206, 12, 105, 215, 208, 105, 215, 208, 105, 215, 208, 51, 141, 58, 250, 5, 105, 26, 117, 0 } }; // weights must be an object of type %q, %q, %q, or %q, not %q 
+const struct compressed_string translation330 = { .data = 25, .tail = { 238, 236, 188, 5, 205, 246, 55, 13, 184, 39, 227, 55, 53, 152 } }; // wrong number of arguments
+
+// 10073 bytes worth of translations
+// 6332 bytes worth of translations compressed
+// 3741 bytes saved
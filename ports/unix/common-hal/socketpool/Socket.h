@@ -0,0 +1,46 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_UNIX_COMMON_HAL_SOCKETPOOL_SOCKET_H
+#define MICROPY_INCLUDED_UNIX_COMMON_HAL_SOCKETPOOL_SOCKET_H
+
+// Sockets for the web workflow in the coverage build. They are connected to
+// the simulated clients in web_workflow_sim.c rather than to a network.
+
+#include "py/obj.h"
+
+#include "common-hal/socketpool/SocketPool.h"
+
+typedef struct {
+    mp_obj_base_t base;
+    // -1 when closed, 0 for the listening socket, otherwise the client number.
+    int num;
+} socketpool_socket_obj_t;
+
+// Unblock workflow socket select thread (platform specific)
+void socketpool_socket_poll_resume(void);
+
+#endif // MICROPY_INCLUDED_UNIX_COMMON_HAL_SOCKETPOOL_SOCKET_H
@@ -17,6 +17,12 @@
 #include "py/stream.h"
 #include "py/binary.h"
 #include "py/bc.h"
+// CIRCUITPY-CHANGE
+#include "supervisor/flash.h"
+#include "external_flash_sim.h"
+#include "port_heap_sim.h"
+#include "shared-bindings/bitmaptools/__init__.h"
+#include "shared-bindings/displayio/Bitmap.h"
 
 // expected output of this file is found in extra_coverage.py.exp
 
@@ -115,6 +121,84 @@ STATIC MP_DEFINE_CONST_OBJ_TYPE(
     locals_dict, &rawfile_locals_dict
     );
 
+// CIRCUITPY-CHANGE: stream testing object that can notify select.poll
+typedef struct _mp_obj_stest_notify_t {
+    mp_obj_base_t base;
+    mp_stream_notify_t notify;
+    uint16_t poll_count;
+    bool ready;
+    // Become ready (and notify if armed_notify) once the next poll has started.
+    bool armed;
+    bool armed_notify;
+} mp_obj_stest_notify_t;
+
+STATIC mp_obj_t stest_notify_fire(mp_obj_t o_in) {
+    mp_obj_stest_notify_t *o = MP_OBJ_TO_PTR(o_in);
+    o->ready = true;
+    if (o->armed_notify) {
+        mp_stream_notify(&o->notify);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(stest_notify_fire_obj, stest_notify_fire);
+
+STATIC mp_obj_t stest_notify_arm(mp_obj_t o_in, mp_obj_t notify_in) {
+    mp_obj_stest_notify_t *o = MP_OBJ_TO_PTR(o_in);
+    o->ready = false;
+    o->armed = true;
+    o->armed_notify = mp_obj_is_true(notify_in);
+    o->poll_count = 0;
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(stest_notify_arm_obj, stest_notify_arm);
+
+STATIC mp_obj_t stest_notify_get_poll_count(mp_obj_t o_in) {
+    mp_obj_stest_notify_t *o = MP_OBJ_TO_PTR(o_in);
+    return MP_OBJ_NEW_SMALL_INT(o->poll_count);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(stest_notify_get_poll_count_obj, stest_notify_get_poll_count);
+
+STATIC mp_uint_t stest_notify_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    mp_obj_stest_notify_t *o = MP_OBJ_TO_PTR(o_in);
+    switch (request) {
+        case MP_STREAM_POLL:
+            o->poll_count++;
+            if (o->armed) {
+                // Runs from the poll loop, between two passes over the poll set.
+                o->armed = false;
+                mp_sched_schedule(MP_OBJ_FROM_PTR(&stest_notify_fire_obj), o_in);
+            }
+            return o->ready ? (arg & MP_STREAM_POLL_RD) : 0;
+        #if MICROPY_PY_SELECT_NOTIFY
+        case MP_STREAM_POLL_NOTIFY:
+            *(mp_stream_notify_t **)arg = &o->notify;
+            return 0;
+        #endif
+        default:
+            *errcode = MP_EINVAL;
+            return MP_STREAM_ERROR;
+    }
+}
+
+STATIC const mp_rom_map_elem_t stest_notify_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_arm), MP_ROM_PTR(&stest_notify_arm_obj) },
+    { MP_ROM_QSTR(MP_QSTR_poll_count), MP_ROM_PTR(&stest_notify_get_poll_count_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(stest_notify_locals_dict, stest_notify_locals_dict_table);
+
+STATIC const mp_stream_p_t stest_notify_stream_p = {
+    .ioctl = stest_notify_ioctl,
+};
+
+STATIC MP_DEFINE_CONST_OBJ_TYPE(
+    mp_type_stest_notify,
+    MP_QSTR_stest_notify,
+    MP_TYPE_FLAG_NONE,
+    protocol, &stest_notify_stream_p,
+    locals_dict, &stest_notify_locals_dict
+    );
+
 // stream read returns non-blocking error
 STATIC mp_uint_t stest_read2(mp_obj_t o_in, void *buf, mp_uint_t size, int *errcode) {
     (void)o_in;
@@ -182,6 +266,50 @@ STATIC void pairheap_test(size_t nops, int *ops) {
     mp_printf(&mp_plat_print, "\n");
 }
 
+// CIRCUITPY-CHANGE: external flash cache, tested against the simulated chip
+// in external_flash_sim.c. model holds what every block should contain.
+#define FLASH_TEST_BLOCKS ((EXTERNAL_FLASH_SIM_SIZE - SPI_FLASH_ERASE_SIZE) / FILESYSTEM_BLOCK_SIZE)
+STATIC uint8_t flash_test_model[FLASH_TEST_BLOCKS][FILESYSTEM_BLOCK_SIZE];
+
+STATIC void flash_test_write(uint32_t block, uint8_t value) {
+    memset(flash_test_model[block], value, FILESYSTEM_BLOCK_SIZE);
+    flash_test_model[block][0] = block;
+    supervisor_flash_write_blocks(flash_test_model[block], block, 1);
+}
+
+// Check that reads see every write and, once flushed, so does the chip itself.
+STATIC void flash_test_check(void) {
+    uint8_t buf[FILESYSTEM_BLOCK_SIZE];
+    bool reads_ok = true;
+    for (uint32_t block = 0; block < FLASH_TEST_BLOCKS; block++) {
+        reads_ok &= supervisor_flash_read_blocks(buf, block, 1) == 0 &&
+            memcmp(buf, flash_test_model[block], FILESYSTEM_BLOCK_SIZE) == 0;
+    }
+    supervisor_external_flash_flush();
+    bool chip_ok = memcmp(external_flash_sim_data, flash_test_model, sizeof(flash_test_model)) == 0;
+    mp_printf(&mp_plat_print, "erases %u reads %d chip %d\n",
+        (unsigned)external_flash_sim_erase_count, reads_ok, chip_ok);
+    external_flash_sim_erase_count = 0;
+}
+
+// CIRCUITPY-CHANGE: report the area of a bitmap that would be refreshed as
+// (x1, y1, x2, y2), or None if nothing is dirty, and start over as a display
+// refresh would.
+STATIC mp_obj_t bitmap_dirty_area(mp_obj_t bitmap_in) {
+    displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(mp_arg_validate_type(bitmap_in, &displayio_bitmap_type, MP_QSTR_bitmap));
+    if (displayio_area_empty(&bitmap->dirty_area)) {
+        return mp_const_none;
+    }
+    const displayio_area_t *area = &bitmap->dirty_area;
+    mp_obj_t items[] = {
+        MP_OBJ_NEW_SMALL_INT(area->x1), MP_OBJ_NEW_SMALL_INT(area->y1),
+        MP_OBJ_NEW_SMALL_INT(area->x2), MP_OBJ_NEW_SMALL_INT(area->y2),
+    };
+    displayio_bitmap_finish_refresh(bitmap);
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(bitmap_dirty_area_obj, bitmap_dirty_area);
+
 // function to run extra tests for things that can't be checked by scripts
 STATIC mp_obj_t extra_coverage(void) {
     // mp_printf (used by ports that don't have a native printf)
@@ -726,6 +854,99 @@ STATIC mp_obj_t extra_coverage(void) {
         mp_printf(&mp_plat_print, "%d %d\n", mp_obj_is_int(MP_OBJ_NEW_SMALL_INT(1)), mp_obj_is_int(mp_obj_new_int_from_ll(1)));
     }
 
+    // CIRCUITPY-CHANGE: external flash cache
+    {
+        mp_printf(&mp_plat_print, "# external flash\n");
+
+        supervisor_flash_init();
+        mp_printf(&mp_plat_print, "%u\n", (unsigned)supervisor_flash_get_block_count());
+        memset(flash_test_model, 0xff, sizeof(flash_test_model));
+
+        // Writes to erased blocks are programmed in place.
+        for (uint32_t block = 0; block < 16; block++) {
+            flash_test_write(block, 0x11);
+        }
+        flash_test_check();
+
+        // Logging: append to a file and update its FAT and directory blocks.
+        // Each flush erases the FAT and directory sectors once.
+        for (uint32_t line = 0; line < 40; line++) {
+            flash_test_write(16 + line, line);
+            flash_test_write(1, line);
+            flash_test_write(8, line);
+            if (line % 10 == 9) {
+                flash_test_check();
+            }
+        }
+
+        // Rewriting a cached block only updates ram.
+        for (uint32_t i = 0; i < 100; i++) {
+            flash_test_write(3, i);
+        }
+        flash_test_check();
+
+        // Writing to more sectors than can be cached writes the oldest back.
+        for (uint32_t block = 0; block < 6 * 8; block += 8) {
+            flash_test_write(block, 0x22);
+        }
+        flash_test_check();
+
+        // Without ram for the cache, sectors are staged in the scratch sector,
+        // which is also erased each time it's used.
+        supervisor_flash_release_cache();
+        port_heap_sim_mallocs_left = 0;
+        flash_test_write(2, 0x33);
+        flash_test_write(9, 0x33);
+        flash_test_write(9, 0x34);
+        flash_test_check();
+
+        // Running out partway through allocating the cache gives back what
+        // was allocated.
+        port_heap_sim_mallocs_left = 5;
+        flash_test_write(4, 0x44);
+        flash_test_write(5, 0x44);
+        flash_test_check();
+
+        port_heap_sim_mallocs_left = -1;
+        supervisor_flash_release_cache();
+    }
+
+    // CIRCUITPY-CHANGE: conversions into read-only bitmaps
+    {
+        mp_printf(&mp_plat_print, "# bitmaptools\n");
+
+        static uint32_t pixels[2] = { 0xa5a5a5a5, 0xa5a5a5a5 };
+        static const uint16_t source_pixels[8] = { 0 };
+        static uint8_t lookup[BITMAPTOOLS_PALETTE_LOOKUP_SIZE];
+        displayio_bitmap_t bitmap;
+        common_hal_displayio_bitmap_construct_from_buffer(&bitmap, 4, 2, 8, pixels, true);
+        bitmaptools_source_t source = { .data = source_pixels, .stride = 8, .width = 4, .height = 2 };
+
+        for (int i = 0; i < 4; i++) {
+            nlr_buf_t nlr;
+            if (nlr_push(&nlr) == 0) {
+                switch (i) {
+                    case 0:
+                        common_hal_bitmaptools_resize(&bitmap, &source, DISPLAYIO_COLORSPACE_L8, RESIZE_ALGORITHM_AREA);
+                        break;
+                    case 1:
+                        common_hal_bitmaptools_yuv422_to_rgb565(&bitmap, &source, DISPLAYIO_COLORSPACE_RGB565);
+                        break;
+                    case 2:
+                        common_hal_bitmaptools_rgb565_to_l8(&bitmap, &source, DISPLAYIO_COLORSPACE_RGB565);
+                        break;
+                    default:
+                        common_hal_bitmaptools_rgb565_to_palette(&bitmap, &source, DISPLAYIO_COLORSPACE_RGB565, lookup);
+                        break;
+                }
+                nlr_pop();
+            } else {
+                mp_obj_print_exception(&mp_plat_print, MP_OBJ_FROM_PTR(nlr.ret_val));
+            }
+        }
+        mp_printf(&mp_plat_print, "%08x %08x\n", (unsigned)pixels[0], (unsigned)pixels[1]);
+    }
+
     mp_printf(&mp_plat_print, "# end coverage.c\n");
 
     mp_obj_streamtest_t *s = mp_obj_malloc(mp_obj_streamtest_t, &mp_type_stest_fileio);
@@ -734,9 +955,15 @@ STATIC mp_obj_t extra_coverage(void) {
     s->pos = 0;
     s->error_code = 0;
     mp_obj_streamtest_t *s2 = mp_obj_malloc(mp_obj_streamtest_t, &mp_type_stest_textio2);
+    // CIRCUITPY-CHANGE
+    mp_obj_stest_notify_t *s3 = mp_obj_malloc(mp_obj_stest_notify_t, &mp_type_stest_notify);
+    s3->notify = 0;
+    s3->poll_count = 0;
+    s3->ready = false;
+    s3->armed = false;
 
     // return a tuple of data for testing on the Python side
-    mp_obj_t items[] = {(mp_obj_t)&str_no_hash_obj, (mp_obj_t)&bytes_no_hash_obj, MP_OBJ_FROM_PTR(s), MP_OBJ_FROM_PTR(s2)};
+    mp_obj_t items[] = {(mp_obj_t)&str_no_hash_obj, (mp_obj_t)&bytes_no_hash_obj, MP_OBJ_FROM_PTR(s), MP_OBJ_FROM_PTR(s2), MP_OBJ_FROM_PTR(s3)};
     return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
 }
 MP_DEFINE_CONST_FUN_OBJ_0(extra_coverage_obj, extra_coverage);
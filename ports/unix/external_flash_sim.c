@@ -0,0 +1,113 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "external_flash_sim.h"
+
+#include "shared-bindings/microcontroller/__init__.h"
+#include "supervisor/spi_flash_api.h"
+#include "supervisor/shared/external_flash/common_commands.h"
+#include "supervisor/shared/external_flash/external_flash.h"
+
+uint8_t external_flash_sim_data[EXTERNAL_FLASH_SIM_SIZE];
+uint32_t external_flash_sim_erase_count;
+uint32_t external_flash_sim_program_count;
+
+static bool write_enabled;
+
+void common_hal_mcu_delay_us(uint32_t delay) {
+    (void)delay;
+}
+
+void spi_flash_init(void) {
+    memset(external_flash_sim_data, 0xff, sizeof(external_flash_sim_data));
+    write_enabled = false;
+}
+
+void spi_flash_init_device(const external_flash_device *device) {
+    (void)device;
+}
+
+bool spi_flash_command(uint8_t command) {
+    if (command == CMD_ENABLE_WRITE) {
+        write_enabled = true;
+    } else if (command == CMD_DISABLE_WRITE) {
+        write_enabled = false;
+    }
+    return true;
+}
+
+bool spi_flash_read_command(uint8_t command, uint8_t *response, uint32_t length) {
+    memset(response, 0, length);
+    if (command == CMD_READ_JEDEC_ID && length == 3) {
+        // Matches UNIX_SIM_FLASH in external_flash_sim_devices.h.
+        response[0] = 0xef;
+        response[1] = 0x40;
+        response[2] = 0x10;
+    }
+    // Operations finish immediately so the status registers always read as
+    // idle.
+    return true;
+}
+
+bool spi_flash_write_command(uint8_t command, uint8_t *data, uint32_t length) {
+    (void)command;
+    (void)data;
+    (void)length;
+    return true;
+}
+
+bool spi_flash_sector_command(uint8_t command, uint32_t address) {
+    if (command != CMD_SECTOR_ERASE || !write_enabled || address >= EXTERNAL_FLASH_SIM_SIZE) {
+        return false;
+    }
+    address &= ~(SPI_FLASH_ERASE_SIZE - 1);
+    memset(external_flash_sim_data + address, 0xff, SPI_FLASH_ERASE_SIZE);
+    external_flash_sim_erase_count++;
+    write_enabled = false;
+    return true;
+}
+
+bool spi_flash_write_data(uint32_t address, uint8_t *data, uint32_t data_length) {
+    if (!write_enabled || address + data_length > EXTERNAL_FLASH_SIM_SIZE) {
+        return false;
+    }
+    for (uint32_t i = 0; i < data_length; i++) {
+        external_flash_sim_data[address + i] &= data[i];
+    }
+    external_flash_sim_program_count++;
+    write_enabled = false;
+    return true;
+}
+
+bool spi_flash_read_data(uint32_t address, uint8_t *data, uint32_t data_length) {
+    if (address + data_length > EXTERNAL_FLASH_SIM_SIZE) {
+        return false;
+    }
+    memcpy(data, external_flash_sim_data + address, data_length);
+    return true;
+}
@@ -0,0 +1,42 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_UNIX_EXTERNAL_FLASH_SIM_H
+#define MICROPY_INCLUDED_UNIX_EXTERNAL_FLASH_SIM_H
+
+#include <stdint.h>
+
+// A NOR flash chip in ram, for testing supervisor/shared/external_flash in the
+// coverage build. Erases set a sector to 0xff and programs can only clear bits,
+// like the real thing.
+
+#define EXTERNAL_FLASH_SIM_SIZE (1 << 16)
+
+extern uint8_t external_flash_sim_data[EXTERNAL_FLASH_SIM_SIZE];
+extern uint32_t external_flash_sim_erase_count;
+extern uint32_t external_flash_sim_program_count;
+
+#endif // MICROPY_INCLUDED_UNIX_EXTERNAL_FLASH_SIM_H
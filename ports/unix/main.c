@@ -624,6 +624,12 @@ MP_NOINLINE int main_(int argc, char **argv) {
         // CIRCUITPY-CHANGE: test native base classes work as needed by CircuitPython libraries.
         extern const mp_obj_type_t native_base_class_type;
         mp_store_global(MP_QSTR_NativeBaseClass, MP_OBJ_FROM_PTR(&native_base_class_type));
+        // CIRCUITPY-CHANGE: drive the web workflow with simulated clients.
+        extern const mp_obj_module_t web_workflow_sim_module;
+        mp_store_global(MP_QSTR_web_workflow_sim, MP_OBJ_FROM_PTR(&web_workflow_sim_module));
+        // CIRCUITPY-CHANGE: check which part of a bitmap is marked for refresh.
+        MP_DECLARE_CONST_FUN_OBJ_1(bitmap_dirty_area_obj);
+        mp_store_global(MP_QSTR_bitmap_dirty_area, MP_OBJ_FROM_PTR(&bitmap_dirty_area_obj));
         mp_store_global(MP_QSTR_getenv_int, MP_OBJ_FROM_PTR(&mod_os_getenv_int_obj));
         mp_store_global(MP_QSTR_getenv_str, MP_OBJ_FROM_PTR(&mod_os_getenv_str_obj));
     }
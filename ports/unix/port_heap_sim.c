@@ -0,0 +1,56 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+
+#include "port_heap_sim.h"
+
+#include "supervisor/port_heap.h"
+
+int port_heap_sim_mallocs_left = -1;
+int port_heap_sim_blocks;
+
+void *port_malloc(size_t size, bool dma_capable) {
+    (void)dma_capable;
+    if (port_heap_sim_mallocs_left == 0) {
+        return NULL;
+    }
+    if (port_heap_sim_mallocs_left > 0) {
+        port_heap_sim_mallocs_left--;
+    }
+    void *ptr = malloc(size);
+    if (ptr != NULL) {
+        port_heap_sim_blocks++;
+    }
+    return ptr;
+}
+
+void port_free(void *ptr) {
+    if (ptr != NULL) {
+        port_heap_sim_blocks--;
+    }
+    free(ptr);
+}
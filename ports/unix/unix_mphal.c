@@ -35,6 +35,8 @@
 #include "py/mpthread.h"
 #include "py/runtime.h"
 #include "extmod/misc.h"
+// CIRCUITPY-CHANGE
+#include "py/profile.h"
 
 #if defined(__GLIBC__) && defined(__GLIBC_PREREQ)
 #if __GLIBC_PREREQ(2, 25)
@@ -72,6 +74,38 @@ STATIC void sighandler(int signum) {
 }
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PROF_SAMPLING && !defined(_WIN32)
+// Drive the sampling profiler from SIGPROF, which fires after the given
+// amount of CPU time (not wall time) has been used by the process.
+
+STATIC void prof_sighandler(int signum) {
+    (void)signum;
+    mp_prof_sample();
+}
+
+STATIC void prof_set_timer(mp_uint_t period_us) {
+    struct itimerval it;
+    it.it_interval.tv_sec = period_us / 1000000;
+    it.it_interval.tv_usec = period_us % 1000000;
+    it.it_value = it.it_interval;
+    setitimer(ITIMER_PROF, &it, NULL);
+}
+
+void mp_prof_sampling_port_start(mp_uint_t period_us) {
+    struct sigaction sa;
+    sa.sa_flags = SA_RESTART;
+    sa.sa_handler = prof_sighandler;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGPROF, &sa, NULL);
+    prof_set_timer(period_us);
+}
+
+void mp_prof_sampling_port_stop(void) {
+    prof_set_timer(0);
+}
+#endif
+
 // CIRCUITPY-CHANGE: mp_hal_set_interrupt_char(int) instead of char
 void mp_hal_set_interrupt_char(int c) {
     // configure terminal settings to (not) let ctrl-C through
@@ -41,6 +41,17 @@
 #define MICROPY_DEBUG_PARSE_RULE_NAME  (1)
 #define MICROPY_TRACKED_ALLOC          (1)
 #define MICROPY_WARNINGS_CATEGORY      (1)
+#define MICROPY_COMP_STREAMING         (1)
+#define MICROPY_MODULE_BYTECODE_CACHE  (1)
+#define MICROPY_MODULE_BYTECODE_CACHE_DIR ".mpycache"
+#define MICROPY_PROF_SAMPLING          (1)
+#define MICROPY_FATFS_TINY             (0)
+#define MICROPY_FATFS_SECTOR_CACHE_LINES (8)
+// Take VfsLfs buffers from the C heap to exercise the port heap code.
+#include <stdlib.h>
+#define MICROPY_VFS_LFS_PORT_HEAP      (1)
+#define MICROPY_VFS_LFS_PORT_HEAP_ALLOC(size) malloc(size)
+#define MICROPY_VFS_LFS_PORT_HEAP_FREE(ptr) free(ptr)
 
 // CIRCUITPY-CHANGE: Disable things never used in circuitpython
 #define MICROPY_PY_CRYPTOLIB          (0)
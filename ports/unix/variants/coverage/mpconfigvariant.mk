@@ -10,6 +10,11 @@ CFLAGS += \
 
 LDFLAGS += -fprofile-arcs -ftest-coverage
 
+# CIRCUITPY-CHANGE: littlefs isn't used by CircuitPython ports, but build it
+# here so that VfsLfs stays tested.
+MICROPY_VFS_LFS1 = 1
+MICROPY_VFS_LFS2 = 1
+
 FROZEN_MANIFEST ?= $(VARIANT_DIR)/manifest.py
 USER_C_MODULES = $(TOP)/examples/usercmodule
 
@@ -22,6 +27,9 @@ $(BUILD)/lib/quirc/lib/%.o: CFLAGS += -Wno-shadow -Wno-sign-compare -include sha
 SRC_C += lib/tjpgd/src/tjpgd.c
 $(BUILD)/lib/tjpgd/src/tjpgd.o: CFLAGS += -Wno-shadow -Wno-cast-align
 
+SRC_C += lib/AnimatedGIF/gif.c
+$(BUILD)/lib/AnimatedGIF/gif.o: CFLAGS += -DCIRCUITPY
+
 SRC_BITMAP := \
 	shared/runtime/context_manager_helpers.c \
 	displayio_min.c \
@@ -40,9 +48,18 @@ SRC_BITMAP := \
 	shared-bindings/displayio/Bitmap.c \
 	shared-bindings/displayio/ColorConverter.c \
 	shared-bindings/displayio/Palette.c \
+	shared-bindings/gifio/__init__.c \
+	shared-bindings/gifio/GifWriter.c \
+	shared-bindings/gifio/OnDiskGif.c \
 	shared-bindings/jpegio/__init__.c \
 	shared-bindings/jpegio/JpegDecoder.c \
 	shared-bindings/locale/__init__.c \
+	shared-bindings/msgpack/__init__.c \
+	shared-bindings/msgpack/ExtType.c \
+	shared-bindings/pngio/__init__.c \
+	shared-bindings/pngio/PngDecoder.c \
+	shared-bindings/qoiio/__init__.c \
+	shared-bindings/qoiio/QoiDecoder.c \
 	shared-bindings/rainbowio/__init__.c \
 	shared-bindings/struct/__init__.c \
 	shared-bindings/synthio/__init__.c \
@@ -55,6 +72,8 @@ SRC_BITMAP := \
 	shared-bindings/traceback/__init__.c \
 	shared-bindings/util.c \
 	shared-bindings/zlib/__init__.c \
+	shared-bindings/zlib/Compress.c \
+	shared-bindings/zlib/Decompress.c \
 	shared-module/aesio/aes.c \
 	shared-module/aesio/__init__.c \
 	shared-module/audiocore/__init__.c \
@@ -69,9 +88,15 @@ SRC_BITMAP := \
 	shared-module/displayio/Bitmap.c \
 	shared-module/displayio/ColorConverter.c \
 	shared-module/displayio/Palette.c \
+	shared-module/gifio/__init__.c \
+	shared-module/gifio/GifWriter.c \
+	shared-module/gifio/OnDiskGif.c \
 	shared-module/jpegio/__init__.c \
 	shared-module/jpegio/JpegDecoder.c \
+	shared-module/msgpack/__init__.c \
 	shared-module/os/getenv.c \
+	shared-module/pngio/PngDecoder.c \
+	shared-module/qoiio/QoiDecoder.c \
 	shared-module/rainbowio/__init__.c \
 	shared-module/struct/__init__.c \
 	shared-module/synthio/__init__.c \
@@ -83,6 +108,8 @@ SRC_BITMAP := \
 	shared-module/synthio/Synthesizer.c \
 	shared-module/traceback/__init__.c \
 	shared-module/zlib/__init__.c \
+	shared-module/zlib/Compress.c \
+	shared-module/zlib/Decompress.c \
 
 SRC_C += $(SRC_BITMAP)
 
@@ -98,7 +125,10 @@ CFLAGS += \
 	-DCIRCUITPY_GIFIO=1 \
 	-DCIRCUITPY_JPEGIO=1 \
 	-DCIRCUITPY_LOCALE=1 \
+	-DCIRCUITPY_MSGPACK=1 \
 	-DCIRCUITPY_OS_GETENV=1 \
+	-DCIRCUITPY_PNGIO=1 \
+	-DCIRCUITPY_QOIIO=1 \
 	-DCIRCUITPY_RAINBOWIO=1 \
 	-DCIRCUITPY_STRUCT=1 \
 	-DCIRCUITPY_SYNTHIO=1 \
@@ -106,6 +136,31 @@ CFLAGS += \
 	-DCIRCUITPY_TRACEBACK=1 \
 	-DCIRCUITPY_ZLIB=1
 
+# CIRCUITPY-CHANGE: test the external flash cache against a simulated chip.
+SRC_C += supervisor/shared/external_flash/external_flash.c external_flash_sim.c port_heap_sim.c
+CFLAGS += \
+	-DCIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS=4 \
+	-DCIRCUITPY_PROCESSOR_COUNT=1 \
+	-DEXTERNAL_FLASH_DEVICES=UNIX_SIM_FLASH \
+	-DFILESYSTEM_BLOCK_SIZE=512
+QSTR_GLOBAL_REQUIREMENTS += $(BUILD)/genhdr/devices.h
+$(BUILD)/genhdr/devices.h: external_flash_sim_devices.h
+	$(Q)install -d $(BUILD)/genhdr
+	$(Q)cp $< $@
+
+# CIRCUITPY-CHANGE: test the web workflow against simulated clients.
+SRC_C += supervisor/shared/web_workflow/web_workflow.c web_workflow_sim.c
+$(BUILD)/supervisor/shared/web_workflow/web_workflow.o: CFLAGS += \
+	-DCIRCUITPY_WEB_WORKFLOW=1 \
+	-DCIRCUITPY_WEB_WORKFLOW_CONNECTIONS=3 \
+	-DCIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE=4096 \
+	-DCIRCUITPY_WIFI=1 \
+	-DCIRCUITPY_BOARD_ID='"unix_coverage"' \
+	-DCIRCUITPY_CREATOR_ID=0 \
+	-DCIRCUITPY_CREATION_ID=0 \
+	-DMICROPY_HW_BOARD_NAME='"unix"' \
+	-DMICROPY_HW_MCU_NAME='"coverage"'
+
 # CIRCUITPY-CHANGE: test native base classes.
 SRC_C += coverage.c native_base_class.c
 SRC_CXX += coveragecpp.cpp
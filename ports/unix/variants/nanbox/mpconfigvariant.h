@@ -27,6 +27,12 @@
 // This config is mostly used to ensure that the nan-boxing object model
 // continues to build (i.e. catches usage of mp_obj_t that don't work with
 // this representation).
+//
+// CIRCUITPY-CHANGE
+// With nan-boxing floats are stored inline in mp_obj_t, so together with
+// MICROPY_OPT_FLOAT_BINARY_OP_FAST_PATH float arithmetic in the VM does not
+// allocate on the heap.  Build with `make VARIANT=nanbox` (needs a 32-bit
+// toolchain) to benchmark float-heavy code without GC overhead.
 
 #define MICROPY_CONFIG_ROM_LEVEL (MICROPY_CONFIG_ROM_LEVEL_EXTRA_FEATURES)
 
@@ -36,6 +42,9 @@
 // select nan-boxing object model
 #define MICROPY_OBJ_REPR (MICROPY_OBJ_REPR_D)
 
+// handle float arithmetic inline in the VM
+#define MICROPY_OPT_FLOAT_BINARY_OP_FAST_PATH (1)
+
 // native emitters don't work with nan-boxing
 #define MICROPY_EMIT_X86 (0)
 #define MICROPY_EMIT_X64 (0)
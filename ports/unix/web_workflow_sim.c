@@ -0,0 +1,483 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// Stand-ins for the network, radio and supervisor services used by the web
+// workflow, so that its request handling can be tested in the coverage build.
+// Python drives simulated clients through the web_workflow_sim module.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "py/mperrno.h"
+#include "py/objstr.h"
+#include "py/runtime.h"
+#include "extmod/vfs.h"
+#include "extmod/vfs_fat.h"
+#include "shared-bindings/hashlib/__init__.h"
+#include "shared-bindings/microcontroller/Processor.h"
+#include "shared-bindings/socketpool/Socket.h"
+#include "shared-bindings/socketpool/SocketPool.h"
+#include "shared-bindings/wifi/__init__.h"
+#include "supervisor/fatfs.h"
+#include "supervisor/filesystem.h"
+#include "supervisor/port.h"
+#include "supervisor/shared/reload.h"
+#include "supervisor/shared/tick.h"
+#include "supervisor/shared/web_workflow/web_workflow.h"
+#include "supervisor/shared/web_workflow/websocket.h"
+#include "supervisor/shared/workflow.h"
+#include "supervisor/workflow.h"
+
+#include "port_heap_sim.h"
+
+#define SIM_CLIENTS (16)
+
+typedef struct {
+    bool accepted;
+    bool server_closed;
+    bool client_closed;
+    // Sent by the client and not yet received by the server.
+    uint8_t *in;
+    size_t in_len;
+    size_t in_pos;
+    // Sent by the server and not yet received by the client.
+    uint8_t *out;
+    size_t out_len;
+} sim_client_t;
+
+static sim_client_t clients[SIM_CLIENTS];
+static size_t client_count;
+// How much the server can send to a client that isn't receiving.
+static size_t send_window = SIZE_MAX;
+static uint64_t ticks_ms;
+static uint32_t autoreload_suspended;
+static bool radio_enabled;
+
+static sim_client_t *sim_client(mp_obj_t id_in) {
+    mp_int_t id = mp_obj_get_int(id_in);
+    if (id < 0 || (size_t)id >= client_count) {
+        mp_raise_ValueError(NULL);
+    }
+    return &clients[id];
+}
+
+static sim_client_t *socket_client(socketpool_socket_obj_t *self) {
+    if (self->num <= 0) {
+        return NULL;
+    }
+    return &clients[self->num - 1];
+}
+
+// Supervisor services.
+
+uint64_t supervisor_ticks_ms64(void) {
+    return ticks_ms;
+}
+
+void port_yield(void) {
+}
+
+void supervisor_workflow_request_background(void) {
+}
+
+void autoreload_suspend(uint32_t suspend_reason_mask) {
+    autoreload_suspended |= suspend_reason_mask;
+}
+
+void autoreload_resume(uint32_t suspend_reason_mask) {
+    autoreload_suspended &= ~suspend_reason_mask;
+}
+
+void autoreload_trigger(void) {
+}
+
+void override_fattime(DWORD time) {
+    (void)time;
+}
+
+mcu_reset_reason_t common_hal_mcu_processor_get_reset_reason(void) {
+    return RESET_REASON_POWER_ON;
+}
+
+// The file system mounted at / stands in for CIRCUITPY.
+fs_user_mount_t *filesystem_circuitpy(void) {
+    for (mp_vfs_mount_t *vfs = MP_STATE_VM(vfs_mount_table); vfs != NULL; vfs = vfs->next) {
+        if (vfs->len == 1 && mp_obj_is_type(vfs->obj, &mp_fat_vfs_type)) {
+            return MP_OBJ_TO_PTR(vfs->obj);
+        }
+    }
+    return NULL;
+}
+
+bool filesystem_native_fatfs(fs_user_mount_t *fs_mount) {
+    return fs_mount->base.type == &mp_fat_vfs_type;
+}
+
+bool filesystem_lock(fs_user_mount_t *fs_mount) {
+    fs_mount->lock_count += 1;
+    return true;
+}
+
+void filesystem_unlock(fs_user_mount_t *fs_mount) {
+    fs_mount->lock_count -= 1;
+}
+
+FRESULT supervisor_workflow_move(const char *old_path, const char *new_path) {
+    (void)old_path;
+    (void)new_path;
+    return FR_DENIED;
+}
+
+FRESULT supervisor_workflow_mkdir_parents(DWORD fattime, char *path) {
+    (void)fattime;
+    (void)path;
+    return FR_DENIED;
+}
+
+FRESULT supervisor_workflow_delete_recursive(const char *full_path) {
+    (void)full_path;
+    return FR_DENIED;
+}
+
+void websocket_init(void) {
+}
+
+void websocket_handoff(socketpool_socket_obj_t *socket) {
+    common_hal_socketpool_socket_close(socket);
+}
+
+void websocket_background(void) {
+}
+
+bool common_hal_hashlib_new(hashlib_hash_obj_t *self, const char *algorithm) {
+    (void)self;
+    (void)algorithm;
+    return false;
+}
+
+void common_hal_hashlib_hash_update(hashlib_hash_obj_t *self, const uint8_t *data, size_t datalen) {
+    (void)self;
+    (void)data;
+    (void)datalen;
+}
+
+void common_hal_hashlib_hash_digest(hashlib_hash_obj_t *self, uint8_t *data, size_t datalen) {
+    (void)self;
+    memset(data, 0, datalen);
+}
+
+size_t common_hal_hashlib_hash_get_digest_size(hashlib_hash_obj_t *self) {
+    (void)self;
+    return 0;
+}
+
+#define SIM_STATIC_FILE(filename) \
+    uint8_t filename[] = #filename; \
+    uint32_t filename##_length = sizeof(#filename) - 1; \
+    uint32_t filename##_crc = 0; \
+    const char *filename##_content_type = "text/plain";
+
+SIM_STATIC_FILE(code_html)
+SIM_STATIC_FILE(directory_html)
+SIM_STATIC_FILE(directory_js)
+SIM_STATIC_FILE(welcome_html)
+SIM_STATIC_FILE(welcome_js)
+SIM_STATIC_FILE(edit_html)
+SIM_STATIC_FILE(edit_js)
+SIM_STATIC_FILE(style_css)
+SIM_STATIC_FILE(serial_html)
+SIM_STATIC_FILE(serial_js)
+SIM_STATIC_FILE(blinka_32x32_ico)
+
+// The radio is always in range of the network.
+
+wifi_radio_obj_t common_hal_wifi_radio_obj;
+
+void common_hal_wifi_init(bool user_initiated) {
+    (void)user_initiated;
+}
+
+bool common_hal_wifi_radio_get_enabled(wifi_radio_obj_t *self) {
+    (void)self;
+    return radio_enabled;
+}
+
+void common_hal_wifi_radio_set_enabled(wifi_radio_obj_t *self, bool enabled) {
+    (void)self;
+    radio_enabled = enabled;
+}
+
+wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len) {
+    (void)self;
+    (void)ssid;
+    (void)ssid_len;
+    (void)password;
+    (void)password_len;
+    (void)channel;
+    (void)timeout;
+    (void)bssid;
+    (void)bssid_len;
+    return WIFI_RADIO_ERROR_NONE;
+}
+
+uint32_t wifi_radio_get_ipv4_address(wifi_radio_obj_t *self) {
+    (void)self;
+    // 192.168.0.2
+    return 0x0200a8c0;
+}
+
+// Sockets. The listening socket accepts clients created by connect().
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    socketpool_socketpool_type,
+    MP_QSTR_SocketPool,
+    MP_TYPE_FLAG_NONE
+    );
+
+void common_hal_socketpool_socketpool_construct(socketpool_socketpool_obj_t *self, mp_obj_t radio) {
+    (void)self;
+    (void)radio;
+}
+
+bool socketpool_socket(socketpool_socketpool_obj_t *self,
+    socketpool_socketpool_addressfamily_t family, socketpool_socketpool_sock_t type,
+    int proto, socketpool_socket_obj_t *sock) {
+    (void)self;
+    (void)family;
+    (void)type;
+    (void)proto;
+    sock->num = 0;
+    return true;
+}
+
+void socketpool_socket_reset(socketpool_socket_obj_t *self) {
+    self->base.type = NULL;
+    self->num = -1;
+}
+
+void socketpool_socket_poll_resume(void) {
+}
+
+bool common_hal_socketpool_socket_bind(socketpool_socket_obj_t *self, const char *host, size_t hostlen, uint32_t port) {
+    (void)self;
+    (void)host;
+    (void)hostlen;
+    (void)port;
+    return true;
+}
+
+bool common_hal_socketpool_socket_listen(socketpool_socket_obj_t *self, int backlog) {
+    (void)self;
+    (void)backlog;
+    return true;
+}
+
+void common_hal_socketpool_socket_settimeout(socketpool_socket_obj_t *self, uint32_t timeout_ms) {
+    (void)self;
+    (void)timeout_ms;
+}
+
+int common_hal_socketpool_socket_setsockopt(socketpool_socket_obj_t *self, int level, int optname, const void *value, size_t optlen) {
+    (void)self;
+    (void)level;
+    (void)optname;
+    (void)value;
+    (void)optlen;
+    return 0;
+}
+
+int socketpool_socket_accept(socketpool_socket_obj_t *self, uint8_t *ip, uint32_t *port, socketpool_socket_obj_t *accepted) {
+    (void)self;
+    (void)ip;
+    (void)port;
+    for (size_t i = 0; i < client_count; i++) {
+        if (!clients[i].accepted && !clients[i].client_closed) {
+            clients[i].accepted = true;
+            accepted->num = i + 1;
+            return accepted->num;
+        }
+    }
+    return -MP_EAGAIN;
+}
+
+void common_hal_socketpool_socket_close(socketpool_socket_obj_t *self) {
+    sim_client_t *client = socket_client(self);
+    if (client != NULL) {
+        client->server_closed = true;
+    }
+    self->num = -1;
+}
+
+bool common_hal_socketpool_socket_get_closed(socketpool_socket_obj_t *self) {
+    return self->num < 0;
+}
+
+bool common_hal_socketpool_socket_get_connected(socketpool_socket_obj_t *self) {
+    sim_client_t *client = socket_client(self);
+    return client != NULL && !client->client_closed;
+}
+
+int socketpool_socket_recv_into(socketpool_socket_obj_t *self, const uint8_t *buf, uint32_t len) {
+    sim_client_t *client = socket_client(self);
+    if (client == NULL) {
+        return -MP_ENOTCONN;
+    }
+    size_t available = client->in_len - client->in_pos;
+    if (available == 0) {
+        return client->client_closed ? 0 : -MP_EAGAIN;
+    }
+    len = MIN(len, available);
+    memcpy((uint8_t *)buf, client->in + client->in_pos, len);
+    client->in_pos += len;
+    return len;
+}
+
+int socketpool_socket_send(socketpool_socket_obj_t *self, const uint8_t *buf, uint32_t len) {
+    sim_client_t *client = socket_client(self);
+    if (client == NULL || client->client_closed) {
+        return -MP_ENOTCONN;
+    }
+    if (client->out_len >= send_window) {
+        return -MP_EAGAIN;
+    }
+    len = MIN(len, send_window - client->out_len);
+    client->out = realloc(client->out, client->out_len + len);
+    memcpy(client->out + client->out_len, buf, len);
+    client->out_len += len;
+    return len;
+}
+
+// The Python side.
+
+STATIC mp_obj_t web_workflow_sim_start(void) {
+    return mp_obj_new_bool(supervisor_start_web_workflow(false));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(web_workflow_sim_start_obj, web_workflow_sim_start);
+
+STATIC mp_obj_t web_workflow_sim_background(void) {
+    supervisor_web_workflow_background(NULL);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(web_workflow_sim_background_obj, web_workflow_sim_background);
+
+// Returns the number of a new client, which the workflow accepts in its next
+// background call.
+STATIC mp_obj_t web_workflow_sim_connect(void) {
+    if (client_count == SIM_CLIENTS) {
+        mp_raise_OSError(MP_ENOMEM);
+    }
+    memset(&clients[client_count], 0, sizeof(sim_client_t));
+    return MP_OBJ_NEW_SMALL_INT(client_count++);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(web_workflow_sim_connect_obj, web_workflow_sim_connect);
+
+STATIC mp_obj_t web_workflow_sim_send(mp_obj_t id_in, mp_obj_t data_in) {
+    sim_client_t *client = sim_client(id_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data_in, &bufinfo, MP_BUFFER_READ);
+    client->in = realloc(client->in, client->in_len + bufinfo.len);
+    memcpy(client->in + client->in_len, bufinfo.buf, bufinfo.len);
+    client->in_len += bufinfo.len;
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(web_workflow_sim_send_obj, web_workflow_sim_send);
+
+// Returns everything the server has sent to the client since the last call.
+STATIC mp_obj_t web_workflow_sim_recv(mp_obj_t id_in) {
+    sim_client_t *client = sim_client(id_in);
+    mp_obj_t result = mp_obj_new_bytes(client->out, client->out_len);
+    client->out_len = 0;
+    return result;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(web_workflow_sim_recv_obj, web_workflow_sim_recv);
+
+STATIC mp_obj_t web_workflow_sim_hangup(mp_obj_t id_in) {
+    sim_client(id_in)->client_closed = true;
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(web_workflow_sim_hangup_obj, web_workflow_sim_hangup);
+
+// Whether the server has accepted the client and not closed the connection.
+STATIC mp_obj_t web_workflow_sim_is_open(mp_obj_t id_in) {
+    sim_client_t *client = sim_client(id_in);
+    return mp_obj_new_bool(client->accepted && !client->server_closed);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(web_workflow_sim_is_open_obj, web_workflow_sim_is_open);
+
+STATIC mp_obj_t web_workflow_sim_sleep_ms(mp_obj_t ms_in) {
+    ticks_ms += mp_obj_get_int(ms_in);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(web_workflow_sim_sleep_ms_obj, web_workflow_sim_sleep_ms);
+
+// Limit how much the server can send to a client before it has to wait, or
+// -1 for no limit.
+STATIC mp_obj_t web_workflow_sim_set_window(mp_obj_t window_in) {
+    send_window = mp_obj_get_int(window_in);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(web_workflow_sim_set_window_obj, web_workflow_sim_set_window);
+
+// Whether autoreload is held off by a request in progress.
+STATIC mp_obj_t web_workflow_sim_busy(void) {
+    return mp_obj_new_bool(autoreload_suspended & AUTORELOAD_SUSPEND_WEB);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(web_workflow_sim_busy_obj, web_workflow_sim_busy);
+
+STATIC mp_obj_t web_workflow_sim_heap_blocks(void) {
+    return MP_OBJ_NEW_SMALL_INT(port_heap_sim_blocks);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(web_workflow_sim_heap_blocks_obj, web_workflow_sim_heap_blocks);
+
+// Let n more port heap allocations succeed, or any number if n is -1.
+STATIC mp_obj_t web_workflow_sim_mallocs_left(mp_obj_t n_in) {
+    port_heap_sim_mallocs_left = mp_obj_get_int(n_in);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(web_workflow_sim_mallocs_left_obj, web_workflow_sim_mallocs_left);
+
+STATIC const mp_rom_map_elem_t web_workflow_sim_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_web_workflow_sim) },
+    { MP_ROM_QSTR(MP_QSTR_start), MP_ROM_PTR(&web_workflow_sim_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_background), MP_ROM_PTR(&web_workflow_sim_background_obj) },
+    { MP_ROM_QSTR(MP_QSTR_connect), MP_ROM_PTR(&web_workflow_sim_connect_obj) },
+    { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&web_workflow_sim_send_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recv), MP_ROM_PTR(&web_workflow_sim_recv_obj) },
+    { MP_ROM_QSTR(MP_QSTR_hangup), MP_ROM_PTR(&web_workflow_sim_hangup_obj) },
+    { MP_ROM_QSTR(MP_QSTR_is_open), MP_ROM_PTR(&web_workflow_sim_is_open_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sleep_ms), MP_ROM_PTR(&web_workflow_sim_sleep_ms_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_window), MP_ROM_PTR(&web_workflow_sim_set_window_obj) },
+    { MP_ROM_QSTR(MP_QSTR_busy), MP_ROM_PTR(&web_workflow_sim_busy_obj) },
+    { MP_ROM_QSTR(MP_QSTR_heap_blocks), MP_ROM_PTR(&web_workflow_sim_heap_blocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mallocs_left), MP_ROM_PTR(&web_workflow_sim_mallocs_left_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(web_workflow_sim_module_globals, web_workflow_sim_module_globals_table);
+
+const mp_obj_module_t web_workflow_sim_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&web_workflow_sim_module_globals,
+};
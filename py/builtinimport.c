@@ -38,6 +38,12 @@
 #include "py/runtime.h"
 #include "py/builtin.h"
 #include "py/frozenmod.h"
+// CIRCUITPY-CHANGE: for the import bytecode cache
+#if MICROPY_MODULE_BYTECODE_CACHE
+#include "py/reader.h"
+#include "py/stream.h"
+#include "extmod/vfs.h"
+#endif
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_PRINT (1)
@@ -161,6 +167,13 @@ STATIC void do_load_from_lexer(mp_module_context_t *context, mp_lexer_t *lex) {
 
     // parse, compile and execute the module in its context
     mp_obj_dict_t *mod_globals = context->module.globals;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_STREAMING
+    if (MP_STATE_VM(comp_streaming)) {
+        mp_parse_compile_execute_stmts(lex, mod_globals, mod_globals);
+        return;
+    }
+    #endif
     mp_parse_compile_execute(lex, MP_PARSE_FILE_INPUT, mod_globals, mod_globals);
 }
 #endif
@@ -197,6 +210,224 @@ STATIC void do_execute_raw_code(const mp_module_context_t *context, const mp_raw
 }
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_BYTECODE_CACHE
+
+// The bytecode cache keeps the compiled form of imported .py files in
+// MICROPY_MODULE_BYTECODE_CACHE_DIR. Each entry is named after a hash of the
+// source path and starts with a key record (source size, mtime, CRC32 and
+// path) followed by the .mpy data. An entry is only used if its key record
+// matches the source file exactly, so editing a file invalidates its entry.
+// The CRC catches edits that keep the size and that FAT's 2 second mtime, or
+// a board without a clock, can't tell apart.
+
+#define BYTECODE_CACHE_KEY_MAGIC 'K'
+
+STATIC mp_int_t bytecode_cache_stat(const char *path, size_t len, mp_obj_t *items_out) {
+    mp_obj_t stat = mp_vfs_stat(mp_obj_new_str(path, len));
+    size_t n;
+    mp_obj_t *items;
+    mp_obj_tuple_get(stat, &n, &items);
+    if (items_out != NULL) {
+        items_out[0] = items[6];
+        items_out[1] = items[8];
+    }
+    return mp_obj_get_int(items[0]);
+}
+
+// Cache errors only turn into a miss if they are filesystem errors (or, for a
+// corrupt entry, a ValueError from the loader). Anything else, such as
+// KeyboardInterrupt or MemoryError, is raised again.
+STATIC void bytecode_cache_check_error(nlr_buf_t *nlr, bool corrupt_ok) {
+    mp_obj_t exc = MP_OBJ_FROM_PTR(nlr->ret_val);
+    if (!mp_obj_exception_match(exc, MP_OBJ_FROM_PTR(&mp_type_OSError))
+        && !(corrupt_ok && mp_obj_exception_match(exc, MP_OBJ_FROM_PTR(&mp_type_ValueError)))) {
+        nlr_jump(nlr->ret_val);
+    }
+}
+
+// CRC32 of the source file, read in small pieces. This costs far less than
+// compiling it.
+STATIC uint32_t bytecode_cache_crc(const char *file_str, size_t file_len, mp_obj_t *file) {
+    mp_obj_t args[2] = { mp_obj_new_str(file_str, file_len), MP_OBJ_NEW_QSTR(MP_QSTR_rb) };
+    *file = mp_vfs_open(MP_ARRAY_SIZE(args), args, (mp_map_t *)&mp_const_empty_map);
+    uint32_t crc = 0xffffffff;
+    byte buf[64];
+    for (;;) {
+        int errcode;
+        mp_uint_t len = mp_stream_rw(*file, buf, sizeof(buf), &errcode, MP_STREAM_RW_READ | MP_STREAM_RW_ONCE);
+        if (len == MP_STREAM_ERROR) {
+            mp_raise_OSError(errcode);
+        }
+        if (len == 0) {
+            break;
+        }
+        for (mp_uint_t i = 0; i < len; ++i) {
+            crc ^= buf[i];
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+            }
+        }
+    }
+    mp_obj_t f = *file;
+    *file = MP_OBJ_NULL;
+    mp_stream_close(f);
+    return ~crc;
+}
+
+// Build the key record and the cache entry path for the given source file.
+// Returns false if the cache directory doesn't exist or the source can't be
+// stat'ed or read, in which case the module is compiled as normal.
+STATIC bool bytecode_cache_key(const char *file_str, size_t file_len, vstr_t *key, vstr_t *cache_path) {
+    mp_obj_t volatile file = MP_OBJ_NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) != 0) {
+        if (file != MP_OBJ_NULL) {
+            nlr_buf_t nlr_cleanup;
+            if (nlr_push(&nlr_cleanup) == 0) {
+                mp_stream_close(file);
+                nlr_pop();
+            }
+        }
+        bytecode_cache_check_error(&nlr, false);
+        return false;
+    }
+    const char *cache_dir = MICROPY_MODULE_BYTECODE_CACHE_DIR;
+    if ((bytecode_cache_stat(cache_dir, strlen(cache_dir), NULL) & MP_S_IFDIR) == 0) {
+        nlr_pop();
+        return false;
+    }
+    mp_obj_t size_mtime[2];
+    bytecode_cache_stat(file_str, file_len, size_mtime);
+    uint32_t size = mp_obj_get_int_truncated(size_mtime[0]);
+    uint32_t mtime = mp_obj_get_int_truncated(size_mtime[1]);
+    uint32_t crc = bytecode_cache_crc(file_str, file_len, (mp_obj_t *)&file);
+    nlr_pop();
+
+    vstr_add_byte(key, BYTECODE_CACHE_KEY_MAGIC);
+    for (size_t i = 0; i < 4; ++i) {
+        vstr_add_byte(key, size >> (8 * i));
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        vstr_add_byte(key, mtime >> (8 * i));
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        vstr_add_byte(key, crc >> (8 * i));
+    }
+    vstr_add_byte(key, file_len);
+    vstr_add_byte(key, file_len >> 8);
+    vstr_add_strn(key, file_str, file_len);
+
+    // FNV-1a hash of the path names the entry. Collisions just cause misses
+    // because the full path is part of the key record.
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < file_len; ++i) {
+        hash = (hash ^ (byte)file_str[i]) * 16777619u;
+    }
+    vstr_printf(cache_path, "%s/%08x.mpy", cache_dir, (unsigned int)hash);
+    return true;
+}
+
+// Try to load the cached bytecode for a module. Any failure, including a
+// missing, stale or corrupt entry, is reported as a miss.
+STATIC bool bytecode_cache_load(mp_compiled_module_t *cm, const vstr_t *key, const char *cache_path) {
+    mp_reader_t reader;
+    // Set while this function, rather than mp_raw_code_load, must close the reader.
+    volatile bool reader_open = false;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) != 0) {
+        if (reader_open) {
+            reader.close(reader.data);
+        }
+        bytecode_cache_check_error(&nlr, true);
+        return false;
+    }
+    mp_reader_new_file(&reader, cache_path);
+    reader_open = true;
+    for (size_t i = 0; i < key->len; ++i) {
+        if (reader.readbyte(reader.data) != (byte)key->buf[i]) {
+            reader.close(reader.data);
+            nlr_pop();
+            return false;
+        }
+    }
+    // This closes the reader, even if loading fails.
+    reader_open = false;
+    mp_raw_code_load(&reader, cm);
+    nlr_pop();
+    return true;
+}
+
+// Write the compiled module to the cache. Failures, such as a read-only
+// filesystem, are ignored and leave no partial entry behind.
+STATIC void bytecode_cache_save(mp_compiled_module_t *cm, const vstr_t *key, const char *cache_path) {
+    if (cm->has_native) {
+        // Native code can only be saved by mpy-cross.
+        return;
+    }
+    mp_obj_t path = mp_obj_new_str(cache_path, strlen(cache_path));
+    mp_obj_t volatile file = MP_OBJ_NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t args[2] = { path, MP_OBJ_NEW_QSTR(MP_QSTR_wb) };
+        file = mp_vfs_open(MP_ARRAY_SIZE(args), args, (mp_map_t *)&mp_const_empty_map);
+        mp_stream_write(file, key->buf, key->len, MP_STREAM_RW_WRITE);
+        mp_print_t print = {MP_OBJ_TO_PTR(file), mp_stream_write_adaptor};
+        mp_raw_code_save(cm, &print);
+        mp_stream_close(file);
+        nlr_pop();
+    } else {
+        if (file != MP_OBJ_NULL) {
+            nlr_buf_t nlr_cleanup;
+            if (nlr_push(&nlr_cleanup) == 0) {
+                mp_stream_close(file);
+                mp_vfs_remove(path);
+                nlr_pop();
+            }
+        }
+        bytecode_cache_check_error(&nlr, false);
+    }
+}
+
+// Load a .py module through the bytecode cache, compiling and caching it on a
+// miss. Returns false if the cache is unavailable.
+STATIC bool do_load_via_bytecode_cache(mp_module_context_t *context, const char *file_str, size_t file_len) {
+    #if MICROPY_COMP_STREAMING
+    // A streamed module is never compiled as a whole, so there is nothing to
+    // cache. Streaming is asked for to bound compile memory, so it wins.
+    if (MP_STATE_VM(comp_streaming)) {
+        return false;
+    }
+    #endif
+    vstr_t key;
+    vstr_t cache_path;
+    vstr_init(&key, 20 + file_len);
+    vstr_init(&cache_path, sizeof(MICROPY_MODULE_BYTECODE_CACHE_DIR) + 14);
+    if (!bytecode_cache_key(file_str, file_len, &key, &cache_path)) {
+        vstr_clear(&key);
+        vstr_clear(&cache_path);
+        return false;
+    }
+
+    mp_compiled_module_t cm;
+    cm.context = context;
+    const char *cache_path_str = vstr_null_terminated_str(&cache_path);
+    if (!bytecode_cache_load(&cm, &key, cache_path_str)) {
+        mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
+        qstr source_name = lex->source_name;
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        mp_compile_to_raw_code(&parse_tree, source_name, false, &cm);
+        bytecode_cache_save(&cm, &key, cache_path_str);
+    }
+    vstr_clear(&key);
+    vstr_clear(&cache_path);
+
+    do_execute_raw_code(context, cm.rc, file_str);
+    return true;
+}
+
+#endif // MICROPY_MODULE_BYTECODE_CACHE
+
 STATIC void do_load(mp_module_context_t *module_obj, vstr_t *file) {
     #if MICROPY_MODULE_FROZEN || MICROPY_ENABLE_COMPILER || (MICROPY_PERSISTENT_CODE_LOAD && MICROPY_HAS_FILE_READER)
     const char *file_str = vstr_null_terminated_str(file);
@@ -249,6 +480,12 @@ STATIC void do_load(mp_module_context_t *module_obj, vstr_t *file) {
     // If we can compile scripts then load the file and compile and execute it.
     #if MICROPY_ENABLE_COMPILER
     {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_MODULE_BYTECODE_CACHE
+        if (do_load_via_bytecode_cache(module_obj, file_str, file->len)) {
+            return;
+        }
+        #endif
         mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
         do_load_from_lexer(module_obj, lex);
         return;
@@ -303,6 +303,9 @@ endif
 ifeq ($(CIRCUITPY_PICODVI),1)
 SRC_PATTERNS += picodvi/%
 endif
+ifeq ($(CIRCUITPY_PNGIO),1)
+SRC_PATTERNS += pngio/%
+endif
 ifeq ($(CIRCUITPY_PS2IO),1)
 SRC_PATTERNS += ps2io/%
 endif
@@ -312,6 +315,9 @@ endif
 ifeq ($(CIRCUITPY_PWMIO),1)
 SRC_PATTERNS += pwmio/%
 endif
+ifeq ($(CIRCUITPY_QOIIO),1)
+SRC_PATTERNS += qoiio/%
+endif
 ifeq ($(CIRCUITPY_QRIO),1)
 SRC_PATTERNS += qrio/%
 endif
@@ -673,6 +679,8 @@ SRC_SHARED_MODULE_ALL = \
 	onewireio/OneWire.c \
 	os/__init__.c \
 	paralleldisplaybus/ParallelBus.c \
+	pngio/PngDecoder.c \
+	qoiio/QoiDecoder.c \
 	qrio/__init__.c \
 	qrio/QRDecoder.c \
 	rainbowio/__init__.c \
@@ -713,6 +721,8 @@ SRC_SHARED_MODULE_ALL = \
 	warnings/__init__.c \
 	watchdog/__init__.c \
 	zlib/__init__.c \
+	zlib/Compress.c \
+	zlib/Decompress.c \
 
 # All possible sources are listed here, and are filtered by SRC_PATTERNS.
 SRC_SHARED_MODULE = $(filter $(SRC_PATTERNS), $(SRC_SHARED_MODULE_ALL))
@@ -800,7 +810,7 @@ SRC_MOD += $(addprefix lib/protomatter/src/, \
 $(BUILD)/lib/protomatter/src/core.o: CFLAGS += -include "shared-module/rgbmatrix/allocator.h" -DCIRCUITPY -Wno-missing-braces -Wno-missing-prototypes
 endif
 
-ifeq ($(CIRCUITPY_ZLIB),1)
+ifneq ($(filter 1,$(CIRCUITPY_ZLIB) $(CIRCUITPY_PNGIO)),)
 SRC_MOD += $(addprefix lib/uzlib/, \
 	tinflate.c \
 	tinfzlib.c \
@@ -73,6 +73,8 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_ALLOC_PATH_MAX           (96)
 #define MICROPY_CAN_OVERRIDE_BUILTINS    (1)
 #define MICROPY_COMP_CONST               (1)
+#define MICROPY_COMP_STREAMING           (CIRCUITPY_STREAMING_COMPILE)
+#define MICROPY_COMP_STREAMING_DEFAULT   (CIRCUITPY_STREAMING_COMPILE)
 #define MICROPY_COMP_DOUBLE_TUPLE_ASSIGN (1)
 #define MICROPY_COMP_MODULE_CONST        (1)
 #define MICROPY_COMP_TRIPLE_TUPLE_ASSIGN (0)
@@ -102,13 +104,16 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_MEM_STATS                (0)
 #define MICROPY_MODULE_BUILTIN_INIT      (1)
 #define MICROPY_MODULE_BUILTIN_SUBPACKAGES (1)
+#define MICROPY_MODULE_BYTECODE_CACHE    (CIRCUITPY_BYTECODE_CACHE)
 #define MICROPY_NONSTANDARD_TYPECODES    (0)
 #define MICROPY_OPT_COMPUTED_GOTO        (1)
 #define MICROPY_OPT_COMPUTED_GOTO_SAVE_SPACE (CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE)
+#define MICROPY_OPT_FLOAT_BINARY_OP_FAST_PATH (CIRCUITPY_OPT_FLOAT_BINARY_OP_FAST_PATH)
 #define MICROPY_OPT_LOAD_ATTR_FAST_PATH  (CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 #define MICROPY_OPT_MAP_LOOKUP_CACHE  (CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (CIRCUITPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE)
 #define MICROPY_PERSISTENT_CODE_LOAD     (1)
+#define MICROPY_PROF_SAMPLING            (CIRCUITPY_SAMPLING_PROFILER)
 
 #define MICROPY_PY_ARRAY                 (CIRCUITPY_ARRAY)
 #define MICROPY_PY_ARRAY_SLICE_ASSIGN    (1)
@@ -180,6 +185,8 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_FATFS_RPATH           (2)
 #define MICROPY_FATFS_MULTI_PARTITION (1)
 #define MICROPY_FATFS_LFN_UNICODE      2  // UTF-8
+#define MICROPY_FATFS_TINY            (CIRCUITPY_FATFS_TINY)
+#define MICROPY_FATFS_SECTOR_CACHE_LINES (CIRCUITPY_FATFS_SECTOR_CACHE_LINES)
 
 // Only enable this if you really need it. It allocates a byte cache of this size.
 // #define MICROPY_FATFS_MAX_SS           (4096)
@@ -263,6 +270,12 @@ typedef long mp_off_t;
 #define MICROPY_PY_RE_MATCH_GROUPS           (CIRCUITPY_RE)
 #define MICROPY_PY_RE_MATCH_SPAN_START_END   (CIRCUITPY_RE)
 #define MICROPY_PY_RE_SUB                    (CIRCUITPY_RE)
+#ifndef MICROPY_PY_RE_CACHE
+#define MICROPY_PY_RE_CACHE                  (CIRCUITPY_FULL_BUILD ? 4 : 0)
+#endif
+#ifndef MICROPY_PY_RE_DFA_STATES
+#define MICROPY_PY_RE_DFA_STATES             (CIRCUITPY_FULL_BUILD ? 16 : 0)
+#endif
 
 #define CIRCUITPY_MICROPYTHON_ADVANCED        (0)
 
@@ -424,6 +437,10 @@ void background_callback_run_all(void);
 #define MICROPY_VM_HOOK_LOOP RUN_BACKGROUND_TASKS;
 #define MICROPY_VM_HOOK_RETURN RUN_BACKGROUND_TASKS;
 
+// From supervisor/shared/tick.c
+void supervisor_idle_until_interrupt(uint32_t max_ms);
+#define MICROPY_PY_SELECT_NOTIFY_IDLE(ms) supervisor_idle_until_interrupt(ms)
+
 // CIRCUITPY_AUTORELOAD_DELAY_MS = 0 will completely disable autoreload.
 #ifndef CIRCUITPY_AUTORELOAD_DELAY_MS
 #define CIRCUITPY_AUTORELOAD_DELAY_MS 750
@@ -433,6 +450,26 @@ void background_callback_run_all(void);
 #define CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS 1000
 #endif
 
+// Size of the buffer the web workflow reads files into while serving them.
+// Larger buffers mean fewer, fuller TCP segments.
+#ifndef CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE
+#define CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE (4096)
+#endif
+
+// Number of clients the web workflow serves at once. Each one holds a file
+// buffer and its request state in RAM.
+#ifndef CIRCUITPY_WEB_WORKFLOW_CONNECTIONS
+#define CIRCUITPY_WEB_WORKFLOW_CONNECTIONS (3)
+#endif
+
+// Number of external flash erase sectors whose writes are cached in ram before
+// being written back. Each takes SPI_FLASH_ERASE_SIZE bytes of the port heap
+// while it holds writes, which is also memory the VM heap can't grow into, so
+// boards with RAM to spare opt in to more than one.
+#ifndef CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS (1)
+#endif
+
 #ifndef CIRCUITPY_PYSTACK_SIZE
 #define CIRCUITPY_PYSTACK_SIZE 1536
 #endif
@@ -174,6 +174,16 @@ CFLAGS += -DCIRCUITPY_BUSDEVICE=$(CIRCUITPY_BUSDEVICE)
 CIRCUITPY_BUILTINS_POW3 ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_BUILTINS_POW3=$(CIRCUITPY_BUILTINS_POW3)
 
+# Cache compiled bytecode of imported .py files in /.mpycache, when that
+# directory exists.
+CIRCUITPY_BYTECODE_CACHE ?= 0
+CFLAGS += -DCIRCUITPY_BYTECODE_CACHE=$(CIRCUITPY_BYTECODE_CACHE)
+
+# Compile and run .py files one top-level statement at a time, to bound the
+# memory used by the parser and compiler.
+CIRCUITPY_STREAMING_COMPILE ?= 0
+CFLAGS += -DCIRCUITPY_STREAMING_COMPILE=$(CIRCUITPY_STREAMING_COMPILE)
+
 CIRCUITPY_BUSIO ?= 1
 CFLAGS += -DCIRCUITPY_BUSIO=$(CIRCUITPY_BUSIO)
 
@@ -281,6 +291,20 @@ CFLAGS += -DCIRCUITPY_ESPCAMERA=$(CIRCUITPY_ESPCAMERA)
 CIRCUITPY__EVE ?= 0
 CFLAGS += -DCIRCUITPY__EVE=$(CIRCUITPY__EVE)
 
+# Number of FatFs sectors cached per mounted filesystem, taken from the port
+# heap at mount time. 0 disables the cache.
+ifeq ($(CIRCUITPY_FULL_BUILD),1)
+CIRCUITPY_FATFS_SECTOR_CACHE_LINES ?= 8
+else
+CIRCUITPY_FATFS_SECTOR_CACHE_LINES ?= 0
+endif
+CFLAGS += -DCIRCUITPY_FATFS_SECTOR_CACHE_LINES=$(CIRCUITPY_FATFS_SECTOR_CACHE_LINES)
+
+# Give each open file its own sector buffer instead of sharing the
+# filesystem's single window.
+CIRCUITPY_FATFS_TINY ?= $(call enable-if-not,$(CIRCUITPY_FULL_BUILD))
+CFLAGS += -DCIRCUITPY_FATFS_TINY=$(CIRCUITPY_FATFS_TINY)
+
 CIRCUITPY_FLOPPYIO ?= 0
 CFLAGS += -DCIRCUITPY_FLOPPYIO=$(CIRCUITPY_FLOPPYIO)
 
@@ -377,6 +401,9 @@ CFLAGS += -DCIRCUITPY_NVM=$(CIRCUITPY_NVM)
 CIRCUITPY_ONEWIREIO ?= $(CIRCUITPY_BUSIO)
 CFLAGS += -DCIRCUITPY_ONEWIREIO=$(CIRCUITPY_ONEWIREIO)
 
+CIRCUITPY_OPT_FLOAT_BINARY_OP_FAST_PATH ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_FLOAT_BINARY_OP_FAST_PATH=$(CIRCUITPY_OPT_FLOAT_BINARY_OP_FAST_PATH)
+
 CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH ?= 1
 CFLAGS += -DCIRCUITPY_OPT_LOAD_ATTR_FAST_PATH=$(CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 
@@ -400,6 +427,10 @@ CFLAGS += -DCIRCUITPY_PIXELBUF=$(CIRCUITPY_PIXELBUF)
 CIRCUITPY_PIXELMAP ?= $(CIRCUITPY_PIXELBUF)
 CFLAGS += -DCIRCUITPY_PIXELMAP=$(CIRCUITPY_PIXELMAP)
 
+# Uses the inflate code of zlib, which is built for it even without zlib
+CIRCUITPY_PNGIO ?= $(CIRCUITPY_JPEGIO)
+CFLAGS += -DCIRCUITPY_PNGIO=$(CIRCUITPY_PNGIO)
+
 # Only for SAMD boards for the moment
 CIRCUITPY_PS2IO ?= 0
 CFLAGS += -DCIRCUITPY_PS2IO=$(CIRCUITPY_PS2IO)
@@ -410,6 +441,9 @@ CFLAGS += -DCIRCUITPY_PULSEIO=$(CIRCUITPY_PULSEIO)
 CIRCUITPY_PWMIO ?= 1
 CFLAGS += -DCIRCUITPY_PWMIO=$(CIRCUITPY_PWMIO)
 
+CIRCUITPY_QOIIO ?= $(CIRCUITPY_JPEGIO)
+CFLAGS += -DCIRCUITPY_QOIIO=$(CIRCUITPY_QOIIO)
+
 CIRCUITPY_QRIO ?= $(CIRCUITPY_IMAGECAPTURE)
 CFLAGS += -DCIRCUITPY_QRIO=$(CIRCUITPY_QRIO)
 
@@ -457,6 +491,10 @@ CFLAGS += -DCIRCUITPY_SAFEMODE_PY=$(CIRCUITPY_SAFEMODE_PY)
 CIRCUITPY_SAMD ?= 0
 CFLAGS += -DCIRCUITPY_SAMD=$(CIRCUITPY_SAMD)
 
+# Sampling profiler (micropython.prof_start() etc.) driven by the supervisor tick.
+CIRCUITPY_SAMPLING_PROFILER ?= 0
+CFLAGS += -DCIRCUITPY_SAMPLING_PROFILER=$(CIRCUITPY_SAMPLING_PROFILER)
+
 CIRCUITPY_SDCARDIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_SDCARDIO=$(CIRCUITPY_SDCARDIO)
 
@@ -635,6 +673,10 @@ CFLAGS += -DCIRCUITPY_WIFI=$(CIRCUITPY_WIFI)
 CIRCUITPY_WEB_WORKFLOW ?= $(CIRCUITPY_WIFI)
 CFLAGS += -DCIRCUITPY_WEB_WORKFLOW=$(CIRCUITPY_WEB_WORKFLOW)
 
+# Store the web workflow's static files gzip compressed and send them as is.
+CIRCUITPY_WEB_WORKFLOW_STATIC_GZIP ?= 1
+CFLAGS += -DCIRCUITPY_WEB_WORKFLOW_STATIC_GZIP=$(CIRCUITPY_WEB_WORKFLOW_STATIC_GZIP)
+
 CIRCUITPY_WIFI_RADIO_SETTABLE_MAC_ADDRESS?= 1
 CFLAGS += -DCIRCUITPY_WIFI_RADIO_SETTABLE_MAC_ADDRESS=$(CIRCUITPY_WIFI_RADIO_SETTABLE_MAC_ADDRESS)
 
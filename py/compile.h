@@ -43,4 +43,10 @@ void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool
 // this is implemented in runtime.c
 mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_input_kind, mp_obj_dict_t *globals, mp_obj_dict_t *locals);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_STREAMING
+// like mp_parse_compile_execute with MP_PARSE_FILE_INPUT, but one top-level statement at a time
+void mp_parse_compile_execute_stmts(mp_lexer_t *lex, mp_obj_dict_t *globals, mp_obj_dict_t *locals);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_COMPILE_H
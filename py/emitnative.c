@@ -2608,6 +2608,15 @@ STATIC void emit_native_store_map(emit_t *emit) {
 #if MICROPY_PY_BUILTINS_SLICE
 STATIC void emit_native_build_slice(emit_t *emit, mp_uint_t n_args) {
     DEBUG_printf("build_slice %d\n", n_args);
+    // CIRCUITPY-CHANGE: in viper code the arguments may be native values, so
+    // convert them to objects (this leaves them in place on the stack)
+    for (mp_uint_t i = 0; i < n_args; ++i) {
+        if (peek_vtype(emit, i) != VTYPE_PYOBJ) {
+            emit_get_stack_pointer_to_reg_for_pop(emit, REG_ARG_1, n_args);
+            adjust_stack(emit, n_args);
+            break;
+        }
+    }
     if (n_args == 2) {
         vtype_kind_t vtype_start, vtype_stop;
         emit_pre_pop_reg_reg(emit, &vtype_stop, REG_ARG_2, &vtype_start, REG_ARG_1); // arg1 = start, arg2 = stop
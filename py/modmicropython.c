@@ -31,6 +31,8 @@
 #include "py/runtime.h"
 #include "py/gc.h"
 #include "py/mphal.h"
+// CIRCUITPY-CHANGE
+#include "py/profile.h"
 
 #if MICROPY_PY_MICROPYTHON
 
@@ -49,6 +51,52 @@ STATIC mp_obj_t mp_micropython_opt_level(size_t n_args, const mp_obj_t *args) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_opt_level_obj, 0, 1, mp_micropython_opt_level);
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_STREAMING
+STATIC mp_obj_t mp_micropython_compile_streaming(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        return mp_obj_new_bool(MP_STATE_VM(comp_streaming));
+    } else {
+        MP_STATE_VM(comp_streaming) = mp_obj_is_true(args[0]);
+        return mp_const_none;
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_compile_streaming_obj, 0, 1, mp_micropython_compile_streaming);
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_PROF_SAMPLING
+STATIC mp_obj_t mp_micropython_prof_start(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_period_us, ARG_samples };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_period_us, MP_ARG_INT, {.u_int = 1000} },
+        { MP_QSTR_samples, MP_ARG_INT, {.u_int = 256} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_int_t period_us = mp_arg_validate_int_min(args[ARG_period_us].u_int, 1, MP_QSTR_period_us);
+    mp_int_t samples = mp_arg_validate_int_min(args[ARG_samples].u_int, 1, MP_QSTR_samples);
+    mp_prof_sampling_start(period_us, samples);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mp_micropython_prof_start_obj, 0, mp_micropython_prof_start);
+
+STATIC mp_obj_t mp_micropython_prof_stop(void) {
+    return mp_obj_new_int_from_uint(mp_prof_sampling_stop());
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(mp_micropython_prof_stop_obj, mp_micropython_prof_stop);
+
+STATIC mp_obj_t mp_micropython_prof_flat(size_t n_args, const mp_obj_t *args) {
+    return mp_prof_sampling_flat(n_args == 0 || mp_obj_is_true(args[0]));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_prof_flat_obj, 0, 1, mp_micropython_prof_flat);
+
+STATIC mp_obj_t mp_micropython_prof_stacks(void) {
+    return mp_prof_sampling_stacks();
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(mp_micropython_prof_stacks_obj, mp_micropython_prof_stacks);
+#endif
+
 #if CIRCUITPY_MICROPYTHON_ADVANCED && MICROPY_PY_MICROPYTHON_MEM_INFO
 
 #if MICROPY_MEM_STATS
@@ -172,6 +220,17 @@ STATIC const mp_rom_map_elem_t mp_module_micropython_globals_table[] = {
     #if CIRCUITPY_MICROPYTHON_ADVANCED && MICROPY_ENABLE_COMPILER
     { MP_ROM_QSTR(MP_QSTR_opt_level), MP_ROM_PTR(&mp_micropython_opt_level_obj) },
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_STREAMING
+    { MP_ROM_QSTR(MP_QSTR_compile_streaming), MP_ROM_PTR(&mp_micropython_compile_streaming_obj) },
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PROF_SAMPLING
+    { MP_ROM_QSTR(MP_QSTR_prof_start), MP_ROM_PTR(&mp_micropython_prof_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_prof_stop), MP_ROM_PTR(&mp_micropython_prof_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_prof_flat), MP_ROM_PTR(&mp_micropython_prof_flat_obj) },
+    { MP_ROM_QSTR(MP_QSTR_prof_stacks), MP_ROM_PTR(&mp_micropython_prof_stacks_obj) },
+    #endif
     #if CIRCUITPY_MICROPYTHON_ADVANCED && MICROPY_PY_MICROPYTHON_MEM_INFO
     #if MICROPY_MEM_STATS
     { MP_ROM_QSTR(MP_QSTR_mem_total), MP_ROM_PTR(&mp_micropython_mem_total_obj) },
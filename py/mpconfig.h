@@ -326,8 +326,9 @@
 // Whether to support saving of persistent code, i.e. for mpy-cross to
 // generate .mpy files. Enabling this enables additional metadata on raw code
 // objects which is also required for sys.settrace.
+// CIRCUITPY-CHANGE: also required by the import bytecode cache
 #ifndef MICROPY_PERSISTENT_CODE_SAVE
-#define MICROPY_PERSISTENT_CODE_SAVE (MICROPY_PY_SYS_SETTRACE)
+#define MICROPY_PERSISTENT_CODE_SAVE (MICROPY_PY_SYS_SETTRACE || MICROPY_MODULE_BYTECODE_CACHE)
 #endif
 
 // Whether to support saving persistent code to a file via mp_raw_code_save_file
@@ -483,6 +484,24 @@
 #define MICROPY_COMP_RETURN_IF_EXPR (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether imported .py files (and files run by pyexec) can be parsed, compiled
+// and executed one top-level statement at a time. Peak compile memory is then
+// bounded by the largest statement rather than the whole module, but a syntax
+// error is only reported once the statements before it have run, and the
+// source file stays open while the module executes. Streamed imports don't
+// use or fill the import bytecode cache (MICROPY_MODULE_BYTECODE_CACHE).
+// The mode is switched at runtime with micropython.compile_streaming().
+#ifndef MICROPY_COMP_STREAMING
+#define MICROPY_COMP_STREAMING (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether streaming compilation is on at startup.
+#ifndef MICROPY_COMP_STREAMING_DEFAULT
+#define MICROPY_COMP_STREAMING_DEFAULT (0)
+#endif
+
 /*****************************************************************************/
 /* Internal debugging stuff                                                  */
 
@@ -549,6 +568,15 @@
 #define MICROPY_OPT_COMPUTED_GOTO_SAVE_SPACE (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether the VM handles arithmetic and comparisons between a float and a
+// float or small int inline, instead of going through mp_binary_op and the
+// float type's binary_op slot.  With MICROPY_OBJ_REPR_C or _D floats are
+// immediate objects so such expressions also don't allocate on the heap.
+#ifndef MICROPY_OPT_FLOAT_BINARY_OP_FAST_PATH
+#define MICROPY_OPT_FLOAT_BINARY_OP_FAST_PATH (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Optimise the fast path for loading attributes from instance types. Increases
 // Thumb2 code size by about 48 bytes.
 #ifndef MICROPY_OPT_LOAD_ATTR_FAST_PATH
@@ -612,6 +640,31 @@
 #define MICROPY_FATFS_NUM_PERSISTENT (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether VfsLfs takes its cache and lookahead buffers from a heap outside
+// the GC heap when it can. The port then defines
+// MICROPY_VFS_LFS_PORT_HEAP_ALLOC(size), returning NULL when full, and
+// MICROPY_VFS_LFS_PORT_HEAP_FREE(ptr).
+#ifndef MICROPY_VFS_LFS_PORT_HEAP
+#define MICROPY_VFS_LFS_PORT_HEAP (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether FatFs uses its tiny buffer configuration, where all open files share
+// the volume's sector window. Set to 0 to give each open file its own
+// FF_MAX_SS-byte sector buffer, so that files read in turn don't reload it.
+#ifndef MICROPY_FATFS_TINY
+#define MICROPY_FATFS_TINY (1)
+#endif
+
+// CIRCUITPY-CHANGE
+// Number of sectors cached below FatFs for each mounted filesystem. The lines
+// are split between FAT, directory and data sectors so that streaming file
+// data doesn't evict the FAT. 0 disables the cache.
+#ifndef MICROPY_FATFS_SECTOR_CACHE_LINES
+#define MICROPY_FATFS_SECTOR_CACHE_LINES (0)
+#endif
+
 // Hook for the VM at the start of the opcode loop (can contain variable
 // definitions usable by the other hook functions)
 #ifndef MICROPY_VM_HOOK_INIT
@@ -938,6 +991,22 @@ typedef double mp_float_t;
 #define MICROPY_MODULE_FROZEN (MICROPY_MODULE_FROZEN_STR || MICROPY_MODULE_FROZEN_MPY)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether importing a .py file saves its compiled bytecode to a cache
+// directory, and later imports of the unchanged file load it from there
+// instead of compiling again. The cache is only used if the directory exists,
+// and not while streaming compilation (MICROPY_COMP_STREAMING) is switched on.
+// Requires MICROPY_VFS and MICROPY_PERSISTENT_CODE_LOAD.
+#ifndef MICROPY_MODULE_BYTECODE_CACHE
+#define MICROPY_MODULE_BYTECODE_CACHE (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Directory that holds the import bytecode cache.
+#ifndef MICROPY_MODULE_BYTECODE_CACHE_DIR
+#define MICROPY_MODULE_BYTECODE_CACHE_DIR "/.mpycache"
+#endif
+
 // Whether you can override builtins in the builtins module
 #ifndef MICROPY_CAN_OVERRIDE_BUILTINS
 #define MICROPY_CAN_OVERRIDE_BUILTINS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
@@ -1500,6 +1569,19 @@ typedef double mp_float_t;
 #define MICROPY_PY_SYS_SETTRACE (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to provide a sampling profiler via micropython.prof_start() and
+// friends.  The port must call mp_prof_sample() periodically (eg from a timer
+// interrupt) and implement mp_prof_sampling_port_start/stop to control that.
+#ifndef MICROPY_PROF_SAMPLING
+#define MICROPY_PROF_SAMPLING (0)
+#endif
+
+// Maximum number of frames recorded per sample, innermost first
+#ifndef MICROPY_PROF_SAMPLING_DEPTH
+#define MICROPY_PROF_SAMPLING_DEPTH (8)
+#endif
+
 // Whether to provide "sys.getsizeof" function
 #ifndef MICROPY_PY_SYS_GETSIZEOF
 #define MICROPY_PY_SYS_GETSIZEOF (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
@@ -1547,6 +1629,13 @@ typedef double mp_float_t;
 #define MICROPY_PY_SELECT_POSIX_OPTIMISATIONS (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether streams can notify the "select" module when they may have become
+// ready (see MP_STREAM_POLL_NOTIFY), so that it can sleep instead of polling
+#ifndef MICROPY_PY_SELECT_NOTIFY
+#define MICROPY_PY_SELECT_NOTIFY (MICROPY_PY_SELECT)
+#endif
+
 // Whether to enable the select() function in the "select" module (baremetal
 // implementation). This is present for compatibility but can be disabled to
 // save space.
@@ -1665,6 +1754,18 @@ typedef double mp_float_t;
 #define MICROPY_PY_RE_SUB (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE: Number of patterns compiled by the module-level re
+// functions that are kept for reuse (0 to disable)
+#ifndef MICROPY_PY_RE_CACHE
+#define MICROPY_PY_RE_CACHE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES ? 8 : 0)
+#endif
+
+// CIRCUITPY-CHANGE: Maximum number of states of the lazy DFA used to reject
+// non-matching subjects in re.search, split and sub (0 to disable, max 253)
+#ifndef MICROPY_PY_RE_DFA_STATES
+#define MICROPY_PY_RE_DFA_STATES (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES ? 16 : 0)
+#endif
+
 #ifndef MICROPY_PY_HEAPQ
 #define MICROPY_PY_HEAPQ (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
@@ -229,6 +229,20 @@ typedef struct _mp_state_vm_t {
     #if MICROPY_EMIT_NATIVE
     uint8_t default_emit_opt; // one of MP_EMIT_OPT_xxx
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_STREAMING
+    bool comp_streaming; // compile files one top-level statement at a time
+    #endif
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PROF_SAMPLING
+    // ring buffer state of the sampling profiler; the buffer itself is the
+    // prof_samples root pointer
+    volatile bool prof_sampling_enabled;
+    size_t prof_samples_len;
+    size_t prof_samples_head;
+    size_t prof_samples_total;
     #endif
 
     // size of the emergency exception buf, if it's dynamically allocated
@@ -313,6 +327,9 @@ typedef struct _mp_state_thread_t {
     #if MICROPY_PY_SYS_SETTRACE
     mp_obj_t prof_trace_callback;
     bool prof_callback_is_executing;
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_SYS_SETTRACE || MICROPY_PROF_SAMPLING
     struct _mp_code_state_t *current_code_state;
     #endif
 
@@ -1027,10 +1027,16 @@ STATIC void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id,
     push_result_node(parser, (mp_parse_node_t)pn);
 }
 
-mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
+// CIRCUITPY-CHANGE: shared by mp_parse and mp_parse_stmt. If stmt_consts is
+// non-NULL then only the next top-level statement is parsed, const()
+// definitions are carried between calls in stmt_consts, and the lexer is left
+// for the caller to free.
+STATIC mp_parse_tree_t parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind, mp_map_t *stmt_consts) {
     // Set exception handler to free the lexer if an exception is raised.
     MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, mp_lexer_free, lex);
-    nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+    if (stmt_consts == NULL) {
+        nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+    }
 
     // initialise parser and allocate memory for its stacks
 
@@ -1071,20 +1077,29 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     parser.cur_chunk = NULL;
 
     #if MICROPY_COMP_CONST
-    mp_map_init(&parser.consts, 0);
+    if (stmt_consts != NULL) {
+        parser.consts = *stmt_consts;
+    } else {
+        mp_map_init(&parser.consts, 0);
+    }
     #endif
 
     // work out the top-level rule to use, and push it on the stack
     size_t top_level_rule;
-    switch (input_kind) {
-        case MP_PARSE_SINGLE_INPUT:
-            top_level_rule = RULE_single_input;
-            break;
-        case MP_PARSE_EVAL_INPUT:
-            top_level_rule = RULE_eval_input;
-            break;
-        default:
-            top_level_rule = RULE_file_input;
+    if (stmt_consts != NULL) {
+        // a single statement, as for the REPL
+        top_level_rule = RULE_single_input;
+    } else {
+        switch (input_kind) {
+            case MP_PARSE_SINGLE_INPUT:
+                top_level_rule = RULE_single_input;
+                break;
+            case MP_PARSE_EVAL_INPUT:
+                top_level_rule = RULE_eval_input;
+                break;
+            default:
+                top_level_rule = RULE_file_input;
+        }
     }
     push_rule(&parser, lex->tok_line, top_level_rule, 0);
 
@@ -1347,7 +1362,11 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     }
 
     #if MICROPY_COMP_CONST
-    mp_map_deinit(&parser.consts);
+    if (stmt_consts != NULL) {
+        *stmt_consts = parser.consts;
+    } else {
+        mp_map_deinit(&parser.consts);
+    }
     #endif
 
     // truncate final chunk and link into chain of chunks
@@ -1362,7 +1381,7 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     }
 
     if (
-        lex->tok_kind != MP_TOKEN_END // check we are at the end of the token stream
+        (stmt_consts == NULL && lex->tok_kind != MP_TOKEN_END) // check we are at the end of the token stream
         || parser.result_stack_top == 0 // check that we got a node (can fail on empty input)
         ) {
     syntax_error:;
@@ -1400,11 +1419,32 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     m_del(mp_parse_node_t, parser.result_stack, parser.result_stack_alloc);
 
     // Deregister exception handler and free the lexer.
-    nlr_pop_jump_callback(true);
+    if (stmt_consts == NULL) {
+        nlr_pop_jump_callback(true);
+    }
 
     return parser.tree;
 }
 
+mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
+    return parse(lex, input_kind, NULL);
+}
+
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_STREAMING
+mp_parse_tree_t mp_parse_stmt(mp_lexer_t *lex, mp_map_t *consts) {
+    // skip blank lines between statements
+    while (lex->tok_kind == MP_TOKEN_NEWLINE) {
+        mp_lexer_to_next(lex);
+    }
+    if (lex->tok_kind == MP_TOKEN_END) {
+        mp_parse_tree_t tree = { MP_PARSE_NODE_NULL, NULL };
+        return tree;
+    }
+    return parse(lex, MP_PARSE_FILE_INPUT, consts);
+}
+#endif
+
 void mp_parse_tree_clear(mp_parse_tree_t *tree) {
     mp_parse_chunk_t *chunk = tree->chunk;
     while (chunk != NULL) {
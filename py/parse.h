@@ -111,6 +111,14 @@ typedef struct _mp_parse_t {
 // the parser will raise an exception if an error occurred
 // the parser will free the lexer before it returns
 mp_parse_tree_t mp_parse(struct _mp_lexer_t *lex, mp_parse_input_kind_t input_kind);
+
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_STREAMING
+// parse the next top-level statement of file input; the root is MP_PARSE_NODE_NULL
+// at the end of the input. The lexer is not freed, and consts must be initialised
+// by the caller and passed to each call so const() definitions carry over.
+mp_parse_tree_t mp_parse_stmt(struct _mp_lexer_t *lex, mp_map_t *consts);
+#endif
 void mp_parse_tree_clear(mp_parse_tree_t *tree);
 
 #endif // MICROPY_INCLUDED_PY_PARSE_H
@@ -975,3 +975,151 @@ void mp_prof_print_instr(const byte *ip, mp_code_state_t *code_state) {
 #endif // MICROPY_PROF_INSTR_DEBUG_PRINT_ENABLE
 
 #endif // MICROPY_PY_SYS_SETTRACE
+
+// CIRCUITPY-CHANGE
+#if MICROPY_PROF_SAMPLING
+
+MP_REGISTER_ROOT_POINTER(struct _mp_prof_frame_sample_t *prof_samples);
+
+void mp_prof_sampling_init(void) {
+    MP_STATE_VM(prof_sampling_enabled) = false;
+    mp_prof_sampling_port_stop();
+    MP_STATE_VM(prof_samples) = NULL;
+    MP_STATE_VM(prof_samples_len) = 0;
+    MP_STATE_VM(prof_samples_head) = 0;
+    MP_STATE_VM(prof_samples_total) = 0;
+}
+
+void mp_prof_sampling_start(mp_uint_t period_us, size_t n_samples) {
+    mp_prof_sampling_stop();
+    mp_prof_frame_sample_t *samples = m_new0(mp_prof_frame_sample_t, n_samples * MICROPY_PROF_SAMPLING_DEPTH);
+    MP_STATE_VM(prof_samples) = samples;
+    MP_STATE_VM(prof_samples_len) = n_samples;
+    MP_STATE_VM(prof_samples_head) = 0;
+    MP_STATE_VM(prof_samples_total) = 0;
+    MP_STATE_VM(prof_sampling_enabled) = true;
+    mp_prof_sampling_port_start(period_us);
+}
+
+size_t mp_prof_sampling_stop(void) {
+    mp_prof_sampling_port_stop();
+    MP_STATE_VM(prof_sampling_enabled) = false;
+    return MP_STATE_VM(prof_samples_total);
+}
+
+void mp_prof_sample(void) {
+    if (!MP_STATE_VM(prof_sampling_enabled)) {
+        return;
+    }
+    #if MICROPY_PY_THREAD
+    if (mp_thread_get_state() == NULL) {
+        return;
+    }
+    #endif
+    const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+    if (code_state == NULL) {
+        // Not executing any bytecode.
+        return;
+    }
+    size_t head = MP_STATE_VM(prof_samples_head);
+    mp_prof_frame_sample_t *sample = MP_STATE_VM(prof_samples) + head * MICROPY_PROF_SAMPLING_DEPTH;
+    for (size_t i = 0; i < MICROPY_PROF_SAMPLING_DEPTH; ++i) {
+        if (code_state != NULL) {
+            sample[i].fun_bc = code_state->fun_bc;
+            sample[i].ip = code_state->ip;
+            code_state = code_state->prev_state;
+        } else {
+            sample[i].fun_bc = NULL;
+            sample[i].ip = NULL;
+        }
+    }
+    if (++head == MP_STATE_VM(prof_samples_len)) {
+        head = 0;
+    }
+    MP_STATE_VM(prof_samples_head) = head;
+    MP_STATE_VM(prof_samples_total) += 1;
+}
+
+// Convert a recorded frame to a (file, function[, line]) tuple.
+STATIC mp_obj_t prof_sample_frame_key(const mp_prof_frame_sample_t *frame, bool with_line) {
+    const mp_obj_fun_bc_t *fun_bc = frame->fun_bc;
+    const byte *ip = fun_bc->bytecode;
+    MP_BC_PRELUDE_SIG_DECODE(ip);
+    MP_BC_PRELUDE_SIZE_DECODE(ip);
+    const byte *line_info_top = ip + n_info;
+    const byte *bytecode_start = ip + n_info + n_cell;
+    qstr block_name = mp_decode_uint_value(ip);
+    #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+    block_name = fun_bc->context->constants.qstr_table[block_name];
+    qstr source_file = fun_bc->context->constants.qstr_table[0];
+    #else
+    qstr source_file = fun_bc->context->constants.source_file;
+    #endif
+    mp_obj_t items[3] = { MP_OBJ_NEW_QSTR(source_file), MP_OBJ_NEW_QSTR(block_name), MP_OBJ_NULL };
+    if (!with_line) {
+        return mp_obj_new_tuple(2, items);
+    }
+    for (size_t i = 0; i < 1 + n_pos_args + n_kwonly_args; ++i) {
+        ip = mp_decode_uint_skip(ip);
+    }
+    // A frame that has not dispatched its first opcode yet may still point
+    // into the prelude.
+    size_t bc = frame->ip > bytecode_start ? (size_t)(frame->ip - bytecode_start) : 0;
+    items[2] = MP_OBJ_NEW_SMALL_INT(mp_bytecode_get_source_line(ip, line_info_top, bc));
+    return mp_obj_new_tuple(3, items);
+}
+
+STATIC void prof_sample_count(mp_obj_t dict, mp_obj_t key) {
+    mp_map_elem_t *elem = mp_map_lookup(mp_obj_dict_get_map(dict), key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND);
+    if (elem->value == MP_OBJ_NULL) {
+        elem->value = MP_OBJ_NEW_SMALL_INT(1);
+    } else {
+        elem->value = MP_OBJ_NEW_SMALL_INT(MP_OBJ_SMALL_INT_VALUE(elem->value) + 1);
+    }
+}
+
+// Build a dict from the recorded samples, pausing sampling meanwhile so the
+// ring buffer isn't modified underneath us.
+STATIC mp_obj_t prof_sampling_aggregate(bool stacks, bool by_line) {
+    bool enabled = MP_STATE_VM(prof_sampling_enabled);
+    MP_STATE_VM(prof_sampling_enabled) = false;
+    mp_obj_t dict = mp_obj_new_dict(0);
+    const mp_prof_frame_sample_t *samples = MP_STATE_VM(prof_samples);
+    size_t n_samples = MIN(MP_STATE_VM(prof_samples_total), MP_STATE_VM(prof_samples_len));
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        for (size_t i = 0; i < n_samples; ++i) {
+            const mp_prof_frame_sample_t *sample = samples + i * MICROPY_PROF_SAMPLING_DEPTH;
+            if (!stacks) {
+                prof_sample_count(dict, prof_sample_frame_key(&sample[0], by_line));
+                continue;
+            }
+            size_t depth = 0;
+            while (depth < MICROPY_PROF_SAMPLING_DEPTH && sample[depth].fun_bc != NULL) {
+                ++depth;
+            }
+            mp_obj_tuple_t *stack = MP_OBJ_TO_PTR(mp_obj_new_tuple(depth, NULL));
+            for (size_t j = 0; j < depth; ++j) {
+                // Outermost frame first.
+                stack->items[depth - 1 - j] = prof_sample_frame_key(&sample[j], true);
+            }
+            prof_sample_count(dict, MP_OBJ_FROM_PTR(stack));
+        }
+        nlr_pop();
+    } else {
+        MP_STATE_VM(prof_sampling_enabled) = enabled;
+        nlr_jump(nlr.ret_val);
+    }
+    MP_STATE_VM(prof_sampling_enabled) = enabled;
+    return dict;
+}
+
+mp_obj_t mp_prof_sampling_flat(bool by_line) {
+    return prof_sampling_aggregate(false, by_line);
+}
+
+mp_obj_t mp_prof_sampling_stacks(void) {
+    return prof_sampling_aggregate(true, true);
+}
+
+#endif // MICROPY_PROF_SAMPLING
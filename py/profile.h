@@ -78,4 +78,32 @@ void mp_prof_print_instr(const byte *ip, mp_code_state_t *code_state);
 #endif
 
 #endif // MICROPY_PY_SYS_SETTRACE
+
+// CIRCUITPY-CHANGE
+#if MICROPY_PROF_SAMPLING
+
+// One frame of a sample.  Each sample is MICROPY_PROF_SAMPLING_DEPTH of these,
+// innermost frame first, with unused frames having fun_bc == NULL.
+typedef struct _mp_prof_frame_sample_t {
+    struct _mp_obj_fun_bc_t *fun_bc;
+    const byte *ip;
+} mp_prof_frame_sample_t;
+
+void mp_prof_sampling_init(void);
+void mp_prof_sampling_start(mp_uint_t period_us, size_t n_samples);
+size_t mp_prof_sampling_stop(void);
+mp_obj_t mp_prof_sampling_flat(bool by_line);
+mp_obj_t mp_prof_sampling_stacks(void);
+
+// Record the currently executing frames.  Safe to call from an interrupt or
+// signal handler; does nothing unless sampling is enabled.
+void mp_prof_sample(void);
+
+// To be provided by the port: arrange for mp_prof_sample() to be called
+// every period_us microseconds (as best the port can), or stop doing so.
+void mp_prof_sampling_port_start(mp_uint_t period_us);
+void mp_prof_sampling_port_stop(void);
+
+#endif // MICROPY_PROF_SAMPLING
+
 #endif // MICROPY_INCLUDED_PY_PROFILING_H
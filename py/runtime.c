@@ -46,6 +46,8 @@
 #include "py/stackctrl.h"
 #include "py/stream.h"
 #include "py/gc.h"
+// CIRCUITPY-CHANGE
+#include "py/profile.h"
 
 #if CIRCUITPY_WARNINGS
 #include "shared-module/warnings/__init__.h"
@@ -110,6 +112,10 @@ void mp_init(void) {
     #if MICROPY_EMIT_NATIVE
     MP_STATE_VM(default_emit_opt) = MP_EMIT_OPT_NONE;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_STREAMING
+    MP_STATE_VM(comp_streaming) = MICROPY_COMP_STREAMING_DEFAULT;
+    #endif
     #endif
 
     // init global module dict
@@ -162,6 +168,16 @@ void mp_init(void) {
     MP_STATE_VM(sys_exitfunc) = mp_const_none;
     #endif
 
+    // CIRCUITPY-CHANGE: forget the asyncio core of a previous run
+    #if MICROPY_PY_ASYNCIO
+    MP_STATE_VM(asyncio_core_context) = MP_OBJ_NULL;
+    #endif
+
+    // CIRCUITPY-CHANGE: forget patterns compiled on a previous heap
+    #if MICROPY_PY_RE && MICROPY_PY_RE_CACHE
+    memset(MP_STATE_VM(re_cache), 0, sizeof(MP_STATE_VM(re_cache)));
+    #endif
+
     #if MICROPY_PY_SYS_PS1_PS2
     MP_STATE_VM(sys_mutable[MP_SYS_MUTABLE_PS1]) = MP_OBJ_NEW_QSTR(MP_QSTR__gt__gt__gt__space_);
     MP_STATE_VM(sys_mutable[MP_SYS_MUTABLE_PS2]) = MP_OBJ_NEW_QSTR(MP_QSTR__dot__dot__dot__space_);
@@ -170,8 +186,14 @@ void mp_init(void) {
     #if MICROPY_PY_SYS_SETTRACE
     MP_STATE_THREAD(prof_trace_callback) = MP_OBJ_NULL;
     MP_STATE_THREAD(prof_callback_is_executing) = false;
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_SYS_SETTRACE || MICROPY_PROF_SAMPLING
     MP_STATE_THREAD(current_code_state) = NULL;
     #endif
+    #if MICROPY_PROF_SAMPLING
+    mp_prof_sampling_init();
+    #endif
 
     #if MICROPY_PY_SYS_TRACEBACKLIMIT
     MP_STATE_VM(sys_mutable[MP_SYS_MUTABLE_TRACEBACKLIMIT]) = MP_OBJ_NEW_SMALL_INT(1000);
@@ -196,6 +218,11 @@ void mp_init(void) {
 void mp_deinit(void) {
     MP_THREAD_GIL_EXIT();
 
+    // CIRCUITPY-CHANGE: a profile left running would keep the port's sampling timer on.
+    #if MICROPY_PROF_SAMPLING
+    mp_prof_sampling_stop();
+    #endif
+
     // call port specific deinitialization if any
     #ifdef MICROPY_PORT_DEINIT_FUNC
     MICROPY_PORT_DEINIT_FUNC;
@@ -1728,6 +1755,47 @@ mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_i
     return ret;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_STREAMING
+// Each statement's parse tree is freed once it's compiled, and its bytecode
+// becomes garbage once it has run, so memory use is bounded by the largest
+// statement rather than the whole file.
+void mp_parse_compile_execute_stmts(mp_lexer_t *lex, mp_obj_dict_t *globals, mp_obj_dict_t *locals) {
+    // save context
+    nlr_jump_callback_node_globals_locals_t ctx;
+    ctx.globals = mp_globals_get();
+    ctx.locals = mp_locals_get();
+
+    // set new context
+    mp_globals_set(globals);
+    mp_locals_set(locals);
+
+    // set exception handler to restore context if an exception is raised
+    nlr_push_jump_callback(&ctx.callback, mp_globals_locals_set_from_nlr_jump_callback);
+
+    // set exception handler to free the lexer if an exception is raised
+    MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(lex_ctx, mp_lexer_free, lex);
+    nlr_push_jump_callback(&lex_ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+
+    qstr source_name = lex->source_name;
+    mp_map_t consts;
+    mp_map_init(&consts, 0);
+    for (;;) {
+        mp_parse_tree_t parse_tree = mp_parse_stmt(lex, &consts);
+        if (parse_tree.root == MP_PARSE_NODE_NULL) {
+            break;
+        }
+        mp_obj_t stmt_fun = mp_compile(&parse_tree, source_name, false);
+        mp_call_function_0(stmt_fun);
+    }
+    mp_map_deinit(&consts);
+
+    // deregister exception handlers, free the lexer and restore context
+    nlr_pop_jump_callback(true);
+    nlr_pop_jump_callback(true);
+}
+#endif
+
 #endif // MICROPY_ENABLE_COMPILER
 
 // CIRCUITPY-CHANGE: MP_COLD are CIRCUITPY
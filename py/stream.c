@@ -29,6 +29,8 @@
 #include <unistd.h>
 
 #include "py/objstr.h"
+// CIRCUITPY-CHANGE
+#include "py/objtype.h"
 #include "py/stream.h"
 #include "py/runtime.h"
 
@@ -40,6 +42,13 @@
 
 STATIC mp_obj_t stream_readall(mp_obj_t self_in);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_SELECT_NOTIFY
+// Bumped by every mp_stream_notify(), so a poller can tell cheaply whether any
+// stream at all may have become ready.
+mp_stream_notify_t mp_stream_notify_seq;
+#endif
+
 // Returns error condition in *errcode, if non-zero, return value is number of bytes written
 // before error condition occurred. If *errcode == 0, returns total bytes written (which will
 // be equal to input size).
@@ -488,6 +497,22 @@ mp_obj_t mp_stream_flush(mp_obj_t self) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_stream_flush_obj, mp_stream_flush);
 
+// CIRCUITPY-CHANGE
+bool mp_stream_seek_relative(mp_obj_t stream, mp_off_t offset) {
+    // Streams implemented in Python get ioctl arguments as integers, so they
+    // can't be passed a seek request.
+    if (mp_obj_is_instance_type(mp_obj_get_type(stream))) {
+        return false;
+    }
+    const mp_stream_p_t *stream_p = mp_get_stream(stream);
+    if (stream_p == NULL || stream_p->ioctl == NULL) {
+        return false;
+    }
+    struct mp_stream_seek_t seek_s = { .offset = offset, .whence = MP_SEEK_CUR };
+    int error;
+    return stream_p->ioctl(stream, MP_STREAM_SEEK, (uintptr_t)&seek_s, &error) != MP_STREAM_ERROR;
+}
+
 STATIC mp_obj_t stream_ioctl(size_t n_args, const mp_obj_t *args) {
     mp_buffer_info_t bufinfo;
     uintptr_t val = 0;
@@ -45,6 +45,8 @@
 #define MP_STREAM_GET_DATA_OPTS (8)  // Get data/message options
 #define MP_STREAM_SET_DATA_OPTS (9)  // Set data/message options
 #define MP_STREAM_GET_FILENO    (10) // Get fileno of underlying file
+// CIRCUITPY-CHANGE
+#define MP_STREAM_POLL_NOTIFY   (11) // Get readiness counter, see mp_stream_notify()
 
 // These poll ioctl values are compatible with Linux
 #define MP_STREAM_POLL_RD       (0x0001)
@@ -126,6 +128,28 @@ mp_uint_t mp_stream_rw(mp_obj_t stream, void *buf, mp_uint_t size, int *errcode,
 void mp_stream_write_adaptor(void *self, const char *buf, size_t len);
 // CIRCUITPY-CHANGE
 mp_obj_t mp_stream_flush(mp_obj_t self);
+// CIRCUITPY-CHANGE
+// Seek a native stream by offset from its current position, for readers that
+// read ahead and give back what they didn't use. Returns false if the stream
+// can't seek, including streams implemented in Python.
+bool mp_stream_seek_relative(mp_obj_t stream, mp_off_t offset);
+
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_SELECT_NOTIFY
+// Readiness notification for select.  A stream that answers MP_STREAM_POLL_NOTIFY
+// stores a pointer to its own counter in *(mp_stream_notify_t **)arg and then
+// calls mp_stream_notify() on it whenever its MP_STREAM_POLL result may have
+// changed.  A poller then only calls the ioctl of streams whose counter moved,
+// and can sleep while no stream has notified.
+typedef volatile uint32_t mp_stream_notify_t;
+extern mp_stream_notify_t mp_stream_notify_seq;
+
+// Safe to call from an interrupt handler.
+static inline void mp_stream_notify(mp_stream_notify_t *notify) {
+    *notify += 1;
+    mp_stream_notify_seq += 1;
+}
+#endif
 
 #if MICROPY_STREAMS_POSIX_API
 #include <sys/types.h>
@@ -187,6 +187,16 @@
     } \
 } while(0)
 
+// CIRCUITPY-CHANGE
+#elif MICROPY_PROF_SAMPLING
+
+// The sampling profiler only needs to be able to walk the active frames.
+#define FRAME_SETUP() MP_STATE_THREAD(current_code_state) = code_state
+#define FRAME_ENTER() code_state->prev_state = MP_STATE_THREAD(current_code_state)
+#define FRAME_LEAVE() MP_STATE_THREAD(current_code_state) = code_state->prev_state
+#define FRAME_UPDATE()
+#define TRACE_TICK(current_ip, current_sp, is_exception)
+
 #else // MICROPY_PY_SYS_SETTRACE
 #define FRAME_SETUP()
 #define FRAME_ENTER()
@@ -205,6 +215,79 @@ STATIC mp_obj_t get_active_exception(mp_exc_stack_t *exc_sp, mp_exc_stack_t *exc
     return MP_OBJ_NULL;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_FLOAT_BINARY_OP_FAST_PATH && MICROPY_PY_BUILTINS_FLOAT
+// Inline handling of the common arithmetic and comparison operators when one
+// argument is a float and the other is a float or small int.  Anything else,
+// including cases that must raise (eg division by zero), returns MP_OBJ_NULL
+// so the caller falls back to mp_binary_op.
+static inline mp_obj_t vm_float_binary_op(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs) {
+    mp_float_t lhs_val, rhs_val;
+    if (mp_obj_is_float(lhs)) {
+        lhs_val = mp_obj_float_get(lhs);
+        if (mp_obj_is_float(rhs)) {
+            rhs_val = mp_obj_float_get(rhs);
+        } else if (mp_obj_is_small_int(rhs)) {
+            rhs_val = (mp_float_t)MP_OBJ_SMALL_INT_VALUE(rhs);
+        } else {
+            return MP_OBJ_NULL;
+        }
+    } else if (mp_obj_is_small_int(lhs) && mp_obj_is_float(rhs)) {
+        lhs_val = (mp_float_t)MP_OBJ_SMALL_INT_VALUE(lhs);
+        rhs_val = mp_obj_float_get(rhs);
+    } else {
+        return MP_OBJ_NULL;
+    }
+
+    switch (op) {
+        case MP_BINARY_OP_LESS:
+            return mp_obj_new_bool(lhs_val < rhs_val);
+        case MP_BINARY_OP_MORE:
+            return mp_obj_new_bool(lhs_val > rhs_val);
+        case MP_BINARY_OP_EQUAL:
+            return mp_obj_new_bool(lhs_val == rhs_val);
+        case MP_BINARY_OP_LESS_EQUAL:
+            return mp_obj_new_bool(lhs_val <= rhs_val);
+        case MP_BINARY_OP_MORE_EQUAL:
+            return mp_obj_new_bool(lhs_val >= rhs_val);
+        case MP_BINARY_OP_NOT_EQUAL:
+            return mp_obj_new_bool(lhs_val != rhs_val);
+        case MP_BINARY_OP_ADD:
+        case MP_BINARY_OP_INPLACE_ADD:
+            lhs_val += rhs_val;
+            break;
+        case MP_BINARY_OP_SUBTRACT:
+        case MP_BINARY_OP_INPLACE_SUBTRACT:
+            lhs_val -= rhs_val;
+            break;
+        case MP_BINARY_OP_MULTIPLY:
+        case MP_BINARY_OP_INPLACE_MULTIPLY:
+            lhs_val *= rhs_val;
+            break;
+        case MP_BINARY_OP_TRUE_DIVIDE:
+        case MP_BINARY_OP_INPLACE_TRUE_DIVIDE:
+            if (rhs_val == 0) {
+                return MP_OBJ_NULL;
+            }
+            lhs_val /= rhs_val;
+            break;
+        default:
+            return MP_OBJ_NULL;
+    }
+    return mp_obj_new_float(lhs_val);
+}
+
+static inline mp_obj_t vm_binary_op(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs) {
+    mp_obj_t res = vm_float_binary_op(op, lhs, rhs);
+    if (res == MP_OBJ_NULL) {
+        res = mp_binary_op(op, lhs, rhs);
+    }
+    return res;
+}
+#else
+#define vm_binary_op mp_binary_op
+#endif
+
 // fastn has items in reverse order (fastn[0] is local[0], fastn[-1] is local[1], etc)
 // sp points to bottom of stack which grows up
 // returns:
@@ -1305,7 +1388,7 @@ yield:
                     MARK_EXC_IP_SELECTIVE();
                     mp_obj_t rhs = POP();
                     mp_obj_t lhs = TOP();
-                    SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                    SET_TOP(vm_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
                     DISPATCH();
                 }
 
@@ -1328,7 +1411,7 @@ yield:
                     } else if (ip[-1] < MP_BC_BINARY_OP_MULTI + MP_BC_BINARY_OP_MULTI_NUM) {
                         mp_obj_t rhs = POP();
                         mp_obj_t lhs = TOP();
-                        SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                        SET_TOP(vm_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
                         DISPATCH();
                     } else
                 #endif // MICROPY_OPT_COMPUTED_GOTO
@@ -1103,6 +1103,289 @@ STATIC mp_obj_t bitmaptools_obj_blit(size_t n_args, const mp_obj_t *pos_args, mp
 MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_blit_obj, 1, bitmaptools_obj_blit);
 
 
+//| class ResizeAlgorithm:
+//|     """Identifies the algorithm for `resize` to use"""
+//|
+//|     Area: "ResizeAlgorithm"
+//|     """Each output pixel is the mean of the source pixels it covers. This is the best choice for
+//|     shrinking. When enlarging, it picks the nearest source pixel."""
+//|
+//|     Bilinear: "ResizeAlgorithm"
+//|     """Interpolate between the four nearest source pixels. This is smoother when enlarging, but
+//|     skips source pixels when shrinking by more than half."""
+//|
+MAKE_ENUM_VALUE(bitmaptools_resize_algorithm_type, resize_algorithm, Area, RESIZE_ALGORITHM_AREA);
+MAKE_ENUM_VALUE(bitmaptools_resize_algorithm_type, resize_algorithm, Bilinear, RESIZE_ALGORITHM_BILINEAR);
+
+MAKE_ENUM_MAP(bitmaptools_resize_algorithm) {
+    MAKE_ENUM_MAP_ENTRY(resize_algorithm, Area),
+    MAKE_ENUM_MAP_ENTRY(resize_algorithm, Bilinear),
+};
+STATIC MP_DEFINE_CONST_DICT(bitmaptools_resize_algorithm_locals_dict, bitmaptools_resize_algorithm_locals_table);
+
+MAKE_PRINTER(bitmaptools, bitmaptools_resize_algorithm);
+
+MAKE_ENUM_TYPE(bitmaptools, ResizeAlgorithm, bitmaptools_resize_algorithm);
+
+// Get the pixels of a Bitmap with the given bits per value, or of a buffer
+// holding rows of `width` such pixels.
+STATIC bool bitmaptools_get_source(bitmaptools_source_t *source, mp_obj_t obj, int bits_per_value, mp_int_t width) {
+    if (mp_obj_is_type(obj, &displayio_bitmap_type)) {
+        displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(obj);
+        mp_arg_validate_int(bitmap->bits_per_value, bits_per_value, MP_QSTR_bits_per_value);
+        source->data = bitmap->data;
+        source->stride = bitmap->stride * sizeof(uint32_t);
+        source->width = bitmap->width;
+        source->height = bitmap->height;
+        return true;
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(obj, &bufinfo, MP_BUFFER_READ);
+    // Rows of 16-bit pixels are read a halfword at a time
+    if (bits_per_value == 16 && ((uintptr_t)bufinfo.buf & 1)) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be %d-byte aligned"), MP_QSTR_source, 2);
+    }
+    source->data = bufinfo.buf;
+    source->stride = width * (bits_per_value / 8);
+    source->width = width;
+    source->height = MIN(bufinfo.len / source->stride, 32767);
+    return false;
+}
+
+// Get a source that is the same size as the destination bitmap
+STATIC void bitmaptools_get_source_like(bitmaptools_source_t *source, mp_obj_t obj, int bits_per_value, displayio_bitmap_t *dest) {
+    if (bitmaptools_get_source(source, obj, bits_per_value, dest->width)) {
+        if (source->width != dest->width || source->height != dest->height) {
+            mp_raise_ValueError(MP_ERROR_TEXT("bitmap sizes must match"));
+        }
+    } else if (source->height < dest->height) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Buffer too small"));
+    }
+}
+
+STATIC void bitmaptools_validate_rgb565_colorspace(displayio_colorspace_t colorspace) {
+    switch (colorspace) {
+        case DISPLAYIO_COLORSPACE_RGB565:
+        case DISPLAYIO_COLORSPACE_RGB565_SWAPPED:
+        case DISPLAYIO_COLORSPACE_BGR565:
+        case DISPLAYIO_COLORSPACE_BGR565_SWAPPED:
+            break;
+
+        default:
+            mp_raise_ValueError(MP_ERROR_TEXT("Unsupported colorspace"));
+    }
+}
+
+//| def resize(
+//|     dest_bitmap: displayio.Bitmap,
+//|     source: Union[displayio.Bitmap, ReadableBuffer],
+//|     colorspace: displayio.Colorspace,
+//|     algorithm: ResizeAlgorithm = ResizeAlgorithm.Area,
+//|     *,
+//|     source_width: Optional[int] = None,
+//| ) -> None:
+//|     """Scale the whole source image to fill the destination bitmap.
+//|
+//|     :param bitmap dest_bitmap: Destination bitmap. It must not be the source bitmap.
+//|     :param source: Source bitmap, or a buffer of pixels stored row after row
+//|     :param displayio.Colorspace colorspace: The colorspace of both images. Only ``L8``, ``RGB565``, ``RGB565_SWAPPED``, ``BGR565`` and ``BGR565_SWAPPED`` are supported.
+//|     :param algorithm: The resize algorithm to use, one of the `ResizeAlgorithm` values.
+//|     :param int source_width: The width of a buffer source in pixels. Its height is the number of whole rows in the buffer.
+//|
+//|     For the L8 colorspace, bitmaps must have a bits-per-value of 8.
+//|     For the RGB colorspaces, they must have a bits-per-value of 16."""
+//|     ...
+//|
+STATIC mp_obj_t bitmaptools_resize(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_dest_bitmap, ARG_source, ARG_colorspace, ARG_algorithm, ARG_source_width };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_dest_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_source, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_colorspace, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_algorithm, MP_ARG_OBJ, { .u_obj = MP_ROM_PTR((void *)&resize_algorithm_Area_obj) } },
+        { MP_QSTR_source_width, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    displayio_bitmap_t *dest_bitmap = mp_arg_validate_type(args[ARG_dest_bitmap].u_obj, &displayio_bitmap_type, MP_QSTR_dest_bitmap);
+    displayio_colorspace_t colorspace = cp_enum_value(&displayio_colorspace_type, args[ARG_colorspace].u_obj, MP_QSTR_colorspace);
+    bitmaptools_resize_algorithm_t algorithm = cp_enum_value(&bitmaptools_resize_algorithm_type, args[ARG_algorithm].u_obj, MP_QSTR_algorithm);
+
+    int bits_per_value = 16;
+    if (colorspace == DISPLAYIO_COLORSPACE_L8) {
+        bits_per_value = 8;
+    } else {
+        bitmaptools_validate_rgb565_colorspace(colorspace);
+    }
+    mp_arg_validate_int(dest_bitmap->bits_per_value, bits_per_value, MP_QSTR_bits_per_value);
+
+    mp_obj_t source_obj = args[ARG_source].u_obj;
+    mp_int_t source_width = 0;
+    if (!mp_obj_is_type(source_obj, &displayio_bitmap_type)) {
+        source_width = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_source_width].u_obj), 1, 32767, MP_QSTR_source_width);
+    }
+    bitmaptools_source_t source;
+    if (!bitmaptools_get_source(&source, source_obj, bits_per_value, source_width) && source.height < 1) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Buffer too small"));
+    }
+    if (source.width < 1 || source.height < 1) {
+        // Nothing to scale
+        return mp_const_none;
+    }
+
+    common_hal_bitmaptools_resize(dest_bitmap, &source, colorspace, algorithm);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_resize_obj, 0, bitmaptools_resize);
+
+//| def yuv422_to_rgb565(
+//|     dest_bitmap: displayio.Bitmap,
+//|     source: Union[displayio.Bitmap, ReadableBuffer],
+//|     colorspace: displayio.Colorspace,
+//| ) -> None:
+//|     """Convert a YUV422 camera image to RGB565.
+//|
+//|     Each pair of pixels in the source is stored as the four bytes Y0, U, Y1, V. The JPEG (full range) conversion is used.
+//|
+//|     :param bitmap dest_bitmap: Destination bitmap. It must have a bits-per-value of 16.
+//|     :param source: Source bitmap with a bits-per-value of 16 and the same size as ``dest_bitmap``, or a buffer holding at least as many pixels
+//|     :param displayio.Colorspace colorspace: The colorspace of ``dest_bitmap``. Only ``RGB565``, ``RGB565_SWAPPED``, ``BGR565`` and ``BGR565_SWAPPED`` are supported.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t bitmaptools_yuv422_to_rgb565(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_dest_bitmap, ARG_source, ARG_colorspace };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_dest_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_source, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_colorspace, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    displayio_bitmap_t *dest_bitmap = mp_arg_validate_type(args[ARG_dest_bitmap].u_obj, &displayio_bitmap_type, MP_QSTR_dest_bitmap);
+    displayio_colorspace_t colorspace = cp_enum_value(&displayio_colorspace_type, args[ARG_colorspace].u_obj, MP_QSTR_colorspace);
+    bitmaptools_validate_rgb565_colorspace(colorspace);
+    mp_arg_validate_int(dest_bitmap->bits_per_value, 16, MP_QSTR_bits_per_value);
+
+    bitmaptools_source_t source;
+    bitmaptools_get_source_like(&source, args[ARG_source].u_obj, 16, dest_bitmap);
+
+    common_hal_bitmaptools_yuv422_to_rgb565(dest_bitmap, &source, colorspace);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_yuv422_to_rgb565_obj, 0, bitmaptools_yuv422_to_rgb565);
+
+//| def rgb565_to_l8(
+//|     dest_bitmap: displayio.Bitmap,
+//|     source: Union[displayio.Bitmap, ReadableBuffer],
+//|     colorspace: displayio.Colorspace,
+//| ) -> None:
+//|     """Convert an RGB565 image to luminance, with the same weights as `dither`.
+//|
+//|     :param bitmap dest_bitmap: Destination bitmap. It must have a bits-per-value of 8.
+//|     :param source: Source bitmap with a bits-per-value of 16 and the same size as ``dest_bitmap``, or a buffer holding at least as many pixels
+//|     :param displayio.Colorspace colorspace: The colorspace of ``source``. Only ``RGB565``, ``RGB565_SWAPPED``, ``BGR565`` and ``BGR565_SWAPPED`` are supported.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t bitmaptools_rgb565_to_l8(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_dest_bitmap, ARG_source, ARG_colorspace };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_dest_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_source, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_colorspace, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    displayio_bitmap_t *dest_bitmap = mp_arg_validate_type(args[ARG_dest_bitmap].u_obj, &displayio_bitmap_type, MP_QSTR_dest_bitmap);
+    displayio_colorspace_t colorspace = cp_enum_value(&displayio_colorspace_type, args[ARG_colorspace].u_obj, MP_QSTR_colorspace);
+    bitmaptools_validate_rgb565_colorspace(colorspace);
+    mp_arg_validate_int(dest_bitmap->bits_per_value, 8, MP_QSTR_bits_per_value);
+
+    bitmaptools_source_t source;
+    bitmaptools_get_source_like(&source, args[ARG_source].u_obj, 16, dest_bitmap);
+
+    common_hal_bitmaptools_rgb565_to_l8(dest_bitmap, &source, colorspace);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_rgb565_to_l8_obj, 0, bitmaptools_rgb565_to_l8);
+
+//| def palette_lookup(palette: displayio.Palette) -> bytearray:
+//|     """Make the color lookup table that `rgb565_to_palette` uses.
+//|
+//|     Each entry holds the index of the nearest opaque palette color to one combination of the top 4 bits of red,
+//|     green and blue. Making the table takes time, so keep it for as long as the palette doesn't change.
+//|
+//|     :param displayio.Palette palette: A palette of at most 256 colors
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t bitmaptools_palette_lookup(mp_obj_t palette_in) {
+    displayio_palette_t *palette = mp_arg_validate_type(palette_in, &displayio_palette_type, MP_QSTR_palette);
+    if (palette->color_count > 256) {
+        mp_raise_ValueError(MP_ERROR_TEXT("source palette too large"));
+    }
+
+    mp_obj_t lookup = mp_obj_new_bytearray_of_zeros(BITMAPTOOLS_PALETTE_LOOKUP_SIZE);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(lookup, &bufinfo, MP_BUFFER_WRITE);
+    common_hal_bitmaptools_palette_lookup(palette, bufinfo.buf);
+
+    return lookup;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(bitmaptools_palette_lookup_obj, bitmaptools_palette_lookup);
+
+//| def rgb565_to_palette(
+//|     dest_bitmap: displayio.Bitmap,
+//|     source: Union[displayio.Bitmap, ReadableBuffer],
+//|     colorspace: displayio.Colorspace,
+//|     lookup: ReadableBuffer,
+//| ) -> None:
+//|     """Convert an RGB565 image to palette indices, using a table made by `palette_lookup`.
+//|
+//|     :param bitmap dest_bitmap: Destination bitmap
+//|     :param source: Source bitmap with a bits-per-value of 16 and the same size as ``dest_bitmap``, or a buffer holding at least as many pixels
+//|     :param displayio.Colorspace colorspace: The colorspace of ``source``. Only ``RGB565``, ``RGB565_SWAPPED``, ``BGR565`` and ``BGR565_SWAPPED`` are supported.
+//|     :param ReadableBuffer lookup: The table returned by `palette_lookup`
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t bitmaptools_rgb565_to_palette(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_dest_bitmap, ARG_source, ARG_colorspace, ARG_lookup };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_dest_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_source, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_colorspace, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_lookup, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    displayio_bitmap_t *dest_bitmap = mp_arg_validate_type(args[ARG_dest_bitmap].u_obj, &displayio_bitmap_type, MP_QSTR_dest_bitmap);
+    displayio_colorspace_t colorspace = cp_enum_value(&displayio_colorspace_type, args[ARG_colorspace].u_obj, MP_QSTR_colorspace);
+    bitmaptools_validate_rgb565_colorspace(colorspace);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_lookup].u_obj, &bufinfo, MP_BUFFER_READ);
+    if (bufinfo.len < BITMAPTOOLS_PALETTE_LOOKUP_SIZE) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Buffer too small"));
+    }
+
+    bitmaptools_source_t source;
+    bitmaptools_get_source_like(&source, args[ARG_source].u_obj, 16, dest_bitmap);
+
+    common_hal_bitmaptools_rgb565_to_palette(dest_bitmap, &source, colorspace, bufinfo.buf);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_rgb565_to_palette_obj, 0, bitmaptools_rgb565_to_palette);
+
 STATIC const mp_rom_map_elem_t bitmaptools_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_bitmaptools) },
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&bitmaptools_readinto_obj) },
@@ -1116,8 +1399,14 @@ STATIC const mp_rom_map_elem_t bitmaptools_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_draw_circle), MP_ROM_PTR(&bitmaptools_draw_circle_obj) },
     { MP_ROM_QSTR(MP_QSTR_blit), MP_ROM_PTR(&bitmaptools_blit_obj) },
     { MP_ROM_QSTR(MP_QSTR_dither), MP_ROM_PTR(&bitmaptools_dither_obj) },
+    { MP_ROM_QSTR(MP_QSTR_resize), MP_ROM_PTR(&bitmaptools_resize_obj) },
+    { MP_ROM_QSTR(MP_QSTR_yuv422_to_rgb565), MP_ROM_PTR(&bitmaptools_yuv422_to_rgb565_obj) },
+    { MP_ROM_QSTR(MP_QSTR_rgb565_to_l8), MP_ROM_PTR(&bitmaptools_rgb565_to_l8_obj) },
+    { MP_ROM_QSTR(MP_QSTR_palette_lookup), MP_ROM_PTR(&bitmaptools_palette_lookup_obj) },
+    { MP_ROM_QSTR(MP_QSTR_rgb565_to_palette), MP_ROM_PTR(&bitmaptools_rgb565_to_palette_obj) },
     { MP_ROM_QSTR(MP_QSTR_BlendMode), MP_ROM_PTR(&bitmaptools_blendmode_type) },
     { MP_ROM_QSTR(MP_QSTR_DitherAlgorithm), MP_ROM_PTR(&bitmaptools_dither_algorithm_type) },
+    { MP_ROM_QSTR(MP_QSTR_ResizeAlgorithm), MP_ROM_PTR(&bitmaptools_resize_algorithm_type) },
 };
 STATIC MP_DEFINE_CONST_DICT(bitmaptools_module_globals, bitmaptools_module_globals_table);
 
@@ -48,6 +48,22 @@ typedef enum {
 extern const mp_obj_type_t bitmaptools_blendmode_type;
 extern const cp_enum_obj_t bitmaptools_blendmode_Normal_obj;
 
+typedef enum {
+    RESIZE_ALGORITHM_AREA, RESIZE_ALGORITHM_BILINEAR,
+} bitmaptools_resize_algorithm_t;
+
+extern const mp_obj_type_t bitmaptools_resize_algorithm_type;
+
+// Pixels of a Bitmap or of a buffer, as rows of `stride` bytes
+typedef struct {
+    const void *data;
+    size_t stride;
+    int width, height;
+} bitmaptools_source_t;
+
+// One entry for each 4-bit red, green and blue value
+#define BITMAPTOOLS_PALETTE_LOOKUP_SIZE (4096)
+
 void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16_t oy,
     int16_t dest_clip0_x, int16_t dest_clip0_y,
     int16_t dest_clip1_x, int16_t dest_clip1_y,
@@ -89,6 +105,12 @@ void common_hal_bitmaptools_dither(displayio_bitmap_t *dest_bitmap, displayio_bi
 void common_hal_bitmaptools_alphablend(displayio_bitmap_t *destination, displayio_bitmap_t *source1, displayio_bitmap_t *source2, displayio_colorspace_t colorspace, mp_float_t factor1, mp_float_t factor2,
     bitmaptools_blendmode_t blendmode, uint32_t skip_source1_index, bool skip_source1_index_none, uint32_t skip_source2_index, bool skip_source2_index_none);
 
+void common_hal_bitmaptools_resize(displayio_bitmap_t *dest, const bitmaptools_source_t *source, displayio_colorspace_t colorspace, bitmaptools_resize_algorithm_t algorithm);
+void common_hal_bitmaptools_yuv422_to_rgb565(displayio_bitmap_t *dest, const bitmaptools_source_t *source, displayio_colorspace_t colorspace);
+void common_hal_bitmaptools_rgb565_to_l8(displayio_bitmap_t *dest, const bitmaptools_source_t *source, displayio_colorspace_t colorspace);
+void common_hal_bitmaptools_palette_lookup(displayio_palette_t *palette, uint8_t *lookup);
+void common_hal_bitmaptools_rgb565_to_palette(displayio_bitmap_t *dest, const bitmaptools_source_t *source, displayio_colorspace_t colorspace, const uint8_t *lookup);
+
 typedef struct {
     union {
         struct {
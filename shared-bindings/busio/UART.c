@@ -306,6 +306,11 @@ STATIC mp_uint_t busio_uart_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t
         if ((flags & MP_STREAM_POLL_WR) && common_hal_busio_uart_ready_to_tx(self)) {
             ret |= MP_STREAM_POLL_WR;
         }
+    #if MICROPY_PY_SELECT_NOTIFY
+    } else if (request == MP_STREAM_POLL_NOTIFY && common_hal_busio_uart_get_notify(self) != NULL) {
+        *(mp_stream_notify_t **)arg = common_hal_busio_uart_get_notify(self);
+        ret = 0;
+    #endif
     } else {
         *errcode = MP_EINVAL;
         ret = MP_STREAM_ERROR;
@@ -313,6 +318,12 @@ STATIC mp_uint_t busio_uart_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t
     return ret;
 }
 
+#if MICROPY_PY_SELECT_NOTIFY
+MP_WEAK mp_stream_notify_t *common_hal_busio_uart_get_notify(busio_uart_obj_t *self) {
+    return NULL;
+}
+#endif
+
 //|     baudrate: int
 //|     """The current baudrate."""
 STATIC mp_obj_t busio_uart_obj_get_baudrate(mp_obj_t self_in) {
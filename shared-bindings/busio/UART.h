@@ -30,6 +30,7 @@
 #include "common-hal/microcontroller/Pin.h"
 #include "common-hal/busio/UART.h"
 #include "py/ringbuf.h"
+#include "py/stream.h"
 
 extern const mp_obj_type_t busio_uart_type;
 
@@ -67,6 +68,12 @@ extern void common_hal_busio_uart_set_timeout(busio_uart_obj_t *self, mp_float_t
 extern uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self);
 extern void common_hal_busio_uart_clear_rx_buffer(busio_uart_obj_t *self);
 extern bool common_hal_busio_uart_ready_to_tx(busio_uart_obj_t *self);
+#if MICROPY_PY_SELECT_NOTIFY
+// Returns the counter bumped whenever rx_characters_available() or ready_to_tx()
+// may have changed, or NULL if the port can't tell. The default implementation
+// returns NULL.
+extern mp_stream_notify_t *common_hal_busio_uart_get_notify(busio_uart_obj_t *self);
+#endif
 
 extern void common_hal_busio_uart_never_reset(busio_uart_obj_t *self);
 
@@ -30,6 +30,7 @@
 
 #include "py/runtime.h"
 #include "py/objproperty.h"
+#include "extmod/vfs_fat.h"
 #include "shared/runtime/context_manager_helpers.h"
 #include "shared-bindings/util.h"
 #include "shared-bindings/gifio/OnDiskGif.h"
@@ -107,12 +108,20 @@
 //|
 //|     """
 //|
-//|     def __init__(self, file: str) -> None:
+//|     def __init__(self, file: str, *, use_palette: bool = False, cache_size: int = 0) -> None:
 //|         """Create an `OnDiskGif` object with the given file.
 //|         The GIF frames are decoded into RGB565 big-endian format.
 //|         `displayio` expects little-endian, so the example above uses `Colorspace.RGB565_SWAPPED`.
 //|
 //|         :param file file: The name of the GIF file.
+//|         :param bool use_palette: Decode into an 8-bit bitmap and `palette` instead.
+//|         :param int cache_size: Up to this many bytes of RAM (or PSRAM, where the heap lives
+//|           there) are used to keep the decoded frames, so that after the first loop they are
+//|           replayed without reading and decompressing the file. A frame takes the area it
+//|           covers in bytes, plus its colors if they differ from the previous frame's. If the
+//|           frames don't fit, they are decoded from the file as usual.
+//|
+//|         Each frame only marks the part of the bitmap it draws as changed.
 //|
 //|         If the image is too large it will be cropped at the bottom and right when displayed.
 //|
@@ -122,10 +131,11 @@
 //|         """
 //|         ...
 STATIC mp_obj_t gifio_ondiskgif_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_filename, ARG_use_palette, NUM_ARGS };
+    enum { ARG_filename, ARG_use_palette, ARG_cache_size, NUM_ARGS };
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_filename, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_filename, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = mp_const_none} },
         { MP_QSTR_use_palette, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        { MP_QSTR_cache_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
     };
     MP_STATIC_ASSERT(MP_ARRAY_SIZE(allowed_args) == NUM_ARGS);
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -136,12 +146,14 @@ STATIC mp_obj_t gifio_ondiskgif_make_new(const mp_obj_type_t *type, size_t n_arg
         filename = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), filename, MP_ROM_QSTR(MP_QSTR_rb));
     }
 
-    if (!mp_obj_is_type(filename, &mp_type_fileio)) {
+    if (!mp_obj_is_type(filename, &mp_type_vfs_fat_fileio)) {
         mp_raise_TypeError(MP_ERROR_TEXT("file must be a file opened in byte mode"));
     }
 
+    mp_int_t cache_size = mp_arg_validate_int_min(args[ARG_cache_size].u_int, 0, MP_QSTR_cache_size);
+
     gifio_ondiskgif_t *self = mp_obj_malloc(gifio_ondiskgif_t, &gifio_ondiskgif_type);
-    common_hal_gifio_ondiskgif_construct(self, MP_OBJ_TO_PTR(filename), args[ARG_use_palette].u_bool);
+    common_hal_gifio_ondiskgif_construct(self, MP_OBJ_TO_PTR(filename), args[ARG_use_palette].u_bool, cache_size);
 
     return MP_OBJ_FROM_PTR(self);
 }
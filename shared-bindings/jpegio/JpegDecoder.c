@@ -30,6 +30,7 @@
 
 #include "shared-bindings/bitmaptools/__init__.h"
 #include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/displayio/Palette.h"
 #include "shared-bindings/jpegio/JpegDecoder.h"
 #include "shared-module/jpegio/JpegDecoder.h"
 #include "shared-module/displayio/Bitmap.h"
@@ -40,6 +41,12 @@
 //|     A JpegDecoder allocates a few thousand bytes of memory. To reduce memory fragmentation,
 //|     create a single JpegDecoder object and use it anytime a JPEG image needs to be decoded.
 //|
+//|     Progressive JPEGs are supported, but all of their scans have to be
+//|     read before anything can be output, so `decode` temporarily allocates
+//|     a buffer for the coefficients of the decoded area. It takes 3 to 6
+//|     bytes per output pixel plus 8 bytes per 8x8 block of the whole image
+//|     (without the latter at ``scale=3``).
+//|
 //|     Example::
 //|
 //|         from jpegio import JpegDecoder
@@ -99,7 +106,7 @@ STATIC mp_obj_t jpegio_jpegdecoder_open(mp_obj_t self_in, mp_obj_t arg) {
     } else if (mp_get_buffer(arg, &bufinfo, MP_BUFFER_READ)) {
         return common_hal_jpegio_jpegdecoder_set_source_buffer(self, arg);
     }
-    mp_raise_TypeError_varg(MP_ERROR_TEXT("%q must be of type %q, %q, or %q, not %q"), MP_QSTR_data_source, MP_QSTR_str, MP_QSTR_BytesIO, MP_QSTR_ReadableBuffer);
+    mp_raise_TypeError_varg(MP_ERROR_TEXT("%q must be of type %q, %q, or %q, not %q"), MP_QSTR_data_source, MP_QSTR_str, MP_QSTR_BytesIO, MP_QSTR_ReadableBuffer, mp_obj_get_type_qstr(arg));
 }
 MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 
@@ -116,11 +123,19 @@ MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 //|         y2: int,
 //|         skip_source_index: int,
 //|         skip_dest_index: int,
+//|         palette: Optional[displayio.Palette] = None,
+//|         dither: bool = False,
 //|     ) -> None:
 //|         """Decode JPEG data
 //|
 //|         The bitmap must be large enough to contain the decoded image.
 //|         The pixel data is stored in the `displayio.Colorspace.RGB565_SWAPPED` colorspace.
+//|         If the bitmap has fewer than 16 bits per value, each pixel is instead stored
+//|         as a greyscale level scaled to the bitmap's bit depth, or, if ``palette`` is
+//|         given, as the index of the nearest color in ``palette``.
+//|
+//|         Only the part of the image that ends up in the bitmap is fully decoded, so
+//|         decoding a small crop of a large image is much faster than decoding all of it.
 //|
 //|         The image is optionally downscaled by a factor of ``2**scale``.
 //|         Scaling by a factor of 8 (scale=3) is particularly efficient in terms of decoding time.
@@ -150,12 +165,15 @@ MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 //|                                set to None to copy all pixels
 //|         :param int skip_dest_index: bitmap palette index in the destination bitmap that will not get overwritten
 //|                                 by the pixels from the source
+//|         :param Palette palette: Colors to choose from when the bitmap has fewer than 16 bits per value.
+//|                                 Transparent entries are never chosen.
+//|         :param bool dither: Apply an ordered dither when the bitmap has fewer than 16 bits per value
 //|         """
 //|
 STATIC mp_obj_t jpegio_jpegdecoder_decode(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     jpegio_jpegdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_bitmap, ARG_scale, ARG_x, ARG_y, ARGS_X1_Y1_X2_Y2, ARG_skip_source_index, ARG_skip_dest_index };
+    enum { ARG_bitmap, ARG_scale, ARG_x, ARG_y, ARGS_X1_Y1_X2_Y2, ARG_skip_source_index, ARG_skip_dest_index, ARG_palette, ARG_dither };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_bitmap, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = mp_const_none } },
         { MP_QSTR_scale, MP_ARG_INT, {.u_int = 0 } },
@@ -164,6 +182,8 @@ STATIC mp_obj_t jpegio_jpegdecoder_decode(mp_uint_t n_args, const mp_obj_t *pos_
         ALLOWED_ARGS_X1_Y1_X2_Y2(0, 0),
         {MP_QSTR_skip_source_index, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
         {MP_QSTR_skip_dest_index, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        {MP_QSTR_palette, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        {MP_QSTR_dither, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -200,7 +220,10 @@ STATIC mp_obj_t jpegio_jpegdecoder_decode(mp_uint_t n_args, const mp_obj_t *pos_
         skip_dest_index = mp_obj_get_int(args[ARG_skip_dest_index].u_obj);
         skip_dest_index_none = false;
     }
-    common_hal_jpegio_jpegdecoder_decode_into(self, bitmap, scale, x, y, &lim, skip_source_index, skip_source_index_none, skip_dest_index, skip_dest_index_none);
+    mp_obj_t palette_in = mp_arg_validate_type_or_none(args[ARG_palette].u_obj, &displayio_palette_type, MP_QSTR_palette);
+    displayio_palette_t *palette = palette_in == mp_const_none ? NULL : MP_OBJ_TO_PTR(palette_in);
+
+    common_hal_jpegio_jpegdecoder_decode_into(self, bitmap, scale, x, y, &lim, skip_source_index, skip_source_index_none, skip_dest_index, skip_dest_index_none, palette, args[ARG_dither].u_bool);
 
     return mp_const_none;
 }
@@ -27,6 +27,7 @@
 #include "py/obj.h"
 #include "py/stream.h"
 #include "shared-module/displayio/Bitmap.h"
+#include "shared-module/displayio/Palette.h"
 #include "shared-bindings/bitmaptools/__init__.h"
 
 extern const mp_obj_type_t jpegio_jpegdecoder_type;
@@ -42,4 +43,5 @@ void common_hal_jpegio_jpegdecoder_decode_into(
     displayio_bitmap_t *bitmap, int scale, int16_t x, int16_t y,
     bitmaptools_rect_t *lim,
     uint32_t skip_source_index, bool skip_source_index_none,
-    uint32_t skip_dest_index, bool skip_dest_index_none);
+    uint32_t skip_dest_index, bool skip_dest_index_none,
+    displayio_palette_t *palette, bool dither);
@@ -153,6 +153,11 @@ STATIC mp_uint_t eventqueue_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t
             }
             return ret;
         }
+        #if MICROPY_PY_SELECT_NOTIFY
+        case MP_STREAM_POLL_NOTIFY:
+            *(mp_stream_notify_t **)arg = &self->notify;
+            return 0;
+        #endif
         default:
             *errcode = MP_EINVAL;
             return MP_STREAM_ERROR;
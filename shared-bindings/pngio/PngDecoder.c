@@ -0,0 +1,228 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/obj.h"
+#include "py/builtin.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/bitmaptools/__init__.h"
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/displayio/Palette.h"
+#include "shared-bindings/pngio/PngDecoder.h"
+#include "shared-module/pngio/PngDecoder.h"
+#include "shared-module/displayio/Bitmap.h"
+
+//| class PngDecoder:
+//|     """A PNG decoder
+//|
+//|     The image is decompressed one row at a time, so decoding only needs
+//|     memory for two rows of the image plus the compression window the PNG
+//|     was written with (at most 32kB, often less for small images).
+//|
+//|     All PNG color types and bit depths are supported, as are interlaced images.
+//|
+//|     Example::
+//|
+//|         from pngio import PngDecoder
+//|         from displayio import Bitmap
+//|
+//|         decoder = PngDecoder()
+//|         width, height = decoder.open("/sd/example.png")
+//|         bitmap = Bitmap(width, height, 65535)
+//|         decoder.decode(bitmap)
+//|         # .. do something with bitmap
+//|     """
+//|
+//|     def __init__(self) -> None: ...
+//|
+STATIC mp_obj_t pngio_pngdecoder_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    static const mp_arg_t allowed_args[] = {
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    pngio_pngdecoder_obj_t *self = mp_obj_malloc(pngio_pngdecoder_obj_t, &pngio_pngdecoder_type);
+    common_hal_pngio_pngdecoder_construct(self);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     @overload
+//|     def open(self, filename: str) -> Tuple[int, int]: ...
+//|     @overload
+//|     def open(self, buffer: ReadableBuffer) -> Tuple[int, int]: ...
+//|     @overload
+//|     def open(self, bytesio: io.BytesIO) -> Tuple[int, int]:
+//|         """Use the specified object as the PNG data source.
+//|
+//|         The source may be a filename, a binary buffer in memory, or an opened binary stream.
+//|
+//|         The single parameter is positional-only (write ``open(f)``, not
+//|         ``open(filename=f)`` but due to technical limitations this is
+//|         not shown in the function signature in the documentation.
+//|
+//|         Returns the image size as the tuple ``(width, height)``."""
+STATIC mp_obj_t pngio_pngdecoder_open(mp_obj_t self_in, mp_obj_t arg) {
+    pngio_pngdecoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (mp_obj_is_str(arg)) {
+        arg = mp_call_function_2(
+            MP_OBJ_FROM_PTR(&mp_builtin_open_obj),
+            arg,
+            MP_OBJ_NEW_QSTR(MP_QSTR_rb));
+    }
+
+    mp_buffer_info_t bufinfo;
+    const mp_stream_p_t *proto = mp_get_stream(arg);
+
+    if (proto && proto->read && !proto->is_text) {
+        return common_hal_pngio_pngdecoder_set_source_file(self, arg);
+    } else if (mp_get_buffer(arg, &bufinfo, MP_BUFFER_READ)) {
+        return common_hal_pngio_pngdecoder_set_source_buffer(self, arg);
+    }
+    mp_raise_TypeError_varg(MP_ERROR_TEXT("%q must be of type %q, %q, or %q, not %q"), MP_QSTR_data_source, MP_QSTR_str, MP_QSTR_BytesIO, MP_QSTR_ReadableBuffer, mp_obj_get_type_qstr(arg));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(pngio_pngdecoder_open_obj, pngio_pngdecoder_open);
+
+//|     def decode(
+//|         self,
+//|         bitmap: displayio.Bitmap,
+//|         x: int = 0,
+//|         y: int = 0,
+//|         *,
+//|         x1: int,
+//|         y1: int,
+//|         x2: int,
+//|         y2: int,
+//|         skip_source_index: int,
+//|         skip_dest_index: int,
+//|         palette: Optional[displayio.Palette] = None,
+//|     ) -> None:
+//|         """Decode PNG data
+//|
+//|         The bitmap must be large enough to contain the decoded image.
+//|
+//|         Indexed-color images are stored as palette indices when the bitmap has
+//|         fewer than 16 bits per value. Greyscale images are then stored as grey
+//|         levels scaled to the bitmap's bit depth, as are truecolor images after
+//|         conversion to greyscale. If ``palette`` is given, the image's own colors
+//|         (or, for greyscale images, the matching grey ramp) are stored into it.
+//|
+//|         With 16 bits per value, pixels are stored in the
+//|         `displayio.Colorspace.RGB565_SWAPPED` colorspace; with more, as RGB888.
+//|         Pixels that are mostly transparent are not stored at all, except for
+//|         palette indices, whose transparency is up to the palette.
+//|
+//|         Rows past the bottom of the copied area are not decompressed, unless
+//|         the image is interlaced.
+//|
+//|         The remaining parameters are as for `bitmaptools.blit`.
+//|
+//|         After a call to ``decode``, you must ``open`` a new PNG. It is not
+//|         possible to repeatedly ``decode`` the same PNG data.
+//|
+//|         :param Bitmap bitmap: Output buffer
+//|         :param int x: Horizontal pixel location in bitmap where source_bitmap upper-left
+//|                       corner will be placed
+//|         :param int y: Vertical pixel location in bitmap where source_bitmap upper-left
+//|                       corner will be placed
+//|         :param int x1: Minimum x-value for rectangular bounding box to be copied from the source bitmap
+//|         :param int y1: Minimum y-value for rectangular bounding box to be copied from the source bitmap
+//|         :param int x2: Maximum x-value (exclusive) for rectangular bounding box to be copied from the source bitmap
+//|         :param int y2: Maximum y-value (exclusive) for rectangular bounding box to be copied from the source bitmap
+//|         :param int skip_source_index: bitmap palette index in the source that will not be copied,
+//|                                set to None to copy all pixels
+//|         :param int skip_dest_index: bitmap palette index in the destination bitmap that will not get overwritten
+//|                                 by the pixels from the source
+//|         :param Palette palette: Palette to store the image's colors into
+//|         """
+//|
+STATIC mp_obj_t pngio_pngdecoder_decode(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    pngio_pngdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+
+    enum { ARG_bitmap, ARG_x, ARG_y, ARGS_X1_Y1_X2_Y2, ARG_skip_source_index, ARG_skip_dest_index, ARG_palette };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_bitmap, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = mp_const_none } },
+        { MP_QSTR_x, MP_ARG_INT, {.u_int = 0 } },
+        { MP_QSTR_y, MP_ARG_INT, {.u_int = 0 } },
+        ALLOWED_ARGS_X1_Y1_X2_Y2(0, 0),
+        {MP_QSTR_skip_source_index, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        {MP_QSTR_skip_dest_index, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        {MP_QSTR_palette, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t bitmap_in = args[ARG_bitmap].u_obj;
+    mp_arg_validate_type(bitmap_in, &displayio_bitmap_type, MP_QSTR_bitmap);
+    displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(args[ARG_bitmap].u_obj);
+
+    int x = mp_arg_validate_int_range(args[ARG_x].u_int, 0, bitmap->width, MP_QSTR_x);
+    int y = mp_arg_validate_int_range(args[ARG_y].u_int, 0, bitmap->height, MP_QSTR_y);
+    bitmaptools_rect_t lim = bitmaptools_validate_coord_range_pair(&args[ARG_x1], bitmap->width, bitmap->height);
+
+    uint32_t skip_source_index;
+    bool skip_source_index_none; // flag whether skip_value was None
+
+    if (args[ARG_skip_source_index].u_obj == mp_const_none) {
+        skip_source_index = 0;
+        skip_source_index_none = true;
+    } else {
+        skip_source_index = mp_obj_get_int(args[ARG_skip_source_index].u_obj);
+        skip_source_index_none = false;
+    }
+
+    uint32_t skip_dest_index;
+    bool skip_dest_index_none; // flag whether skip_self_value was None
+
+    if (args[ARG_skip_dest_index].u_obj == mp_const_none) {
+        skip_dest_index = 0;
+        skip_dest_index_none = true;
+    } else {
+        skip_dest_index = mp_obj_get_int(args[ARG_skip_dest_index].u_obj);
+        skip_dest_index_none = false;
+    }
+    mp_obj_t palette_in = mp_arg_validate_type_or_none(args[ARG_palette].u_obj, &displayio_palette_type, MP_QSTR_palette);
+    displayio_palette_t *palette = palette_in == mp_const_none ? NULL : MP_OBJ_TO_PTR(palette_in);
+
+    common_hal_pngio_pngdecoder_decode_into(self, bitmap, x, y, &lim, skip_source_index, skip_source_index_none, skip_dest_index, skip_dest_index_none, palette);
+
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(pngio_pngdecoder_decode_obj, 1, pngio_pngdecoder_decode);
+
+STATIC const mp_rom_map_elem_t pngio_pngdecoder_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_open), MP_ROM_PTR(&pngio_pngdecoder_open_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decode), MP_ROM_PTR(&pngio_pngdecoder_decode_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(pngio_pngdecoder_locals_dict, pngio_pngdecoder_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    pngio_pngdecoder_type,
+    MP_QSTR_PngDecoder,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, pngio_pngdecoder_make_new,
+    locals_dict, &pngio_pngdecoder_locals_dict
+    );
@@ -119,6 +119,44 @@ STATIC mp_obj_t qrio_qrdecoder_find(size_t n_args, const mp_obj_t *pos_args, mp_
 MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_find_obj, 1, qrio_qrdecoder_find);
 
 
+//|     def scan(
+//|         self, buffer: ReadableBuffer, pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE
+//|     ) -> List[QRInfo]:
+//|         """Decode zero or more QR codes from successive frames of a camera.
+//|
+//|         This works like `decode`, but is meant to be called on every frame.
+//|         Once a code has been decoded, the next frame is only searched in the
+//|         region around it, which is much faster than searching the whole frame.
+//|         Only if nothing is decoded there is the whole frame searched again, so
+//|         further codes elsewhere in the frame may not be found while one is
+//|         being followed.
+//|
+//|         Each pixel is also compared to the average brightness of the area around
+//|         it rather than to that of its row, which copes better with uneven lighting.
+//|
+//|         The buffers used by ``scan`` are allocated on the first call and kept
+//|         for the following frames."""
+STATIC mp_obj_t qrio_qrdecoder_scan(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+
+    enum { ARG_buffer, ARG_pixel_policy };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_int = 0} },
+        { MP_QSTR_pixel_policy, MP_ARG_OBJ, {.u_obj = MP_ROM_PTR((mp_obj_t *)&qrio_pixel_policy_EVERY_BYTE_obj)} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
+    qrio_pixel_policy_t policy = cp_enum_value(&qrio_pixel_policy_type, args[ARG_pixel_policy].u_obj, MP_QSTR_pixel_policy);
+    verify_buffer_size(self, &args[ARG_buffer].u_obj, bufinfo.len, policy);
+
+    return shared_module_qrio_qrdecoder_scan(self, &bufinfo, policy);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_scan_obj, 1, qrio_qrdecoder_scan);
+
+
 //|     width: int
 //|     """The width of image the decoder expects"""
 STATIC mp_obj_t qrio_qrdecoder_get_width(mp_obj_t self_in) {
@@ -166,6 +204,7 @@ STATIC const mp_rom_map_elem_t qrio_qrdecoder_locals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&qrio_qrdecoder_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_decode), MP_ROM_PTR(&qrio_qrdecoder_decode_obj) },
     { MP_ROM_QSTR(MP_QSTR_find), MP_ROM_PTR(&qrio_qrdecoder_find_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scan), MP_ROM_PTR(&qrio_qrdecoder_scan_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(qrio_qrdecoder_locals, qrio_qrdecoder_locals_table);
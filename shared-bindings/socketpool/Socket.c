@@ -455,6 +455,11 @@ STATIC mp_uint_t socket_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg
         if ((flags & MP_STREAM_POLL_WR) && common_hal_socketpool_writable(self)) {
             ret |= MP_STREAM_POLL_WR;
         }
+    #if MICROPY_PY_SELECT_NOTIFY
+    } else if (request == MP_STREAM_POLL_NOTIFY && common_hal_socketpool_socket_get_notify(self) != NULL) {
+        *(mp_stream_notify_t **)arg = common_hal_socketpool_socket_get_notify(self);
+        ret = 0;
+    #endif
     } else {
         *errcode = MP_EINVAL;
         ret = MP_STREAM_ERROR;
@@ -462,6 +467,12 @@ STATIC mp_uint_t socket_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg
     return ret;
 }
 
+#if MICROPY_PY_SELECT_NOTIFY
+MP_WEAK mp_stream_notify_t *common_hal_socketpool_socket_get_notify(socketpool_socket_obj_t *self) {
+    return NULL;
+}
+#endif
+
 STATIC const mp_stream_p_t socket_stream_p = {
     .read = socket_read,
     .write = socket_write,
@@ -28,6 +28,7 @@
 #define MICROPY_INCLUDED_SHARED_BINDINGS_SOCKETPOOL_SOCKET_H
 
 #include "common-hal/socketpool/Socket.h"
+#include "py/stream.h"
 
 extern const mp_obj_type_t socketpool_socket_type;
 
@@ -49,6 +50,11 @@ void common_hal_socketpool_socket_settimeout(socketpool_socket_obj_t *self, uint
 int common_hal_socketpool_socket_setsockopt(socketpool_socket_obj_t *self, int level, int optname, const void *value, size_t optlen);
 bool common_hal_socketpool_readable(socketpool_socket_obj_t *self);
 bool common_hal_socketpool_writable(socketpool_socket_obj_t *self);
+#if MICROPY_PY_SELECT_NOTIFY
+// Returns the counter bumped whenever readable() or writable() may have changed,
+// or NULL if the port can't tell. The default implementation returns NULL.
+mp_stream_notify_t *common_hal_socketpool_socket_get_notify(socketpool_socket_obj_t *self);
+#endif
 
 // Non-allocating versions for internal use.
 int socketpool_socket_accept(socketpool_socket_obj_t *self, uint8_t *ip, uint32_t *port, socketpool_socket_obj_t *accepted);
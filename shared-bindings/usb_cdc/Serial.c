@@ -135,6 +135,12 @@ STATIC mp_uint_t usb_cdc_serial_ioctl_stream(mp_obj_t self_in, mp_uint_t request
             common_hal_usb_cdc_serial_flush(self);
             break;
 
+        #if MICROPY_PY_SELECT_NOTIFY
+        case MP_STREAM_POLL_NOTIFY:
+            *(mp_stream_notify_t **)arg = &self->notify;
+            break;
+        #endif
+
         default:
             *errcode = MP_EINVAL;
             ret = MP_STREAM_ERROR;
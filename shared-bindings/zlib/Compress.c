@@ -0,0 +1,88 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/zlib/Compress.h"
+
+//| class Compress:
+//|     """A compressor for a stream of data too large to hold in memory at
+//|     once, returned by `zlib.compressobj()`.
+//|
+//|     The output uses DEFLATE blocks with fixed Huffman codes. It keeps only a
+//|     window of recent input (the size given by *wbits*) and a small hash
+//|     table, so memory use doesn't grow with the size of the stream."""
+//|
+
+//|     def compress(self, data: ReadableBuffer) -> bytes:
+//|         """Compress *data*, returning the compressed output available so far.
+//|         Some output may be held back until a later call or `flush`."""
+//|         ...
+//|
+STATIC mp_obj_t zlib_compress_obj_compress(mp_obj_t self_in, mp_obj_t data) {
+    zlib_compress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    return common_hal_zlib_compress_obj_compress(self, bufinfo.buf, bufinfo.len);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(zlib_compress_obj_compress_obj, zlib_compress_obj_compress);
+
+//|     def flush(self, mode: int = Z_FINISH) -> bytes:
+//|         """Return the remaining compressed output.
+//|
+//|         With `Z_FINISH` (the default) the stream is ended, and the object
+//|         can't be used any more. `Z_SYNC_FLUSH` and `Z_FULL_FLUSH` output
+//|         everything so far so that it can be decompressed, and then allow more
+//|         data to be compressed; `Z_FULL_FLUSH` also stops later data from
+//|         referring back to earlier data."""
+//|         ...
+//|
+STATIC mp_obj_t zlib_compress_obj_flush(size_t n_args, const mp_obj_t *args) {
+    zlib_compress_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_int_t mode = ZLIB_Z_FINISH;
+    if (n_args > 1) {
+        mode = mp_obj_get_int(args[1]);
+        if (mode != ZLIB_Z_NO_FLUSH && mode != ZLIB_Z_SYNC_FLUSH && mode != ZLIB_Z_FULL_FLUSH && mode != ZLIB_Z_FINISH) {
+            mp_arg_error_invalid(MP_QSTR_mode);
+        }
+    }
+    return common_hal_zlib_compress_obj_flush(self, mode);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(zlib_compress_obj_flush_obj, 1, 2, zlib_compress_obj_flush);
+
+STATIC const mp_rom_map_elem_t zlib_compress_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_compress), MP_ROM_PTR(&zlib_compress_obj_compress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&zlib_compress_obj_flush_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(zlib_compress_locals_dict, zlib_compress_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    zlib_compress_type,
+    MP_QSTR_Compress,
+    MP_TYPE_FLAG_NONE,
+    locals_dict, &zlib_compress_locals_dict
+    );
@@ -0,0 +1,44 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "shared-module/zlib/Compress.h"
+
+#define ZLIB_DEFLATED (8)
+#define ZLIB_MAX_WBITS (15)
+
+// Values for the mode argument of Compress.flush()
+#define ZLIB_Z_NO_FLUSH (0)
+#define ZLIB_Z_SYNC_FLUSH (2)
+#define ZLIB_Z_FULL_FLUSH (3)
+#define ZLIB_Z_FINISH (4)
+
+extern const mp_obj_type_t zlib_compress_type;
+
+void common_hal_zlib_compress_obj_construct(zlib_compress_obj_t *self, mp_int_t level, mp_int_t wbits);
+mp_obj_t common_hal_zlib_compress_obj_compress(zlib_compress_obj_t *self, const uint8_t *data, size_t len);
+mp_obj_t common_hal_zlib_compress_obj_flush(zlib_compress_obj_t *self, mp_int_t mode);
@@ -0,0 +1,146 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/obj.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/zlib/Decompress.h"
+
+//| class Decompress:
+//|     """A decompressor for a stream of data too large to hold in memory at
+//|     once, returned by `zlib.decompressobj()`.
+//|
+//|     It keeps a window of the most recent output (the size given by
+//|     *wbits*, or by the stream's zlib header) plus any input that ends part
+//|     way through a DEFLATE symbol, so memory use doesn't grow with the size
+//|     of the stream.
+//|
+//|     Example::
+//|
+//|         import zlib
+//|
+//|         d = zlib.decompressobj()
+//|         with open("/data.z", "rb") as src, open("/data", "wb") as dst:
+//|             while chunk := src.read(512):
+//|                 dst.write(d.decompress(chunk))
+//|             dst.write(d.flush())
+//|     """
+//|
+
+//|     def decompress(self, data: ReadableBuffer, max_length: int = 0) -> bytes:
+//|         """Decompress *data*, returning the output it gives. Some of the input
+//|         may be kept back until more is supplied, if it ends part way through
+//|         a symbol.
+//|
+//|         If *max_length* is nonzero, at most that many bytes are returned and
+//|         the input that wasn't processed is stored in `unconsumed_tail`, to be
+//|         passed to a later call."""
+//|         ...
+//|
+STATIC mp_obj_t zlib_decompress_obj_decompress(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_data, ARG_max_length };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_max_length, MP_ARG_INT, {.u_int = 0} },
+    };
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_data].u_obj, &bufinfo, MP_BUFFER_READ);
+    mp_int_t max_length = mp_arg_validate_int_min(args[ARG_max_length].u_int, 0, MP_QSTR_max_length);
+    return common_hal_zlib_decompress_obj_decompress(self, bufinfo.buf, bufinfo.len, max_length);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(zlib_decompress_obj_decompress_obj, 1, zlib_decompress_obj_decompress);
+
+//|     def flush(self, length: int = 0) -> bytes:
+//|         """Process `unconsumed_tail` and return the remaining output.
+//|         Input left over from a truncated stream is discarded.
+//|
+//|         :param int length: ignored for compatibility with CPython only
+//|         """
+//|         ...
+//|
+STATIC mp_obj_t zlib_decompress_obj_flush(size_t n_args, const mp_obj_t *args) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    return common_hal_zlib_decompress_obj_flush(self);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(zlib_decompress_obj_flush_obj, 1, 2, zlib_decompress_obj_flush);
+
+//|     eof: bool
+//|     """True once the end of the compressed stream has been reached."""
+//|
+STATIC mp_obj_t zlib_decompress_obj_get_eof(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_zlib_decompress_obj_get_eof(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_obj_get_eof_obj, zlib_decompress_obj_get_eof);
+
+MP_PROPERTY_GETTER(zlib_decompress_obj_eof_obj,
+    (mp_obj_t)&zlib_decompress_obj_get_eof_obj);
+
+//|     unused_data: bytes
+//|     """Input found after the end of the compressed stream."""
+//|
+STATIC mp_obj_t zlib_decompress_obj_get_unused_data(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_zlib_decompress_obj_get_unused_data(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_obj_get_unused_data_obj, zlib_decompress_obj_get_unused_data);
+
+MP_PROPERTY_GETTER(zlib_decompress_obj_unused_data_obj,
+    (mp_obj_t)&zlib_decompress_obj_get_unused_data_obj);
+
+//|     unconsumed_tail: bytes
+//|     """Input not processed by the last `decompress` call because
+//|     *max_length* was reached."""
+//|
+STATIC mp_obj_t zlib_decompress_obj_get_unconsumed_tail(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_zlib_decompress_obj_get_unconsumed_tail(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_obj_get_unconsumed_tail_obj, zlib_decompress_obj_get_unconsumed_tail);
+
+MP_PROPERTY_GETTER(zlib_decompress_obj_unconsumed_tail_obj,
+    (mp_obj_t)&zlib_decompress_obj_get_unconsumed_tail_obj);
+
+STATIC const mp_rom_map_elem_t zlib_decompress_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&zlib_decompress_obj_decompress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&zlib_decompress_obj_flush_obj) },
+    { MP_ROM_QSTR(MP_QSTR_eof), MP_ROM_PTR(&zlib_decompress_obj_eof_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unused_data), MP_ROM_PTR(&zlib_decompress_obj_unused_data_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unconsumed_tail), MP_ROM_PTR(&zlib_decompress_obj_unconsumed_tail_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(zlib_decompress_locals_dict, zlib_decompress_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    zlib_decompress_type,
+    MP_QSTR_Decompress,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    locals_dict, &zlib_decompress_locals_dict
+    );
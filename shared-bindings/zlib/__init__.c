@@ -38,12 +38,28 @@
 #include "py/parsenum.h"
 
 #include "shared-bindings/zlib/__init__.h"
+#include "shared-bindings/zlib/Compress.h"
+#include "shared-bindings/zlib/Decompress.h"
 
-//| """zlib decompression functionality
+//| """zlib compression and decompression functionality
 //|
 //| The `zlib` module allows limited functionality similar to the CPython zlib library.
 //| This module allows to decompress binary data compressed with DEFLATE algorithm
-//| (commonly used in zlib library and gzip archiver). Compression is not yet implemented."""
+//| (commonly used in zlib library and gzip archiver), and to compress data
+//| in the same formats. `decompressobj` and `compressobj` work on a stream of
+//| data a chunk at a time, so the whole of it never needs to be in memory."""
+//|
+//| DEFLATED: int
+//| """The compression method, for `compressobj`."""
+//|
+//| MAX_WBITS: int
+//| """The largest window size, as a power of 2."""
+//|
+//| Z_NO_FLUSH: int
+//| Z_SYNC_FLUSH: int
+//| Z_FULL_FLUSH: int
+//| Z_FINISH: int
+//| """Modes for `Compress.flush`."""
 //|
 
 //| def decompress(data: bytes, wbits: Optional[int] = 0, bufsize: Optional[int] = 0) -> bytes:
@@ -78,9 +94,127 @@ STATIC mp_obj_t zlib_decompress(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(zlib_decompress_obj, 1, 3, zlib_decompress);
 
+// Check wbits and return the window size it gives, as a power of 2.
+STATIC mp_int_t zlib_validate_wbits(mp_int_t wbits, mp_int_t min_bits) {
+    mp_int_t bits = wbits;
+    if (bits < 0) {
+        bits = -bits;
+    } else if (bits >= 16) {
+        bits -= 16;
+    }
+    if (bits < min_bits || bits > ZLIB_MAX_WBITS) {
+        mp_arg_error_invalid(MP_QSTR_wbits);
+    }
+    return bits;
+}
+
+//| def decompressobj(wbits: int = 15) -> Decompress:
+//|     """Return a `Decompress` object, to decompress a stream of data a chunk
+//|     at a time. *wbits* has the same meaning as for `decompress`; for zlib
+//|     streams the window size in the stream's header is used."""
+//|     ...
+//|
+STATIC mp_obj_t zlib_decompressobj(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_wbits };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = ZLIB_MAX_WBITS} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_int_t wbits = args[ARG_wbits].u_int;
+    if (wbits != 0) {
+        zlib_validate_wbits(wbits, 8);
+    }
+
+    zlib_decompress_obj_t *self = mp_obj_malloc(zlib_decompress_obj_t, &zlib_decompress_type);
+    common_hal_zlib_decompress_obj_construct(self, wbits);
+    return MP_OBJ_FROM_PTR(self);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(zlib_decompressobj_obj, 0, zlib_decompressobj);
+
+STATIC zlib_compress_obj_t *zlib_new_compress(mp_int_t level, mp_int_t wbits) {
+    mp_arg_validate_int_range(level, -1, 9, MP_QSTR_level);
+    if (wbits == 8) {
+        // As in CPython, an 8 bit window is silently widened for zlib streams.
+        wbits = 9;
+    }
+    zlib_validate_wbits(wbits, 9);
+    zlib_compress_obj_t *self = mp_obj_malloc(zlib_compress_obj_t, &zlib_compress_type);
+    common_hal_zlib_compress_obj_construct(self, level, wbits);
+    return self;
+}
+
+//| def compressobj(
+//|     level: int = -1,
+//|     method: int = DEFLATED,
+//|     wbits: int = MAX_WBITS,
+//|     memLevel: int = 8,
+//|     strategy: int = 0,
+//| ) -> Compress:
+//|     """Return a `Compress` object, to compress a stream of data a chunk at
+//|     a time.
+//|
+//|     :param int level: 0 to store the data without compressing it, or -1 or 1-9 to compress it
+//|     :param int method: must be `DEFLATED`
+//|     :param int wbits: window size (9-15) for zlib format, or the negated window size for raw DEFLATE format, or the window size plus 16 for gzip format
+//|     :param int memLevel: ignored for compatibility with CPython only
+//|     :param int strategy: ignored for compatibility with CPython only
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t zlib_compressobj(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_level, ARG_method, ARG_wbits, ARG_memLevel, ARG_strategy };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_level, MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_method, MP_ARG_INT, {.u_int = ZLIB_DEFLATED} },
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = ZLIB_MAX_WBITS} },
+        { MP_QSTR_memLevel, MP_ARG_INT, {.u_int = 8} },
+        { MP_QSTR_strategy, MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_arg_validate_int(args[ARG_method].u_int, ZLIB_DEFLATED, MP_QSTR_method);
+    return MP_OBJ_FROM_PTR(zlib_new_compress(args[ARG_level].u_int, args[ARG_wbits].u_int));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(zlib_compressobj_obj, 0, zlib_compressobj);
+
+//| def compress(data: ReadableBuffer, level: int = -1, wbits: int = MAX_WBITS) -> bytes:
+//|     """Return *data* compressed. *level* and *wbits* are as for `compressobj`."""
+//|     ...
+//|
+STATIC mp_obj_t zlib_compress(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_data, ARG_level, ARG_wbits };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_level, MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = ZLIB_MAX_WBITS} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_data].u_obj, &bufinfo, MP_BUFFER_READ);
+
+    zlib_compress_obj_t *comp = zlib_new_compress(args[ARG_level].u_int, args[ARG_wbits].u_int);
+    mp_obj_t head = common_hal_zlib_compress_obj_compress(comp, bufinfo.buf, bufinfo.len);
+    mp_obj_t tail = common_hal_zlib_compress_obj_flush(comp, ZLIB_Z_FINISH);
+    return mp_binary_op(MP_BINARY_OP_ADD, head, tail);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(zlib_compress_obj, 1, zlib_compress);
+
 STATIC const mp_rom_map_elem_t zlib_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_zlib) },
+    { MP_ROM_QSTR(MP_QSTR_compress), MP_ROM_PTR(&zlib_compress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_compressobj), MP_ROM_PTR(&zlib_compressobj_obj) },
     { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&zlib_decompress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decompressobj), MP_ROM_PTR(&zlib_decompressobj_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Compress), MP_ROM_PTR(&zlib_compress_type) },
+    { MP_ROM_QSTR(MP_QSTR_Decompress), MP_ROM_PTR(&zlib_decompress_type) },
+    { MP_ROM_QSTR(MP_QSTR_DEFLATED), MP_ROM_INT(ZLIB_DEFLATED) },
+    { MP_ROM_QSTR(MP_QSTR_MAX_WBITS), MP_ROM_INT(ZLIB_MAX_WBITS) },
+    { MP_ROM_QSTR(MP_QSTR_Z_NO_FLUSH), MP_ROM_INT(ZLIB_Z_NO_FLUSH) },
+    { MP_ROM_QSTR(MP_QSTR_Z_SYNC_FLUSH), MP_ROM_INT(ZLIB_Z_SYNC_FLUSH) },
+    { MP_ROM_QSTR(MP_QSTR_Z_FULL_FLUSH), MP_ROM_INT(ZLIB_Z_FULL_FLUSH) },
+    { MP_ROM_QSTR(MP_QSTR_Z_FINISH), MP_ROM_INT(ZLIB_Z_FINISH) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(zlib_globals, zlib_globals_table);
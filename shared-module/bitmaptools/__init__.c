@@ -705,6 +705,41 @@ enum {
     SWAP_RB = 1 << 1,
 };
 
+STATIC int colorspace_swap(displayio_colorspace_t colorspace) {
+    int swap = 0;
+    if (colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED || colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED) {
+        swap |= SWAP_BYTES;
+    }
+    if (colorspace == DISPLAYIO_COLORSPACE_BGR565 || colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED) {
+        swap |= SWAP_RB;
+    }
+    return swap;
+}
+
+STATIC int rgb565_luma(uint16_t pixel, int swap) {
+    if (swap & SWAP_BYTES) {
+        pixel = __builtin_bswap16(pixel);
+    }
+    int r = (pixel >> 8) & 0xf8;
+    int g = (pixel >> 3) & 0xfc;
+    int b = (pixel << 3) & 0xf8;
+
+    if (swap & SWAP_RB) {
+        uint8_t tmp = r;
+        r = b;
+        b = tmp;
+    }
+
+    // ideal coefficients are around .299, .587, .114 (according to
+    // ppmtopnm), this differs from the 'other' luma-converting
+    // function in circuitpython (why?)
+
+    // we correct for the fact that the input ranges are 0..0xf8 (or
+    // 0xfc) rather than 0x00..0xff
+    // Check: (0xf8 *  78 + 0xfc * 154 + 0xf8 * 29) // 256 == 255
+    return (r * 78 + g * 154 + b * 29) / 256;
+}
+
 STATIC void fill_row(displayio_bitmap_t *bitmap, int swap, int16_t *luminance_data, int y, int mx) {
     if (y >= bitmap->height) {
         return;
@@ -724,28 +759,7 @@ STATIC void fill_row(displayio_bitmap_t *bitmap, int swap, int16_t *luminance_da
     } else {
         uint16_t *pixel_data = (uint16_t *)(bitmap->data + bitmap->stride * y);
         for (int x = 0; x < bitmap->width; x++) {
-            uint16_t pixel = *pixel_data++;
-            if (swap & SWAP_BYTES) {
-                pixel = __builtin_bswap16(pixel);
-            }
-            int r = (pixel >> 8) & 0xf8;
-            int g = (pixel >> 3) & 0xfc;
-            int b = (pixel << 3) & 0xf8;
-
-            if (swap & SWAP_RB) {
-                uint8_t tmp = r;
-                r = b;
-                b = tmp;
-            }
-
-            // ideal coefficients are around .299, .587, .114 (according to
-            // ppmtopnm), this differs from the 'other' luma-converting
-            // function in circuitpython (why?)
-
-            // we correct for the fact that the input ranges are 0..0xf8 (or
-            // 0xfc) rather than 0x00..0xff
-            // Check: (0xf8 *  78 + 0xfc * 154 + 0xf8 * 29) // 256 == 255
-            *luminance_data++ = (r * 78 + g * 154 + b * 29) / 256;
+            *luminance_data++ = rgb565_luma(*pixel_data++, swap);
         }
     }
 }
@@ -774,13 +788,7 @@ static void write_pixels(displayio_bitmap_t *bitmap, int y, bool *data) {
 void common_hal_bitmaptools_dither(displayio_bitmap_t *dest_bitmap, displayio_bitmap_t *source_bitmap, displayio_colorspace_t colorspace, bitmaptools_dither_algorithm_t algorithm) {
     int height = dest_bitmap->height, width = dest_bitmap->width;
 
-    int swap = 0;
-    if (colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED || colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED) {
-        swap |= SWAP_BYTES;
-    }
-    if (colorspace == DISPLAYIO_COLORSPACE_BGR565 || colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED) {
-        swap |= SWAP_RB;
-    }
+    int swap = colorspace_swap(colorspace);
 
     bitmaptools_dither_algorithm_info_t *info = algorithms[algorithm];
     // rowdata holds 3 rows of data.  Each one is larger than the input
@@ -1121,3 +1129,287 @@ void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitm
         }
     }
 }
+
+STATIC const void *source_row(const bitmaptools_source_t *source, int y) {
+    return (const uint8_t *)source->data + y * source->stride;
+}
+
+STATIC uint16_t rgb565_pack(int c0, int c1, int c2, bool swap) {
+    uint16_t pixel = (c0 << 11) | (c1 << 5) | c2;
+    return swap ? __builtin_bswap16(pixel) : pixel;
+}
+
+// Destination columns are resized in tiles of this many pixels, so the
+// per-column tables and the part of each source row they read stay in cache.
+#define RESIZE_TILE_WIDTH (64)
+
+// Source pixels [area_start(i), area_start(i + 1)) make up destination pixel i
+STATIC int area_start(int i, int source_size, int dest_size) {
+    return (int)((uint32_t)i * source_size / dest_size);
+}
+
+// Each destination pixel is the rounded mean of the source pixels it
+// covers.  When enlarging, a destination pixel covers at least one source
+// pixel, which makes this nearest-neighbour.
+STATIC void resize_area(displayio_bitmap_t *dest, const bitmaptools_source_t *source, int channels, bool swap) {
+    int x0[RESIZE_TILE_WIDTH], x1[RESIZE_TILE_WIDTH];
+    uint32_t sums[RESIZE_TILE_WIDTH * 3];
+
+    for (int tx = 0; tx < dest->width; tx += RESIZE_TILE_WIDTH) {
+        int tw = MIN(RESIZE_TILE_WIDTH, dest->width - tx);
+        for (int i = 0; i < tw; i++) {
+            x0[i] = area_start(tx + i, source->width, dest->width);
+            x1[i] = MAX(area_start(tx + i + 1, source->width, dest->width), x0[i] + 1);
+        }
+
+        for (int y = 0; y < dest->height; y++) {
+            int y0 = area_start(y, source->height, dest->height);
+            int y1 = MAX(area_start(y + 1, source->height, dest->height), y0 + 1);
+
+            memset(sums, 0, tw * channels * sizeof(uint32_t));
+            for (int sy = y0; sy < y1; sy++) {
+                if (channels == 1) {
+                    const uint8_t *row = source_row(source, sy);
+                    for (int i = 0; i < tw; i++) {
+                        uint32_t sum = 0;
+                        for (int sx = x0[i]; sx < x1[i]; sx++) {
+                            sum += row[sx];
+                        }
+                        sums[i] += sum;
+                    }
+                } else {
+                    const uint16_t *row = source_row(source, sy);
+                    uint32_t *sum = sums;
+                    for (int i = 0; i < tw; i++, sum += 3) {
+                        uint32_t s0 = 0, s1 = 0, s2 = 0;
+                        for (int sx = x0[i]; sx < x1[i]; sx++) {
+                            uint16_t pixel = row[sx];
+                            if (swap) {
+                                pixel = __builtin_bswap16(pixel);
+                            }
+                            s0 += pixel >> 11;
+                            s1 += (pixel >> 5) & 0x3f;
+                            s2 += pixel & 0x1f;
+                        }
+                        sum[0] += s0;
+                        sum[1] += s1;
+                        sum[2] += s2;
+                    }
+                }
+            }
+
+            int rows = y1 - y0;
+            if (channels == 1) {
+                uint8_t *out = (uint8_t *)(dest->data + y * dest->stride) + tx;
+                for (int i = 0; i < tw; i++) {
+                    uint32_t n = (x1[i] - x0[i]) * rows;
+                    out[i] = (sums[i] + n / 2) / n;
+                }
+            } else {
+                uint16_t *out = (uint16_t *)(dest->data + y * dest->stride) + tx;
+                const uint32_t *sum = sums;
+                for (int i = 0; i < tw; i++, sum += 3) {
+                    uint32_t n = (x1[i] - x0[i]) * rows;
+                    out[i] = rgb565_pack((sum[0] + n / 2) / n, (sum[1] + n / 2) / n, (sum[2] + n / 2) / n, swap);
+                }
+            }
+        }
+    }
+}
+
+// 16.16 fixed point source position sampled for destination pixel i, with
+// the pixel centres lined up, clamped to the source
+STATIC int32_t bilinear_position(int i, int source_size, int dest_size) {
+    int32_t pos = (int32_t)(((int64_t)(2 * i + 1) * source_size << 15) / dest_size) - 0x8000;
+    return MIN(MAX(pos, 0), (source_size - 1) << 16);
+}
+
+// Interpolate between the corners a b / c d with 8 bit weights
+STATIC int bilinear(int a, int b, int c, int d, int fx, int fy) {
+    int top = a * (256 - fx) + b * fx;
+    int bottom = c * (256 - fx) + d * fx;
+    return (top * (256 - fy) + bottom * fy + 0x8000) >> 16;
+}
+
+STATIC void resize_bilinear(displayio_bitmap_t *dest, const bitmaptools_source_t *source, int channels, bool swap) {
+    uint16_t x0[RESIZE_TILE_WIDTH], x1[RESIZE_TILE_WIDTH];
+    uint8_t fx[RESIZE_TILE_WIDTH];
+
+    for (int tx = 0; tx < dest->width; tx += RESIZE_TILE_WIDTH) {
+        int tw = MIN(RESIZE_TILE_WIDTH, dest->width - tx);
+        for (int i = 0; i < tw; i++) {
+            int32_t pos = bilinear_position(tx + i, source->width, dest->width);
+            x0[i] = pos >> 16;
+            x1[i] = MIN(x0[i] + 1, source->width - 1);
+            fx[i] = (pos >> 8) & 0xff;
+        }
+
+        for (int y = 0; y < dest->height; y++) {
+            int32_t pos = bilinear_position(y, source->height, dest->height);
+            int y0 = pos >> 16;
+            int y1 = MIN(y0 + 1, source->height - 1);
+            int fy = (pos >> 8) & 0xff;
+
+            if (channels == 1) {
+                const uint8_t *row0 = source_row(source, y0);
+                const uint8_t *row1 = source_row(source, y1);
+                uint8_t *out = (uint8_t *)(dest->data + y * dest->stride) + tx;
+                for (int i = 0; i < tw; i++) {
+                    out[i] = bilinear(row0[x0[i]], row0[x1[i]], row1[x0[i]], row1[x1[i]], fx[i], fy);
+                }
+            } else {
+                const uint16_t *row0 = source_row(source, y0);
+                const uint16_t *row1 = source_row(source, y1);
+                uint16_t *out = (uint16_t *)(dest->data + y * dest->stride) + tx;
+                for (int i = 0; i < tw; i++) {
+                    uint16_t a = row0[x0[i]], b = row0[x1[i]], c = row1[x0[i]], d = row1[x1[i]];
+                    if (swap) {
+                        a = __builtin_bswap16(a);
+                        b = __builtin_bswap16(b);
+                        c = __builtin_bswap16(c);
+                        d = __builtin_bswap16(d);
+                    }
+                    out[i] = rgb565_pack(
+                        bilinear(a >> 11, b >> 11, c >> 11, d >> 11, fx[i], fy),
+                        bilinear((a >> 5) & 0x3f, (b >> 5) & 0x3f, (c >> 5) & 0x3f, (d >> 5) & 0x3f, fx[i], fy),
+                        bilinear(a & 0x1f, b & 0x1f, c & 0x1f, d & 0x1f, fx[i], fy),
+                        swap);
+                }
+            }
+        }
+    }
+}
+
+void common_hal_bitmaptools_resize(displayio_bitmap_t *dest, const bitmaptools_source_t *source, displayio_colorspace_t colorspace, bitmaptools_resize_algorithm_t algorithm) {
+    if (dest->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
+    // Which of the outer channels is red doesn't matter here
+    int channels = colorspace == DISPLAYIO_COLORSPACE_L8 ? 1 : 3;
+    bool swap = colorspace_swap(colorspace) & SWAP_BYTES;
+
+    if (algorithm == RESIZE_ALGORITHM_BILINEAR) {
+        resize_bilinear(dest, source, channels, swap);
+    } else {
+        resize_area(dest, source, channels, swap);
+    }
+
+    displayio_area_t a = { 0, 0, dest->width, dest->height, NULL };
+    displayio_bitmap_set_dirty_area(dest, &a);
+}
+
+STATIC uint16_t rgb_to_rgb565(int r, int g, int b, int swap) {
+    r = MIN(255, MAX(0, r));
+    g = MIN(255, MAX(0, g));
+    b = MIN(255, MAX(0, b));
+    if (swap & SWAP_RB) {
+        int tmp = r;
+        r = b;
+        b = tmp;
+    }
+    return rgb565_pack(r >> 3, g >> 2, b >> 3, swap & SWAP_BYTES);
+}
+
+void common_hal_bitmaptools_yuv422_to_rgb565(displayio_bitmap_t *dest, const bitmaptools_source_t *source, displayio_colorspace_t colorspace) {
+    if (dest->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
+    int swap = colorspace_swap(colorspace);
+
+    for (int y = 0; y < dest->height; y++) {
+        const uint8_t *in = source_row(source, y);
+        uint16_t *out = (uint16_t *)(dest->data + y * dest->stride);
+        // Each pair of pixels is stored as Y0 U Y1 V and shares the chroma.
+        // JPEG (full range BT.601) coefficients in 8.8 fixed point.
+        for (int x = 0; x < dest->width; x += 2, in += 4) {
+            int u = in[1] - 128;
+            // An odd last pixel has no V sample of its own
+            int v = x + 1 < dest->width ? in[3] - 128 : 0;
+            int dr = (359 * v + 128) >> 8;
+            int dg = (88 * u + 183 * v + 128) >> 8;
+            int db = (454 * u + 128) >> 8;
+            out[x] = rgb_to_rgb565(in[0] + dr, in[0] - dg, in[0] + db, swap);
+            if (x + 1 < dest->width) {
+                out[x + 1] = rgb_to_rgb565(in[2] + dr, in[2] - dg, in[2] + db, swap);
+            }
+        }
+    }
+
+    displayio_area_t a = { 0, 0, dest->width, dest->height, NULL };
+    displayio_bitmap_set_dirty_area(dest, &a);
+}
+
+void common_hal_bitmaptools_rgb565_to_l8(displayio_bitmap_t *dest, const bitmaptools_source_t *source, displayio_colorspace_t colorspace) {
+    if (dest->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
+    int swap = colorspace_swap(colorspace);
+
+    for (int y = 0; y < dest->height; y++) {
+        const uint16_t *in = source_row(source, y);
+        uint8_t *out = (uint8_t *)(dest->data + y * dest->stride);
+        for (int x = 0; x < dest->width; x++) {
+            out[x] = rgb565_luma(in[x], swap);
+        }
+    }
+
+    displayio_area_t a = { 0, 0, dest->width, dest->height, NULL };
+    displayio_bitmap_set_dirty_area(dest, &a);
+}
+
+void common_hal_bitmaptools_palette_lookup(displayio_palette_t *palette, uint8_t *lookup) {
+    for (int i = 0; i < BITMAPTOOLS_PALETTE_LOOKUP_SIZE; i++) {
+        // Centre of the cell of colors with these top 4 bits of red, green and blue
+        int r = ((i >> 4) & 0xf0) | 8;
+        int g = (i & 0xf0) | 8;
+        int b = ((i << 4) & 0xf0) | 8;
+
+        uint32_t best_distance = UINT32_MAX;
+        uint8_t best = 0;
+        for (uint32_t j = 0; j < palette->color_count; j++) {
+            if (palette->colors[j].transparent) {
+                continue;
+            }
+            uint32_t rgb888 = palette->colors[j].rgb888;
+            int dr = (int)((rgb888 >> 16) & 0xff) - r;
+            int dg = (int)((rgb888 >> 8) & 0xff) - g;
+            int db = (int)(rgb888 & 0xff) - b;
+            uint32_t distance = dr * dr + dg * dg + db * db;
+            if (distance < best_distance) {
+                best_distance = distance;
+                best = j;
+            }
+        }
+        lookup[i] = best;
+    }
+}
+
+void common_hal_bitmaptools_rgb565_to_palette(displayio_bitmap_t *dest, const bitmaptools_source_t *source, displayio_colorspace_t colorspace, const uint8_t *lookup) {
+    if (dest->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
+    int swap = colorspace_swap(colorspace);
+
+    for (int y = 0; y < dest->height; y++) {
+        const uint16_t *in = source_row(source, y);
+        uint8_t *out = (uint8_t *)(dest->data + y * dest->stride);
+        for (int x = 0; x < dest->width; x++) {
+            uint16_t pixel = in[x];
+            if (swap & SWAP_BYTES) {
+                pixel = __builtin_bswap16(pixel);
+            }
+            // Top 4 bits of each channel, as red, green, blue
+            int index = (swap & SWAP_RB)
+                ? (((pixel >> 1) & 0xf) << 8) | ((pixel >> 3) & 0xf0) | (pixel >> 12)
+                : ((pixel >> 4) & 0xf00) | ((pixel >> 3) & 0xf0) | ((pixel >> 1) & 0xf);
+            if (dest->bits_per_value == 8) {
+                out[x] = lookup[index];
+            } else {
+                displayio_bitmap_write_pixel(dest, x, y, lookup[index]);
+            }
+        }
+    }
+
+    displayio_area_t a = { 0, 0, dest->width, dest->height, NULL };
+    displayio_bitmap_set_dirty_area(dest, &a);
+}
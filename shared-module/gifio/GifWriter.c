@@ -36,7 +36,19 @@
 #include "shared-bindings/displayio/ColorConverter.h"
 #include "shared-bindings/util.h"
 
-#define BLOCK_SIZE (126) // (2^7) - 2 // (DO NOT CHANGE!)
+// Output is staged here and written to the file whenever it fills up.
+#define BUFFER_SIZE (512)
+
+// GIF limits LZW codes to 12 bits. Following giflib, the dictionary is
+// cleared one short of the limit. Each hash entry packs the 20 bit key (the
+// prefix code and the next pixel) above the 12 bit code it maps to; the table
+// is sized so it is never more than about 80% full.
+#define LZW_MAX_CODE (4095)
+#define LZW_HASH_SIZE (5003)
+#define LZW_EMPTY (0xffffffff)
+
+// Delta frames use a 256 entry palette so that index 128 can be transparent.
+#define DELTA_TRANSPARENT (128)
 
 static void handle_error(gifio_gifwriter_t *self) {
     if (self->error != 0) {
@@ -56,27 +68,29 @@ static void flush_data(gifio_gifwriter_t *self) {
     }
 }
 
-// These "write" calls _MUST_ have enough buffer space available!  This is
-// ensured by allocating the proper buffer size in construct.
 static void write_data(gifio_gifwriter_t *self, const void *data, size_t size) {
-    assert(self->cur + size <= self->size);
-    memcpy(self->data + self->cur, data, size);
-    self->cur += size;
+    const uint8_t *src = data;
+    while (size > 0) {
+        if (self->cur == self->size) {
+            flush_data(self);
+        }
+        size_t n = MIN(size, self->size - self->cur);
+        memcpy(self->data + self->cur, src, n);
+        self->cur += n;
+        src += n;
+        size -= n;
+    }
 }
 
 static void write_byte(gifio_gifwriter_t *self, uint8_t value) {
     write_data(self, &value, sizeof(value));
 }
 
-static void write_long(gifio_gifwriter_t *self, uint32_t value) {
-    write_data(self, &value, sizeof(value));
-}
-
 static void write_word(gifio_gifwriter_t *self, uint16_t value) {
     write_data(self, &value, sizeof(value));
 }
 
-void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *file, int width, int height, displayio_colorspace_t colorspace, bool loop, bool dither, bool own_file) {
+void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *file, int width, int height, displayio_colorspace_t colorspace, bool loop, bool dither, bool delta, bool own_file) {
     self->file = file;
     self->file_proto = mp_get_stream_raise(file, MP_STREAM_OP_WRITE | MP_STREAM_OP_IOCTL);
     if (self->file_proto->is_text) {
@@ -86,18 +100,23 @@ void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *
     self->height = height;
     self->colorspace = colorspace;
     self->dither = dither;
+    self->delta = delta;
+    self->have_previous = false;
     self->own_file = own_file;
 
-    size_t nblocks = (width * height + 125) / 126;
-    self->size = nblocks * 128 + 4;
+    self->size = BUFFER_SIZE;
     self->data = m_malloc(self->size);
     self->cur = 0;
     self->error = 0;
+    self->row = m_malloc(width);
+    self->previous = delta ? m_malloc(width * height) : NULL;
+    self->hash = m_malloc(LZW_HASH_SIZE * sizeof(uint32_t));
+    self->min_code_size = delta ? 8 : 7;
 
     write_data(self, "GIF89a", 6);
     write_word(self, width);
     write_word(self, height);
-    write_data(self, (uint8_t []) {0xF6, 0x00, 0x00}, 3);
+    write_data(self, (uint8_t []) {delta ? 0xF7 : 0xF6, 0x00, 0x00}, 3);
 
     switch (colorspace) {
         case DISPLAYIO_COLORSPACE_RGB565:
@@ -133,6 +152,11 @@ void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *
             write_data(self, (uint8_t []) {gray, gray, gray}, 3);
         }
     }
+    if (delta) {
+        for (int i = 128; i < 256; i++) {
+            write_data(self, (uint8_t []) {0, 0, 0}, 3);
+        }
+    }
 
     if (loop) {
         write_data(self, (uint8_t []) {'!', 0xFF, 0x0B}, 3);
@@ -174,96 +198,212 @@ static const uint8_t g_bayer[4][4] = {
     {31, 14, 26, 10}
 };
 
-void shared_module_gifio_gifwriter_add_frame(gifio_gifwriter_t *self, const mp_buffer_info_t *bufinfo, int16_t delay) {
-    if (delay) {
-        write_data(self, (uint8_t []) {'!', 0xF9, 0x04, 0x04}, 4);
-        write_word(self, delay);
-        write_word(self, 0); // end
+// Convert row y of the frame to palette indices in self->row.
+static void convert_row(gifio_gifwriter_t *self, const mp_buffer_info_t *bufinfo, int y) {
+    uint8_t *out = self->row;
+    int width = self->width;
+
+    if (self->colorspace == DISPLAYIO_COLORSPACE_L8) {
+        const uint8_t *pixels = (const uint8_t *)bufinfo->buf + y * width;
+        for (int x = 0; x < width; x++) {
+            out[x] = pixels[x] >> 1;
+        }
+    } else if (!self->dither) {
+        const uint16_t *pixels = (const uint16_t *)bufinfo->buf + y * width;
+        for (int x = 0; x < width; x++) {
+            int pixel = pixels[x];
+            if (self->byteswap) {
+                pixel = __builtin_bswap16(pixel);
+            }
+            int red = (pixel >> (11 + (5 - 2))) & 0x3;
+            int green = (pixel >> (5 + (6 - 3))) & 0x7;
+            int blue = (pixel >> (0 + (5 - 2))) & 0x3;
+            out[x] = (red << 5) | (green << 2) | blue;
+        }
+    } else {
+        const uint16_t *pixels = (const uint16_t *)bufinfo->buf + y * width;
+        for (int x = 0; x < width; x++) {
+            int pixel = pixels[x];
+            if (self->byteswap) {
+                pixel = __builtin_bswap16(pixel);
+            }
+            int red = (pixel >> 8) & 0xf8;
+            int green = (pixel >> 3) & 0xfc;
+            int blue = (pixel << 3) & 0xf8;
+
+            red = MAX(0, red - rb_bayer[x % 4][y % 4]);
+            green = MAX(0, green - g_bayer[x % 4][(y + 2) % 4]);
+            blue = MAX(0, blue - rb_bayer[(x + 2) % 4][y % 4]);
+
+            out[x] = ((red >> 1) & 0x60) | ((green >> 3) & 0x1c) | (blue >> 6);
+        }
     }
+}
 
-    write_byte(self, 0x2C);
-    write_long(self, 0);
-    write_word(self, self->width);
-    write_word(self, self->height);
-    write_data(self, (uint8_t []) {0x00, 0x07}, 2); // 7-bits
+// Image data is split into sub-blocks of up to 255 bytes, each preceded by
+// its length.
+static void flush_block(gifio_gifwriter_t *self) {
+    if (self->block_len > 0) {
+        write_byte(self, self->block_len);
+        write_data(self, self->block, self->block_len);
+        self->block_len = 0;
+    }
+}
 
-    int pixel_count = self->width * self->height;
-    int blocks = (pixel_count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+static void lzw_write_code(gifio_gifwriter_t *self, int code) {
+    self->bits |= (uint32_t)code << self->nbits;
+    self->nbits += self->code_size;
+    while (self->nbits >= 8) {
+        self->block[self->block_len++] = self->bits & 0xff;
+        if (self->block_len == sizeof(self->block)) {
+            flush_block(self);
+        }
+        self->bits >>= 8;
+        self->nbits -= 8;
+    }
+    // The decoder widens its codes once the next free code no longer fits.
+    if (self->next_code >= (1 << self->code_size) && self->code_size < 12) {
+        self->code_size++;
+    }
+}
 
-    uint8_t *data = self->data + self->cur;
+static void lzw_clear(gifio_gifwriter_t *self) {
+    int clear_code = 1 << self->min_code_size;
+    lzw_write_code(self, clear_code);
+    self->code_size = self->min_code_size + 1;
+    self->next_code = clear_code + 2;
+    memset(self->hash, 0xff, LZW_HASH_SIZE * sizeof(uint32_t));
+}
 
-    if (self->colorspace == DISPLAYIO_COLORSPACE_L8) {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(pixel_count - 1), false);
-
-        uint8_t *pixels = bufinfo->buf;
-        for (int i = 0; i < blocks; i++) {
-            assert(pixel_count >= 0);
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                *data++ = (*pixels++) >> 1;
-            }
+static void lzw_start(gifio_gifwriter_t *self) {
+    write_byte(self, self->min_code_size);
+    self->bits = 0;
+    self->nbits = 0;
+    self->block_len = 0;
+    self->prefix = -1;
+    self->code_size = self->min_code_size + 1;
+    self->next_code = (1 << self->min_code_size) + 2;
+    lzw_clear(self);
+}
+
+static void lzw_add(gifio_gifwriter_t *self, uint8_t pixel) {
+    if (self->prefix < 0) {
+        self->prefix = pixel;
+        return;
+    }
+    uint32_t key = ((uint32_t)self->prefix << 8) | pixel;
+    size_t i = key % LZW_HASH_SIZE;
+    size_t step = 1 + key % (LZW_HASH_SIZE - 2);
+    uint32_t *hash = self->hash;
+    while (hash[i] != LZW_EMPTY) {
+        if ((hash[i] >> 12) == key) {
+            self->prefix = hash[i] & 0xfff;
+            return;
         }
-    } else if (!self->dither) {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
-
-        uint16_t *pixels = bufinfo->buf;
-        for (int i = 0; i < blocks; i++) {
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                int pixel = *pixels++;
-                if (self->byteswap) {
-                    pixel = __builtin_bswap16(pixel);
-                }
-                int red = (pixel >> (11 + (5 - 2))) & 0x3;
-                int green = (pixel >> (5 + (6 - 3))) & 0x7;
-                int blue = (pixel >> (0 + (5 - 2))) & 0x3;
-                *data++ = (red << 5) | (green << 2) | blue;
+        i += step;
+        if (i >= LZW_HASH_SIZE) {
+            i -= LZW_HASH_SIZE;
+        }
+    }
+    lzw_write_code(self, self->prefix);
+    if (self->next_code < LZW_MAX_CODE) {
+        hash[i] = (key << 12) | self->next_code++;
+    } else {
+        lzw_clear(self);
+    }
+    self->prefix = pixel;
+}
+
+static void lzw_finish(gifio_gifwriter_t *self) {
+    if (self->prefix >= 0) {
+        lzw_write_code(self, self->prefix);
+    }
+    lzw_write_code(self, (1 << self->min_code_size) + 1); // end code
+    if (self->nbits > 0) {
+        self->block[self->block_len++] = self->bits & 0xff;
+    }
+    flush_block(self);
+    write_byte(self, 0);
+}
+
+void shared_module_gifio_gifwriter_add_frame(gifio_gifwriter_t *self, const mp_buffer_info_t *bufinfo, int16_t delay) {
+    int width = self->width;
+    int pixel_count = width * self->height;
+    int bytes_per_pixel = (self->colorspace == DISPLAYIO_COLORSPACE_L8) ? 1 : 2;
+    mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(bytes_per_pixel * pixel_count - 1), false);
+
+    // With delta frames only the box around the changed pixels is encoded
+    // and unchanged pixels inside it are transparent.
+    int left = 0, top = 0, right = width, bottom = self->height;
+    bool transparent = self->delta && self->have_previous;
+    if (transparent) {
+        left = width;
+        top = self->height;
+        right = bottom = 0;
+        for (int y = 0; y < self->height; y++) {
+            convert_row(self, bufinfo, y);
+            const uint8_t *previous = self->previous + y * width;
+            int x0 = 0, x1 = width;
+            while (x0 < x1 && self->row[x0] == previous[x0]) {
+                x0++;
+            }
+            if (x0 == x1) {
+                continue;
+            }
+            while (self->row[x1 - 1] == previous[x1 - 1]) {
+                x1--;
             }
+            left = MIN(left, x0);
+            right = MAX(right, x1);
+            top = MIN(top, y);
+            bottom = y + 1;
         }
+    }
+
+    if (delay || self->delta) {
+        // Leave the previous frame in place so later frames can draw over it.
+        uint8_t flags = 0x04 | (self->delta ? 0x01 : 0x00);
+        write_data(self, (uint8_t []) {'!', 0xF9, 0x04, flags}, 4);
+        write_word(self, delay);
+        write_data(self, (uint8_t []) {self->delta ? DELTA_TRANSPARENT : 0, 0}, 2); // end
+    }
+
+    write_byte(self, 0x2C);
+    if (left >= right) {
+        // Nothing changed. A single transparent pixel still carries the delay.
+        write_word(self, 0);
+        write_word(self, 0);
+        write_word(self, 1);
+        write_word(self, 1);
+        write_byte(self, 0x00);
+        lzw_start(self);
+        lzw_add(self, DELTA_TRANSPARENT);
     } else {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
-
-        uint16_t *pixels = bufinfo->buf;
-        int x = 0, y = 0;
-        for (int i = 0; i < blocks; i++) {
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                int pixel = *pixels++;
-                if (self->byteswap) {
-                    pixel = __builtin_bswap16(pixel);
+        write_word(self, left);
+        write_word(self, top);
+        write_word(self, right - left);
+        write_word(self, bottom - top);
+        write_byte(self, 0x00);
+        lzw_start(self);
+        for (int y = top; y < bottom; y++) {
+            convert_row(self, bufinfo, y);
+            if (self->delta) {
+                uint8_t *previous = self->previous + y * width;
+                for (int x = left; x < right; x++) {
+                    uint8_t pixel = self->row[x];
+                    lzw_add(self, (transparent && pixel == previous[x]) ? DELTA_TRANSPARENT : pixel);
+                    previous[x] = pixel;
                 }
-                int red = (pixel >> 8) & 0xf8;
-                int green = (pixel >> 3) & 0xfc;
-                int blue = (pixel << 3) & 0xf8;
-
-                red = MAX(0, red - rb_bayer[x % 4][y % 4]);
-                green = MAX(0, green - g_bayer[x % 4][(y + 2) % 4]);
-                blue = MAX(0, blue - rb_bayer[(x + 2) % 4][y % 4]);
-                x++;
-                if (x == self->width) {
-                    x = 0;
-                    y++;
+            } else {
+                for (int x = left; x < right; x++) {
+                    lzw_add(self, self->row[x]);
                 }
-
-                *data++ = ((red >> 1) & 0x60) | ((green >> 3) & 0x1c) | (blue >> 6);
             }
         }
     }
+    lzw_finish(self);
+    self->have_previous = true;
 
-    self->cur = data - self->data;
-
-    write_data(self, (uint8_t []) {0x01, 0x81, 0x00}, 3); // end code
     flush_data(self);
     handle_error(self);
 }
@@ -276,6 +416,17 @@ void shared_module_gifio_gifwriter_close(gifio_gifwriter_t *self) {
     self->file_proto->ioctl(self->file, self->own_file ? MP_STREAM_CLOSE : MP_STREAM_FLUSH, 0, &error);
     self->file = NULL;
 
+    m_del(uint8_t, self->data, self->size);
+    self->data = NULL;
+    m_del(uint8_t, self->row, self->width);
+    self->row = NULL;
+    if (self->previous) {
+        m_del(uint8_t, self->previous, self->width * self->height);
+        self->previous = NULL;
+    }
+    m_del(uint32_t, self->hash, LZW_HASH_SIZE);
+    self->hash = NULL;
+
     if (error != 0) {
         self->error = error;
     }
@@ -39,7 +39,20 @@ typedef struct gifio_gifwriter {
     int error;
     uint8_t *data;
     size_t cur, size;
+    // One row of the frame as palette indices.
+    uint8_t *row;
+    // The palette indices of the last frame, only allocated for delta frames.
+    uint8_t *previous;
+    // LZW encoder state.
+    uint32_t *hash;
+    uint32_t bits;
+    int nbits;
+    int min_code_size, code_size, next_code, prefix;
+    uint8_t block_len;
+    uint8_t block[255];
     bool own_file;
     bool byteswap;
     bool dither;
+    bool delta;
+    bool have_previous;
 } gifio_gifwriter_t;
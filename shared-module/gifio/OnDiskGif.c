@@ -62,6 +62,120 @@ static int32_t GIFSeekFile(GIFFILE *pFile, int32_t iPosition) {
     return pFile->iPos;
 } /* GIFSeekFile() */
 
+static void set_palette(displayio_palette_t *palette, const uint8_t *colors, int transparent) {
+    for (int p = 0; p < 256; p++) {
+        uint8_t r = *colors++;
+        uint8_t g = *colors++;
+        uint8_t b = *colors++;
+        uint32_t color = (r << 16) + (g << 8) + b;
+        common_hal_displayio_palette_set_color(palette, p, color);
+        // Transparency can change frame to frame. Only touch the entries that
+        // change so the palette isn't marked for refresh needlessly.
+        bool is_transparent = p == transparent;
+        if (common_hal_displayio_palette_is_transparent(palette, p) != is_transparent) {
+            if (is_transparent) {
+                common_hal_displayio_palette_make_transparent(palette, p);
+            } else {
+                common_hal_displayio_palette_make_opaque(palette, p);
+            }
+        }
+    }
+}
+
+static void draw_row(gifio_ondiskgif_t *self, const uint8_t *s, int x, int y, int width, const uint16_t *colors, int transparent) {
+    displayio_bitmap_t *bitmap = self->bitmap;
+    uint32_t *row = bitmap->data + y * bitmap->stride;
+
+    if (self->palette != NULL) {
+        uint8_t *d = (uint8_t *)row + x;
+        if (transparent >= 0) {
+            // Leave the previous frame showing through transparent pixels.
+            for (int i = 0; i < width; i++) {
+                uint8_t c = *s++;
+                if (c != transparent) {
+                    *d = c;
+                }
+                d++;
+            }
+        } else {
+            memcpy(d, s, width);
+        }
+    } else {
+        // No palette writing RGB565_SWAPPED right to bitmap buffer
+        uint16_t *d = (uint16_t *)row + x;
+        if (transparent >= 0) {
+            for (int i = 0; i < width; i++) {
+                uint8_t c = *s++;
+                if (c != transparent) {
+                    *d = colors[c];
+                }
+                d++;
+            }
+        } else {
+            for (int i = 0; i < width; i++) {
+                *d++ = colors[*s++];
+            }
+        }
+    }
+
+    displayio_area_t area = {
+        .x1 = x,
+        .y1 = y,
+        .x2 = x + width,
+        .y2 = y + 1,
+    };
+    displayio_area_union(&self->dirty_area, &area, &self->dirty_area);
+}
+
+static void cache_drop(gifio_ondiskgif_t *self) {
+    // The frames don't fit, keep decoding from the file. The cached frames
+    // are reclaimed by the garbage collector.
+    self->frames = NULL;
+    self->cache_size = 0;
+}
+
+static void cache_start_frame(gifio_ondiskgif_t *self, GIFDRAW *pDraw) {
+    gifio_ondiskgif_frame_t *frame = &self->frames[self->frame];
+    int width = MIN(pDraw->iWidth, self->bitmap->width - pDraw->iX);
+    int height = MIN(pDraw->iHeight, self->bitmap->height - pDraw->iY);
+    if (width < 1 || height < 1) {
+        return;
+    }
+
+    // Most GIFs use the same colors for every frame, so share them.
+    const void *colors = self->palette != NULL ? (const void *)pDraw->pPalette24 : (const void *)pDraw->pPalette;
+    size_t colors_len = self->palette != NULL ? 256 * 3 : 256 * sizeof(uint16_t);
+    const void *previous_colors = NULL;
+    for (int i = self->frame - 1; i >= 0 && previous_colors == NULL; i--) {
+        previous_colors = self->frames[i].colors;
+    }
+    bool share_colors = previous_colors != NULL && memcmp(previous_colors, colors, colors_len) == 0;
+
+    size_t len = width * height + (share_colors ? 0 : colors_len);
+    uint8_t *pixels = NULL;
+    if (self->cache_used + len <= self->cache_size) {
+        pixels = m_malloc_maybe(len);
+    }
+    if (pixels == NULL) {
+        cache_drop(self);
+        return;
+    }
+    self->cache_used += len;
+
+    if (share_colors) {
+        frame->colors = previous_colors;
+    } else {
+        memcpy(pixels + width * height, colors, colors_len);
+        frame->colors = pixels + width * height;
+    }
+    frame->pixels = pixels;
+    frame->x = pDraw->iX;
+    frame->y = pDraw->iY;
+    frame->width = width;
+    frame->height = height;
+    frame->transparent = pDraw->ucHasTransparency ? pDraw->ucTransparent : -1;
+}
+
 static void GIFDraw(GIFDRAW *pDraw) {
     // Called for every scan line of the image as it decodes
     // The pixels delivered are the 8-bit native GIF output
@@ -72,19 +186,14 @@ static void GIFDraw(GIFDRAW *pDraw) {
     displayio_bitmap_t *bitmap = ondiskgif->bitmap;
     displayio_palette_t *palette = ondiskgif->palette;
 
-    // Update the palette if we have one in RGB888
-    if (palette != NULL) {
-        uint8_t *pPal = pDraw->pPalette24;
-        for (int p = 0; p < 256; p++) {
-            uint8_t r = *pPal++;
-            uint8_t g = *pPal++;
-            uint8_t b = *pPal++;
-            uint32_t color = (r << 16) + (g << 8) + b;
-            common_hal_displayio_palette_set_color(palette, p, color);
-            common_hal_displayio_palette_make_opaque(palette, p); // Transparency can change frame to frame
+    if (!ondiskgif->frame_started) {
+        ondiskgif->frame_started = true;
+        // Update the palette if we have one in RGB888
+        if (palette != NULL) {
+            set_palette(palette, pDraw->pPalette24, pDraw->ucHasTransparency ? pDraw->ucTransparent : -1);
         }
-        if (pDraw->ucHasTransparency) {
-            common_hal_displayio_palette_make_transparent(palette, pDraw->ucTransparent);
+        if (ondiskgif->frames != NULL) {
+            cache_start_frame(ondiskgif, pDraw);
         }
     }
 
@@ -97,9 +206,6 @@ static void GIFDraw(GIFDRAW *pDraw) {
         return;
     }
 
-    int32_t row_start = (pDraw->y + pDraw->iY) * bitmap->stride;
-    uint32_t *row = bitmap->data + row_start;
-
     if (pDraw->ucDisposalMethod == 2) { // restore to background color
         // Not supported currently. Need to reset the area the previous frame occupied
         // to the background color before the previous frame was drawn
@@ -108,46 +214,30 @@ static void GIFDraw(GIFDRAW *pDraw) {
         // To workaround clear the gif.bitmap object yourself as required.
     }
 
-    if (palette != NULL) {
-        uint8_t *s = pDraw->pPixels;
-        uint8_t *d = (uint8_t *)row;
+    draw_row(ondiskgif, pDraw->pPixels, pDraw->iX, pDraw->iY + pDraw->y, iWidth, pDraw->pPalette,
+        pDraw->ucHasTransparency ? pDraw->ucTransparent : -1);
 
-        d += pDraw->iX;
-        for (int x = 0; x < iWidth; x++)
-        {
-            *d++ = *s++;
-        }
-    } else {
-        // No palette writing RGB565_SWAPPED right to bitmap buffer
-        uint8_t *s = pDraw->pPixels;
-        ;
-        uint16_t *d = (uint16_t *)row;
-
-        uint16_t *pPal;
-        pPal = (uint16_t *)pDraw->pPalette;
-
-        uint8_t c, ucTransparent = pDraw->ucTransparent;
-        d += pDraw->iX;
-        if (pDraw->ucHasTransparency == 1) {
-            for (int x = 0; x < iWidth; x++)
-            {
-                c = *s++;
-                if (c != ucTransparent) {
-                    *d = pPal[c];
-                }
-                d++;
-            }
-        } else {
-            for (int x = 0; x < iWidth; x++)
-            {
-                c = *s++;
-                *d++ = pPal[c];
-            }
+    if (ondiskgif->frames != NULL) {
+        gifio_ondiskgif_frame_t *frame = &ondiskgif->frames[ondiskgif->frame];
+        if (frame->pixels != NULL) {
+            memcpy(frame->pixels + pDraw->y * frame->width, pDraw->pPixels, iWidth);
         }
     }
 }
 
-void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_t *file, bool use_palette) {
+static void draw_cached_frame(gifio_ondiskgif_t *self, const gifio_ondiskgif_frame_t *frame) {
+    if (frame->pixels == NULL) {
+        return;
+    }
+    if (self->palette != NULL) {
+        set_palette(self->palette, frame->colors, frame->transparent);
+    }
+    for (int y = 0; y < frame->height; y++) {
+        draw_row(self, frame->pixels + y * frame->width, frame->x, frame->y + y, frame->width, frame->colors, frame->transparent);
+    }
+}
+
+void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_t *file, bool use_palette, size_t cache_size) {
     self->file = file;
 
     if (use_palette == true) {
@@ -199,6 +289,18 @@ void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_
     self->frame_count = info.iFrameCount;
     self->min_delay = info.iMinDelay;
     self->max_delay = info.iMaxDelay;
+
+    self->frame = 0;
+    self->cached_frames = 0;
+    self->cache_size = cache_size;
+    self->cache_used = self->frame_count * sizeof(gifio_ondiskgif_frame_t);
+    self->frames = NULL;
+    if (self->frame_count > 0 && self->cache_used <= cache_size) {
+        self->frames = m_malloc_maybe(self->cache_used);
+        if (self->frames != NULL) {
+            memset(self->frames, 0, self->cache_used);
+        }
+    }
 }
 
 void common_hal_gifio_ondiskgif_deinit(gifio_ondiskgif_t *self) {
@@ -206,6 +308,7 @@ void common_hal_gifio_ondiskgif_deinit(gifio_ondiskgif_t *self) {
     common_hal_displayio_bitmap_deinit(self->bitmap);
     self->bitmap = NULL;
     self->palette = NULL;
+    self->frames = NULL;
 }
 
 bool common_hal_gifio_ondiskgif_deinited(gifio_ondiskgif_t *self) {
@@ -249,18 +352,36 @@ int32_t common_hal_gifio_ondiskgif_get_max_delay(gifio_ondiskgif_t *self) {
 
 uint32_t common_hal_gifio_ondiskgif_next_frame(gifio_ondiskgif_t *self, bool setDirty) {
     int nextDelay = 0;
-    int result = 0;
-    result = GIF_playFrame(&self->gif, &nextDelay, self);
-
-    if ((result >= 0) && (setDirty)) {
-        displayio_area_t dirty_area = {
-            .x1 = 0,
-            .y1 = 0,
-            .x2 = self->bitmap->width,
-            .y2 = self->bitmap->height,
-        };
-
-        displayio_bitmap_set_dirty_area(self->bitmap, &dirty_area);
+    self->dirty_area = (displayio_area_t) {0};
+
+    if (self->cached_frames > 0) {
+        gifio_ondiskgif_frame_t *frame = &self->frames[self->frame];
+        draw_cached_frame(self, frame);
+        nextDelay = frame->delay;
+        self->frame = (self->frame + 1) % self->cached_frames;
+    } else {
+        self->frame_started = false;
+        int result = GIF_playFrame(&self->gif, &nextDelay, self);
+        if (self->frames != NULL) {
+            self->frames[self->frame].delay = nextDelay;
+        }
+        if (result > 0) {
+            self->frame++;
+            if (self->frames != NULL && self->frame >= self->frame_count) {
+                cache_drop(self);
+            }
+        } else {
+            // That was the last frame, the next one starts over.
+            if (self->frames != NULL) {
+                self->cached_frames = self->frame + 1;
+            }
+            self->frame = 0;
+        }
+    }
+
+    // Only the part of the bitmap the frame covers needs to be refreshed.
+    if (setDirty && !displayio_area_empty(&self->dirty_area)) {
+        displayio_bitmap_set_dirty_area(self->bitmap, &self->dirty_area);
     }
 
     return nextDelay;
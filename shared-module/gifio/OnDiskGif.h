@@ -38,6 +38,16 @@
 
 #include "extmod/vfs_fat.h"
 
+// A decoded frame in the cache: the palette indices of the part of the
+// bitmap the frame covers, drawn over the previous frame just like GIFDraw.
+typedef struct {
+    const void *colors; // RGB888 or RGB565_BE, shared with the previous frame if equal
+    uint8_t *pixels;
+    uint16_t x, y, width, height;
+    int32_t delay;
+    int16_t transparent; // -1 if no color is transparent
+} gifio_ondiskgif_frame_t;
+
 typedef struct {
     mp_obj_base_t base;
     GIFIMAGE gif;
@@ -48,6 +58,16 @@ typedef struct {
     int32_t frame_count;
     int32_t min_delay;
     int32_t max_delay;
+    // The part of the bitmap drawn by the current frame.
+    displayio_area_t dirty_area;
+    bool frame_started;
+    // Frames are added to the cache as they are decoded during the first
+    // loop. Once all of them are in, they are replayed from RAM.
+    gifio_ondiskgif_frame_t *frames;
+    size_t cache_size;
+    size_t cache_used;
+    int32_t frame;
+    int32_t cached_frames;
 } gifio_ondiskgif_t;
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_ONDISKGIF_H
@@ -27,6 +27,7 @@
 #include "py/runtime.h"
 
 #include "shared-bindings/jpegio/JpegDecoder.h"
+#include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/bitmaptools/__init__.h"
 #include "shared-module/jpegio/JpegDecoder.h"
 
@@ -145,6 +146,93 @@ mp_obj_t common_hal_jpegio_jpegdecoder_set_source_buffer(jpegio_jpegdecoder_obj_
 
 #define DECODER_CONTINUE (1)
 #define DECODER_INTERRUPT (0)
+
+static const uint8_t bayer[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+};
+
+// Map each RGB333 color to the nearest opaque palette entry that fits in the
+// destination bitmap.
+static void build_palette_lut(jpegio_jpegdecoder_obj_t *self, uint32_t max_colors) {
+    displayio_palette_t *palette = self->palette;
+    uint32_t count = MIN(palette->color_count, max_colors);
+    for (int i = 0; i < (int)sizeof(self->palette_lut); i++) {
+        int r = ((i >> 6) & 7) * 255 / 7;
+        int g = ((i >> 3) & 7) * 255 / 7;
+        int b = (i & 7) * 255 / 7;
+        uint32_t best_distance = UINT32_MAX;
+        uint8_t best = 0;
+        for (uint32_t j = 0; j < count; j++) {
+            if (palette->colors[j].transparent) {
+                continue;
+            }
+            uint32_t color = palette->colors[j].rgb888;
+            int dr = r - (int)((color >> 16) & 0xff);
+            int dg = g - (int)((color >> 8) & 0xff);
+            int db = b - (int)(color & 0xff);
+            uint32_t distance = 2 * dr * dr + 4 * dg * dg + 3 * db * db;
+            if (distance < best_distance) {
+                best_distance = distance;
+                best = j;
+            }
+        }
+        self->palette_lut[i] = best;
+    }
+}
+
+// Store an RGB565_SWAPPED MCU into a bitmap of fewer than 16 bits per value
+// as greyscale or palette indices, optionally with an ordered dither.
+static void convert_output(jpegio_jpegdecoder_obj_t *self, const uint16_t *data, int src_width, int x, int y, int x1, int y1, int x2, int y2) {
+    displayio_bitmap_t *dest = self->dest;
+    x2 = MIN(x2, x1 + dest->width - x);
+    y2 = MIN(y2, y1 + dest->height - y);
+    if (x2 <= x1 || y2 <= y1) {
+        return;
+    }
+
+    int levels = (1 << dest->bits_per_value) - 1;
+    for (int sy = y1; sy < y2; sy++) {
+        int dy = y + sy - y1;
+        const uint16_t *row = data + sy * src_width;
+        for (int sx = x1; sx < x2; sx++) {
+            int dx = x + sx - x1;
+            uint16_t value = row[sx];
+            if (!self->skip_source_index_none && value == self->skip_source_index) {
+                continue;
+            }
+            if (!self->skip_dest_index_none && common_hal_displayio_bitmap_get_pixel(dest, dx, dy) == self->skip_dest_index) {
+                continue;
+            }
+            int pixel = __builtin_bswap16(value);
+            int r = (pixel >> 8) & 0xf8;
+            int g = (pixel >> 3) & 0xfc;
+            int b = (pixel << 3) & 0xf8;
+            r |= r >> 5;
+            g |= g >> 6;
+            b |= b >> 5;
+            // Threshold within one output step, in 16ths. Without dithering round to nearest.
+            int t = self->dither ? bayer[dy & 3][dx & 3] : 8;
+            uint32_t out;
+            if (self->palette) {
+                int r3 = MIN(7, (r + 2 * t) >> 5);
+                int g3 = MIN(7, (g + 2 * t) >> 5);
+                int b3 = MIN(7, (b + 2 * t) >> 5);
+                out = self->palette_lut[(r3 << 6) | (g3 << 3) | b3];
+            } else {
+                int luma = (r * 77 + g * 150 + b * 29) >> 8;
+                out = (luma * levels + t * 16 + 8) / 255;
+            }
+            displayio_bitmap_write_pixel(dest, dx, dy, out);
+        }
+    }
+
+    displayio_area_t area = { x, y, x + (x2 - x1), y + (y2 - y1), NULL};
+    displayio_bitmap_set_dirty_area(dest, &area);
+}
+
 static int bitmap_output(JDEC *jd, void *data, JRECT *rect) {
     jpegio_jpegdecoder_obj_t *self = CONTAINER_OF(jd, jpegio_jpegdecoder_obj_t, decoder);
     int src_width = rect->right - rect->left + 1, src_pixel_stride = src_width /* in units of pixels! */, src_height = rect->bottom - rect->top + 1;
@@ -201,8 +289,20 @@ static int bitmap_output(JDEC *jd, void *data, JRECT *rect) {
     assert(x2 <= src_width);
     assert(y2 <= src_height);
 
-    common_hal_bitmaptools_blit(self->dest, &src, x, y, x1, y1, x2, y2, self->skip_source_index, self->skip_source_index_none, self->skip_dest_index, self->skip_dest_index_none);
-    return 1;
+    if (self->dest->bits_per_value < 16) {
+        convert_output(self, data, src_width, x, y, x1, y1, x2, y2);
+    } else {
+        common_hal_bitmaptools_blit(self->dest, &src, x, y, x1, y1, x2, y2, self->skip_source_index, self->skip_source_index_none, self->skip_dest_index, self->skip_dest_index_none);
+    }
+    return DECODER_CONTINUE;
+}
+
+static void free_progbuf(jpegio_jpegdecoder_obj_t *self) {
+    if (self->decoder.progbuf != NULL) {
+        m_del(uint8_t, self->decoder.progbuf, self->decoder.sz_progbuf);
+    }
+    self->decoder.progbuf = NULL;
+    self->decoder.sz_progbuf = 0;
 }
 
 void common_hal_jpegio_jpegdecoder_decode_into(
@@ -210,7 +310,8 @@ void common_hal_jpegio_jpegdecoder_decode_into(
     displayio_bitmap_t *bitmap, int scale, int16_t x, int16_t y,
     bitmaptools_rect_t *lim,
     uint32_t skip_source_index, bool skip_source_index_none,
-    uint32_t skip_dest_index, bool skip_dest_index_none) {
+    uint32_t skip_dest_index, bool skip_dest_index_none,
+    displayio_palette_t *palette, bool dither) {
     if (self->data_obj == MP_OBJ_NULL) {
         mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q() without %q()"), MP_QSTR_decode, MP_QSTR_open);
     }
@@ -224,7 +325,47 @@ void common_hal_jpegio_jpegdecoder_decode_into(
     self->skip_dest_index_none = skip_dest_index_none;
 
     self->dest = bitmap;
-    JRESULT result = jd_decomp(&self->decoder, bitmap_output, scale);
+    self->palette = palette;
+    self->dither = dither;
+    if (palette && bitmap->bits_per_value < 16) {
+        build_palette_lut(self, 1 << bitmap->bits_per_value);
+    } else {
+        self->palette = NULL;
+    }
+
+    // Only the MCUs that end up in the bitmap need to be IDCT'd and output.
+    int src_x2 = MIN(lim->x2, lim->x1 + bitmap->width - x);
+    int src_y2 = MIN(lim->y2, lim->y1 + bitmap->height - y);
+    JRESULT result = JDR_OK;
+    if (src_x2 > lim->x1 && src_y2 > lim->y1) {
+        JRECT roi = {
+            .left = MIN(lim->x1 << scale, 0xffff),
+            .right = MIN((src_x2 << scale) - 1, 0xffff),
+            .top = MIN(lim->y1 << scale, 0xffff),
+            .bottom = MIN((src_y2 << scale) - 1, 0xffff),
+        };
+        // Progressive images are decoded into a coefficient buffer that
+        // only covers the part of the image within roi.
+        size_t progbuf_size = jd_progressive_size(&self->decoder, scale, &roi);
+        if (progbuf_size) {
+            // The input callback may raise, so don't leave the decoder
+            // pointing at the buffer after it has been freed.
+            nlr_buf_t nlr;
+            if (nlr_push(&nlr) == 0) {
+                self->decoder.progbuf = m_malloc(progbuf_size);
+                self->decoder.sz_progbuf = progbuf_size;
+                result = jd_decomp_roi(&self->decoder, bitmap_output, scale, &roi);
+                nlr_pop();
+            } else {
+                free_progbuf(self);
+                nlr_jump(nlr.ret_val);
+            }
+            free_progbuf(self);
+        } else {
+            result = jd_decomp_roi(&self->decoder, bitmap_output, scale, &roi);
+        }
+    }
+    self->palette = NULL;
     common_hal_jpegio_jpegdecoder_close(self);
     if (result != JDR_INTR) {
         check_jresult(result);
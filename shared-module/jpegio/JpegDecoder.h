@@ -27,6 +27,7 @@
 #include "py/obj.h"
 #include "lib/tjpgd/src/tjpgd.h"
 #include "shared-module/displayio/Bitmap.h"
+#include "shared-module/displayio/Palette.h"
 
 #define TJPGD_WORKSPACE_SIZE 3500
 
@@ -42,4 +43,9 @@ typedef struct jpegio_jpegdecoder_obj {
     uint32_t skip_source_index, skip_dest_index;
     bool skip_source_index_none, skip_dest_index_none;
     uint8_t scale;
+    // Output into bitmaps of fewer than 16 bits: greyscale, or the nearest
+    // palette entry looked up by RGB333.
+    displayio_palette_t *palette;
+    bool dither;
+    uint8_t palette_lut[512];
 } jpegio_jpegdecoder_obj_t;
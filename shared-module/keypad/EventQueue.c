@@ -37,6 +37,9 @@ void common_hal_keypad_eventqueue_construct(keypad_eventqueue_obj_t *self, size_
     // Event queue is 16-bit values.
     ringbuf_alloc(&self->encoded_events, max_events * (sizeof(uint16_t) + sizeof(mp_obj_t)));
     self->overflowed = false;
+    #if MICROPY_PY_SELECT_NOTIFY
+    self->notify = 0;
+    #endif
 }
 
 bool common_hal_keypad_eventqueue_get_into(keypad_eventqueue_obj_t *self, keypad_event_obj_t *event) {
@@ -92,6 +95,10 @@ bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_numbe
     }
     ringbuf_put16(&self->encoded_events, encoded_event);
     ringbuf_put_n(&self->encoded_events, (uint8_t *)&timestamp, sizeof(mp_obj_t));
+    #if MICROPY_PY_SELECT_NOTIFY
+    // Wake anything waiting in select.poll() for this queue.
+    mp_stream_notify(&self->notify);
+    #endif
 
     return true;
 }
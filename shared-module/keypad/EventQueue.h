@@ -29,11 +29,15 @@
 
 #include "py/obj.h"
 #include "py/ringbuf.h"
+#include "py/stream.h"
 
 typedef struct _keypad_eventqueue_obj_t {
     mp_obj_base_t base;
     ringbuf_t encoded_events;
     bool overflowed;
+    #if MICROPY_PY_SELECT_NOTIFY
+    mp_stream_notify_t notify;
+    #endif
 } keypad_eventqueue_obj_t;
 
 bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_number, bool pressed, mp_obj_t timestamp);
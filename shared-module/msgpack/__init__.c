@@ -43,72 +43,129 @@
 ////////////////////////////////////////////////////////////////
 // stream management
 
+// Size of the read-ahead buffer used when unpacking from a seekable stream.
+// Larger payloads are read straight into their destination.
+#define MSGPACK_READ_AHEAD (256)
+
 typedef struct _msgpack_stream_t {
     mp_obj_t stream_obj;
     mp_uint_t (*read)(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode);
     mp_uint_t (*write)(mp_obj_t obj, const void *buf, mp_uint_t size, int *errcode);
     int errcode;
+    // Unread input is cur..end.  When unpacking from a stream, it lies in
+    // buf; when unpacking from memory, buf is NULL and cur..end is the
+    // remaining part of the caller's buffer.
+    const byte *cur;
+    const byte *end;
+    byte *buf;
+    // Only seekable streams are read ahead, because unused bytes have to be
+    // given back when unpacking is done.
+    bool read_ahead;
+    // When set, bin payloads are returned as memoryview slices of the
+    // caller's buffer, which starts at element offset view_offset of
+    // view_items.
+    bool zero_copy;
+    byte view_typecode;
+    void *view_items;
+    size_t view_offset;
+    const byte *view_start;
 } msgpack_stream_t;
 
 STATIC msgpack_stream_t get_stream(mp_obj_t stream_obj, int flags) {
     const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, flags);
-    msgpack_stream_t s = {stream_obj, stream_p->read, stream_p->write, 0};
+    msgpack_stream_t s = {
+        .stream_obj = stream_obj,
+        .read = stream_p->read,
+        .write = stream_p->write,
+    };
     return s;
 }
 
+// Give back to a seekable stream what was read past the current position.
+STATIC void stream_rewind(msgpack_stream_t *s) {
+    if (s->read_ahead && s->cur != s->end) {
+        mp_stream_seek_relative(s->stream_obj, -(mp_off_t)(s->end - s->cur));
+    }
+}
+
 ////////////////////////////////////////////////////////////////
 // readers
 
-STATIC void read(msgpack_stream_t *s, void *buf, mp_uint_t size) {
-    if (size == 0) {
-        return;
+STATIC NORETURN void raise_short_read(size_t got) {
+    if (got == 0) {
+        mp_raise_msg(&mp_type_EOFError, NULL);
     }
-    mp_uint_t ret = s->read(s->stream_obj, buf, size, &s->errcode);
-    if (s->errcode != 0) {
-        mp_raise_OSError(s->errcode);
+    mp_raise_ValueError(MP_ERROR_TEXT("short read"));
+}
+
+// Read at most size bytes from the stream into buf, looping until at
+// least min bytes have arrived.
+STATIC size_t read_stream(msgpack_stream_t *s, byte *buf, size_t min, size_t size, size_t got) {
+    while (got < min) {
+        mp_uint_t ret = s->read(s->stream_obj, buf + got, size - got, &s->errcode);
+        if (s->errcode != 0) {
+            mp_raise_OSError(s->errcode);
+        }
+        if (ret == 0) {
+            raise_short_read(got);
+        }
+        got += ret;
     }
-    if (ret == 0) {
-        mp_raise_msg(&mp_type_EOFError, NULL);
+    return got;
+}
+
+// Return a pointer to the next n bytes of input and consume them.
+// n must not be larger than MSGPACK_READ_AHEAD unless reading from memory.
+STATIC const byte *take(msgpack_stream_t *s, size_t n) {
+    size_t avail = s->end - s->cur;
+    if (avail < n) {
+        if (s->buf == NULL) {
+            raise_short_read(avail);
+        }
+        memmove(s->buf, s->cur, avail);
+        avail = read_stream(s, s->buf, n, s->read_ahead ? MSGPACK_READ_AHEAD : n, avail);
+        s->cur = s->buf;
+        s->end = s->buf + avail;
+    }
+    const byte *p = s->cur;
+    s->cur += n;
+    return p;
+}
+
+STATIC void read_bytes(msgpack_stream_t *s, void *buf, mp_uint_t size) {
+    if (size <= MSGPACK_READ_AHEAD || s->buf == NULL) {
+        memcpy(buf, take(s, size), size);
+        return;
     }
-    if (ret < size) {
-        mp_raise_ValueError(MP_ERROR_TEXT("short read"));
+    // Too big for the read-ahead buffer: drain what is buffered, then
+    // read the rest in place.  Read in chunks: (some drivers - e.g. UART)
+    // limit the maximum number of bytes that can be read at once.
+    size_t got = s->end - s->cur;
+    memcpy(buf, s->cur, got);
+    s->cur = s->end;
+    while (got < size) {
+        size_t n = got + MIN(size - got, 256);
+        got = read_stream(s, buf, n, n, got);
     }
 }
 
 STATIC uint8_t read1(msgpack_stream_t *s) {
-    uint8_t res = 0;
-    read(s, &res, 1);
-    return res;
+    return *take(s, 1);
 }
 
 STATIC uint16_t read2(msgpack_stream_t *s) {
-    uint16_t res = 0;
-    read(s, &res, 2);
-    int n = 1;
-    if (*(char *)&n == 1) {
-        res = __builtin_bswap16(res);
-    }
-    return res;
+    const byte *p = take(s, 2);
+    return (p[0] << 8) | p[1];
 }
 
 STATIC uint32_t read4(msgpack_stream_t *s) {
-    uint32_t res = 0;
-    read(s, &res, 4);
-    int n = 1;
-    if (*(char *)&n == 1) {
-        res = __builtin_bswap32(res);
-    }
-    return res;
+    const byte *p = take(s, 4);
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
 }
 
 STATIC uint64_t read8(msgpack_stream_t *s) {
-    uint64_t res = 0;
-    read(s, &res, 8);
-    int n = 1;
-    if (*(char *)&n == 1) {
-        res = __builtin_bswap64(res);
-    }
-    return res;
+    uint64_t hi = read4(s);
+    return (hi << 32) | read4(s);
 }
 
 STATIC size_t read_size(msgpack_stream_t *s, uint8_t len_index) {
@@ -130,7 +187,7 @@ STATIC size_t read_size(msgpack_stream_t *s, uint8_t len_index) {
 ////////////////////////////////////////////////////////////////
 // writers
 
-STATIC void write(msgpack_stream_t *s, const void *buf, mp_uint_t size) {
+STATIC void write_bytes(msgpack_stream_t *s, const void *buf, mp_uint_t size) {
     mp_uint_t ret = s->write(s->stream_obj, buf, size, &s->errcode);
     if (s->errcode != 0) {
         mp_raise_OSError(s->errcode);
@@ -141,7 +198,7 @@ STATIC void write(msgpack_stream_t *s, const void *buf, mp_uint_t size) {
 }
 
 STATIC void write1(msgpack_stream_t *s, uint8_t obj) {
-    write(s, &obj, 1);
+    write_bytes(s, &obj, 1);
 }
 
 STATIC void write2(msgpack_stream_t *s, uint16_t obj) {
@@ -149,7 +206,7 @@ STATIC void write2(msgpack_stream_t *s, uint16_t obj) {
     if (*(char *)&n == 1) {
         obj = __builtin_bswap16(obj);
     }
-    write(s, &obj, 2);
+    write_bytes(s, &obj, 2);
 }
 
 STATIC void write4(msgpack_stream_t *s, uint32_t obj) {
@@ -157,7 +214,7 @@ STATIC void write4(msgpack_stream_t *s, uint32_t obj) {
     if (*(char *)&n == 1) {
         obj = __builtin_bswap32(obj);
     }
-    write(s, &obj, 4);
+    write_bytes(s, &obj, 4);
 }
 
 // compute and write msgpack size code (array structures)
@@ -212,7 +269,7 @@ STATIC void pack_int(msgpack_stream_t *s, int32_t x) {
 STATIC void pack_bin(msgpack_stream_t *s, const uint8_t *data, size_t len) {
     write_size(s, 0xc4, len);
     if (len > 0) {
-        write(s, data, len);
+        write_bytes(s, data, len);
     }
 }
 
@@ -232,7 +289,7 @@ STATIC void pack_ext(msgpack_stream_t *s, int8_t code, const uint8_t *data, size
     }
     write1(s, code);    // type byte
     if (len > 0) {
-        write(s, data, len);
+        write_bytes(s, data, len);
     }
 }
 
@@ -243,7 +300,7 @@ STATIC void pack_str(msgpack_stream_t *s, const char *str, size_t len) {
         write_size(s, 0xd9, len);
     }
     if (len > 0) {
-        write(s, str, len);
+        write_bytes(s, str, len);
     }
 }
 
@@ -362,25 +419,41 @@ STATIC mp_obj_t unpack_array_elements(msgpack_stream_t *s, size_t size, mp_obj_t
     }
 }
 
-STATIC mp_obj_t unpack_bytes(msgpack_stream_t *s, size_t size) {
+STATIC mp_obj_t unpack_bytes(msgpack_stream_t *s, size_t size, bool allow_view) {
+    if (s->buf == NULL) {
+        const byte *p = take(s, size);
+        #if MICROPY_PY_BUILTINS_MEMORYVIEW
+        size_t offset = s->view_offset + (p - s->view_start);
+        if (allow_view && s->zero_copy && offset <= ((1LL << MP_OBJ_ARRAY_FREE_SIZE_BITS) - 1)) {
+            // Point at the start of the caller's buffer so the GC can
+            // trace it, as memoryview slicing does.
+            mp_obj_array_t *view = MP_OBJ_TO_PTR(mp_obj_new_memoryview(s->view_typecode, size, s->view_items));
+            view->free = offset;
+            return MP_OBJ_FROM_PTR(view);
+        }
+        #endif
+        return mp_obj_new_bytes(p, size);
+    }
     vstr_t vstr;
     vstr_init_len(&vstr, size);
-    byte *p = (byte *)vstr.buf;
-    // read in chunks: (some drivers - e.g. UART) limit the
-    // maximum number of bytes that can be read at once
-    // read(s, p, size);
-    while (size > 0) {
-        int n = size > 256 ? 256 : size;
-        read(s, p, n);
-        size -= n;
-        p += n;
-    }
+    read_bytes(s, vstr.buf, size);
     return mp_obj_new_bytes_from_vstr(&vstr);
 }
 
+STATIC mp_obj_t unpack_str(msgpack_stream_t *s, size_t size) {
+    if (s->buf == NULL || size <= MSGPACK_READ_AHEAD) {
+        const char *p = (const char *)take(s, size);
+        return mp_obj_new_str(p, size);
+    }
+    vstr_t vstr;
+    vstr_init_len(&vstr, size);
+    read_bytes(s, vstr.buf, size);
+    return mp_obj_new_str_from_vstr(&vstr);
+}
+
 STATIC mp_obj_t unpack_ext(msgpack_stream_t *s, size_t size, mp_obj_t ext_hook) {
     int8_t code = read1(s);
-    mp_obj_t data = unpack_bytes(s, size);
+    mp_obj_t data = unpack_bytes(s, size, false);
     if (ext_hook != mp_const_none) {
         return mp_call_function_2(ext_hook, MP_OBJ_NEW_SMALL_INT(code), data);
     } else {
@@ -399,11 +472,7 @@ STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
     }
     if ((code & 0b11100000) == 0b10100000) {
         // str
-        size_t len = code & 0b11111;
-        // allocate on stack; len < 32
-        char str[len];
-        read(s, &str, len);
-        return mp_obj_new_str(str, len);
+        return unpack_str(s, code & 0b11111);
     }
     if ((code & 0b11110000) == 0b10010000) {
         // array (list / tuple)
@@ -414,7 +483,9 @@ STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
         size_t len = code & 0b1111;
         mp_obj_dict_t *d = MP_OBJ_TO_PTR(mp_obj_new_dict(len));
         for (size_t i = 0; i < len; i++) {
-            mp_obj_dict_store(d, unpack(s, ext_hook, use_list), unpack(s, ext_hook, use_list));
+            // key must be read first; argument evaluation order is unspecified
+            mp_obj_t key = unpack(s, ext_hook, use_list);
+            mp_obj_dict_store(d, key, unpack(s, ext_hook, use_list));
         }
         return MP_OBJ_FROM_PTR(d);
     }
@@ -429,7 +500,7 @@ STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
         case 0xc5:
         case 0xc6: {
             // bin 8, 16, 32
-            return unpack_bytes(s, read_size(s, code - 0xc4));
+            return unpack_bytes(s, read_size(s, code - 0xc4), true);
         }
         case 0xcc: // uint8
             return MP_OBJ_NEW_SMALL_INT((uint8_t)read1(s));
@@ -469,12 +540,7 @@ STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
         case 0xda:
         case 0xdb: {
             // str 8, 16, 32
-            size_t size = read_size(s, code - 0xd9);
-            vstr_t vstr;
-            vstr_init_len(&vstr, size);
-            byte *p = (byte *)vstr.buf;
-            read(s, p, size);
-            return mp_obj_new_str_from_vstr(&vstr);
+            return unpack_str(s, read_size(s, code - 0xd9));
         }
         case 0xde:
         case 0xdf: {
@@ -482,7 +548,9 @@ STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
             size_t len = read_size(s, code - 0xde + 1);
             mp_obj_dict_t *d = MP_OBJ_TO_PTR(mp_obj_new_dict(len));
             for (size_t i = 0; i < len; i++) {
-                mp_obj_dict_store(d, unpack(s, ext_hook, use_list), unpack(s, ext_hook, use_list));
+                // key must be read first; argument evaluation order is unspecified
+                mp_obj_t key = unpack(s, ext_hook, use_list);
+                mp_obj_dict_store(d, key, unpack(s, ext_hook, use_list));
             }
             return MP_OBJ_FROM_PTR(d);
         }
@@ -520,5 +588,42 @@ void common_hal_msgpack_pack(mp_obj_t obj, mp_obj_t stream_obj, mp_obj_t default
 
 mp_obj_t common_hal_msgpack_unpack(mp_obj_t stream_obj, mp_obj_t ext_hook, bool use_list) {
     msgpack_stream_t stream = get_stream(stream_obj, MP_STREAM_OP_READ);
+    byte buf[MSGPACK_READ_AHEAD];
+    stream.buf = buf;
+    stream.cur = stream.end = buf;
+    stream.read_ahead = mp_stream_seek_relative(stream_obj, 0);
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) != 0) {
+        // Leave the stream where unpacking stopped.
+        stream_rewind(&stream);
+        nlr_jump(nlr.ret_val);
+    }
+    mp_obj_t obj = unpack(&stream, ext_hook, use_list);
+    nlr_pop();
+    // Give back what was read past the end of the object.
+    stream_rewind(&stream);
+    return obj;
+}
+
+mp_obj_t common_hal_msgpack_unpackb(mp_obj_t data, mp_obj_t ext_hook, bool use_list, bool zero_copy) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    msgpack_stream_t stream = { .stream_obj = data };
+    stream.cur = stream.view_start = bufinfo.buf;
+    stream.end = stream.cur + bufinfo.len;
+    stream.zero_copy = zero_copy;
+    stream.view_typecode = 'B';
+    stream.view_items = bufinfo.buf;
+    #if MICROPY_PY_BUILTINS_MEMORYVIEW
+    if (mp_obj_is_type(data, &mp_type_memoryview)) {
+        mp_obj_array_t *other = MP_OBJ_TO_PTR(data);
+        size_t itemsize = mp_binary_get_size('@', other->typecode & ~MP_OBJ_ARRAY_TYPECODE_FLAG_RW, NULL);
+        stream.view_items = other->items;
+        stream.view_offset = other->free * itemsize;
+    }
+    #endif
+    if (mp_get_buffer(data, &bufinfo, MP_BUFFER_RW)) {
+        stream.view_typecode |= MP_OBJ_ARRAY_TYPECODE_FLAG_RW;
+    }
     return unpack(&stream, ext_hook, use_list);
 }
@@ -30,5 +30,6 @@
 
 void common_hal_msgpack_pack(mp_obj_t obj, mp_obj_t stream_obj, mp_obj_t default_handler);
 mp_obj_t common_hal_msgpack_unpack(mp_obj_t stream_obj, mp_obj_t ext_hook, bool use_list);
+mp_obj_t common_hal_msgpack_unpackb(mp_obj_t data, mp_obj_t ext_hook, bool use_list, bool zero_copy);
 
 #endif
@@ -0,0 +1,546 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/stream.h"
+
+#include "shared-bindings/pngio/PngDecoder.h"
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/displayio/Palette.h"
+#include "shared-module/pngio/PngDecoder.h"
+
+#define PNG_GREY (0)
+#define PNG_RGB (2)
+#define PNG_INDEXED (3)
+#define PNG_GREY_ALPHA (4)
+#define PNG_RGBA (6)
+
+// 256 RGB colors followed by 256 alphas.
+#define PLTE_SIZE (256 * 4)
+
+static const uint8_t png_signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+
+// Adam7 passes as x0, y0, dx, dy.
+static const uint8_t adam7[7][4] = {
+    {0, 0, 8, 8}, {4, 0, 8, 8}, {0, 4, 4, 8}, {2, 0, 4, 4},
+    {0, 2, 2, 4}, {1, 0, 2, 2}, {0, 1, 1, 2},
+};
+
+static const uint8_t no_interlace[1][4] = {
+    {0, 0, 1, 1},
+};
+
+static uint32_t get_be32(const uint8_t *buf) {
+    return (buf[0] << 24) | (buf[1] << 16) | (buf[2] << 8) | buf[3];
+}
+
+static uint8_t png_channels(uint8_t color_type) {
+    switch (color_type) {
+        case PNG_RGB:
+            return 3;
+        case PNG_GREY_ALPHA:
+            return 2;
+        case PNG_RGBA:
+            return 4;
+        default:
+            return 1;
+    }
+}
+
+void common_hal_pngio_pngdecoder_construct(pngio_pngdecoder_obj_t *self) {
+    self->data_obj = MP_OBJ_NULL;
+    self->plte = NULL;
+}
+
+void common_hal_pngio_pngdecoder_close(pngio_pngdecoder_obj_t *self) {
+    self->data_obj = MP_OBJ_NULL;
+    memset(&self->bufinfo, 0, sizeof(self->bufinfo));
+    if (self->plte) {
+        m_del(uint8_t, self->plte, PLTE_SIZE);
+        self->plte = NULL;
+    }
+}
+
+// Read up to len bytes of the source into dest, or skip them if dest is NULL.
+static size_t png_read(pngio_pngdecoder_obj_t *self, uint8_t *dest, size_t len) {
+    if (!self->is_stream) {
+        mp_buffer_info_t *src = &self->bufinfo;
+        size_t to_copy = MIN(len, src->len);
+        if (dest) {
+            memcpy(dest, src->buf, to_copy);
+        }
+        src->buf = (uint8_t *)src->buf + to_copy;
+        src->len -= to_copy;
+        return to_copy;
+    }
+
+    if (!dest) {
+        // Don't assume a seekable stream.
+        size_t total = 0;
+        while (total < len) {
+            size_t read = png_read(self, self->input, MIN(len - total, sizeof(self->input)));
+            if (read == 0) {
+                break;
+            }
+            total += read;
+        }
+        return total;
+    }
+
+    int errcode = 0;
+    size_t result = mp_stream_rw(self->data_obj, dest, len, &errcode, MP_STREAM_RW_READ);
+    if (errcode != 0) {
+        mp_raise_OSError(errcode);
+    }
+    return result;
+}
+
+static void png_read_exact(pngio_pngdecoder_obj_t *self, uint8_t *dest, size_t len) {
+    if (png_read(self, dest, len) != len) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Invalid format"));
+    }
+}
+
+// Read the signature and the chunks up to the first IDAT.
+static void png_parse_header(pngio_pngdecoder_obj_t *self) {
+    uint8_t buf[13];
+    png_read_exact(self, buf, sizeof(png_signature));
+    if (memcmp(buf, png_signature, sizeof(png_signature)) != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Invalid format"));
+    }
+
+    png_read_exact(self, buf, 8);
+    if (get_be32(buf) != 13 || memcmp(buf + 4, "IHDR", 4) != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Invalid format"));
+    }
+    png_read_exact(self, buf, 13);
+    self->width = get_be32(buf);
+    self->height = get_be32(buf + 4);
+    self->bit_depth = buf[8];
+    self->color_type = buf[9];
+    self->interlaced = buf[12];
+    if (self->width == 0 || self->height == 0 || buf[10] != 0 || buf[11] != 0 || buf[12] > 1) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Invalid format"));
+    }
+    bool ok;
+    switch (self->color_type) {
+        case PNG_GREY:
+            ok = self->bit_depth <= 16 && (self->bit_depth & (self->bit_depth - 1)) == 0;
+            break;
+        case PNG_INDEXED:
+            ok = self->bit_depth <= 8 && (self->bit_depth & (self->bit_depth - 1)) == 0;
+            break;
+        case PNG_RGB:
+        case PNG_GREY_ALPHA:
+        case PNG_RGBA:
+            ok = self->bit_depth == 8 || self->bit_depth == 16;
+            break;
+        default:
+            ok = false;
+    }
+    // Larger images can't be shown anyway, and this keeps row sizes in range.
+    if (!ok || self->width > 0xffff || self->height > 0xffff) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Unsupported format"));
+    }
+    // Skip the CRC.
+    png_read_exact(self, NULL, 4);
+
+    self->plte_count = 0;
+    self->has_trns = false;
+    for (;;) {
+        png_read_exact(self, buf, 8);
+        uint32_t len = get_be32(buf);
+        if (memcmp(buf + 4, "IDAT", 4) == 0) {
+            self->idat_left = len;
+            break;
+        }
+        if (memcmp(buf + 4, "PLTE", 4) == 0 && len <= 256 * 3 && len % 3 == 0) {
+            if (!self->plte) {
+                self->plte = m_malloc(PLTE_SIZE);
+            }
+            memset(self->plte + 256 * 3, 0xff, 256);
+            png_read_exact(self, self->plte, len);
+            self->plte_count = len / 3;
+        } else if (memcmp(buf + 4, "tRNS", 4) == 0 && self->color_type == PNG_INDEXED && self->plte && len <= 256) {
+            png_read_exact(self, self->plte + 256 * 3, len);
+        } else if (memcmp(buf + 4, "tRNS", 4) == 0 && len == 2 * png_channels(self->color_type) && len <= 6) {
+            png_read_exact(self, buf, len);
+            for (size_t i = 0; i < len / 2; i++) {
+                self->trns[i] = (buf[2 * i] << 8) | buf[2 * i + 1];
+            }
+            self->has_trns = true;
+        } else if (memcmp(buf + 4, "IEND", 4) == 0) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Invalid format"));
+        } else {
+            png_read_exact(self, NULL, len);
+        }
+        png_read_exact(self, NULL, 4);
+    }
+    if (self->color_type == PNG_INDEXED && !self->plte) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Invalid format"));
+    }
+}
+
+static mp_obj_t png_open_common(pngio_pngdecoder_obj_t *self) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        png_parse_header(self);
+        nlr_pop();
+    } else {
+        common_hal_pngio_pngdecoder_close(self);
+        nlr_jump(nlr.ret_val);
+    }
+    mp_obj_t elems[] = {
+        MP_OBJ_NEW_SMALL_INT(self->width),
+        MP_OBJ_NEW_SMALL_INT(self->height)
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(elems), elems);
+}
+
+mp_obj_t common_hal_pngio_pngdecoder_set_source_file(pngio_pngdecoder_obj_t *self, mp_obj_t file_obj) {
+    common_hal_pngio_pngdecoder_close(self);
+    self->data_obj = file_obj;
+    self->is_stream = true;
+    return png_open_common(self);
+}
+
+mp_obj_t common_hal_pngio_pngdecoder_set_source_buffer(pngio_pngdecoder_obj_t *self, mp_obj_t buffer_obj) {
+    common_hal_pngio_pngdecoder_close(self);
+    self->data_obj = buffer_obj;
+    self->is_stream = false;
+    mp_get_buffer_raise(buffer_obj, &self->bufinfo, MP_BUFFER_READ);
+    return png_open_common(self);
+}
+
+// Called by uzlib when it has used up the current input. The compressed
+// data may be split over several consecutive IDAT chunks.
+static int png_read_idat(TINF_DATA *d) {
+    pngio_pngdecoder_obj_t *self = d->self;
+    while (self->idat_left == 0) {
+        // The CRC of the previous chunk, then the header of the next one.
+        uint8_t buf[12];
+        if (png_read(self, buf, sizeof(buf)) != sizeof(buf) || memcmp(buf + 8, "IDAT", 4) != 0) {
+            return -1;
+        }
+        self->idat_left = get_be32(buf + 4);
+    }
+    size_t len;
+    if (self->is_stream) {
+        len = png_read(self, self->input, MIN(self->idat_left, sizeof(self->input)));
+        d->source = self->input;
+    } else {
+        // Decompress straight from the buffer.
+        d->source = self->bufinfo.buf;
+        len = png_read(self, NULL, self->idat_left);
+    }
+    if (len == 0) {
+        return -1;
+    }
+    self->idat_left -= len;
+    d->source_limit = d->source + len;
+    return *d->source++;
+}
+
+static uint8_t paeth(uint8_t a, uint8_t b, uint8_t c) {
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+    if (pa <= pb && pa <= pc) {
+        return a;
+    }
+    return pb <= pc ? b : c;
+}
+
+static void png_unfilter(uint8_t filter, uint8_t *row, const uint8_t *prev, size_t len, size_t bpp) {
+    size_t i;
+    switch (filter) {
+        case 0:
+            break;
+        case 1:
+            for (i = bpp; i < len; i++) {
+                row[i] += row[i - bpp];
+            }
+            break;
+        case 2:
+            for (i = 0; i < len; i++) {
+                row[i] += prev[i];
+            }
+            break;
+        case 3:
+            for (i = 0; i < bpp; i++) {
+                row[i] += prev[i] >> 1;
+            }
+            for (; i < len; i++) {
+                row[i] += (row[i - bpp] + prev[i]) >> 1;
+            }
+            break;
+        case 4:
+            for (i = 0; i < bpp; i++) {
+                row[i] += prev[i];
+            }
+            for (; i < len; i++) {
+                row[i] += paeth(row[i - bpp], prev[i], prev[i - bpp]);
+            }
+            break;
+        default:
+            mp_raise_ValueError(MP_ERROR_TEXT("Data format error (may be broken data)"));
+    }
+}
+
+// Sample c of pixel i of an unfiltered row, at the image's bit depth.
+static uint32_t png_sample(const pngio_pngdecoder_obj_t *self, const uint8_t *row, uint8_t channels, uint32_t i, int c) {
+    int bit_depth = self->bit_depth;
+    if (bit_depth == 8) {
+        return row[i * channels + c];
+    }
+    if (bit_depth == 16) {
+        const uint8_t *p = row + (i * channels + c) * 2;
+        return (p[0] << 8) | p[1];
+    }
+    uint32_t bit = i * bit_depth;
+    return (row[bit / 8] >> (8 - bit_depth - bit % 8)) & ((1 << bit_depth) - 1);
+}
+
+typedef struct {
+    displayio_bitmap_t *dest;
+    int16_t x, y;
+    bitmaptools_rect_t lim;
+    uint32_t skip_source_index, skip_dest_index;
+    bool skip_source_index_none, skip_dest_index_none;
+} png_output_t;
+
+// Store the pixels of an unfiltered row that fall within the output area.
+static void png_output_row(pngio_pngdecoder_obj_t *self, png_output_t *out, const uint8_t *row, uint32_t sy, const uint8_t pass[4], uint32_t pass_width) {
+    displayio_bitmap_t *dest = out->dest;
+    int bits_per_value = dest->bits_per_value;
+    int levels = (1 << MIN(bits_per_value, 16)) - 1;
+    uint8_t channels = png_channels(self->color_type);
+    int shift = self->bit_depth > 8 ? self->bit_depth - 8 : 0;
+    int sample_max = (1 << MIN(self->bit_depth, 8)) - 1;
+    int dy = out->y + sy - out->lim.y1;
+
+    uint32_t i = 0;
+    if (out->lim.x1 > pass[0]) {
+        i = (out->lim.x1 - pass[0] + pass[2] - 1) / pass[2];
+    }
+    for (uint32_t sx = pass[0] + i * pass[2]; i < pass_width && sx < (uint32_t)out->lim.x2; i++, sx += pass[2]) {
+        int dx = out->x + sx - out->lim.x1;
+        uint32_t value;
+        int r, g, b, a = 255;
+        if (self->color_type == PNG_INDEXED) {
+            uint32_t index = png_sample(self, row, 1, i, 0);
+            if (bits_per_value < 16) {
+                // Transparency is up to the bitmap's palette.
+                value = index;
+                goto write;
+            }
+            if (index >= self->plte_count) {
+                index = 0;
+            }
+            r = self->plte[index * 3];
+            g = self->plte[index * 3 + 1];
+            b = self->plte[index * 3 + 2];
+            a = self->plte[256 * 3 + index];
+        } else if (self->color_type == PNG_GREY || self->color_type == PNG_GREY_ALPHA) {
+            uint32_t grey = png_sample(self, row, channels, i, 0);
+            if (self->has_trns && grey == self->trns[0]) {
+                a = 0;
+            } else if (channels == 2) {
+                a = png_sample(self, row, channels, i, 1) >> shift;
+            }
+            r = g = b = (grey >> shift) * 255 / sample_max;
+            if (bits_per_value < 16) {
+                value = (r * levels + 127) / 255;
+                goto check_alpha;
+            }
+        } else {
+            r = png_sample(self, row, channels, i, 0);
+            g = png_sample(self, row, channels, i, 1);
+            b = png_sample(self, row, channels, i, 2);
+            if (self->has_trns && r == self->trns[0] && g == self->trns[1] && b == self->trns[2]) {
+                a = 0;
+            } else if (channels == 4) {
+                a = png_sample(self, row, channels, i, 3) >> shift;
+            }
+            r >>= shift;
+            g >>= shift;
+            b >>= shift;
+        }
+        if (bits_per_value == 16) {
+            value = __builtin_bswap16(((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3));
+        } else if (bits_per_value > 16) {
+            value = (r << 16) | (g << 8) | b;
+        } else {
+            int luma = (r * 77 + g * 150 + b * 29) >> 8;
+            value = (luma * levels + 127) / 255;
+        }
+    check_alpha:
+        // Mostly transparent pixels are not stored.
+        if (a < 128) {
+            continue;
+        }
+    write:
+        if (!out->skip_source_index_none && value == out->skip_source_index) {
+            continue;
+        }
+        if (!out->skip_dest_index_none && common_hal_displayio_bitmap_get_pixel(dest, dx, dy) == out->skip_dest_index) {
+            continue;
+        }
+        displayio_bitmap_write_pixel(dest, dx, dy, value);
+    }
+}
+
+// Fill the first colors of palette from PLTE, or with a grey ramp for
+// greyscale images.
+static void png_fill_palette(pngio_pngdecoder_obj_t *self, displayio_palette_t *palette, int bits_per_value) {
+    uint32_t count = common_hal_displayio_palette_get_len(palette);
+    if (self->color_type == PNG_INDEXED) {
+        count = MIN(count, self->plte_count);
+        for (uint32_t i = 0; i < count; i++) {
+            const uint8_t *rgb = self->plte + i * 3;
+            common_hal_displayio_palette_set_color(palette, i, (rgb[0] << 16) | (rgb[1] << 8) | rgb[2]);
+            if (self->plte[256 * 3 + i] < 128) {
+                common_hal_displayio_palette_make_transparent(palette, i);
+            } else {
+                common_hal_displayio_palette_make_opaque(palette, i);
+            }
+        }
+    } else if ((self->color_type == PNG_GREY || self->color_type == PNG_GREY_ALPHA) && bits_per_value < 16) {
+        uint32_t levels = (1 << bits_per_value) - 1;
+        count = MIN(count, levels + 1);
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t grey = i * 255 / levels;
+            common_hal_displayio_palette_set_color(palette, i, grey * 0x010101);
+        }
+    }
+}
+
+static void png_decode(pngio_pngdecoder_obj_t *self, png_output_t *out) {
+    TINF_DATA *d = &self->decomp;
+    memset(d, 0, sizeof(*d));
+    d->self = self;
+    d->source_read_cb = png_read_idat;
+    int st = uzlib_zlib_parse_header(d);
+    if (st < 0 || d->eof) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Data format error (may be broken data)"));
+    }
+    // Only allocate as much window as the stream says it needs.
+    size_t window_size = (size_t)1 << (st + 8);
+    uint8_t *window = m_malloc(window_size);
+    uzlib_uncompress_init(d, window, window_size);
+
+    // The filters refer to the previous row, so two rows are kept, each
+    // preceded by its filter type byte.
+    uint8_t channels = png_channels(self->color_type);
+    size_t bpp = MAX(1, channels * self->bit_depth / 8);
+    size_t row_size = (self->width * channels * self->bit_depth + 7) / 8 + 1;
+    uint8_t *rows = m_malloc(2 * row_size);
+    uint8_t *cur = rows, *prev = rows + row_size;
+
+    const uint8_t (*passes)[4] = self->interlaced ? adam7 : no_interlace;
+    int n_passes = self->interlaced ? 7 : 1;
+    for (int p = 0; p < n_passes; p++) {
+        const uint8_t *pass = passes[p];
+        if (self->width <= pass[0] || self->height <= pass[1]) {
+            continue;
+        }
+        uint32_t pass_width = (self->width - pass[0] + pass[2] - 1) / pass[2];
+        size_t pass_size = (pass_width * channels * self->bit_depth + 7) / 8 + 1;
+        memset(prev, 0, pass_size);
+        for (uint32_t sy = pass[1]; sy < self->height; sy += pass[3]) {
+            // Nothing after the last row of the final pass that is shown
+            // needs to be decompressed.
+            if (p == n_passes - 1 && sy >= (uint32_t)out->lim.y2) {
+                break;
+            }
+            d->dest = d->dest_start = cur;
+            d->dest_limit = cur + pass_size;
+            st = uzlib_uncompress_chksum(d);
+            if (st < 0 || d->dest != d->dest_limit) {
+                mp_raise_ValueError(MP_ERROR_TEXT("Data format error (may be broken data)"));
+            }
+            png_unfilter(cur[0], cur + 1, prev + 1, pass_size - 1, bpp);
+            if (sy >= (uint32_t)out->lim.y1 && sy < (uint32_t)out->lim.y2) {
+                png_output_row(self, out, cur + 1, sy, pass, pass_width);
+            }
+            uint8_t *tmp = prev;
+            prev = cur;
+            cur = tmp;
+        }
+    }
+
+    m_del(uint8_t, rows, 2 * row_size);
+    m_del(uint8_t, window, window_size);
+}
+
+void common_hal_pngio_pngdecoder_decode_into(
+    pngio_pngdecoder_obj_t *self,
+    displayio_bitmap_t *bitmap, int16_t x, int16_t y,
+    bitmaptools_rect_t *lim,
+    uint32_t skip_source_index, bool skip_source_index_none,
+    uint32_t skip_dest_index, bool skip_dest_index_none,
+    displayio_palette_t *palette) {
+    if (self->data_obj == MP_OBJ_NULL) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q() without %q()"), MP_QSTR_decode, MP_QSTR_open);
+    }
+    if (self->color_type == PNG_INDEXED && bitmap->bits_per_value < self->bit_depth) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be >= %d"), MP_QSTR_bits_per_value, self->bit_depth);
+    }
+
+    png_output_t out = {
+        .dest = bitmap,
+        .x = x,
+        .y = y,
+        .lim = *lim,
+        .skip_source_index = skip_source_index,
+        .skip_source_index_none = skip_source_index_none,
+        .skip_dest_index = skip_dest_index,
+        .skip_dest_index_none = skip_dest_index_none,
+    };
+    // Clip to the image and to the bitmap.
+    out.lim.x2 = MIN(out.lim.x2, MIN((int32_t)self->width, lim->x1 + bitmap->width - x));
+    out.lim.y2 = MIN(out.lim.y2, MIN((int32_t)self->height, lim->y1 + bitmap->height - y));
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        if (palette) {
+            png_fill_palette(self, palette, bitmap->bits_per_value);
+        }
+        if (out.lim.x2 > out.lim.x1 && out.lim.y2 > out.lim.y1) {
+            displayio_area_t area = { x, y, x + out.lim.x2 - out.lim.x1, y + out.lim.y2 - out.lim.y1, NULL};
+            displayio_bitmap_set_dirty_area(bitmap, &area);
+            png_decode(self, &out);
+        }
+        nlr_pop();
+    } else {
+        common_hal_pngio_pngdecoder_close(self);
+        nlr_jump(nlr.ret_val);
+    }
+    common_hal_pngio_pngdecoder_close(self);
+}
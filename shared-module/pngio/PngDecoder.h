@@ -0,0 +1,56 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "py/obj.h"
+#include "lib/uzlib/uzlib.h"
+#include "shared-module/displayio/Bitmap.h"
+#include "shared-module/displayio/Palette.h"
+
+// Compressed data is read from streams in pieces of this size.
+#define PNGIO_INPUT_SIZE (256)
+
+typedef struct pngio_pngdecoder_obj {
+    mp_obj_base_t base;
+    mp_obj_t data_obj;
+    // The unread part of a buffer source.
+    mp_buffer_info_t bufinfo;
+    bool is_stream;
+    bool interlaced;
+    uint8_t bit_depth, color_type;
+    uint32_t width, height;
+    // PLTE colors as RGB triplets followed by their tRNS alphas, or NULL.
+    uint8_t *plte;
+    uint16_t plte_count;
+    // tRNS color key of greyscale and truecolor images.
+    bool has_trns;
+    uint16_t trns[3];
+    // Bytes of the current IDAT chunk not yet handed to the decompressor.
+    uint32_t idat_left;
+    TINF_DATA decomp;
+    uint8_t input[PNGIO_INPUT_SIZE];
+} pngio_pngdecoder_obj_t;
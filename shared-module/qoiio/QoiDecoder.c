@@ -0,0 +1,258 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/stream.h"
+
+#include "shared-bindings/qoiio/QoiDecoder.h"
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-module/qoiio/QoiDecoder.h"
+
+#define QOI_OP_INDEX (0x00)
+#define QOI_OP_DIFF (0x40)
+#define QOI_OP_LUMA (0x80)
+#define QOI_OP_RUN (0xc0)
+#define QOI_OP_RGB (0xfe)
+#define QOI_OP_RGBA (0xff)
+
+#define QOI_HEADER_SIZE (14)
+
+static uint32_t get_be32(const uint8_t *buf) {
+    return (buf[0] << 24) | (buf[1] << 16) | (buf[2] << 8) | buf[3];
+}
+
+void common_hal_qoiio_qoidecoder_construct(qoiio_qoidecoder_obj_t *self) {
+    self->data_obj = MP_OBJ_NULL;
+}
+
+void common_hal_qoiio_qoidecoder_close(qoiio_qoidecoder_obj_t *self) {
+    self->data_obj = MP_OBJ_NULL;
+    memset(&self->bufinfo, 0, sizeof(self->bufinfo));
+    self->in = self->in_end = NULL;
+}
+
+// Make more input available at self->in.
+static void qoi_fill(qoiio_qoidecoder_obj_t *self) {
+    size_t len = 0;
+    if (self->is_stream) {
+        int errcode = 0;
+        len = mp_stream_rw(self->data_obj, self->input, sizeof(self->input), &errcode, MP_STREAM_RW_READ | MP_STREAM_RW_ONCE);
+        if (errcode != 0) {
+            mp_raise_OSError(errcode);
+        }
+        self->in = self->input;
+    } else {
+        // The whole buffer is used in place.
+        len = self->bufinfo.len;
+        self->in = self->bufinfo.buf;
+        self->bufinfo.len = 0;
+    }
+    if (len == 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Data format error (may be broken data)"));
+    }
+    self->in_end = self->in + len;
+}
+
+static inline uint8_t qoi_byte(qoiio_qoidecoder_obj_t *self) {
+    if (self->in == self->in_end) {
+        qoi_fill(self);
+    }
+    return *self->in++;
+}
+
+static mp_obj_t qoi_open_common(qoiio_qoidecoder_obj_t *self) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        uint8_t header[QOI_HEADER_SIZE];
+        for (size_t i = 0; i < sizeof(header); i++) {
+            header[i] = qoi_byte(self);
+        }
+        self->width = get_be32(header + 4);
+        self->height = get_be32(header + 8);
+        self->channels = header[12];
+        if (memcmp(header, "qoif", 4) != 0 || self->width == 0 || self->height == 0 ||
+            (self->channels != 3 && self->channels != 4) || header[13] > 1) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Invalid format"));
+        }
+        if (self->width > 0xffff || self->height > 0xffff) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Unsupported format"));
+        }
+        nlr_pop();
+    } else {
+        common_hal_qoiio_qoidecoder_close(self);
+        nlr_jump(nlr.ret_val);
+    }
+    mp_obj_t elems[] = {
+        MP_OBJ_NEW_SMALL_INT(self->width),
+        MP_OBJ_NEW_SMALL_INT(self->height)
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(elems), elems);
+}
+
+mp_obj_t common_hal_qoiio_qoidecoder_set_source_file(qoiio_qoidecoder_obj_t *self, mp_obj_t file_obj) {
+    common_hal_qoiio_qoidecoder_close(self);
+    self->data_obj = file_obj;
+    self->is_stream = true;
+    return qoi_open_common(self);
+}
+
+mp_obj_t common_hal_qoiio_qoidecoder_set_source_buffer(qoiio_qoidecoder_obj_t *self, mp_obj_t buffer_obj) {
+    common_hal_qoiio_qoidecoder_close(self);
+    self->data_obj = buffer_obj;
+    self->is_stream = false;
+    mp_get_buffer_raise(buffer_obj, &self->bufinfo, MP_BUFFER_READ);
+    return qoi_open_common(self);
+}
+
+typedef struct {
+    displayio_bitmap_t *dest;
+    int16_t x, y;
+    bitmaptools_rect_t lim;
+    uint32_t skip_source_index, skip_dest_index;
+    bool skip_source_index_none, skip_dest_index_none;
+} qoi_output_t;
+
+static void qoi_decode(qoiio_qoidecoder_obj_t *self, qoi_output_t *out) {
+    displayio_bitmap_t *dest = out->dest;
+    int bits_per_value = dest->bits_per_value;
+    int levels = (1 << MIN(bits_per_value, 16)) - 1;
+    uint8_t index[64][4];
+    uint8_t px[4] = { 0, 0, 0, 255 };
+    uint32_t run = 0;
+    memset(index, 0, sizeof(index));
+
+    // Rows below the copied area are never decoded.
+    for (int sy = 0; sy < out->lim.y2; sy++) {
+        bool show_row = sy >= out->lim.y1;
+        int dy = out->y + sy - out->lim.y1;
+        for (int sx = 0; sx < (int)self->width; sx++) {
+            if (run > 0) {
+                run--;
+            } else {
+                uint8_t b1 = qoi_byte(self);
+                if (b1 == QOI_OP_RGB) {
+                    px[0] = qoi_byte(self);
+                    px[1] = qoi_byte(self);
+                    px[2] = qoi_byte(self);
+                } else if (b1 == QOI_OP_RGBA) {
+                    px[0] = qoi_byte(self);
+                    px[1] = qoi_byte(self);
+                    px[2] = qoi_byte(self);
+                    px[3] = qoi_byte(self);
+                } else {
+                    switch (b1 & 0xc0) {
+                        case QOI_OP_INDEX:
+                            memcpy(px, index[b1], 4);
+                            break;
+                        case QOI_OP_DIFF:
+                            px[0] += ((b1 >> 4) & 3) - 2;
+                            px[1] += ((b1 >> 2) & 3) - 2;
+                            px[2] += (b1 & 3) - 2;
+                            break;
+                        case QOI_OP_LUMA: {
+                            uint8_t b2 = qoi_byte(self);
+                            int vg = (b1 & 0x3f) - 32;
+                            px[0] += vg - 8 + ((b2 >> 4) & 0x0f);
+                            px[1] += vg;
+                            px[2] += vg - 8 + (b2 & 0x0f);
+                            break;
+                        }
+                        case QOI_OP_RUN:
+                            run = b1 & 0x3f;
+                            break;
+                    }
+                }
+                memcpy(index[(px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64], px, 4);
+            }
+
+            if (!show_row || sx < out->lim.x1 || sx >= out->lim.x2) {
+                continue;
+            }
+            // Mostly transparent pixels are not stored.
+            if (self->channels == 4 && px[3] < 128) {
+                continue;
+            }
+            uint32_t value;
+            if (bits_per_value == 16) {
+                value = __builtin_bswap16(((px[0] & 0xf8) << 8) | ((px[1] & 0xfc) << 3) | (px[2] >> 3));
+            } else if (bits_per_value > 16) {
+                value = (px[0] << 16) | (px[1] << 8) | px[2];
+            } else {
+                int luma = (px[0] * 77 + px[1] * 150 + px[2] * 29) >> 8;
+                value = (luma * levels + 127) / 255;
+            }
+            int dx = out->x + sx - out->lim.x1;
+            if (!out->skip_source_index_none && value == out->skip_source_index) {
+                continue;
+            }
+            if (!out->skip_dest_index_none && common_hal_displayio_bitmap_get_pixel(dest, dx, dy) == out->skip_dest_index) {
+                continue;
+            }
+            displayio_bitmap_write_pixel(dest, dx, dy, value);
+        }
+    }
+}
+
+void common_hal_qoiio_qoidecoder_decode_into(
+    qoiio_qoidecoder_obj_t *self,
+    displayio_bitmap_t *bitmap, int16_t x, int16_t y,
+    bitmaptools_rect_t *lim,
+    uint32_t skip_source_index, bool skip_source_index_none,
+    uint32_t skip_dest_index, bool skip_dest_index_none) {
+    if (self->data_obj == MP_OBJ_NULL) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q() without %q()"), MP_QSTR_decode, MP_QSTR_open);
+    }
+
+    qoi_output_t out = {
+        .dest = bitmap,
+        .x = x,
+        .y = y,
+        .lim = *lim,
+        .skip_source_index = skip_source_index,
+        .skip_source_index_none = skip_source_index_none,
+        .skip_dest_index = skip_dest_index,
+        .skip_dest_index_none = skip_dest_index_none,
+    };
+    // Clip to the image and to the bitmap.
+    out.lim.x2 = MIN(out.lim.x2, MIN((int32_t)self->width, lim->x1 + bitmap->width - x));
+    out.lim.y2 = MIN(out.lim.y2, MIN((int32_t)self->height, lim->y1 + bitmap->height - y));
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        if (out.lim.x2 > out.lim.x1 && out.lim.y2 > out.lim.y1) {
+            displayio_area_t area = { x, y, x + out.lim.x2 - out.lim.x1, y + out.lim.y2 - out.lim.y1, NULL};
+            displayio_bitmap_set_dirty_area(bitmap, &area);
+            qoi_decode(self, &out);
+        }
+        nlr_pop();
+    } else {
+        common_hal_qoiio_qoidecoder_close(self);
+        nlr_jump(nlr.ret_val);
+    }
+    common_hal_qoiio_qoidecoder_close(self);
+}
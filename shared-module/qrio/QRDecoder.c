@@ -24,6 +24,7 @@
  * THE SOFTWARE.
  */
 
+#include <limits.h>
 #include <string.h>
 
 #include "py/gc.h"
@@ -35,6 +36,10 @@
 void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *self, int width, int height) {
     self->quirc = quirc_new();
     quirc_resize(self->quirc, width, height);
+    self->roi_quirc = NULL;
+    self->tracking = false;
+    self->scan_buffer = NULL;
+    self->scan_buffer_width = 0;
 }
 
 int shared_module_qrio_qrdecoder_get_height(qrdecoder_qrdecoder_obj_t *self) {
@@ -48,10 +53,22 @@ int shared_module_qrio_qrdecoder_get_width(qrdecoder_qrdecoder_obj_t *self) {
     quirc_begin(self->quirc, &width, NULL);
     return width;
 }
+
+// The region decoder was sized for codes in frames of the old size, so
+// give its memory back rather than keep it around.
+STATIC void forget_roi(qrdecoder_qrdecoder_obj_t *self) {
+    self->tracking = false;
+    if (self->roi_quirc != NULL) {
+        quirc_destroy(self->roi_quirc);
+        self->roi_quirc = NULL;
+    }
+}
+
 void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *self, int height) {
     if (height != shared_module_qrio_qrdecoder_get_height(self)) {
         int width = shared_module_qrio_qrdecoder_get_width(self);
         quirc_resize(self->quirc, width, height);
+        forget_roi(self);
     }
 }
 
@@ -59,6 +76,7 @@ void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *self, int
     if (width != shared_module_qrio_qrdecoder_get_width(self)) {
         int height = shared_module_qrio_qrdecoder_get_height(self);
         quirc_resize(self->quirc, width, height);
+        forget_roi(self);
     }
 }
 
@@ -98,54 +116,155 @@ STATIC mp_obj_t data_type(int type) {
     return mp_obj_new_int(type);
 }
 
-STATIC void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, void *buf, qrio_pixel_policy_t policy) {
-    int width, height;
-    uint8_t *framebuffer = quirc_begin(self->quirc, &width, &height);
-    uint8_t *src = buf;
-
+// Convert n pixels of row y of the frame in buf, starting at column x, to grey.
+STATIC void convert_row(uint8_t *dest, const void *buf, int frame_width, int x, int y, int n, qrio_pixel_policy_t policy) {
+    size_t start = (size_t)y * frame_width + x;
     switch (policy) {
         case QRIO_RGB565: {
-            uint16_t *src16 = buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (src16[i] >> 3) & 0xfc;
+            const uint16_t *src16 = (const uint16_t *)buf + start;
+            for (int i = 0; i < n; i++) {
+                dest[i] = (src16[i] >> 3) & 0xfc;
             }
             break;
         }
         case QRIO_RGB565_SWAPPED: {
-            uint16_t *src16 = buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (__builtin_bswap16(src16[i]) >> 3) & 0xfc;
+            const uint16_t *src16 = (const uint16_t *)buf + start;
+            for (int i = 0; i < n; i++) {
+                dest[i] = (__builtin_bswap16(src16[i]) >> 3) & 0xfc;
             }
             break;
         }
         case QRIO_EVERY_BYTE:
-            memcpy(framebuffer, src, width * height);
+            memcpy(dest, (const uint8_t *)buf + start, n);
             break;
 
         case QRIO_ODD_BYTES:
-            src++;
-            MP_FALLTHROUGH;
-
-        case QRIO_EVEN_BYTES:
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = src[2 * i];
+        case QRIO_EVEN_BYTES: {
+            const uint8_t *src = (const uint8_t *)buf + 2 * start + (policy == QRIO_ODD_BYTES);
+            for (int i = 0; i < n; i++) {
+                dest[i] = src[2 * i];
             }
             break;
+        }
     }
+}
+
+STATIC void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, void *buf, qrio_pixel_policy_t policy) {
+    int width, height;
+    uint8_t *framebuffer = quirc_begin(self->quirc, &width, &height);
+    convert_row(framebuffer, buf, width, 0, 0, width * height, policy);
     quirc_end(self->quirc);
 }
 
+// Percentage below the local mean at which a pixel counts as black.
+#define THRESHOLD_PERCENT (15)
+// Largest distance from a pixel to the edge of the square it is compared
+// to, which keeps the sums from overflowing.
+#define THRESHOLD_MAX_RADIUS (64)
 
-mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
-    int count = quirc_count(self->quirc);
+// Column sums, then THRESHOLD_MAX_RADIUS + 1 rows of one bit per pixel.
+STATIC size_t scan_buffer_size(int width) {
+    return width * sizeof(uint32_t) + (THRESHOLD_MAX_RADIUS + 1) * ((width + 7) / 8);
+}
+
+STATIC void add_row(uint32_t *column_sums, const uint8_t *grey, int n, int sign) {
+    for (int i = 0; i < n; i++) {
+        column_sums[i] += sign * grey[i];
+    }
+}
+
+// Replace a grey row by the black and white one kept in bits.
+STATIC void write_row(uint8_t *row, const uint8_t *bits, int n) {
+    for (int i = 0; i < n; i++) {
+        row[i] = bits[i / 8] & (1 << (i % 8)) ? 0 : 255;
+    }
+}
+
+// Convert the w x h region at (x0, y0) of the frame in buf into q's image,
+// with every pixel set to black or white by comparing it to the mean of the
+// square around it. The window sums come from an integral image that is
+// built a row at a time: column sums over the window's rows, then a running
+// sum along the row. quirc's own threshold leaves the result unchanged, but
+// this one also copes with light that changes from top to bottom.
+//
+// Each row is converted to grey once, straight into the image. Its grey
+// values are still needed until it leaves the window below, so until then
+// its black and white result waits in a ring of bit rows.
+STATIC void threshold_fill_buffer(qrdecoder_qrdecoder_obj_t *self, struct quirc *q, const void *buf, int frame_width, int x0, int y0, qrio_pixel_policy_t policy) {
+    int w, h;
+    uint8_t *image = quirc_begin(q, &w, &h);
+    uint32_t *column_sums = self->scan_buffer;
+    uint8_t *ring = (uint8_t *)(column_sums + self->scan_buffer_width);
+    int ring_stride = (w + 7) / 8;
+    int r = MAX(4, MIN(THRESHOLD_MAX_RADIUS, MIN(w, h) / 16));
+
+    memset(column_sums, 0, w * sizeof(uint32_t));
+    for (int y = 0; y < r && y < h; y++) {
+        convert_row(image + y * w, buf, frame_width, x0, y0 + y, w, policy);
+        add_row(column_sums, image + y * w, w, 1);
+    }
+    for (int y = 0; y < h; y++) {
+        if (y + r < h) {
+            uint8_t *next = image + (y + r) * w;
+            convert_row(next, buf, frame_width, x0, y0 + y + r, w, policy);
+            add_row(column_sums, next, w, 1);
+        }
+        int done = y - r - 1;
+        if (done >= 0) {
+            add_row(column_sums, image + done * w, w, -1);
+            write_row(image + done * w, ring + (done % (r + 1)) * ring_stride, w);
+        }
+        uint32_t rows = MIN(h - 1, y + r) - MAX(0, y - r) + 1;
+        const uint8_t *row = image + y * w;
+        uint8_t *bits = ring + (y % (r + 1)) * ring_stride;
+        memset(bits, 0, ring_stride);
+
+        uint32_t sum = 0;
+        for (int x = 0; x < r && x < w; x++) {
+            sum += column_sums[x];
+        }
+        for (int x = 0; x < w; x++) {
+            if (x + r < w) {
+                sum += column_sums[x + r];
+            }
+            if (x - r - 1 >= 0) {
+                sum -= column_sums[x - r - 1];
+            }
+            uint32_t count = rows * (MIN(w - 1, x + r) - MAX(0, x - r) + 1);
+            if (row[x] * count * 100 < sum * (100 - THRESHOLD_PERCENT)) {
+                bits[x / 8] |= 1 << (x % 8);
+            }
+        }
+    }
+    for (int y = MAX(0, h - r - 1); y < h; y++) {
+        write_row(image + y * w, ring + (y % (r + 1)) * ring_stride, w);
+    }
+    quirc_end(q);
+}
+
+typedef struct {
+    int x1, y1, x2, y2;
+} qrio_bounds_t;
+
+// Decode the codes found by q, whose image is offset by (x0, y0) within
+// the frame, and extend bounds to cover the ones that decode.
+STATIC mp_obj_t decode_codes(qrdecoder_qrdecoder_obj_t *self, struct quirc *q, int x0, int y0, qrio_bounds_t *bounds) {
+    int count = quirc_count(q);
     mp_obj_t result = mp_obj_new_list(0, NULL);
     for (int i = 0; i < count; i++) {
-        quirc_extract(self->quirc, i, &self->code);
+        quirc_extract(q, i, &self->code);
         mp_obj_t code_obj;
         if (quirc_decode(&self->code, &self->data) != QUIRC_SUCCESS) {
             continue;
         }
+        if (bounds) {
+            for (int j = 0; j < 4; j++) {
+                bounds->x1 = MIN(bounds->x1, x0 + self->code.corners[j].x);
+                bounds->y1 = MIN(bounds->y1, y0 + self->code.corners[j].y);
+                bounds->x2 = MAX(bounds->x2, x0 + self->code.corners[j].x);
+                bounds->y2 = MAX(bounds->y2, y0 + self->code.corners[j].y);
+            }
+        }
         mp_obj_t elems[2] = {
             mp_obj_new_bytes(self->data.payload, self->data.payload_len),
             data_type(self->data.data_type),
@@ -156,6 +275,75 @@ mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, co
     return result;
 }
 
+mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
+    quirc_fill_buffer(self, bufinfo->buf, policy);
+    return decode_codes(self, self->quirc, 0, 0, NULL);
+}
+
+// Pick the region to search in the next frame: the codes' bounds, grown by
+// half their size on each side and rounded up so that small movements
+// don't resize the region decoder. Returns false if the region would be
+// too big to save much time.
+STATIC bool update_roi(qrdecoder_qrdecoder_obj_t *self, int frame_width, int frame_height, const qrio_bounds_t *bounds) {
+    int size = MAX(bounds->x2 - bounds->x1, bounds->y2 - bounds->y1);
+    int w = MIN(frame_width, ((bounds->x2 - bounds->x1 + size + 31) & ~31));
+    int h = MIN(frame_height, ((bounds->y2 - bounds->y1 + size + 31) & ~31));
+    if (2 * w * h > frame_width * frame_height) {
+        return false;
+    }
+
+    if (self->roi_quirc == NULL) {
+        self->roi_quirc = quirc_new();
+        if (self->roi_quirc == NULL) {
+            return false;
+        }
+    }
+    int roi_w, roi_h;
+    quirc_begin(self->roi_quirc, &roi_w, &roi_h);
+    // A region that is a bit too big is cheaper than reallocating.
+    if (roi_w < w || roi_h < h || roi_w * roi_h > 2 * w * h) {
+        if (quirc_resize(self->roi_quirc, w, h) < 0) {
+            return false;
+        }
+        roi_w = w;
+        roi_h = h;
+    }
+    if (roi_w > frame_width || roi_h > frame_height) {
+        return false;
+    }
+    self->roi_x = MAX(0, MIN(frame_width - roi_w, (bounds->x1 + bounds->x2 - roi_w) / 2));
+    self->roi_y = MAX(0, MIN(frame_height - roi_h, (bounds->y1 + bounds->y2 - roi_h) / 2));
+    return true;
+}
+
+mp_obj_t shared_module_qrio_qrdecoder_scan(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
+    int width, height;
+    quirc_begin(self->quirc, &width, &height);
+    if (self->scan_buffer_width != width) {
+        m_del(uint8_t, self->scan_buffer, scan_buffer_size(self->scan_buffer_width));
+        self->scan_buffer = NULL;
+        self->scan_buffer_width = 0;
+        self->scan_buffer = m_malloc(scan_buffer_size(width));
+        self->scan_buffer_width = width;
+    }
+
+    qrio_bounds_t bounds = { INT_MAX, INT_MAX, INT_MIN, INT_MIN };
+    mp_obj_t result = mp_const_none;
+    size_t len = 0;
+    if (self->tracking) {
+        threshold_fill_buffer(self, self->roi_quirc, bufinfo->buf, width, self->roi_x, self->roi_y, policy);
+        result = decode_codes(self, self->roi_quirc, self->roi_x, self->roi_y, &bounds);
+        mp_obj_list_get(result, &len, NULL);
+    }
+    if (len == 0) {
+        // Nothing where the code was last seen, so look everywhere.
+        threshold_fill_buffer(self, self->quirc, bufinfo->buf, width, 0, 0, policy);
+        result = decode_codes(self, self->quirc, 0, 0, &bounds);
+        mp_obj_list_get(result, &len, NULL);
+    }
+    self->tracking = len > 0 && update_roi(self, width, height, &bounds);
+    return result;
+}
 
 mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
     quirc_fill_buffer(self, bufinfo->buf, policy);
@@ -35,6 +35,15 @@ typedef struct qrio_qrdecoder_obj {
     struct quirc *quirc;
     struct quirc_code code;
     struct quirc_data data;
+    // Scanning mode: a second decoder sized for the region around the last
+    // code found, which is kept from frame to frame.
+    struct quirc *roi_quirc;
+    int roi_x, roi_y;
+    bool tracking;
+    // Column sums and a ring of thresholded rows, for frames of up to
+    // scan_buffer_width pixels.
+    uint32_t *scan_buffer;
+    int scan_buffer_width;
 } qrdecoder_qrdecoder_obj_t;
 
 void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *, int width, int height);
@@ -44,3 +53,4 @@ void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *, int he
 void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *, int width);
 mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
 mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
+mp_obj_t shared_module_qrio_qrdecoder_scan(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
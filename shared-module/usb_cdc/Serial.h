@@ -28,12 +28,16 @@
 #define SHARED_MODULE_USB_CDC_SERIAL_H
 
 #include "py/obj.h"
+#include "py/stream.h"
 
 typedef struct {
     mp_obj_base_t base;
     mp_float_t timeout;       // if negative, wait forever.
     mp_float_t write_timeout; // if negative, wait forever.
     uint8_t idx;              // which CDC device?
+    #if MICROPY_PY_SELECT_NOTIFY
+    mp_stream_notify_t notify;
+    #endif
 } usb_cdc_serial_obj_t;
 
 #endif // SHARED_MODULE_USB_CDC_SERIAL_H
@@ -181,6 +181,18 @@ bool usb_cdc_data_enabled(void) {
     return usb_cdc_data_is_enabled;
 }
 
+void usb_cdc_notify(uint8_t idx) {
+    #if MICROPY_PY_SELECT_NOTIFY
+    if (usb_cdc_console_is_enabled && usb_cdc_console_obj.idx == idx) {
+        mp_stream_notify(&usb_cdc_console_obj.notify);
+    } else if (usb_cdc_data_is_enabled && usb_cdc_data_obj.idx == idx) {
+        mp_stream_notify(&usb_cdc_data_obj.notify);
+    }
+    #else
+    (void)idx;
+    #endif
+}
+
 size_t usb_cdc_descriptor_length(void) {
     return sizeof(usb_cdc_descriptor_template);
 }
@@ -36,6 +36,9 @@ bool usb_cdc_data_enabled(void);
 
 void usb_cdc_set_defaults(void);
 
+// Called from TinyUSB callbacks when CDC device idx may have become readable or writable.
+void usb_cdc_notify(uint8_t idx);
+
 size_t usb_cdc_descriptor_length(void);
 size_t usb_cdc_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *descriptor_counts, uint8_t *current_interface_string, bool console);
 
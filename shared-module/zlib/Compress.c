@@ -0,0 +1,303 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "shared-bindings/zlib/Compress.h"
+#include "lib/uzlib/uzlib.h"
+
+// This is a small LZ77 compressor producing DEFLATE blocks with the fixed
+// Huffman codes, which needs no buffering of its own beyond the window and
+// a hash table of recent positions.
+
+#define MIN_MATCH (3)
+#define MAX_MATCH (258)
+
+STATIC const uint16_t length_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+STATIC const uint8_t length_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+STATIC const uint16_t dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+STATIC const uint8_t dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+STATIC bool compress_is_gzip(zlib_compress_obj_t *self) {
+    return self->wbits >= 16;
+}
+
+STATIC bool compress_is_raw(zlib_compress_obj_t *self) {
+    return self->wbits < 0;
+}
+
+void common_hal_zlib_compress_obj_construct(zlib_compress_obj_t *self, mp_int_t level, mp_int_t wbits) {
+    self->wbits = wbits;
+    self->level = level;
+    if (wbits < 0) {
+        wbits = -wbits;
+    } else if (wbits >= 16) {
+        wbits -= 16;
+    }
+    self->window_size = (uint32_t)1 << wbits;
+    self->hash_bits = wbits - 3;
+    if (level == 0) {
+        self->window = NULL;
+        self->hash_table = NULL;
+    } else {
+        self->window = m_new(uint8_t, self->window_size);
+        self->hash_table = m_new0(uint16_t, (size_t)1 << self->hash_bits);
+    }
+    self->pos = 0;
+    self->total_in = 0;
+    self->checksum = compress_is_gzip(self) ? 0xffffffff : 1;
+    self->bit_buf = 0;
+    self->bit_count = 0;
+    self->header_done = false;
+    self->block_open = false;
+    self->finished = false;
+}
+
+STATIC void put_bits(zlib_compress_obj_t *self, vstr_t *out, uint32_t bits, uint8_t n) {
+    self->bit_buf |= bits << self->bit_count;
+    self->bit_count += n;
+    while (self->bit_count >= 8) {
+        vstr_add_byte(out, self->bit_buf & 0xff);
+        self->bit_buf >>= 8;
+        self->bit_count -= 8;
+    }
+}
+
+// Huffman codes are sent most significant bit first.
+STATIC void put_code(zlib_compress_obj_t *self, vstr_t *out, uint32_t code, uint8_t n) {
+    uint32_t rev = 0;
+    for (uint8_t i = 0; i < n; ++i) {
+        rev = (rev << 1) | (code & 1);
+        code >>= 1;
+    }
+    put_bits(self, out, rev, n);
+}
+
+STATIC void put_align(zlib_compress_obj_t *self, vstr_t *out) {
+    if (self->bit_count > 0) {
+        put_bits(self, out, 0, 8 - self->bit_count);
+    }
+}
+
+STATIC void put_literal(zlib_compress_obj_t *self, vstr_t *out, unsigned int c) {
+    if (c < 144) {
+        put_code(self, out, 0x30 + c, 8);
+    } else if (c < 256) {
+        put_code(self, out, 0x190 + c - 144, 9);
+    } else if (c < 280) {
+        put_code(self, out, c - 256, 7);
+    } else {
+        put_code(self, out, 0xc0 + c - 280, 8);
+    }
+}
+
+STATIC void put_match(zlib_compress_obj_t *self, vstr_t *out, unsigned int len, unsigned int dist) {
+    unsigned int i = 28;
+    while (length_base[i] > len) {
+        --i;
+    }
+    put_literal(self, out, 257 + i);
+    put_bits(self, out, len - length_base[i], length_extra[i]);
+    i = 29;
+    while (dist_base[i] > dist) {
+        --i;
+    }
+    put_code(self, out, i, 5);
+    put_bits(self, out, dist - dist_base[i], dist_extra[i]);
+}
+
+STATIC void put_header(zlib_compress_obj_t *self, vstr_t *out) {
+    if (compress_is_gzip(self)) {
+        static const uint8_t gzip_header[10] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff };
+        vstr_add_strn(out, (const char *)gzip_header, sizeof(gzip_header));
+    } else if (!compress_is_raw(self)) {
+        uint8_t cmf = ((self->wbits - 8) << 4) | 8;
+        uint8_t flg = (self->level == 0 ? 0 : 2) << 6;
+        flg += 31 - (cmf * 256 + flg) % 31;
+        vstr_add_byte(out, cmf);
+        vstr_add_byte(out, flg);
+    }
+    self->header_done = true;
+}
+
+STATIC void put_trailer(zlib_compress_obj_t *self, vstr_t *out) {
+    uint8_t buf[8];
+    if (compress_is_gzip(self)) {
+        uint32_t crc = ~self->checksum;
+        for (int i = 0; i < 4; ++i) {
+            buf[i] = crc >> (8 * i);
+            buf[4 + i] = self->total_in >> (8 * i);
+        }
+        vstr_add_strn(out, (const char *)buf, 8);
+    } else if (!compress_is_raw(self)) {
+        for (int i = 0; i < 4; ++i) {
+            buf[i] = self->checksum >> (24 - 8 * i);
+        }
+        vstr_add_strn(out, (const char *)buf, 4);
+    }
+}
+
+// Byte at absolute input position p, which is either in the window or, for
+// p >= self->pos, in the data currently being compressed.
+static inline uint8_t compress_byte_at(zlib_compress_obj_t *self, const uint8_t *data, uint32_t p) {
+    if (p < self->pos) {
+        return self->window[p & (self->window_size - 1)];
+    }
+    return data[p - self->pos];
+}
+
+static inline uint32_t compress_hash(zlib_compress_obj_t *self, const uint8_t *p) {
+    uint32_t h = (p[0] << 16) | (p[1] << 8) | p[2];
+    return ((h * 2654435761u) >> (32 - self->hash_bits));
+}
+
+STATIC void compress_lz77(zlib_compress_obj_t *self, vstr_t *out, const uint8_t *data, size_t len) {
+    if (!self->block_open) {
+        // BFINAL=0, BTYPE=01 (fixed Huffman codes)
+        put_bits(self, out, 1 << 1, 3);
+        self->block_open = true;
+    }
+    uint32_t mask = self->window_size - 1;
+    while (len > 0) {
+        size_t match_len = 0;
+        uint32_t dist = 0;
+        if (len >= MIN_MATCH) {
+            uint32_t h = compress_hash(self, data);
+            dist = (uint16_t)(self->pos - self->hash_table[h]);
+            self->hash_table[h] = self->pos;
+            if (dist > 0 && dist <= self->window_size && dist <= self->pos) {
+                size_t max_len = MIN(len, MAX_MATCH);
+                uint32_t p = self->pos - dist;
+                while (match_len < max_len && compress_byte_at(self, data, p + match_len) == data[match_len]) {
+                    ++match_len;
+                }
+            }
+        }
+        if (match_len < MIN_MATCH) {
+            match_len = 1;
+            put_literal(self, out, data[0]);
+        } else {
+            put_match(self, out, match_len, dist);
+        }
+        for (size_t i = 0; i < match_len; ++i) {
+            if (i > 0 && len - i >= MIN_MATCH) {
+                self->hash_table[compress_hash(self, data + i)] = self->pos;
+            }
+            self->window[self->pos & mask] = data[i];
+            self->pos += 1;
+        }
+        data += match_len;
+        len -= match_len;
+    }
+}
+
+STATIC void compress_stored(zlib_compress_obj_t *self, vstr_t *out, const uint8_t *data, size_t len) {
+    while (len > 0) {
+        uint16_t n = MIN(len, 0xffff);
+        // BFINAL=0, BTYPE=00 (stored), then LEN and NLEN on a byte boundary
+        put_bits(self, out, 0, 3);
+        put_align(self, out);
+        uint8_t hdr[4] = { n & 0xff, n >> 8, ~n & 0xff, (~n >> 8) & 0xff };
+        vstr_add_strn(out, (const char *)hdr, 4);
+        vstr_add_strn(out, (const char *)data, n);
+        data += n;
+        len -= n;
+    }
+}
+
+mp_obj_t common_hal_zlib_compress_obj_compress(zlib_compress_obj_t *self, const uint8_t *data, size_t len) {
+    if (self->finished) {
+        raise_deinited_error();
+    }
+    vstr_t out;
+    vstr_init(&out, len / 2 + 16);
+    if (!self->header_done) {
+        put_header(self, &out);
+    }
+    if (compress_is_gzip(self)) {
+        self->checksum = uzlib_crc32(data, len, self->checksum);
+    } else {
+        self->checksum = uzlib_adler32(data, len, self->checksum);
+    }
+    self->total_in += len;
+    if (self->level == 0) {
+        compress_stored(self, &out, data, len);
+    } else {
+        compress_lz77(self, &out, data, len);
+    }
+    return mp_obj_new_bytes_from_vstr(&out);
+}
+
+mp_obj_t common_hal_zlib_compress_obj_flush(zlib_compress_obj_t *self, mp_int_t mode) {
+    if (self->finished) {
+        raise_deinited_error();
+    }
+    vstr_t out;
+    vstr_init(&out, 16);
+    if (!self->header_done) {
+        put_header(self, &out);
+    }
+    if (mode != ZLIB_Z_NO_FLUSH) {
+        if (self->block_open) {
+            // end of block
+            put_literal(self, &out, 256);
+            self->block_open = false;
+        }
+        if (mode == ZLIB_Z_FINISH) {
+            // An empty final block.
+            put_bits(self, &out, 1 | (1 << 1), 3);
+            put_literal(self, &out, 256);
+            put_align(self, &out);
+            put_trailer(self, &out);
+            self->finished = true;
+        } else {
+            // An empty stored block brings the output to a byte boundary.
+            put_bits(self, &out, 0, 3);
+            put_align(self, &out);
+            vstr_add_strn(&out, "\x00\x00\xff\xff", 4);
+            if (mode == ZLIB_Z_FULL_FLUSH && self->hash_table != NULL) {
+                // Later data must not refer back to anything before this.
+                memset(self->hash_table, 0, sizeof(uint16_t) << self->hash_bits);
+                self->pos = 0;
+            }
+        }
+    }
+    return mp_obj_new_bytes_from_vstr(&out);
+}
@@ -0,0 +1,267 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/zlib/Decompress.h"
+
+// Size of the window given by wbits, as for zlib.decompress().
+STATIC size_t decompress_window_size(mp_int_t wbits) {
+    if (wbits < 0) {
+        wbits = -wbits;
+    } else if (wbits >= 16) {
+        wbits -= 16;
+    } else if (wbits == 0) {
+        wbits = 15;
+    }
+    return (size_t)1 << wbits;
+}
+
+// Called by uzlib when it has used up the current source buffer.
+STATIC int decompress_read_next_src(TINF_DATA *d) {
+    zlib_decompress_obj_t *self = d->self;
+    if (self->next_src == NULL || self->next_src == self->next_src_limit) {
+        // Output only happens once a whole symbol has been read, so
+        // everything before this point is complete.
+        self->eof_dest = d->dest;
+        return -1;
+    }
+    d->source = self->next_src + 1;
+    d->source_limit = self->next_src_limit;
+    self->next_src = NULL;
+    return d->source[-1];
+}
+
+void common_hal_zlib_decompress_obj_construct(zlib_decompress_obj_t *self, mp_int_t wbits) {
+    memset(&self->decomp, 0, sizeof(self->decomp));
+    self->decomp.self = self;
+    self->decomp.source_read_cb = decompress_read_next_src;
+    self->saved = m_new_obj(TINF_DATA);
+    self->saved_dict = m_new(uint8_t, ZLIB_DECOMPRESS_STEP);
+    self->window = NULL;
+    self->window_size = 0;
+    self->pending = NULL;
+    self->pending_len = 0;
+    self->next_src = NULL;
+    self->next_src_limit = NULL;
+    self->eof_dest = NULL;
+    self->unused_data = mp_const_empty_bytes;
+    self->unconsumed_tail = mp_const_empty_bytes;
+    self->wbits = wbits;
+    self->header_done = false;
+    self->eof = false;
+}
+
+// Snapshot the decoder state before a step that will write at most n bytes
+// of output, or undo that step.
+STATIC void decompress_save(zlib_decompress_obj_t *self, size_t n) {
+    *self->saved = self->decomp;
+    for (size_t i = 0, idx = self->decomp.dict_idx; i < n && self->window != NULL; ++i) {
+        self->saved_dict[i] = self->window[idx];
+        idx = (idx + 1) & (self->window_size - 1);
+    }
+}
+
+STATIC void decompress_restore(zlib_decompress_obj_t *self, size_t n, const uint8_t *next_src) {
+    self->decomp = *self->saved;
+    self->next_src = next_src;
+    for (size_t i = 0, idx = self->decomp.dict_idx; i < n && self->window != NULL; ++i) {
+        self->window[idx] = self->saved_dict[i];
+        idx = (idx + 1) & (self->window_size - 1);
+    }
+}
+
+STATIC bool decompress_parse_header(zlib_decompress_obj_t *self) {
+    TINF_DATA *d = &self->decomp;
+    const uint8_t *next_src = self->next_src;
+    decompress_save(self, 0);
+    int st = 0;
+    size_t window_size = decompress_window_size(self->wbits);
+    if (self->wbits >= 16) {
+        st = uzlib_gzip_parse_header(d);
+    } else if (self->wbits >= 0) {
+        st = uzlib_zlib_parse_header(d);
+        if (st >= 0) {
+            // Only allocate as much window as the stream says it needs.
+            window_size = (size_t)1 << (st + 8);
+        }
+    }
+    if (d->eof) {
+        decompress_restore(self, 0, next_src);
+        return false;
+    }
+    if (st < 0) {
+        mp_raise_type_arg(&mp_type_ValueError, MP_OBJ_NEW_SMALL_INT(st));
+    }
+    self->window = m_new(uint8_t, window_size);
+    self->window_size = window_size;
+    // uzlib_uncompress_init() resets the bit reader, but keeps the source
+    // and the checksum set up by the header parser.
+    uzlib_uncompress_init(d, self->window, window_size);
+    self->header_done = true;
+    return true;
+}
+
+// Append the input that uzlib has not consumed to a new buffer of len bytes.
+STATIC void decompress_copy_leftover(zlib_decompress_obj_t *self, uint8_t *buf) {
+    TINF_DATA *d = &self->decomp;
+    size_t n = d->source_limit - d->source;
+    memcpy(buf, d->source, n);
+    if (self->next_src != NULL) {
+        memcpy(buf + n, self->next_src, self->next_src_limit - self->next_src);
+    }
+}
+
+mp_obj_t common_hal_zlib_decompress_obj_decompress(zlib_decompress_obj_t *self, const uint8_t *data, size_t len, size_t max_length) {
+    TINF_DATA *d = &self->decomp;
+    self->unconsumed_tail = mp_const_empty_bytes;
+
+    if (self->eof) {
+        if (len > 0) {
+            self->unused_data = mp_binary_op(MP_BINARY_OP_ADD, self->unused_data, mp_obj_new_bytes(data, len));
+        }
+        return mp_const_empty_bytes;
+    }
+
+    // Continue with any input left over from last time, then the new data.
+    if (self->pending_len > 0) {
+        d->source = self->pending;
+        d->source_limit = self->pending + self->pending_len;
+        self->next_src = data;
+        self->next_src_limit = data + len;
+    } else {
+        d->source = data;
+        d->source_limit = data + len;
+        self->next_src = NULL;
+    }
+
+    vstr_t out;
+    vstr_init(&out, max_length > 0 ? MIN(max_length, ZLIB_DECOMPRESS_STEP) : ZLIB_DECOMPRESS_STEP);
+    bool limited = false;
+
+    if (self->header_done || decompress_parse_header(self)) {
+        // Each step decodes up to ZLIB_DECOMPRESS_STEP bytes. When a step
+        // runs out of input part way through a symbol, it's undone and the
+        // output that was complete before that is decoded once more, which
+        // leaves the decoder at the start of the unfinished symbol. The rest
+        // of the input is kept for the next call.
+        for (;;) {
+            if (max_length > 0 && out.len >= max_length) {
+                limited = true;
+                break;
+            }
+            if (out.alloc - out.len < ZLIB_DECOMPRESS_STEP) {
+                vstr_hint_size(&out, MAX(out.len, ZLIB_DECOMPRESS_STEP));
+            }
+            size_t step = MIN(ZLIB_DECOMPRESS_STEP, out.alloc - out.len);
+            if (max_length > 0) {
+                step = MIN(step, max_length - out.len);
+            }
+
+            const uint8_t *next_src = self->next_src;
+            decompress_save(self, step);
+            uint8_t *dest = (uint8_t *)out.buf + out.len;
+            d->dest = dest;
+            d->dest_limit = dest + step;
+            int st = uzlib_uncompress_chksum(d);
+            if (d->eof) {
+                size_t complete = self->eof_dest - dest;
+                decompress_restore(self, step, next_src);
+                if (complete > 0) {
+                    d->dest = dest;
+                    d->dest_limit = dest + complete;
+                    uzlib_uncompress_chksum(d);
+                    out.len += complete;
+                }
+                break;
+            }
+            if (st < 0) {
+                mp_raise_type_arg(&mp_type_ValueError, MP_OBJ_NEW_SMALL_INT(st));
+            }
+            out.len += d->dest - dest;
+            if (st == TINF_DONE) {
+                self->eof = true;
+                break;
+            }
+        }
+    }
+
+    size_t leftover = d->source_limit - d->source;
+    if (self->next_src != NULL) {
+        leftover += self->next_src_limit - self->next_src;
+    }
+    uint8_t *old_pending = self->pending;
+    size_t old_pending_len = self->pending_len;
+    self->pending = NULL;
+    self->pending_len = 0;
+    if (leftover > 0) {
+        if (self->eof || limited) {
+            vstr_t rest;
+            vstr_init_len(&rest, leftover);
+            decompress_copy_leftover(self, (uint8_t *)rest.buf);
+            mp_obj_t rest_obj = mp_obj_new_bytes_from_vstr(&rest);
+            if (self->eof) {
+                self->unused_data = rest_obj;
+            } else {
+                self->unconsumed_tail = rest_obj;
+            }
+        } else {
+            self->pending = m_new(uint8_t, leftover);
+            self->pending_len = leftover;
+            decompress_copy_leftover(self, self->pending);
+        }
+    }
+    m_del(uint8_t, old_pending, old_pending_len);
+    // Don't keep pointers into the caller's buffer.
+    d->source = d->source_limit = NULL;
+    self->next_src = self->next_src_limit = NULL;
+
+    return mp_obj_new_bytes_from_vstr(&out);
+}
+
+mp_obj_t common_hal_zlib_decompress_obj_flush(zlib_decompress_obj_t *self) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(self->unconsumed_tail, &bufinfo, MP_BUFFER_READ);
+    mp_obj_t result = common_hal_zlib_decompress_obj_decompress(self, bufinfo.buf, bufinfo.len, 0);
+    // Whatever is still pending is a truncated stream; drop it.
+    m_del(uint8_t, self->pending, self->pending_len);
+    self->pending = NULL;
+    self->pending_len = 0;
+    return result;
+}
+
+bool common_hal_zlib_decompress_obj_get_eof(zlib_decompress_obj_t *self) {
+    return self->eof;
+}
+
+mp_obj_t common_hal_zlib_decompress_obj_get_unused_data(zlib_decompress_obj_t *self) {
+    return self->unused_data;
+}
+
+mp_obj_t common_hal_zlib_decompress_obj_get_unconsumed_tail(zlib_decompress_obj_t *self) {
+    return self->unconsumed_tail;
+}
@@ -0,0 +1,59 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "py/obj.h"
+#include "lib/uzlib/uzlib.h"
+
+// Upper bound on the output produced by one call into uzlib. The dictionary
+// bytes that such a call may overwrite are saved so it can be undone.
+#define ZLIB_DECOMPRESS_STEP (512)
+
+typedef struct {
+    mp_obj_base_t base;
+    TINF_DATA decomp;
+    // Copy of decomp taken before each step, to roll back to if the input
+    // runs out part way through a symbol.
+    TINF_DATA *saved;
+    uint8_t *saved_dict;
+    uint8_t *window;
+    size_t window_size;
+    // Input left over from the previous call because it ends part way
+    // through a symbol or header.
+    uint8_t *pending;
+    size_t pending_len;
+    // Caller's buffer to continue with once the pending input is used up.
+    const uint8_t *next_src;
+    const uint8_t *next_src_limit;
+    // Output position when uzlib last ran out of input.
+    uint8_t *eof_dest;
+    mp_obj_t unused_data;
+    mp_obj_t unconsumed_tail;
+    int8_t wbits;
+    bool header_done;
+    bool eof;
+} zlib_decompress_obj_t;
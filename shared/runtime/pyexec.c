@@ -88,6 +88,10 @@ STATIC int parse_compile_execute(const void *source, mp_parse_input_kind_t input
     nlr.ret_val = NULL;
     if (nlr_push(&nlr) == 0) {
         mp_obj_t module_fun;
+        // CIRCUITPY-CHANGE
+        #if MICROPY_COMP_STREAMING && MICROPY_ENABLE_COMPILER
+        mp_lexer_t *stmts_lex = NULL;
+        #endif
         #if CIRCUITPY_ATEXIT
         if (!(exec_flags & EXEC_FLAG_SOURCE_IS_ATEXIT))
         #endif
@@ -124,8 +128,18 @@ STATIC int parse_compile_execute(const void *source, mp_parse_input_kind_t input
                 }
                 #endif
 
-                mp_parse_tree_t parse_tree = mp_parse(lex, input_kind);
-                module_fun = mp_compile(&parse_tree, source_name, exec_flags & EXEC_FLAG_IS_REPL);
+                // CIRCUITPY-CHANGE
+                #if MICROPY_COMP_STREAMING
+                if (MP_STATE_VM(comp_streaming) && input_kind == MP_PARSE_FILE_INPUT && (exec_flags & EXEC_FLAG_SOURCE_IS_FILENAME)) {
+                    // the file is parsed, compiled and executed one statement at a time below
+                    stmts_lex = lex;
+                    module_fun = MP_OBJ_NULL;
+                } else
+                #endif
+                {
+                    mp_parse_tree_t parse_tree = mp_parse(lex, input_kind);
+                    module_fun = mp_compile(&parse_tree, source_name, exec_flags & EXEC_FLAG_IS_REPL);
+                }
                 #else
                 mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("script compilation not supported"));
                 #endif
@@ -148,6 +162,12 @@ STATIC int parse_compile_execute(const void *source, mp_parse_input_kind_t input
             mp_call_function_n_kw(callback->func, callback->n_pos, callback->n_kw, callback->args);
         } else
         #endif
+        // CIRCUITPY-CHANGE
+        #if MICROPY_COMP_STREAMING && MICROPY_ENABLE_COMPILER
+        if (stmts_lex != NULL) {
+            mp_parse_compile_execute_stmts(stmts_lex, mp_globals_get(), mp_locals_get());
+        } else
+        #endif
         {
             mp_call_function_0(module_fun);
         }
@@ -30,6 +30,7 @@
 #include "genhdr/devices.h"
 #include "supervisor/flash.h"
 #include "supervisor/port.h"
+#include "supervisor/port_heap.h"
 #include "supervisor/spi_flash_api.h"
 #include "supervisor/shared/external_flash/common_commands.h"
 #include "extmod/vfs.h"
@@ -42,20 +43,31 @@
 
 #define NO_SECTOR_LOADED 0xFFFFFFFF
 
-// The currently cached sector in the cache, ram or flash based.
-static uint32_t current_sector;
-
 STATIC const external_flash_device possible_devices[] = {EXTERNAL_FLASH_DEVICES};
 #define EXTERNAL_FLASH_DEVICE_COUNT MP_ARRAY_SIZE(possible_devices)
 
 static const external_flash_device *flash_device = NULL;
 
-// Track which blocks (up to 32) in the current sector currently live in the
-// cache.
-static uint32_t dirty_mask;
-
-// Table of pointers to each cached block
-static uint8_t **flash_cache_table = NULL;
+// Writes are cached a sector (erase block) at a time and only written back
+// when a sector has to be evicted to make room for another, or when the
+// filesystem is flushed, which happens at most CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS
+// after a write. Scattered writes, such as a file append plus its FAT and
+// directory updates, then cost one erase per sector per flush instead of one
+// each time the writes move to a different sector.
+typedef struct {
+    // The cached sector, or NO_SECTOR_LOADED.
+    uint32_t sector;
+    // Track which blocks (up to 32) in the sector currently live in the cache.
+    uint32_t dirty_mask;
+    // Value of cache_use_count when last written, to pick which one to evict.
+    uint32_t last_used;
+    // Table of pointers to each cached page. NULL when this sector is cached
+    // in the scratch sector at the end of flash, which only one can be.
+    uint8_t **table;
+} flash_cache_t;
+
+static flash_cache_t flash_cache[CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS];
+static uint32_t cache_use_count;
 
 // Wait until both the write enable and write in progress bits have cleared.
 static bool wait_for_flash_ready(void) {
@@ -151,7 +163,7 @@ static bool page_erased(uint32_t sector_address) {
     uint8_t full_buffer[FILESYSTEM_BLOCK_SIZE];
     if (read_flash(sector_address, full_buffer, FILESYSTEM_BLOCK_SIZE)) {
         for (uint16_t i = 0; i < FILESYSTEM_BLOCK_SIZE; i++) {
-            if (short_buffer[i] != 0xff) {
+            if (full_buffer[i] != 0xff) {
                 return false;
             }
         }
@@ -293,9 +305,11 @@ void supervisor_flash_init(void) {
 
     wait_for_flash_ready();
 
-    current_sector = NO_SECTOR_LOADED;
-    dirty_mask = 0;
-    flash_cache_table = NULL;
+    for (size_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+        flash_cache[i].sector = NO_SECTOR_LOADED;
+        flash_cache[i].dirty_mask = 0;
+        flash_cache[i].table = NULL;
+    }
 }
 
 // The size of each individual block.
@@ -315,18 +329,15 @@ uint32_t supervisor_flash_get_block_count(void) {
 
 // Flush the cache that was written to the scratch portion of flash. Only used
 // when ram is tight.
-static bool flush_scratch_flash(void) {
-    if (current_sector == NO_SECTOR_LOADED) {
-        return true;
-    }
+static bool flush_scratch_flash(flash_cache_t *cache) {
     // First, copy out any blocks that we haven't touched from the sector we've
     // cached.
     bool copy_to_scratch_ok = true;
     uint32_t scratch_sector = flash_device->total_size - SPI_FLASH_ERASE_SIZE;
     for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
+        if ((cache->dirty_mask & (1 << i)) == 0) {
             copy_to_scratch_ok = copy_to_scratch_ok &&
-                copy_block(current_sector + i * FILESYSTEM_BLOCK_SIZE,
+                copy_block(cache->sector + i * FILESYSTEM_BLOCK_SIZE,
                 scratch_sector + i * FILESYSTEM_BLOCK_SIZE);
         }
     }
@@ -336,11 +347,11 @@ static bool flush_scratch_flash(void) {
         return false;
     }
     // Second, erase the current sector.
-    erase_sector(current_sector);
+    erase_sector(cache->sector);
     // Finally, copy the new version into it.
     for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
         copy_block(scratch_sector + i * FILESYSTEM_BLOCK_SIZE,
-            current_sector + i * FILESYSTEM_BLOCK_SIZE);
+            cache->sector + i * FILESYSTEM_BLOCK_SIZE);
     }
     return true;
 }
@@ -348,79 +359,95 @@ static bool flush_scratch_flash(void) {
 // Attempts to allocate a new set of page buffers for caching a full sector in
 // ram. Each page is allocated separately so that the GC doesn't need to provide
 // one huge block. We can free it as we write if we want to also.
-static bool allocate_ram_cache(void) {
+static bool allocate_ram_cache(flash_cache_t *cache) {
     uint8_t blocks_per_sector = SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE;
     uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
 
     uint32_t table_size = blocks_per_sector * pages_per_block * sizeof(size_t);
     // Attempt to allocate outside the heap first.
-    flash_cache_table = port_malloc(table_size, false);
-
-    // Declare i and j outside the loops in case we fail to allocate everything
-    // we need. In that case we'll give it back.
-    uint8_t i = 0;
-    uint8_t j = 0;
-    bool success = flash_cache_table != NULL;
-    for (i = 0; i < blocks_per_sector && success; i++) {
-        for (j = 0; j < pages_per_block && success; j++) {
-            uint8_t *page_cache = port_malloc(SPI_FLASH_PAGE_SIZE, false);
-            if (page_cache == NULL) {
-                success = false;
-                break;
-            }
-            flash_cache_table[i * pages_per_block + j] = page_cache;
+    uint8_t **flash_cache_table = port_malloc(table_size, false);
+
+    // Count what we allocate in case we fail to allocate everything we need.
+    // In that case we'll give it back.
+    size_t page_count = blocks_per_sector * pages_per_block;
+    size_t allocated = 0;
+    while (flash_cache_table != NULL && allocated < page_count) {
+        uint8_t *page_cache = port_malloc(SPI_FLASH_PAGE_SIZE, false);
+        if (page_cache == NULL) {
+            break;
         }
+        flash_cache_table[allocated++] = page_cache;
     }
+    bool success = flash_cache_table != NULL && allocated == page_count;
     // We couldn't allocate enough so give back what we got.
-    if (!success) {
-        // We add 1 so that we delete 0 when i is 1. Going to zero (i >= 0)
-        // would never stop because i is unsigned.
-        i++;
-        for (; i > 0; i--) {
-            for (; j > 0; j--) {
-                port_free(flash_cache_table[(i - 1) * pages_per_block + (j - 1)]);
-            }
-            j = pages_per_block;
+    if (!success && flash_cache_table != NULL) {
+        while (allocated > 0) {
+            port_free(flash_cache_table[--allocated]);
         }
         port_free(flash_cache_table);
         flash_cache_table = NULL;
     }
+    cache->table = flash_cache_table;
     return success;
 }
 
-static void release_ram_cache(void) {
+static void release_ram_cache(flash_cache_t *cache) {
+    if (cache->table == NULL) {
+        return;
+    }
     uint8_t blocks_per_sector = SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE;
     uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
     for (uint8_t i = 0; i < blocks_per_sector; i++) {
         for (uint8_t j = 0; j < pages_per_block; j++) {
             uint32_t offset = i * pages_per_block + j;
-            port_free(flash_cache_table[offset]);
+            port_free(cache->table[offset]);
         }
     }
-    port_free(flash_cache_table);
-    flash_cache_table = NULL;
+    port_free(cache->table);
+    cache->table = NULL;
 }
 
-// Flush the cached sector from ram onto the flash. We'll free the cache unless
-// keep_cache is true.
-static bool flush_ram_cache(bool keep_cache) {
-    if (current_sector == NO_SECTOR_LOADED) {
-        if (!keep_cache) {
-            release_ram_cache();
+static void write_cached_block(flash_cache_t *cache, uint8_t block_index) {
+    uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
+    for (uint8_t j = 0; j < pages_per_block; j++) {
+        write_flash(cache->sector + (block_index * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
+            cache->table[block_index * pages_per_block + j],
+            SPI_FLASH_PAGE_SIZE);
+    }
+}
+
+// Flush the cached sector from ram onto the flash.
+static bool flush_ram_cache(flash_cache_t *cache) {
+    uint8_t blocks_per_sector = SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE;
+    // If every block we've changed is still erased on the flash, such as when
+    // appending to a file, we can program them in place and spare the sector
+    // an erase.
+    bool needs_erase = false;
+    for (uint8_t i = 0; i < blocks_per_sector && !needs_erase; i++) {
+        if ((cache->dirty_mask & (1 << i)) != 0) {
+            needs_erase = !page_erased(cache->sector + i * FILESYSTEM_BLOCK_SIZE);
+        }
+    }
+    if (!needs_erase) {
+        for (uint8_t i = 0; i < blocks_per_sector; i++) {
+            if ((cache->dirty_mask & (1 << i)) != 0) {
+                write_cached_block(cache, i);
+            }
         }
         return true;
     }
+
     // First, copy out any blocks that we haven't touched from the sector
     // we've cached. If we don't do this we'll erase the data during the sector
     // erase below.
     bool copy_to_ram_ok = true;
     uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
+    for (uint8_t i = 0; i < blocks_per_sector; i++) {
+        if ((cache->dirty_mask & (1 << i)) == 0) {
             for (uint8_t j = 0; j < pages_per_block; j++) {
                 copy_to_ram_ok = read_flash(
-                    current_sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
-                    flash_cache_table[i * pages_per_block + j],
+                    cache->sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
+                    cache->table[i * pages_per_block + j],
                     SPI_FLASH_PAGE_SIZE);
                 if (!copy_to_ram_ok) {
                     break;
@@ -436,35 +463,41 @@ static bool flush_ram_cache(bool keep_cache) {
         return false;
     }
     // Second, erase the current sector.
-    erase_sector(current_sector);
+    erase_sector(cache->sector);
     // Lastly, write all the data in ram that we've cached.
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        for (uint8_t j = 0; j < pages_per_block; j++) {
-            write_flash(current_sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
-                flash_cache_table[i * pages_per_block + j],
-                SPI_FLASH_PAGE_SIZE);
-        }
-    }
-    // We're done with the cache for now so give it back.
-    if (!keep_cache) {
-        release_ram_cache();
+    for (uint8_t i = 0; i < blocks_per_sector; i++) {
+        write_cached_block(cache, i);
     }
     return true;
 }
 
+// Write a cached sector back to flash, whichever kind of cache it is in.
+static void flush_cache(flash_cache_t *cache) {
+    if (cache->sector == NO_SECTOR_LOADED) {
+        return;
+    }
+    if (cache->table == NULL) {
+        flush_scratch_flash(cache);
+    } else {
+        flush_ram_cache(cache);
+    }
+    cache->sector = NO_SECTOR_LOADED;
+    cache->dirty_mask = 0;
+}
+
 // Delegates to the correct flash flush method depending on the existing cache.
+// We'll free the cache unless keep_cache is true.
 // TODO Don't blink the status indicator if we don't actually do any writing (hard to tell right now).
 static void spi_flash_flush_keep_cache(bool keep_cache) {
     #ifdef MICROPY_HW_LED_MSC
     port_pin_set_output_level(MICROPY_HW_LED_MSC, true);
     #endif
-    // If we've cached to the flash itself flush from there.
-    if (flash_cache_table == NULL) {
-        flush_scratch_flash();
-    } else {
-        flush_ram_cache(keep_cache);
+    for (size_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+        flush_cache(&flash_cache[i]);
+        if (!keep_cache) {
+            release_ram_cache(&flash_cache[i]);
+        }
     }
-    current_sector = NO_SECTOR_LOADED;
     #ifdef MICROPY_HW_LED_MSC
     port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
     #endif
@@ -478,8 +511,55 @@ void supervisor_flash_release_cache(void) {
     spi_flash_flush_keep_cache(false);
 }
 
+static flash_cache_t *find_cache(uint32_t sector) {
+    for (size_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+        if (flash_cache[i].sector == sector) {
+            return &flash_cache[i];
+        }
+    }
+    return NULL;
+}
+
+// Find room to cache a sector that isn't cached yet, writing back the least
+// recently written sector if they're all in use.
+static flash_cache_t *start_cache(uint32_t sector) {
+    flash_cache_t *cache = NULL;
+    flash_cache_t *scratch = NULL;
+    // Prefer an empty cache that already has its ram.
+    for (size_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+        flash_cache_t *c = &flash_cache[i];
+        if (c->sector != NO_SECTOR_LOADED && c->table == NULL) {
+            scratch = c;
+        }
+        if (c->sector == NO_SECTOR_LOADED && (cache == NULL || cache->table == NULL)) {
+            cache = c;
+        }
+    }
+    if (cache != NULL && cache->table == NULL && !allocate_ram_cache(cache) && scratch != NULL) {
+        // The scratch sector is taken so make room by writing it back.
+        cache = scratch;
+        flush_cache(cache);
+    }
+    if (cache == NULL) {
+        cache = &flash_cache[0];
+        for (size_t i = 1; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+            if (flash_cache[i].last_used < cache->last_used) {
+                cache = &flash_cache[i];
+            }
+        }
+        flush_cache(cache);
+    }
+    if (cache->table == NULL) {
+        erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
+        wait_for_flash_ready();
+    }
+    cache->sector = sector;
+    cache->dirty_mask = 0;
+    return cache;
+}
+
 static int32_t convert_block_to_flash_addr(uint32_t block) {
-    if (0 <= block && block < supervisor_flash_get_block_count()) {
+    if (block < supervisor_flash_get_block_count()) {
         // a block in partition 1
         return block * FILESYSTEM_BLOCK_SIZE;
     }
@@ -497,14 +577,15 @@ static bool external_flash_read_block(uint8_t *dest, uint32_t block) {
     // Mask out the lower bits that designate the address within the sector.
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
     uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
-    uint8_t mask = 1 << (block_index);
-    // We're reading from the currently cached sector.
-    if (current_sector == this_sector && (mask & dirty_mask) > 0) {
-        if (flash_cache_table != NULL) {
+    uint32_t mask = 1 << (block_index);
+    flash_cache_t *cache = find_cache(this_sector);
+    // We're reading from a cached sector.
+    if (cache != NULL && (mask & cache->dirty_mask) > 0) {
+        if (cache->table != NULL) {
             uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
             for (int i = 0; i < pages_per_block; i++) {
                 memcpy(dest + i * SPI_FLASH_PAGE_SIZE,
-                    flash_cache_table[block_index * pages_per_block + i],
+                    cache->table[block_index * pages_per_block + i],
                     SPI_FLASH_PAGE_SIZE);
             }
             return true;
@@ -528,31 +609,29 @@ static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     // Mask out the lower bits that designate the address within the sector.
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
     uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
-    uint8_t mask = 1 << (block_index);
-    // Flush the cache if we're moving onto a sector or we're writing the
-    // same block again.
-    if (current_sector != this_sector || (mask & dirty_mask) > 0) {
+    uint32_t mask = 1 << (block_index);
+    flash_cache_t *cache = find_cache(this_sector);
+    // A block can only be written to the scratch sector once, so flush if
+    // we're writing the same block again.
+    if (cache != NULL && cache->table == NULL && (mask & cache->dirty_mask) > 0) {
+        flush_cache(cache);
+        cache = NULL;
+    }
+    if (cache == NULL) {
         // Check to see if we'd write to an erased page. In that case we
         // can write directly.
         if (page_erased(address)) {
             return write_flash(address, data, FILESYSTEM_BLOCK_SIZE);
         }
-        if (current_sector != NO_SECTOR_LOADED) {
-            supervisor_flash_flush();
-        }
-        if (flash_cache_table == NULL && !allocate_ram_cache()) {
-            erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
-            wait_for_flash_ready();
-        }
-        current_sector = this_sector;
-        dirty_mask = 0;
+        cache = start_cache(this_sector);
     }
-    dirty_mask |= mask;
+    cache->dirty_mask |= mask;
+    cache->last_used = ++cache_use_count;
     // Copy the block to the appropriate cache.
-    if (flash_cache_table != NULL) {
+    if (cache->table != NULL) {
         uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
         for (int i = 0; i < pages_per_block; i++) {
-            memcpy(flash_cache_table[block_index * pages_per_block + i],
+            memcpy(cache->table[block_index * pages_per_block + i],
                 data + i * SPI_FLASH_PAGE_SIZE,
                 SPI_FLASH_PAGE_SIZE);
         }
@@ -34,6 +34,7 @@
 
 #include "supervisor/flash.h"
 #include "supervisor/linker.h"
+#include "supervisor/port_heap.h"
 
 static mp_vfs_mount_t _mp_vfs;
 static fs_user_mount_t _internal_vfs;
@@ -89,6 +90,13 @@ static void make_file_with_contents(FATFS *fatfs, const char *filename, const by
     make_empty_file(fatfs, filename)
 #endif
 
+#if MICROPY_FATFS_SECTOR_CACHE_LINES
+// CIRCUITPY outlives the VM, so its sector cache comes from the port heap.
+static void *filesystem_sector_cache_alloc(size_t size) {
+    return port_malloc(size, false);
+}
+#endif
+
 // we don't make this function static because it needs a lot of stack and we
 // want it to be executed without using stack within main() function
 bool filesystem_init(bool create_allowed, bool force_create) {
@@ -168,6 +176,10 @@ bool filesystem_init(bool create_allowed, bool force_create) {
         return false;
     }
 
+    #if MICROPY_FATFS_SECTOR_CACHE_LINES
+    fat_vfs_sector_cache_init(vfs_fat, filesystem_sector_cache_alloc);
+    #endif
+
     vfs->str = "/";
     vfs->len = 1;
     vfs->obj = MP_OBJ_FROM_PTR(vfs_fat);
@@ -64,6 +64,31 @@ static volatile uint64_t last_finished_tick = 0;
 
 static volatile size_t tick_enable_count = 0;
 
+#if MICROPY_PROF_SAMPLING
+#include "py/profile.h"
+
+// Number of ticks between profiler samples, or 0 when not sampling.
+static volatile uint32_t prof_sample_period_ticks = 0;
+static uint32_t prof_sample_countdown = 0;
+
+void mp_prof_sampling_port_start(mp_uint_t period_us) {
+    // Ticks are 1/1024 of a second, and are the finest resolution available.
+    uint32_t period_ticks = (uint64_t)period_us * 1024 / 1000000;
+    if (prof_sample_period_ticks == 0) {
+        supervisor_enable_tick();
+    }
+    prof_sample_countdown = 0;
+    prof_sample_period_ticks = MAX(period_ticks, 1);
+}
+
+void mp_prof_sampling_port_stop(void) {
+    if (prof_sample_period_ticks != 0) {
+        prof_sample_period_ticks = 0;
+        supervisor_disable_tick();
+    }
+}
+#endif
+
 static void supervisor_background_tick(void *unused) {
     port_start_background_tick();
 
@@ -102,6 +127,13 @@ void supervisor_tick(void) {
     keypad_tick();
     #endif
 
+    #if MICROPY_PROF_SAMPLING
+    if (prof_sample_period_ticks != 0 && ++prof_sample_countdown >= prof_sample_period_ticks) {
+        prof_sample_countdown = 0;
+        mp_prof_sample();
+    }
+    #endif
+
     background_callback_add(&tick_callback, supervisor_background_tick, NULL);
 }
 
@@ -140,6 +172,11 @@ void mp_hal_delay_ms(mp_uint_t delay_ms) {
     }
 }
 
+void supervisor_idle_until_interrupt(uint32_t max_ms) {
+    port_interrupt_after_ticks((max_ms * (uint64_t)1024) / 1000);
+    port_idle_until_interrupt();
+}
+
 void supervisor_enable_tick(void) {
     common_hal_mcu_disable_interrupts();
     if (tick_enable_count == 0) {
@@ -57,6 +57,13 @@ extern uint64_t supervisor_ticks_ms64(void);
 extern void supervisor_enable_tick(void);
 extern void supervisor_disable_tick(void);
 
+/** @brief Sleep until an interrupt occurs or max_ms have passed
+ *
+ * Background tasks are not run, so callers should run them and recheck
+ * whatever they are waiting for after this returns.
+ */
+extern void supervisor_idle_until_interrupt(uint32_t max_ms);
+
 /**
  * @brief Return true if tick-based background tasks ran within the last 1s
  *
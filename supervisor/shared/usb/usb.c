@@ -314,6 +314,21 @@ bool tud_vendor_control_xfer_cb(uint8_t rhport, uint8_t stage, tusb_control_requ
 }
 #endif // CIRCUITPY_USB_VENDOR
 
+#if CIRCUITPY_USB_CDC
+
+// Invoked when a CDC interface has received data.
+void tud_cdc_rx_cb(uint8_t itf) {
+    usb_cdc_notify(itf);
+    // The VM may be idle waiting for input, e.g. for "press any key to enter REPL" or in select.
+    port_wake_main_task();
+}
+
+// Invoked when a CDC interface has finished sending, so there is room to write again.
+void tud_cdc_tx_complete_cb(uint8_t itf) {
+    usb_cdc_notify(itf);
+}
+
+#endif
 
 #if MICROPY_KBD_EXCEPTION && CIRCUITPY_USB_CDC
 
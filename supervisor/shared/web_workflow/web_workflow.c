@@ -27,6 +27,7 @@
 // Include strchrnul()
 #define _GNU_SOURCE
 
+#include <inttypes.h>
 #include <stdarg.h>
 #include <string.h>
 
@@ -43,11 +44,14 @@
 #include "supervisor/fatfs.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/port.h"
+#include "supervisor/port_heap.h"
 #include "supervisor/shared/reload.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/translate/translate.h"
 #include "supervisor/shared/web_workflow/web_workflow.h"
 #include "supervisor/shared/web_workflow/websocket.h"
 #include "supervisor/shared/workflow.h"
+#include "supervisor/workflow.h"
 #include "supervisor/usb.h"
 
 #include "shared-bindings/hashlib/__init__.h"
@@ -90,6 +94,8 @@ typedef struct {
     char header_value[256];
     char origin[64];        // We store the origin so we can reply back with it.
     char host[64];          // We store the host to check against origin.
+    char if_none_match[64];
+    char range[32];
     size_t content_length;
     size_t offset;
     uint64_t timestamp_ms;
@@ -100,12 +106,37 @@ typedef struct {
     bool expect;
     bool json;
     bool websocket;
-    bool new_socket;
+    bool keep_alive;
+    bool body_read;
+    bool accept_gzip;
     uint32_t websocket_version;
     // RFC6455 for websockets says this header should be 24 base64 characters long.
     char websocket_key[24 + 1];
+    // When the connection last finished a request, for the keep-alive timeout.
+    uint64_t idle_since_ms;
+    // State for streaming a file body out as the socket accepts it, or a PUT
+    // body in as it arrives. See _send_file_continue() and _write_file_continue().
+    bool sending_file;
+    bool receiving_file;
+    bool file_nodelay;
+    bool new_file;
+    DWORD fattime;
+    fs_user_mount_t *fs_mount;
+    FIL file;
+    uint32_t file_remaining;
+    size_t buffer_start;
+    size_t buffer_end;
+    // CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE bytes from the port heap while a
+    // file is being sent or received, so idle connections don't hold one.
+    uint8_t *buffer;
 } _request;
 
+// One client connection and the request it is working on.
+typedef struct {
+    socketpool_socket_obj_t socket;
+    _request request;
+} _connection;
+
 static wifi_radio_error_t _wifi_status = WIFI_RADIO_ERROR_NONE;
 
 #if CIRCUITPY_STATUS_BAR
@@ -123,9 +154,17 @@ static mp_int_t web_api_port = 80;
 
 static socketpool_socketpool_obj_t pool;
 static socketpool_socket_obj_t listening;
-static socketpool_socket_obj_t active;
 
-static _request active_request;
+// Connections are served round-robin from the background task. One slot is
+// always kept free for new clients by closing keep-alive connections instead
+// of parking them in the last one.
+static _connection connections[CIRCUITPY_WEB_WORKFLOW_CONNECTIONS];
+static size_t next_connection;
+
+// Idle keep-alive connections are closed after this long.
+#define KEEP_ALIVE_TIMEOUT_MS (5000)
+
+static void _reset_request(_request *request);
 
 static char _api_password[64];
 static char web_instance_name[50];
@@ -332,7 +371,9 @@ bool supervisor_start_web_workflow(bool reload) {
         common_hal_socketpool_socketpool_construct(&pool, &common_hal_wifi_radio_obj);
 
         socketpool_socket_reset(&listening);
-        socketpool_socket_reset(&active);
+        for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CONNECTIONS; i++) {
+            socketpool_socket_reset(&connections[i].socket);
+        }
 
         websocket_init();
     }
@@ -340,8 +381,11 @@ bool supervisor_start_web_workflow(bool reload) {
     initialized = pool.base.type == &socketpool_socketpool_type;
 
     if (initialized) {
-        if (!common_hal_socketpool_socket_get_closed(&active)) {
-            common_hal_socketpool_socket_close(&active);
+        for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CONNECTIONS; i++) {
+            _reset_request(&connections[i].request);
+            if (!common_hal_socketpool_socket_get_closed(&connections[i].socket)) {
+                common_hal_socketpool_socket_close(&connections[i].socket);
+            }
         }
 
         #if CIRCUITPY_MDNS
@@ -364,7 +408,7 @@ bool supervisor_start_web_workflow(bool reload) {
             common_hal_socketpool_socket_settimeout(&listening, 0);
             // Bind to any ip. (Not checking for failures)
             common_hal_socketpool_socket_bind(&listening, "", 0, web_api_port);
-            common_hal_socketpool_socket_listen(&listening, 1);
+            common_hal_socketpool_socket_listen(&listening, CIRCUITPY_WEB_WORKFLOW_CONNECTIONS);
         }
         // Wake polling thread (maybe)
         socketpool_socket_poll_resume();
@@ -494,6 +538,42 @@ static bool _endswith(const char *str, const char *suffix) {
 const char http_scheme[] = "http://";
 #define PREFIX_HTTP_LEN (sizeof(http_scheme) - 1)
 
+// Whether an Accept-Encoding value allows coding, either by name or through
+// "*". A q of zero rules it out.
+static bool _accepts_coding(const char *accept_encoding, const char *coding) {
+    size_t coding_len = strlen(coding);
+    int star = -1;
+    const char *entry = accept_encoding;
+    while (*entry != '\0') {
+        while (*entry == ' ' || *entry == ',') {
+            entry++;
+        }
+        size_t len = strcspn(entry, ",; ");
+        bool named = len == coding_len && strncasecmp(entry, coding, len) == 0;
+        bool wildcard = len == 1 && entry[0] == '*';
+        entry += len;
+        size_t params_len = strcspn(entry, ",");
+        if (named || wildcard) {
+            // Weights are 0 to 1 with up to three decimals so only zero needs spotting.
+            bool accepted = true;
+            const char *q = strstr(entry, "q=");
+            if (q != NULL && q < entry + params_len) {
+                q += 2;
+                while (*q == '0' || *q == '.') {
+                    q++;
+                }
+                accepted = *q >= '1' && *q <= '9';
+            }
+            if (named) {
+                return accepted;
+            }
+            star = accepted;
+        }
+        entry += params_len;
+    }
+    return star == 1;
+}
+
 static bool _origin_ok(_request *request) {
     // Origin may be 'null'
     if (request->origin[0] == '\0') {
@@ -562,7 +642,7 @@ static void _reply_access_control(socketpool_socket_obj_t *socket, _request *req
         "HTTP/1.1 204 No Content\r\n",
         "Content-Length: 0\r\n",
         "Access-Control-Expose-Headers: Access-Control-Allow-Methods\r\n",
-        "Access-Control-Allow-Headers: X-Timestamp, X-Destination, Content-Type, Authorization\r\n",
+        "Access-Control-Allow-Headers: X-Timestamp, X-Destination, Content-Type, Authorization, If-None-Match, Range\r\n",
         "Access-Control-Allow-Methods:GET, OPTIONS, PUT, DELETE, MOVE", NULL);
     _send_str(socket, "\r\n");
     _cors_header(socket, request);
@@ -626,6 +706,15 @@ static void _reply_expectation_failed(socketpool_socket_obj_t *socket, _request
     _send_final_str(socket, "\r\n");
 }
 
+static void _reply_service_unavailable(socketpool_socket_obj_t *socket, _request *request) {
+    _send_strs(socket,
+        "HTTP/1.1 503 Service Unavailable\r\n",
+        "Content-Length: 0\r\n",
+        "Retry-After: 1\r\n", NULL);
+    _cors_header(socket, request);
+    _send_final_str(socket, "\r\n");
+}
+
 static void _reply_unauthorized(socketpool_socket_obj_t *socket, _request *request) {
     _send_strs(socket,
         "HTTP/1.1 401 Unauthorized\r\n",
@@ -648,6 +737,7 @@ static void _reply_redirect(socketpool_socket_obj_t *socket, _request *request,
     int nodelay = 1;
     common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
     const char *hostname = common_hal_mdns_server_get_hostname(&mdns);
+    request->keep_alive = false;
     _send_strs(socket,
         "HTTP/1.1 307 Temporary Redirect\r\n",
         "Connection: close\r\n",
@@ -750,12 +840,171 @@ static void _reply_directory_json(socketpool_socket_obj_t *socket, _request *req
     _send_chunk(socket, "");
 }
 
-static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request, const char *filename, FIL *active_file) {
-    uint32_t total_length = f_size(active_file);
+// Get request->buffer for a file transfer. It is freed by _reset_request().
+// Returns false when the port heap can't spare it right now.
+static bool _alloc_file_buffer(_request *request) {
+    if (request->buffer == NULL) {
+        request->buffer = port_malloc(CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE, false);
+    }
+    return request->buffer != NULL;
+}
+
+// Send as much of the open file as the socket will take without blocking.
+// Clears request->sending_file once the body is done or the send failed.
+static void _send_file_continue(socketpool_socket_obj_t *socket, _request *request) {
+    while (true) {
+        if (request->buffer_start == request->buffer_end) {
+            if (request->file_remaining == 0) {
+                break;
+            }
+            UINT quantity_read;
+            UINT to_read = MIN(CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE, request->file_remaining);
+            FRESULT result = f_read(&request->file, request->buffer, to_read, &quantity_read);
+            if (result != FR_OK || quantity_read == 0) {
+                // The file shrank or the filesystem went away, so the promised length
+                // can't be met. Closing the socket tells the client.
+                common_hal_socketpool_socket_close(socket);
+                break;
+            }
+            request->file_remaining -= quantity_read;
+            request->buffer_start = 0;
+            request->buffer_end = quantity_read;
+            // With the last block in hand, disable Nagle's combining algorithm so
+            // that the tail is sent immediately.
+            if (request->file_remaining == 0) {
+                int nodelay = 1;
+                // Returns 0 when it works.
+                request->file_nodelay = common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay)) == 0;
+            }
+        }
+        int sent = socketpool_socket_send(socket, request->buffer + request->buffer_start, request->buffer_end - request->buffer_start);
+        if (sent == -MP_EAGAIN || sent == 0) {
+            // Socket buffers are full. Pick up from here on the next background call.
+            return;
+        }
+        if (sent < 0) {
+            break;
+        }
+        request->buffer_start += sent;
+    }
+
+    // Re-enable Nagle's algorithm when done sending.
+    if (request->file_nodelay) {
+        int nodelay = 0;
+        common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
+        request->file_nodelay = false;
+    }
+    f_close(&request->file);
+    request->sending_file = false;
+}
+
+// Parse a "bytes=first-last" Range header against a file of the given size.
+// Returns 1 and fills in the inclusive range if it should be honored, 0 if the
+// header should be ignored and -1 if the range can't be satisfied.
+static int _parse_range(const char *range, uint32_t size, uint32_t *first, uint32_t *last) {
+    const char *prefix = "bytes=";
+    if (strncmp(range, prefix, strlen(prefix)) != 0 || strchr(range, ',') != NULL) {
+        // Other units and multiple ranges aren't supported, so send the whole file.
+        return 0;
+    }
+    const char *spec = range + strlen(prefix);
+    const char *dash = strchr(spec, '-');
+    if (dash == NULL) {
+        return 0;
+    }
+    char *end;
+    if (dash == spec) {
+        // Suffix range: the last N bytes.
+        uint32_t suffix = strtoul(dash + 1, &end, 10);
+        if (end == dash + 1 || *end != '\0') {
+            return 0;
+        }
+        if (suffix == 0 || size == 0) {
+            return -1;
+        }
+        *first = size - MIN(suffix, size);
+        *last = size - 1;
+        return 1;
+    }
+    *first = strtoul(spec, &end, 10);
+    if (end != dash) {
+        return 0;
+    }
+    if (dash[1] == '\0') {
+        *last = size - 1;
+    } else {
+        *last = strtoul(dash + 1, &end, 10);
+        if (*end != '\0' || *last < *first) {
+            return 0;
+        }
+        *last = MIN(*last, size - 1);
+    }
+    if (*first >= size) {
+        return -1;
+    }
+    return 1;
+}
+
+// Reply to a GET of request->file, which the caller has opened. The body is
+// streamed out by _send_file_continue() from the background task.
+static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request, const char *filename, FILINFO *file_info) {
+    uint32_t total_length = file_info->fsize;
+
+    // The size and modification time stand in for a content hash. Editors use
+    // it to avoid downloading unchanged files again.
+    char etag[24];
+    snprintf(etag, sizeof(etag), "\"%" PRIx32 "-%04x%04x\"", total_length, file_info->fdate, file_info->ftime);
 
-    _send_str(socket, "HTTP/1.1 200 OK\r\n");
     mp_print_t _socket_print = {socket, _print_raw};
-    mp_printf(&_socket_print, "Content-Length: %d\r\n", total_length);
+    if (request->if_none_match[0] != '\0' &&
+        (strcmp(request->if_none_match, "*") == 0 || strstr(request->if_none_match, etag) != NULL)) {
+        f_close(&request->file);
+        _send_strs(socket,
+            "HTTP/1.1 304 Not Modified\r\n",
+            "ETag: ", etag, "\r\n", NULL);
+        _cors_header(socket, request);
+        _send_final_str(socket, "\r\n");
+        return;
+    }
+
+    uint32_t first = 0;
+    uint32_t last = total_length - 1;
+    int range = 0;
+    if (request->range[0] != '\0') {
+        range = _parse_range(request->range, total_length, &first, &last);
+    }
+    if (range < 0) {
+        f_close(&request->file);
+        _send_str(socket, "HTTP/1.1 416 Range Not Satisfiable\r\n");
+        mp_printf(&_socket_print, "Content-Range: bytes */%u\r\n", (uint)total_length);
+        _send_str(socket, "Content-Length: 0\r\n");
+        _cors_header(socket, request);
+        _send_final_str(socket, "\r\n");
+        return;
+    }
+    if (!_alloc_file_buffer(request)) {
+        f_close(&request->file);
+        _reply_service_unavailable(socket, request);
+        return;
+    }
+    if (range > 0) {
+        if (f_lseek(&request->file, first) != FR_OK) {
+            f_close(&request->file);
+            _reply_server_error(socket, request);
+            return;
+        }
+        _send_str(socket, "HTTP/1.1 206 Partial Content\r\n");
+        mp_printf(&_socket_print, "Content-Range: bytes %u-%u/%u\r\n", (uint)first, (uint)last, (uint)total_length);
+        request->file_remaining = last - first + 1;
+    } else {
+        _send_str(socket, "HTTP/1.1 200 OK\r\n");
+        request->file_remaining = total_length;
+    }
+    mp_printf(&_socket_print, "Content-Length: %u\r\n", (uint)request->file_remaining);
+    _send_strs(socket,
+        "Accept-Ranges: bytes\r\n",
+        "ETag: ", etag, "\r\n",
+        "Access-Control-Expose-Headers: ETag, Content-Range\r\n", NULL);
     // TODO: Make this a table to save space.
     if (_endswith(filename, ".txt") || _endswith(filename, ".py") || _endswith(filename, ".toml")) {
         _send_strs(socket, "Content-Type:", "text/plain", ";charset=UTF-8\r\n", NULL);
@@ -771,42 +1020,11 @@ static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request,
     _cors_header(socket, request);
     _send_str(socket, "\r\n");
 
-    uint32_t total_read = 0;
-    int nodelay_ok = -1;
-    while (total_read < total_length) {
-        uint8_t data_buffer[64];
-        size_t quantity_read;
-        f_read(active_file, data_buffer, 64, &quantity_read);
-        total_read += quantity_read;
-        // When getting near the end of the file, disable Nagle's combining algorithm so that
-        // data is sent immediately.
-        if (total_length - total_read < 64) {
-            int nodelay = 1;
-            // Returns 0 when it works.
-            nodelay_ok = common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
-        }
-        uint32_t send_offset = 0;
-        while (send_offset < quantity_read) {
-            int sent = socketpool_socket_send(socket, data_buffer + send_offset, quantity_read - send_offset);
-            if (sent < 0) {
-                if (sent == -MP_EAGAIN) {
-                    sent = 0;
-                } else {
-                    break;
-                }
-            }
-            send_offset += sent;
-        }
-    }
-    if (total_read < total_length) {
-        socketpool_socket_close(socket);
-    }
-
-    // Re-enable Nagle's algorithm when done sending.
-    if (nodelay_ok == 0) {
-        int nodelay = 0;
-        nodelay_ok = common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
-    }
+    request->buffer_start = 0;
+    request->buffer_end = 0;
+    request->file_nodelay = false;
+    request->sending_file = true;
+    _send_file_continue(socket, request);
 }
 
 static void _reply_with_devices_json(socketpool_socket_obj_t *socket, _request *request) {
@@ -969,35 +1187,85 @@ STATIC void _discard_incoming(socketpool_socket_obj_t *socket, size_t amount) {
     }
 }
 
-static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *request, fs_user_mount_t *fs_mount, const TCHAR *path) {
-    FIL active_file;
+// Write as much of the PUT body as has arrived without blocking. Replies and
+// clears request->receiving_file once the whole body is written or it fails.
+static void _write_file_continue(socketpool_socket_obj_t *socket, _request *request) {
+    bool error = false;
+    while (request->file_remaining > 0) {
+        size_t read_len = MIN(CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE, request->file_remaining);
+        int len = socketpool_socket_recv_into(socket, request->buffer, read_len);
+        if (len == -MP_EAGAIN) {
+            // Pick up from here when more of the body arrives.
+            return;
+        }
+        if (len <= 0) {
+            error = true;
+            break;
+        }
+        request->file_remaining -= len;
+        UINT actual;
+        f_write(&request->file, request->buffer, len, &actual);
+        if (actual < (UINT)len) {
+            error = true;
+            break;
+        }
+    }
 
+    // The timestamp is written when the file is closed.
+    override_fattime(request->fattime);
+    f_close(&request->file);
+    override_fattime(0);
+    filesystem_unlock(request->fs_mount);
+    request->receiving_file = false;
+
+    if (error) {
+        _discard_incoming(socket, request->file_remaining);
+        _reply_server_error(socket, request);
+    } else if (request->new_file) {
+        _reply_created(socket, request);
+    } else {
+        _reply_no_content(socket, request);
+    }
+    request->body_read = true;
+}
+
+// Open path for a PUT and start receiving the body into it. The rest of the
+// body is written by _write_file_continue() as it arrives.
+static void _write_file_start(socketpool_socket_obj_t *socket, _request *request, fs_user_mount_t *fs_mount, const TCHAR *path) {
+    if (!_alloc_file_buffer(request)) {
+        _discard_incoming(socket, request->content_length);
+        request->body_read = true;
+        _reply_service_unavailable(socket, request);
+        return;
+    }
     if (!filesystem_lock(fs_mount)) {
         _discard_incoming(socket, request->content_length);
+        request->body_read = true;
         _reply_conflict(socket, request);
         return;
     }
+    request->fattime = 0;
     if (request->timestamp_ms > 0) {
-        DWORD fattime;
-        truncate_time(request->timestamp_ms * 1000000, &fattime);
-        override_fattime(fattime);
+        truncate_time(request->timestamp_ms * 1000000, &request->fattime);
     }
+    override_fattime(request->fattime);
 
     FATFS *fs = &fs_mount->fatfs;
-    FRESULT result = f_open(fs, &active_file, path, FA_WRITE);
+    FRESULT result = f_open(fs, &request->file, path, FA_WRITE);
     bool new_file = false;
     size_t old_length = 0;
     if (result == FR_NO_FILE) {
         new_file = true;
-        result = f_open(fs, &active_file, path, FA_WRITE | FA_OPEN_ALWAYS);
+        result = f_open(fs, &request->file, path, FA_WRITE | FA_OPEN_ALWAYS);
     } else {
-        old_length = f_size(&active_file);
+        old_length = f_size(&request->file);
     }
 
     if (result == FR_NO_PATH) {
         override_fattime(0);
         filesystem_unlock(fs_mount);
         _discard_incoming(socket, request->content_length);
+        request->body_read = true;
         _reply_missing(socket, request);
         return;
     }
@@ -1005,76 +1273,68 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
         override_fattime(0);
         filesystem_unlock(fs_mount);
         _discard_incoming(socket, request->content_length);
+        request->body_read = true;
         _reply_server_error(socket, request);
         return;
     }
 
-    // Change the file size to start.
-    f_lseek(&active_file, request->content_length);
-    if (f_tell(&active_file) < request->content_length) {
+    // Change the file size to start. The seek stops short without an error
+    // when the disk is full.
+    result = f_lseek(&request->file, request->content_length);
+    bool too_large = result == FR_OK && f_tell(&request->file) < request->content_length;
+    if (result != FR_OK || too_large) {
         if (!new_file) {
-            // Truncate the file back to the old length.
-            f_lseek(&active_file, old_length);
-            f_truncate(&active_file);
+            // Truncate the file back to the old length, but only if we got
+            // there. Truncating anywhere else would lose data.
+            if (f_lseek(&request->file, old_length) == FR_OK) {
+                f_truncate(&request->file);
+            }
         }
-        f_close(&active_file);
+        f_close(&request->file);
 
         if (new_file) {
             f_unlink(fs, path);
         }
         override_fattime(0);
         filesystem_unlock(fs_mount);
-        // Too large.
-        if (request->expect) {
+        if (!too_large) {
+            _discard_incoming(socket, request->content_length);
+            request->body_read = true;
+            _reply_server_error(socket, request);
+        } else if (request->expect) {
             _reply_expectation_failed(socket, request);
         } else {
             _discard_incoming(socket, request->content_length);
+            request->body_read = true;
             _reply_payload_too_large(socket, request);
         }
         return;
     } else if (request->expect) {
         _reply_continue(socket, request);
     }
-    f_truncate(&active_file);
-    f_rewind(&active_file);
-
-    size_t total_read = 0;
-    bool error = false;
-    while (total_read < request->content_length && !error) {
-        uint8_t bytes[64];
-        size_t read_len = MIN(sizeof(bytes), request->content_length - total_read);
-        int len = socketpool_socket_recv_into(socket, bytes, read_len);
-        if (len < 0) {
-            if (len == -MP_EAGAIN) {
-                continue;
-            }
-            error = true;
-            break;
-        }
-        total_read += len;
-        UINT actual;
-        f_write(&active_file, bytes, len, &actual);
-        if (actual < (UINT)len) {
-            error = true;
-            break;
-        }
+    result = f_truncate(&request->file);
+    if (result == FR_OK) {
+        result = f_rewind(&request->file);
     }
-
-    f_close(&active_file);
-    filesystem_unlock(fs_mount);
-
-    override_fattime(0);
-    if (error) {
-        _discard_incoming(socket, request->content_length - total_read);
+    if (result != FR_OK) {
+        f_close(&request->file);
+        override_fattime(0);
+        filesystem_unlock(fs_mount);
+        _discard_incoming(socket, request->content_length);
+        request->body_read = true;
         _reply_server_error(socket, request);
-    } else if (new_file) {
-        _reply_created(socket, request);
-    } else {
-        _reply_no_content(socket, request);
+        return;
     }
+    override_fattime(0);
+
+    request->fs_mount = fs_mount;
+    request->new_file = new_file;
+    request->file_remaining = request->content_length;
+    request->receiving_file = true;
+    _write_file_continue(socket, request);
 }
 
-#define STATIC_FILE(filename) extern uint32_t filename##_length; extern uint8_t filename[]; extern const char *filename##_content_type;
+#define STATIC_FILE(filename) extern uint32_t filename##_length; extern uint32_t filename##_crc; extern uint8_t filename[]; extern const char *filename##_content_type;
 
 STATIC_FILE(code_html);
 STATIC_FILE(directory_html);
@@ -1088,21 +1348,53 @@ STATIC_FILE(serial_html);
 STATIC_FILE(serial_js);
 STATIC_FILE(blinka_32x32_ico);
 
-static void _reply_static(socketpool_socket_obj_t *socket, _request *request, const uint8_t *response, size_t response_len, const char *content_type) {
+static void _reply_static(socketpool_socket_obj_t *socket, _request *request, const uint8_t *response, size_t response_len, uint32_t crc, const char *content_type) {
+    // The files only change with the firmware so tag them with the build and
+    // their CRC. Browsers revalidate on every load and get an empty 304 back
+    // until the firmware is updated.
+    char etag[48];
+    snprintf(etag, sizeof(etag), "\"" MICROPY_GIT_HASH "-%08" PRIx32 "\"", crc);
+    if (request->if_none_match[0] != '\0' && strstr(request->if_none_match, etag) != NULL) {
+        _send_strs(socket,
+            "HTTP/1.1 304 Not Modified\r\n",
+            "ETag: ", etag, "\r\n",
+            "Cache-Control: no-cache\r\n",
+            "Vary: Accept, Accept-Encoding\r\n",
+            "\r\n", NULL);
+        return;
+    }
+
+    #if CIRCUITPY_WEB_WORKFLOW_STATIC_GZIP
+    // There is no uncompressed copy to fall back to.
+    if (!request->accept_gzip) {
+        _send_strs(socket,
+            "HTTP/1.1 406 Not Acceptable\r\n",
+            "Content-Length: 0\r\n",
+            "Vary: Accept-Encoding\r\n",
+            "\r\n", NULL);
+        return;
+    }
+    #endif
+
     uint32_t total_length = response_len;
     char encoded_len[10];
     snprintf(encoded_len, sizeof(encoded_len), "%" PRIu32, total_length);
 
     _send_strs(socket,
         "HTTP/1.1 200 OK\r\n",
+        #if CIRCUITPY_WEB_WORKFLOW_STATIC_GZIP
         "Content-Encoding: gzip\r\n",
+        #endif
         "Content-Length: ", encoded_len, "\r\n",
         "Content-Type: ", content_type, "\r\n",
+        "ETag: ", etag, "\r\n",
+        "Cache-Control: no-cache\r\n",
+        "Vary: Accept, Accept-Encoding\r\n",
         "\r\n", NULL);
     web_workflow_send_raw(socket, true, response, response_len);
 }
 
-#define _REPLY_STATIC(socket, request, filename) _reply_static(socket, request, filename, filename##_length, filename##_content_type)
+#define _REPLY_STATIC(socket, request, filename) _reply_static(socket, request, filename, filename##_length, filename##_crc, filename##_content_type)
 
 static void _reply_websocket_upgrade(socketpool_socket_obj_t *socket, _request *request) {
     // Compute accept key
@@ -1306,18 +1598,19 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
                 }
             } else { // Dealing with a file.
                 if (strcasecmp(request->method, "GET") == 0) {
-                    FIL active_file;
-                    FRESULT result = f_open(fs, &active_file, path, FA_READ);
+                    FILINFO file_info;
+                    FRESULT result = f_stat(fs, path, &file_info);
+                    if (result == FR_OK) {
+                        result = f_open(fs, &request->file, path, FA_READ);
+                    }
 
                     if (result != FR_OK) {
                         _reply_missing(socket, request);
                     } else {
-                        _reply_with_file(socket, request, path, &active_file);
+                        _reply_with_file(socket, request, path, &file_info);
                     }
-
-                    f_close(&active_file);
                 } else if (strcasecmp(request->method, "PUT") == 0) {
-                    _write_file_and_reply(socket, request, fs_mount, path);
+                    _write_file_start(socket, request, fs_mount, path);
                     return true;
                 }
             }
@@ -1391,23 +1684,98 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
 }
 
 static void _reset_request(_request *request) {
+    if (request->sending_file) {
+        f_close(&request->file);
+        request->sending_file = false;
+    }
+    if (request->receiving_file) {
+        // The upload was cut short. Keep what arrived, as a failed write would.
+        override_fattime(request->fattime);
+        f_close(&request->file);
+        override_fattime(0);
+        filesystem_unlock(request->fs_mount);
+        request->receiving_file = false;
+    }
+    if (request->buffer != NULL) {
+        port_free(request->buffer);
+        request->buffer = NULL;
+    }
     request->state = STATE_METHOD;
     request->origin[0] = '\0';
     request->host[0] = '\0';
+    request->if_none_match[0] = '\0';
+    request->range[0] = '\0';
     request->content_length = 0;
     request->offset = 0;
     request->timestamp_ms = 0;
     request->redirect = false;
     request->done = false;
     request->in_progress = false;
-    request->new_socket = false;
     request->authenticated = false;
     request->expect = false;
     request->json = false;
     request->websocket = false;
+    // HTTP/1.1 connections are persistent unless the client says otherwise.
+    request->keep_alive = true;
+    request->body_read = false;
+    // Without Accept-Encoding any content coding is acceptable (RFC 9110 12.5.3).
+    request->accept_gzip = true;
+}
+
+static size_t _free_connections(void) {
+    size_t count = 0;
+    for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CONNECTIONS; i++) {
+        if (common_hal_socketpool_socket_get_closed(&connections[i].socket)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// Autoreload is suspended while any connection has a request in progress.
+static void _autoreload_resume_if_idle(void) {
+    for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CONNECTIONS; i++) {
+        if (connections[i].request.in_progress) {
+            return;
+        }
+    }
+    autoreload_resume(AUTORELOAD_SUSPEND_WEB);
+}
+
+static void _finish_request(socketpool_socket_obj_t *socket, _request *request, bool reload) {
+    // Keep the connection for another request only if the whole request was
+    // consumed and this doesn't take the last free slot.
+    bool keep_alive = request->keep_alive &&
+        (request->content_length == 0 || request->body_read) &&
+        common_hal_socketpool_socket_get_connected(socket) &&
+        _free_connections() > 0;
+    _reset_request(request);
+    if (keep_alive) {
+        request->idle_since_ms = supervisor_ticks_ms64();
+    } else {
+        common_hal_socketpool_socket_close(socket);
+    }
+    _autoreload_resume_if_idle();
+    if (reload) {
+        autoreload_trigger();
+    }
 }
 
 static void _process_request(socketpool_socket_obj_t *socket, _request *request) {
+    if (request->sending_file) {
+        _send_file_continue(socket, request);
+        if (!request->sending_file) {
+            _finish_request(socket, request, false);
+        }
+        return;
+    }
+    if (request->receiving_file) {
+        _write_file_continue(socket, request);
+        if (!request->receiving_file) {
+            _finish_request(socket, request, true);
+        }
+        return;
+    }
     bool more = true;
     bool error = false;
     uint8_t c;
@@ -1419,15 +1787,14 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
             more = false;
             if (len == 0 || len == -MP_ENOTCONN) {
                 // Disconnect - clear 'in-progress'
-                _reset_request(request);
-                common_hal_socketpool_socket_close(socket);
+                request->keep_alive = false;
+                _finish_request(socket, request, false);
             }
             break;
         }
         if (!request->in_progress) {
             autoreload_suspend(AUTORELOAD_SUSPEND_WEB);
             request->in_progress = true;
-            request->new_socket = false;
         }
         switch (request->state) {
             case STATE_METHOD: {
@@ -1524,6 +1891,16 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
                         strcpy(request->websocket_key, request->header_value);
                     } else if (strcasecmp(request->header_key, "X-Destination") == 0) {
                         strcpy(request->destination, request->header_value);
+                    } else if (strcasecmp(request->header_key, "If-None-Match") == 0) {
+                        strncpy(request->if_none_match, request->header_value, sizeof(request->if_none_match) - 1);
+                        request->if_none_match[sizeof(request->if_none_match) - 1] = '\0';
+                    } else if (strcasecmp(request->header_key, "Connection") == 0) {
+                        request->keep_alive = strcasecmp(request->header_value, "close") != 0;
+                    } else if (strcasecmp(request->header_key, "Accept-Encoding") == 0) {
+                        request->accept_gzip = _accepts_coding(request->header_value, "gzip");
+                    } else if (strcasecmp(request->header_key, "Range") == 0) {
+                        strncpy(request->range, request->header_value, sizeof(request->range) - 1);
+                        request->range[sizeof(request->range) - 1] = '\0';
                     }
                 } else if (request->offset > sizeof(request->header_value) - 1) {
                     // Skip methods that are too long.
@@ -1545,60 +1922,87 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
         int nodelay = 1;
         common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
         socketpool_socket_send(socket, (const uint8_t *)error_response, strlen(error_response));
+        request->keep_alive = false;
         request->done = true;
     }
     if (!request->done) {
         return;
     }
     bool reload = _reply(socket, request);
-    _reset_request(request);
-    common_hal_socketpool_socket_close(socket);
-    autoreload_resume(AUTORELOAD_SUSPEND_WEB);
-    if (reload) {
-        autoreload_trigger();
+    if (request->sending_file || request->receiving_file) {
+        // The rest of the body is moved from the background task as the socket
+        // allows, so that a large transfer doesn't stall other connections.
+        return;
     }
+    _finish_request(socket, request, reload);
 }
 
 
 void supervisor_web_workflow_background(void *data) {
-    while (true) {
-        // If we have a request in progress, continue working on it. Do this first
-        // so that we can accept another socket after finishing this request.
-        if (common_hal_socketpool_socket_get_connected(&active)) {
-            _process_request(&active, &active_request);
-            if (active_request.in_progress) {
-                break;
+    bool transferring = false;
+    // Give each connection a turn, starting one further along each time so that
+    // a busy client can't starve the others.
+    for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CONNECTIONS; i++) {
+        _connection *connection = &connections[(next_connection + i) % CIRCUITPY_WEB_WORKFLOW_CONNECTIONS];
+        socketpool_socket_obj_t *socket = &connection->socket;
+        _request *request = &connection->request;
+        if (common_hal_socketpool_socket_get_connected(socket)) {
+            _process_request(socket, request);
+            if (request->sending_file || request->receiving_file) {
+                transferring = true;
+            } else if (!request->in_progress &&
+                       supervisor_ticks_ms64() - request->idle_since_ms > KEEP_ALIVE_TIMEOUT_MS) {
+                common_hal_socketpool_socket_close(socket);
             }
         } else {
-            // Close the active socket if necessary
-            if (!common_hal_socketpool_socket_get_closed(&active)) {
-                common_hal_socketpool_socket_close(&active);
+            if (request->in_progress) {
+                // The client went away part way through a request.
+                request->keep_alive = false;
+                _finish_request(socket, request, false);
             }
-        }
-        // Otherwise, see if we have another socket to accept.
-        if ((!common_hal_socketpool_socket_get_connected(&active) ||
-             (!active_request.in_progress && !active_request.new_socket)) &&
-            !common_hal_socketpool_socket_get_closed(&listening)) {
-            uint32_t ip;
-            uint32_t port;
-            if (!common_hal_socketpool_socket_get_closed(&active)) {
-                common_hal_socketpool_socket_close(&active);
+            // Close the socket if necessary
+            if (!common_hal_socketpool_socket_get_closed(socket)) {
+                common_hal_socketpool_socket_close(socket);
             }
-            int newsoc = socketpool_socket_accept(&listening, (uint8_t *)&ip, &port, &active);
-            if (newsoc == -EBADF) {
-                common_hal_socketpool_socket_close(&listening);
+        }
+    }
+    next_connection = (next_connection + 1) % CIRCUITPY_WEB_WORKFLOW_CONNECTIONS;
+
+    // Accept new sockets into any free slots.
+    while (!common_hal_socketpool_socket_get_closed(&listening)) {
+        _connection *connection = NULL;
+        for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CONNECTIONS; i++) {
+            if (common_hal_socketpool_socket_get_closed(&connections[i].socket)) {
+                connection = &connections[i];
                 break;
             }
-            if (newsoc > 0) {
-                common_hal_socketpool_socket_settimeout(&active, 0);
-                _reset_request(&active_request);
-                // Mark new sockets, otherwise we may accept another before the first
-                // could start its request.
-                active_request.new_socket = true;
-                continue;
-            }
+        }
+        if (connection == NULL) {
+            break;
+        }
+        uint32_t ip;
+        uint32_t port;
+        int newsoc = socketpool_socket_accept(&listening, (uint8_t *)&ip, &port, &connection->socket);
+        if (newsoc == -EBADF) {
+            common_hal_socketpool_socket_close(&listening);
+            break;
+        }
+        if (newsoc <= 0) {
             break;
         }
+        common_hal_socketpool_socket_settimeout(&connection->socket, 0);
+        _reset_request(&connection->request);
+        connection->request.idle_since_ms = supervisor_ticks_ms64();
+        _process_request(&connection->socket, &connection->request);
+        if (connection->request.sending_file || connection->request.receiving_file) {
+            transferring = true;
+        }
+    }
+
+    if (transferring) {
+        // Nothing wakes us up when a socket can take or has more data for a
+        // transfer in progress, so ask to be run again.
+        supervisor_workflow_request_background();
     }
 
     // Let the websocket code run.
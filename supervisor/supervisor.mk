@@ -188,10 +188,17 @@ endif
 
 STATIC_RESOURCES = $(wildcard $(TOP)/supervisor/shared/web_workflow/static/*)
 
+ifeq ($(CIRCUITPY_WEB_WORKFLOW_STATIC_GZIP),1)
+  STATIC_RESOURCES_FLAGS = --gzip
+else
+  STATIC_RESOURCES_FLAGS = --no-gzip
+endif
+
 $(BUILD)/autogen_web_workflow_static.c: ../../tools/gen_web_workflow_static.py $(STATIC_RESOURCES) | $(HEADER_BUILD)
 	$(STEPECHO) "GEN $@"
 	$(Q)$(PYTHON) $< \
 		--output_c_file $@ \
+		$(STATIC_RESOURCES_FLAGS) \
 		$(STATIC_RESOURCES)
 
 ifeq ($(CIRCUITPY_WEB_WORKFLOW),1)
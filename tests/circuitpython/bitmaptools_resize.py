@@ -0,0 +1,78 @@
+import array
+import displayio
+import bitmaptools
+
+Colorspace = displayio.Colorspace
+
+
+def dump(bmp):
+    for y in range(bmp.height):
+        print(" ".join("%04x" % bmp[x, y] for x in range(bmp.width)))
+
+
+# An 8x4 L8 ramp
+src = displayio.Bitmap(8, 4, 256)
+for y in range(4):
+    for x in range(8):
+        src[x, y] = x * 32 + y * 8
+
+for algorithm in (bitmaptools.ResizeAlgorithm.Area, bitmaptools.ResizeAlgorithm.Bilinear):
+    print(algorithm)
+    for w, h in ((3, 2), (8, 4), (11, 5)):
+        dest = displayio.Bitmap(w, h, 256)
+        bitmaptools.resize(dest, src, Colorspace.L8, algorithm)
+        dump(dest)
+
+# RGB565 from a buffer, byte swapped
+pixels = array.array("H", [0xF800, 0x07E0, 0x001F, 0xFFFF, 0x0000, 0x8410])
+swapped = array.array("H", [((p & 0xFF) << 8) | (p >> 8) for p in pixels])
+dest = displayio.Bitmap(2, 1, 65536)
+bitmaptools.resize(dest, memoryview(swapped), Colorspace.RGB565_SWAPPED, source_width=3)
+dump(dest)
+bitmaptools.resize(dest, pixels, Colorspace.RGB565, bitmaptools.ResizeAlgorithm.Bilinear, source_width=3)
+dump(dest)
+
+# YUV422: white, black, then a red and a blue pair
+yuv = bytes([255, 128, 0, 128, 76, 85, 76, 255, 29, 255, 29, 107])
+rgb = displayio.Bitmap(6, 1, 65536)
+for colorspace in (Colorspace.RGB565, Colorspace.BGR565_SWAPPED):
+    bitmaptools.yuv422_to_rgb565(rgb, yuv, colorspace)
+    dump(rgb)
+
+# Back to luminance and to a palette
+bitmaptools.yuv422_to_rgb565(rgb, yuv, Colorspace.RGB565)
+l8 = displayio.Bitmap(6, 1, 256)
+bitmaptools.rgb565_to_l8(l8, rgb, Colorspace.RGB565)
+dump(l8)
+
+palette = displayio.Palette(4)
+palette[0] = 0x000000
+palette[1] = 0xFFFFFF
+palette[2] = 0xFF0000
+palette[3] = 0x0000FF
+lookup = bitmaptools.palette_lookup(palette)
+print(len(lookup))
+indices = displayio.Bitmap(6, 1, 4)
+bitmaptools.rgb565_to_palette(indices, rgb, Colorspace.RGB565, lookup)
+dump(indices)
+
+try:
+    bitmaptools.rgb565_to_l8(l8, displayio.Bitmap(5, 1, 65536), Colorspace.RGB565)
+except ValueError as e:
+    print(f"Error: {e}")
+
+try:
+    bitmaptools.resize(l8, bytes(3), Colorspace.L8, source_width=4)
+except ValueError as e:
+    print(f"Error: {e}")
+
+try:
+    bitmaptools.resize(l8, src, Colorspace.RGB888)
+except ValueError as e:
+    print(f"Error: {e}")
+
+# 16-bit pixels are read a halfword at a time, so the buffer must be aligned
+try:
+    bitmaptools.rgb565_to_l8(l8, memoryview(bytearray(14))[1:], Colorspace.RGB565)
+except ValueError as e:
+    print(f"Error: {e}")
@@ -0,0 +1,88 @@
+# Play a multi-frame GIF with gifio.OnDiskGif, with and without the frame
+# cache, and check which part of the bitmap each frame marks for refresh.
+try:
+    import gifio
+    import displayio
+
+    bitmap_dirty_area
+except (ImportError, NameError):
+    print("SKIP")
+    raise SystemExit
+
+import os
+
+os.umount("/")
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+
+    def readblocks(self, block, buf, off=0):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        buf[:] = self.data[addr : addr + len(buf)]
+
+    def writeblocks(self, block, buf, off=None):
+        if off is None:
+            off = 0
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        self.data[addr : addr + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+        if op == 6:  # erase block
+            return 0
+
+
+bdev = RAMBlockDevice(256)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/")
+
+W, H = 32, 24
+
+# A background, then a box that moves, a frame with no change, and a box
+# that is cleared again.
+frame = bytearray((x * 6 + y * 9) & 0xFF for y in range(H) for x in range(W))
+frames = [bytes(frame)]
+for x0, y0 in ((2, 3), (12, 10)):
+    for y in range(y0, y0 + 6):
+        for x in range(x0, x0 + 8):
+            frame[y * W + x] = 0xFE
+    frames.append(bytes(frame))
+frames.append(bytes(frame))
+for y in range(20, 22):
+    for x in range(28, 30):
+        frame[y * W + x] = 0
+frames.append(bytes(frame))
+
+with gifio.GifWriter("/anim.gif", W, H, displayio.Colorspace.L8, delta=True) as g:
+    for i, f in enumerate(frames):
+        g.add_frame(f, (i + 1) / 100)
+
+
+def play(use_palette, cache_size):
+    # Two passes, so the second one can come from the cache.
+    result = []
+    with gifio.OnDiskGif("/anim.gif", use_palette=use_palette, cache_size=cache_size) as odg:
+        bitmap = odg.bitmap
+        bitmap_dirty_area(bitmap)
+        for i in range(2 * odg.frame_count):
+            delay = odg.next_frame()
+            result.append((delay, [bitmap[j] for j in range(W * H)], bitmap_dirty_area(bitmap)))
+    return result
+
+
+for use_palette in (True, False):
+    uncached = play(use_palette, 0)
+    if use_palette:
+        for i, (delay, pixels, area) in enumerate(uncached[: len(frames)]):
+            print(round(delay, 2), area, pixels == [p >> 1 for p in frames[i]])
+    print(uncached[: len(frames)] == uncached[len(frames) :])
+    # Enough for every frame, and too little so the cache is given up.
+    for cache_size in (16384, 300):
+        print(cache_size, play(use_palette, cache_size) == uncached)
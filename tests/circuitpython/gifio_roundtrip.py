@@ -0,0 +1,105 @@
+# Write GIFs with gifio.GifWriter and read them back with gifio.OnDiskGif.
+try:
+    import gifio
+    import displayio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+import gc
+import os
+
+os.umount("/")
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+
+    def readblocks(self, block, buf, off=0):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        buf[:] = self.data[addr : addr + len(buf)]
+
+    def writeblocks(self, block, buf, off=None):
+        if off is None:
+            off = 0
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        self.data[addr : addr + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+        if op == 6:  # erase block
+            return 0
+
+
+bdev = RAMBlockDevice(256)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/")
+
+W, H = 40, 30
+
+
+def l8_index(pixel):
+    return pixel >> 1
+
+
+def rgb565_index(pixel):
+    return (pixel >> 14 & 0x3) << 5 | (pixel >> 8 & 0x7) << 2 | (pixel >> 3 & 0x3)
+
+
+def frames(colorspace):
+    # A gradient, then a box with a hole of unchanged pixels, then no change.
+    if colorspace == displayio.Colorspace.L8:
+        first = bytearray((x * 6 + y * 8) & 0xFF for y in range(H) for x in range(W))
+        second = bytearray(first)
+        view = second
+        color = 0xFE
+    else:
+        first = bytearray(2 * W * H)
+        view = memoryview(first).cast("H")
+        for i in range(W * H):
+            view[i] = (i * 2731) & 0xFFFF
+        second = bytearray(first)
+        view = memoryview(second).cast("H")
+        color = 0xF81F
+    for y in range(5, 20):
+        for x in range(10, 30):
+            if not (12 <= y < 15 and 20 <= x < 25):
+                view[y * W + x] = color
+    return first, second, second
+
+
+def indices(colorspace, frame):
+    if colorspace == displayio.Colorspace.L8:
+        return [l8_index(p) for p in frame]
+    return [rgb565_index(p) for p in memoryview(frame).cast("H")]
+
+
+for colorspace in (displayio.Colorspace.L8, displayio.Colorspace.RGB565):
+    sizes = []
+    for delta in (False, True):
+        with gifio.GifWriter("/t.gif", W, H, colorspace, loop=False, delta=delta) as g:
+            for frame in frames(colorspace):
+                g.add_frame(frame, 0.25)
+        sizes.append(os.stat("/t.gif")[6])
+        with gifio.OnDiskGif("/t.gif", use_palette=True) as odg:
+            print(odg.frame_count, odg.width, odg.height)
+            for frame in frames(colorspace):
+                delay = odg.next_frame()
+                bitmap = odg.bitmap
+                expected = indices(colorspace, frame)
+                print(delay, all(bitmap[i] == expected[i] for i in range(W * H)))
+    print(sizes[1] < sizes[0])
+
+# Closing the writer gives back its buffers, even while the object is alive.
+gc.collect()
+g = gifio.GifWriter("/t.gif", W, H, displayio.Colorspace.L8, delta=True)
+g.add_frame(frames(displayio.Colorspace.L8)[0])
+before = gc.mem_alloc()
+g.deinit()
+print(before - gc.mem_alloc() > 5003 * 4 + W * H)
@@ -1,5 +1,7 @@
+import gc
 import io
 
+import displayio
 from displayio import Bitmap
 import binascii
 import jpegio
@@ -130,3 +132,186 @@ test(content, scale=3, x=12, y=16, x1=8, y1=12, x2=16, y2=16)
 
 print("color key")
 test(content, scale=0, skip_source_index=0x4529, fill=0)
+
+print("crop at full scale")
+test(content, scale=0, x1=100, y1=90, x2=140, y2=120)
+test(content, scale=1, x=3, y=5, x1=33, y1=17, x2=90, y2=60)
+
+
+def luma(v):
+    v = ((v & 0xFF) << 8) | (v >> 8)
+    r = (v >> 8) & 0xF8
+    g = (v >> 3) & 0xFC
+    b = (v << 3) & 0xF8
+    r |= r >> 5
+    g |= g >> 6
+    b |= b >> 5
+    return (r * 77 + g * 150 + b * 29) >> 8
+
+
+print("greyscale")
+w, h = decoder.open(content)
+w >>= 2
+h >>= 2
+full = Bitmap(w, h, 65536)
+decoder.decode(full, scale=2)
+grey = Bitmap(w, h, 256)
+decoder.open(content)
+decoder.decode(grey, scale=2)
+print(all(grey[i] == luma(full[i]) for i in range(w * h)))
+
+for dither in (False, True):
+    mono = Bitmap(w, h, 2)
+    decoder.open(content)
+    decoder.decode(mono, scale=2, dither=dither)
+    print(f"{dither=}", sum(mono[i] for i in range(w * h)))
+dump = Bitmap(w, h, 65536)
+for i in range(w * h):
+    dump[i] = 0xFFFF if mono[i] else 0
+dump_bitmap(dump)
+
+print("palette")
+palette = displayio.Palette(4)
+palette[0] = 0x000000
+palette[1] = 0xFFFFFF
+palette[2] = 0x00FF00
+palette[3] = 0x808080
+palette.make_transparent(2)
+indexed = Bitmap(w, h, 4)
+decoder.open(content)
+decoder.decode(indexed, scale=2, palette=palette)
+print(sorted(set(indexed[i] for i in range(w * h))))
+
+
+base_content = binascii.a2b_base64(
+    b"""
+/9j/4AAQSkZJRgABAQAAAQABAAD/2wBDABALDA4MChAODQ4SERATGCgaGBYWGDEjJR0oOjM9PDkz
+ODdASFxOQERXRTc4UG1RV19iZ2hnPk1xeXBkeFxlZ2P/2wBDARESEhgVGC8aGi9jQjhCY2NjY2Nj
+Y2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2P/wAARCABQAGADASIA
+AhEBAxEB/8QAHwAAAQUBAQEBAQEAAAAAAAAAAAECAwQFBgcICQoL/8QAtRAAAgEDAwIEAwUFBAQA
+AAF9AQIDAAQRBRIhMUEGE1FhByJxFDKBkaEII0KxwRVS0fAkM2JyggkKFhcYGRolJicoKSo0NTY3
+ODk6Q0RFRkdISUpTVFVWV1hZWmNkZWZnaGlqc3R1dnd4eXqDhIWGh4iJipKTlJWWl5iZmqKjpKWm
+p6ipqrKztLW2t7i5usLDxMXGx8jJytLT1NXW19jZ2uHi4+Tl5ufo6erx8vP09fb3+Pn6/8QAHwEA
+AwEBAQEBAQEBAQAAAAAAAAECAwQFBgcICQoL/8QAtREAAgECBAQDBAcFBAQAAQJ3AAECAxEEBSEx
+BhJBUQdhcRMiMoEIFEKRobHBCSMzUvAVYnLRChYkNOEl8RcYGRomJygpKjU2Nzg5OkNERUZHSElK
+U1RVVldYWVpjZGVmZ2hpanN0dXZ3eHl6goOEhYaHiImKkpOUlZaXmJmaoqOkpaanqKmqsrO0tba3
+uLm6wsPExcbHyMnK0tPU1dbX2Nna4uPk5ebn6Onq8vP09fb3+Pn6/9oADAMBAAIRAxEAPwDk6t26
+xyLtb71VKKcZWY1Kxfa1XduqxVGGSZl+X5qmWaT/AJ510xkkbLa7LFFQ+ZJ/zzpy+Y33vlrS9wT1
+JG+b73zUU1V206nYcUooKKKKdkMKbJ/q2p1R3DbYWqZ7CexmUqrubbSVZsI90nmN91a4jKnHmkSX
+DeTGsMf/AAKqe5v7zU6ZvMkZqZRccpXZKtxIv8VSLdSfxVWop8z6EXNGG4WT/eqasuNtrK1ai/dr
+opTctzWLuFFFFbFBVe9bbDViqd+3zKtTN+6KRUqf7Qyw+Wv8VQUVwmMZOL0CiiigS2CiiigBY13M
+tay/dqjZR7pN392r1dNJWVzaEXa7CiiitkUFZtw26ZqvTNtjZqzKwrS6GcpBRRRXOZhRRRQAUUVb
+06FZrhd33VotccYtvQ0bCHy4V/vNSTfeq+qw1Xv1j3Lt+9XbCNkd1SvHlUEipRRRVbGGyKd7J91a
+qU+ZvMkZqZXFN3kzBu4UUUVIgooooAK2dOh8uHd/E1Z9hbtcXCr/AHa3PKZf4a1hG+p34L2alzTd
+hjNtWqlW7qNlj3VUrpimtx16yrSurNeQVDdSbY6mqjeybpNv92pqP3Tmk7FaiiiuMwP/2Q=="""
+)
+
+progressive_content = binascii.a2b_base64(
+    b"""
+/9j/4AAQSkZJRgABAQAAAQABAAD/2wBDABALDA4MChAODQ4SERATGCgaGBYWGDEjJR0oOjM9PDkz
+ODdASFxOQERXRTc4UG1RV19iZ2hnPk1xeXBkeFxlZ2P/2wBDARESEhgVGC8aGi9jQjhCY2NjY2Nj
+Y2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2P/wgARCABQAGADASIA
+AhEBAxEB/8QAGQABAAMBAQAAAAAAAAAAAAAAAAEDBAIF/8QAGAEAAwEBAAAAAAAAAAAAAAAAAAID
+AQT/3QAEAAT/2gAMAwEAAhADEAAAAfJtqBfZR3V7HEsdIk3/0Mg6KInnDMWQTqmYN//R8vqtpo7y
+6qOD6rspzP/S8nvgAAANdF9H/9PIL0Zr8yKE1AP/1PJLQ0xortekalNUxGf/1fJAADZn3NeKbqa7
+/9bJx3RZ6xFP/8QAHRAAAgICAwEAAAAAAAAAAAAAAAECEBEhEiAxA//aAAgBAQABBQIjhnGv/9Dp
+/9G35//SpNmWf//Tyzd//9S5ef/VqWkf/9bkzkxSzX//17n5/9AgtvbP/9GlX//SuZ//0zlqv//U
+pV//1bl7/9bp/9eoLZ//0Kfh/9Hp/9KoLCZ//9Opuv/U6f/VPmsy0Twf/9antn//1+n/0D5rCr//
+0ST1X//S6f/ThHlLBJaP/9Qm91//xAAbEQACAwEBAQAAAAAAAAAAAAAAAQIQERIDIf/aAAgBAwEB
+PwHbXw//0KitY2f/0RUz/9JPLSP/0xu//9RIlNZl/wD/1a8ed1k59s//1nX/xAAZEQADAQEBAAAA
+AAAAAAAAAAAAARACMRH/2gAIAQIBAT8BTE7/AP/QHf/R9Mv2Ph//0rk//9M27//UEo+n/9WJCP/W
+1yf/xAAZEAEAAwEBAAAAAAAAAAAAAAAgABARMQH/2gAIAQEABj8CH//QH//RH//Svk//0+D/1B//
+1azyv//WH//XH//Qm3//0R//0h//05l//9Qf/9Uf/9Yf/9cf/9Af/9Ef/9If/9Mf/9Qf/9Uf/9Yf
+/9cf/9Af/9Ef/9If/9Mf/9Qf/8QAHhAAAgICAwEBAAAAAAAAAAAAAAEQESExIEFRcYH/2gAIAQEA
+AT8hERT2NbuP/9CHneY//9Gdh//Sh1YyIn//0wK28CVR/9SWpz//1RK3Q1X7Fv1n/9ZI7F3CvqP/
+15aj/9Aus0h7HH//0YammLR//9KXykf/0yyq7n//1IS2haP/1Za3P//W4f/Xiy3kf//Qh6Zx/9Hh
+/9KK31m5/9ONCj//1OH/1RKr0hIrZVs//9aHscf/1+H/0DK9sbpR/9Eql//S4f/TcheFl0OVo//U
+LKeT/9oADAMBAAIAAwAAABBP337/0PfF+v/Rx889/9JEAD7/0/uAAP/UFT+p/9UAB9T/1vQP/8QA
+GxEAAwADAQEAAAAAAAAAAAAAAAERECExIGH/2gAIAQMBAT8QUC5WJ7ESH//QHzAUZ//Ro1y//9Jj
+aFzDpWf/0/B//9RjeiIqOIbp/9XEqYKoo18P/9Zpj//EABoRAAMBAQEBAAAAAAAAAAAAAAABERAx
+QSH/2gAIAQIBAT8QgxCLSH//0IjnKf/Rrwf1jj//0tWKn//TR4b/AP/UlJI4PWP/1ct9Ea6f/9Zs
+f//EABQQAQAAAAAAAAAAAAAAAAAAACD/2gAIAQEAAT8QAAD/0AH/0QP/0gAD/9MAA//UAP/VAAAP
+/9YAAH//1xH/0BAAf//RAB//0hD/0wA//9QAP//VAP/WH//XEH//0AB//9Ef/9IQD//TEf/UH//V
+EAED/9YAf//XH//QEAP/0QH/0h//0xAQB//UEH//2Q=="""
+)
+
+restart_content = binascii.a2b_base64(
+    b"""
+/9j/4AAQSkZJRgABAQAAAQABAAD/2wBDABALDA4MChAODQ4SERATGCgaGBYWGDEjJR0oOjM9PDkz
+ODdASFxOQERXRTc4UG1RV19iZ2hnPk1xeXBkeFxlZ2P/2wBDARESEhgVGC8aGi9jQjhCY2NjY2Nj
+Y2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2NjY2P/wAARCABQAGADASIA
+AhEBAxEB/8QAHwAAAQUBAQEBAQEAAAAAAAAAAAECAwQFBgcICQoL/8QAtRAAAgEDAwIEAwUFBAQA
+AAF9AQIDAAQRBRIhMUEGE1FhByJxFDKBkaEII0KxwRVS0fAkM2JyggkKFhcYGRolJicoKSo0NTY3
+ODk6Q0RFRkdISUpTVFVWV1hZWmNkZWZnaGlqc3R1dnd4eXqDhIWGh4iJipKTlJWWl5iZmqKjpKWm
+p6ipqrKztLW2t7i5usLDxMXGx8jJytLT1NXW19jZ2uHi4+Tl5ufo6erx8vP09fb3+Pn6/8QAHwEA
+AwEBAQEBAQEBAQAAAAAAAAECAwQFBgcICQoL/8QAtREAAgECBAQDBAcFBAQAAQJ3AAECAxEEBSEx
+BhJBUQdhcRMiMoEIFEKRobHBCSMzUvAVYnLRChYkNOEl8RcYGRomJygpKjU2Nzg5OkNERUZHSElK
+U1RVVldYWVpjZGVmZ2hpanN0dXZ3eHl6goOEhYaHiImKkpOUlZaXmJmaoqOkpaanqKmqsrO0tba3
+uLm6wsPExcbHyMnK0tPU1dbX2Nna4uPk5ebn6Onq8vP09fb3+Pn6/90ABAAG/9oADAMBAAIRAxEA
+PwDk6t26xyLtb71VKKcZWY1Kxfa1XduqxVGGSZl+X5qmWaT/AJ510xkkbLa7LFFQ+ZJ/zzpy+Y33
+vlrS9wT1JG+b73zUU1V206nYcUooKKKKdkMKbJ/q2p1R3DbYWqZ7Cex//9Dk6VV3NtpKs2Ee6TzG
++6tMunHmkSXDeTGsMf8AwKqe5v7zU6ZvMkZqZRccpXZKtxIv8VSLdSfxVWop8z6EXNGG4WT/AHqm
+rLjbaytWov3a6KU3Lc1i7hRRRWxQVXvW2w1Yqnft8yrUzfuikf/R5Op/tDLD5a/xVBRQOMnF6BRR
+RQJbBRRRQAsa7mWtZfu1Rso90m7+7V6umkrK5tCLtdhRRRWyKCs24bdM1Xpm2xs1ZlYVpdDOUj//
+0uTooooAKKKKACiirenQrNcLu+6tFrjjFt6GjYQ+XCv95qSb71X1WGq9+se5dv3q7YRsjuqV48qg
+kVKKKKrYw2RTvZPurVSnzN5kjNTK4pu8mYN3P//T5OiiigAooooAK2dOh8uHd/E1Z9hbtcXCr/dr
+c8pl/hrWEb6nfgvZqXNN2GM21aqVbuo2WPdVSumKa3HXrKtK6s15BUN1JtjqaqN7Juk2/wB2pqP3
+Tmk7FaiiiuMwP//Z"""
+)
+
+
+def decode_all(jpeg_input, scale):
+    w, h = decoder.open(jpeg_input)
+    b = Bitmap(w >> scale, h >> scale, 65536)
+    b.fill(0x1234)
+    decoder.decode(b, scale=scale)
+    return b
+
+
+def max_diff(a, b):
+    # largest difference of a color channel, in 5-bit steps
+    result = 0
+    for i in range(a.width * a.height):
+        u = ((a[i] & 0xFF) << 8) | (a[i] >> 8)
+        v = ((b[i] & 0xFF) << 8) | (b[i] >> 8)
+        for shift, mask, div in ((11, 0x1F, 1), (5, 0x3F, 2), (0, 0x1F, 1)):
+            result = max(result, abs(((u >> shift) & mask) - ((v >> shift) & mask)) // div)
+    return result
+
+
+print("progressive")
+for scale in range(4):
+    print(scale, max_diff(decode_all(base_content, scale), decode_all(progressive_content, scale)))
+test(progressive_content, scale=0, x1=20, y1=30, x2=50, y2=50)
+test(progressive_content, scale=1, x=3, y=5, x1=10, y1=8, x2=40, y2=30)
+test(progressive_content, scale=3, x1=4, y1=2)
+partial = decode_all(progressive_content[:700], 2)
+print(all(partial[i] != 0x1234 for i in range(partial.width * partial.height)))
+
+print("restart markers")
+print(memoryview(decode_all(base_content, 0)) == memoryview(decode_all(restart_content, 0)))
+test(restart_content, scale=0, x1=20, y1=30, x2=50, y2=50)
+test(restart_content, scale=0, x1=64, y1=64)
+test(restart_content, scale=2, x=1, y=1, x1=2, y1=4, x2=20, y2=12)
+try:
+    decoder.open(5)
+except TypeError as e:
+    print(e)
+
+print("reader raises during a progressive decode")
+
+
+class FailingAdapter(IOAdapter):
+    def readinto(self, buf):
+        if self._pos > 700:
+            raise OSError(5)
+        return super().readinto(buf)
+
+
+reference = decode_all(progressive_content, 1)
+try:
+    decode_all(FailingAdapter(progressive_content), 1)
+except OSError as e:
+    print("OSError", e.errno)
+gc.collect()
+print(memoryview(decode_all(progressive_content, 1)) == memoryview(reference))
@@ -0,0 +1,110 @@
+import io
+
+import binascii
+import displayio
+from displayio import Bitmap
+import pngio
+
+# 9x7 RGBA, interlaced, with the data split over several IDAT chunks
+rgba_content = binascii.a2b_base64(
+    b"""
+iVBORw0KGgoAAAANSUhEUgAAAAkAAAAHCAYAAAGtnFf2AAAADXRFWHRDb21tZW50AGhlbGxv5v+u
+JAAAAChJREFUeNpjZDDNYtDQ0GBgmXLyHwNLzsJrDCwsLGDM6FW/5f+UKVMYmJYsWTN7PVsAAAAo
+SURBVMIgIiLCwLLttcL/tLQ0RiCG08zHH9U0LFy4sHHvXtuGyJs3G7+WljbDRz/yAAAAKElEQVSw
+qEb1//fy8mKAYYaXcsH//Vt2/t/6Sv6/dEDrf5YjR44wPGhyY/jzYXrvbQAAAChJREFU5w+DhIQE
+A0Phstv/+V0q/699JP7fu2Hrf+boCUf/R5X0NxR0LW1oW1O8+fcAAAAoSURBVGDdOMcs8L+RT3qD
+R1JtQ1zF5MaSvpX/mbZt28YANIrx0qVLDA8ePPgb7JAnAAAAKElEQVT/7t07kJGMXFxcIGP/q6mp
+Ad0NVOTh8e8/Dw8Pg5TUA0aNdxr/gYr+tnM9DwAAAAxJREFUQxUxAhX9BwBpBXNFFZGboAAAAABJ
+RU5ErkJggg==
+"""
+)
+
+# 9x7 indexed, 2 bits per pixel, with a transparent color
+indexed_content = binascii.a2b_base64(
+    b"""
+iVBORw0KGgoAAAANSUhEUgAAAAkAAAAHAgMAAACn9Y/zAAAADXRFWHRDb21tZW50AGhlbGxv5v+u
+JAAAAAxQTFRF/wAAAP8AAAD/////+wBg9gAAAAN0Uk5T//8A18oNQQAAACNJREFUeNpjlGZ4yjRt
+WgODtDQD8xJvDebDWzczbmQ4D+IDAHGkB+WWrn5LAAAAAElFTkSuQmCC
+"""
+)
+
+# 9x7 greyscale, 16 bits per pixel
+grey_content = binascii.a2b_base64(
+    b"""
+iVBORw0KGgoAAAANSUhEUgAAAAkAAAAHEAAAAACvYOT/AAAADXRFWHRDb21tZW50AGhlbGxv5v+u
+JAAAAHVJREFUeNpjYWBQRQMM0dHt7Zs337/PzW1unpzc3797N3Nnp7e3n9+lS6GhkZExMQkJjx8z
+RUcnJWVmFhSUl9fVtbb29EyezJCTs3btu3f6+gUFGzd++mRsXFLCcPw4P394+Pz5z5/r65eX79/P
+zs6opOSPBgCiMzNTnK6inwAAAABJRU5ErkJggg==
+"""
+)
+
+decoder = pngio.PngDecoder()
+
+
+def dump_bitmap(b):
+    for i in range(b.height):
+        print(" ".join("%04x" % b[j, i] for j in range(b.width)))
+    print()
+
+
+def test(content, bits_per_value=16, fill=0xFFFF, **kwargs):
+    print(decoder.open(content))
+    b = Bitmap(9, 7, 1 << bits_per_value)
+    b.fill(fill)
+    decoder.decode(b, **kwargs)
+    dump_bitmap(b)
+    return b
+
+
+print("RGBA")
+full = test(rgba_content)
+print("BytesIO")
+test(io.BytesIO(rgba_content))
+
+print("crop & move")
+b = test(rgba_content, x=2, y=1, x1=1, y1=2, x2=5, y2=6)
+print(
+    all(
+        b[x + 1, y - 1] == full[x, y] or full[x, y] == 0xFFFF
+        for x in range(1, 5)
+        for y in range(2, 6)
+    )
+)
+
+print("color key")
+test(rgba_content, skip_source_index=full[1, 0], skip_dest_index=0)
+
+print("indexed")
+test(indexed_content)
+palette = displayio.Palette(4)
+test(indexed_content, bits_per_value=2, fill=0, palette=palette)
+print([hex(palette[i]) for i in range(4)], [palette.is_transparent(i) for i in range(4)])
+try:
+    test(indexed_content, bits_per_value=1, fill=0)
+except ValueError as e:
+    print(e)
+
+print("greyscale")
+test(grey_content)
+palette = displayio.Palette(4)
+test(grey_content, bits_per_value=2, fill=0, palette=palette)
+print([hex(palette[i]) for i in range(4)])
+
+print("errors")
+try:
+    decoder.decode(Bitmap(9, 7, 65536))
+except RuntimeError as e:
+    print(e)
+try:
+    decoder.open(grey_content[:20])
+except ValueError as e:
+    print(e)
+decoder.open(grey_content[:120])
+try:
+    decoder.decode(Bitmap(9, 7, 65536))
+except ValueError as e:
+    print(e)
+try:
+    decoder.open(5)
+except TypeError as e:
+    print(e)
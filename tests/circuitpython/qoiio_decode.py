@@ -0,0 +1,75 @@
+import io
+
+import binascii
+from displayio import Bitmap
+import qoiio
+
+# 9x7 RGBA
+content = binascii.a2b_base64(
+    b"""
+cW9pZgAAAAkAAAAHBAD/ADVqAP8lWo///kp/tP5vpNn/lMn+AP+57iP//t4TSP4DOG3/KF2SAP9b
+kMX//oe88f6z6B3/3xRJAP8LQHX//jdsof5jmM3/j8T5AP+78CX/m4j+6R5T/xxRhgD/T4S5//6C
+t+z+teof/+gdUgD/G1CF//5Og7j+EUZ7/0uAtQD/hbrv//6/9Cn++S5j/zNonQD/baLX//6n3BH+
+4RZL/2yh1gD/reIX//7uI1j+L2SZ/3Cl2gD/seYb//7yJ1z+M2id/3Sp3gD/x/wx//4PRHn+V4zB
+/5/UCQD/5xxR/yX+d6zh/7/0KQD/Bzxx/7uI/nGm2//A9SoABf5ek8gH//wxZgD/S4C1//6azwQA
+AAAAAAAAAQ==
+"""
+)
+
+decoder = qoiio.QoiDecoder()
+
+
+def dump_bitmap(b):
+    for i in range(b.height):
+        print(" ".join("%04x" % b[j, i] for j in range(b.width)))
+    print()
+
+
+def test(content, bits_per_value=16, fill=0xFFFF, **kwargs):
+    print(decoder.open(content))
+    b = Bitmap(9, 7, 1 << bits_per_value)
+    b.fill(fill)
+    decoder.decode(b, **kwargs)
+    dump_bitmap(b)
+    return b
+
+
+print("bytes")
+full = test(content)
+print("BytesIO")
+test(io.BytesIO(content))
+
+print("crop & move")
+b = test(content, x=2, y=1, x1=1, y1=2, x2=5, y2=6)
+print(
+    all(
+        b[x + 1, y - 1] == full[x, y] or full[x, y] == 0xFFFF
+        for x in range(1, 5)
+        for y in range(2, 6)
+    )
+)
+
+print("color key")
+test(content, skip_source_index=full[1, 0], skip_dest_index=0)
+
+print("greyscale")
+test(content, bits_per_value=2, fill=0)
+
+print("errors")
+try:
+    decoder.decode(Bitmap(9, 7, 65536))
+except RuntimeError as e:
+    print(e)
+try:
+    decoder.open(b"qoif" + bytes(10))
+except ValueError as e:
+    print(e)
+decoder.open(content[:100])
+try:
+    decoder.decode(Bitmap(9, 7, 65536))
+except ValueError as e:
+    print(e)
+try:
+    decoder.open(5)
+except TypeError as e:
+    print(e)
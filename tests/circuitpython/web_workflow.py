@@ -0,0 +1,148 @@
+# Test the web workflow's handling of requests and connections against
+# simulated clients. Needs the unix coverage build.
+try:
+    sim = web_workflow_sim
+except NameError:
+    print("SKIP")
+    raise SystemExit
+
+import os
+
+os.umount("/")
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+
+    def readblocks(self, block, buf, off=0):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        buf[:] = self.data[addr : addr + len(buf)]
+
+    def writeblocks(self, block, buf, off=None):
+        if off is None:
+            off = 0
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        self.data[addr : addr + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+        if op == 6:  # erase block
+            return 0
+
+
+bdev = RAMBlockDevice(128)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/")
+
+with open("/settings.toml", "w") as f:
+    f.write('CIRCUITPY_WIFI_SSID = "sim"\nCIRCUITPY_WEB_API_PASSWORD = "pw"\n')
+
+data = bytes(i * 7 & 0xFF for i in range(10000))
+with open("/data.bin", "wb") as f:
+    f.write(data)
+
+AUTH = "Authorization: Basic OnB3\r\n"  # ":pw"
+
+
+def request(method, path, headers="", body=b""):
+    return bytes("{} {} HTTP/1.1\r\n{}\r\n".format(method, path, headers), "ascii") + body
+
+
+def status(response):
+    return str(response[: response.index(b"\r\n")], "ascii")
+
+
+def body(response):
+    return response[response.index(b"\r\n\r\n") + 4 :]
+
+
+def get(path, headers=""):
+    c = sim.connect()
+    sim.send(c, request("GET", path, headers))
+    sim.background()
+    return c, sim.recv(c)
+
+
+print(sim.start())
+
+# A connection stays open for further requests.
+a, response = get("/missing")
+print(status(response), sim.is_open(a))
+sim.send(a, request("GET", "/missing"))
+sim.background()
+print(status(sim.recv(a)), sim.is_open(a), sim.busy())
+
+# Unless the client asks for it to be closed.
+c, response = get("/missing", "Connection: close\r\n")
+print(status(response), sim.is_open(c))
+
+# The last free connection slot isn't used for keep-alive.
+b, response = get("/missing")
+print(status(response), sim.is_open(b))
+c, response = get("/missing")
+print(status(response), sim.is_open(a), sim.is_open(b), sim.is_open(c))
+
+# A request arriving in pieces holds off autoreload until it is answered.
+sim.send(a, b"GET /missing HT")
+sim.background()
+print(sim.recv(a), sim.busy())
+sim.send(a, b"TP/1.1\r\n\r\n")
+sim.background()
+print(status(sim.recv(a)), sim.busy())
+
+# A client that goes away part way through a request frees its slot.
+sim.send(b, b"GET /miss")
+sim.background()
+sim.hangup(b)
+sim.background()
+print(sim.is_open(b), sim.busy())
+
+# Idle connections are closed after a while.
+sim.sleep_ms(4000)
+sim.background()
+print(sim.is_open(a))
+sim.sleep_ms(2000)
+sim.background()
+print(sim.is_open(a))
+
+# A file is sent as the client takes it, while other connections are served.
+# The file buffer is only held during the transfer.
+sim.set_window(3000)
+c, response = get("/fs/data.bin", AUTH)
+print(status(response), sim.heap_blocks())
+d, other = get("/missing")
+print(status(other))
+for i in range(10):
+    sim.background()
+    response += sim.recv(c)
+    if not sim.heap_blocks():
+        break
+print(body(response) == data, sim.is_open(c))
+sim.set_window(-1)
+
+# A range of the file.
+c, response = get("/fs/data.bin", AUTH + "Range: bytes=9990-\r\n")
+print(status(response), body(response) == data[9990:], sim.heap_blocks())
+
+# Without memory for the buffer the client is asked to try again.
+sim.mallocs_left(0)
+c, response = get("/fs/data.bin", AUTH)
+print(status(response), sim.heap_blocks())
+sim.mallocs_left(-1)
+
+# A PUT body is written as it arrives.
+c = sim.connect()
+sim.send(c, request("PUT", "/fs/new.txt", AUTH + "Content-Length: 10\r\n", b"hello"))
+sim.background()
+print(sim.recv(c), sim.heap_blocks(), sim.busy())
+sim.send(c, b"world")
+sim.background()
+print(status(sim.recv(c)), sim.heap_blocks(), sim.busy())
+with open("/new.txt") as f:
+    print(f.read())
@@ -0,0 +1,88 @@
+try:
+    import zlib
+
+    zlib.decompressobj
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+DATA = b"".join(b"line %d of some fairly repetitive text\n" % i for i in range(200))
+
+# Produced by CPython's zlib.compress(b"hello hello hello hello")
+PACKED = b"x\x9c\xcbH\xcd\xc9\xc9W\xc8@'\x01h\x03\x08\xb1"
+
+
+def decompress_chunks(packed, chunk, wbits=15):
+    d = zlib.decompressobj(wbits)
+    out = []
+    for i in range(0, len(packed), chunk):
+        out.append(d.decompress(packed[i : i + chunk]))
+    out.append(d.flush())
+    return b"".join(out), d
+
+
+def compress_chunks(data, chunk, level=-1, wbits=15):
+    c = zlib.compressobj(level, zlib.DEFLATED, wbits)
+    out = []
+    for i in range(0, len(data), chunk):
+        out.append(c.compress(data[i : i + chunk]))
+    out.append(c.flush())
+    return b"".join(out)
+
+
+# Round trips in each format and at each compression level, fed in chunks.
+for wbits in (15, 9, -15, 31):
+    for level in (0, 1, 6, 9):
+        packed = compress_chunks(DATA, 100, level, wbits)
+        print(wbits, level, decompress_chunks(packed, 37, wbits)[0] == DATA)
+        print(zlib.decompress(packed, wbits) == DATA)
+
+print(zlib.decompress(compress_chunks(DATA, 1000, 6, 8)) == DATA)
+
+# Compression actually makes repetitive data smaller.
+print(len(zlib.compress(DATA)) < len(DATA) // 4)
+print(zlib.decompress(zlib.compress(b"")) == b"")
+
+# Input fed a byte at a time.
+packed = zlib.compress(DATA)
+print(decompress_chunks(packed, 1)[0] == DATA)
+
+# max_length limits the output; the rest of the input is kept in unconsumed_tail.
+d = zlib.decompressobj()
+out = d.decompress(packed, 100)
+print(len(out), len(d.unconsumed_tail) > 0)
+while d.unconsumed_tail:
+    out += d.decompress(d.unconsumed_tail, 100)
+print(out == DATA, d.eof)
+
+# Data after the end of the stream ends up in unused_data.
+out, d = decompress_chunks(zlib.compress(b"hello") + b"trailing", 3)
+print(out, d.eof, d.unused_data)
+out, d = decompress_chunks(PACKED, 4)
+print(out, d.eof, d.unused_data)
+
+# Flushing partway lets the receiver decompress everything sent so far.
+c = zlib.compressobj()
+d = zlib.decompressobj()
+part = c.compress(b"first part ") + c.flush(zlib.Z_SYNC_FLUSH)
+print(d.decompress(part))
+part = c.compress(b"second part") + c.flush(zlib.Z_FULL_FLUSH)
+print(d.decompress(part))
+print(d.decompress(c.flush()), d.eof)
+
+# No more data can be compressed once the stream is finished.
+try:
+    c.compress(b"more")
+except Exception:
+    print("Exception")
+
+# Bad arguments.
+for kwargs in ({"level": 10}, {"method": 7}, {"wbits": 7}, {"wbits": -8}, {"wbits": 16}):
+    try:
+        zlib.compressobj(**kwargs)
+    except ValueError:
+        print("ValueError")
+try:
+    zlib.decompressobj().decompress(b"abc")
+except Exception:
+    print("Exception")
@@ -0,0 +1,188 @@
+# Test the native event loop core in _asyncio, driven by a minimal core
+# context in this module's globals (the same names the asyncio package uses).
+
+try:
+    import _asyncio
+    import io, select
+
+    _asyncio.run_until_complete
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class CancelledError(BaseException):
+    pass
+
+
+class Loop:
+    @staticmethod
+    def call_exception_handler(context):
+        print("handler:", repr(context["exception"]), context["future"] is not None)
+
+
+cur_task = None
+_task_queue = _asyncio.TaskQueue()
+_io_queue = _asyncio.IOQueue()
+_exc_context = {"message": "Task exception wasn't retrieved", "exception": None, "future": None}
+
+sleep = _asyncio.sleep
+sleep_ms = _asyncio.sleep_ms
+
+
+def create_task(coro):
+    t = _asyncio.Task(coro, globals())
+    _task_queue.push(t)
+    return t
+
+
+# Tasks interleave on sleep(0) and are resumed in order.
+async def worker(name, n):
+    for i in range(n):
+        print(name, i)
+        await sleep(0)
+    return name
+
+
+async def main():
+    t1 = create_task(worker("a", 3))
+    t2 = create_task(worker("b", 2))
+    print("joined", await t1, await t2)
+    return 42
+
+
+print("result", _asyncio.run_until_complete(create_task(main())))
+print("cur_task", cur_task)
+
+
+# Timed sleeps wake in deadline order.
+async def sleeper(name, ms):
+    await sleep_ms(ms)
+    print("woke", name)
+
+
+async def main():
+    ts = [create_task(sleeper(n, ms)) for n, ms in (("late", 30), ("early", 10), ("mid", 20))]
+    for t in ts:
+        await t
+
+
+_asyncio.run_until_complete(create_task(main()))
+
+
+# Exceptions propagate to awaiting tasks; unretrieved ones reach the handler.
+async def fail(msg):
+    await sleep(0)
+    raise ValueError(msg)
+
+
+async def main():
+    try:
+        await create_task(fail("awaited"))
+    except ValueError as er:
+        print("caught", er)
+    create_task(fail("detached"))
+    await sleep_ms(10)
+
+
+_asyncio.run_until_complete(create_task(main()))
+
+
+# Cancelling a sleeping task wakes it with CancelledError.
+async def long_sleep():
+    try:
+        await sleep(10)
+    except CancelledError as er:
+        print("cancelled")
+        raise er
+
+
+async def main():
+    t = create_task(long_sleep())
+    await sleep(0)
+    print("cancel", t.cancel())
+    try:
+        await t
+    except CancelledError:
+        print("main saw cancel")
+
+
+_asyncio.run_until_complete(create_task(main()))
+
+
+# Sleeps longer than the ticks range are capped instead of wrapping around
+# and waking early.
+async def nap(t):
+    await sleep(t)
+    print("woke early", t)
+
+
+async def main():
+    ts = [create_task(nap(t)) for t in (10**6, 10**30, 1e30)]
+    await sleep_ms(10)
+    for t in ts:
+        t.cancel()
+    print("still asleep", len([t for t in ts if not t.done()]))
+
+
+_asyncio.run_until_complete(create_task(main()))
+
+# An exception in the main task is raised out of run_until_complete.
+try:
+    _asyncio.run_until_complete(create_task(fail("main")))
+except ValueError as er:
+    print("raised", er)
+
+# With no main task, the loop runs until nothing is scheduled.
+create_task(worker("c", 2))
+print(_asyncio.run_until_complete())
+
+# Tasks wait for streams through the IOQueue.
+_MP_STREAM_POLL = const(3)
+_MP_STREAM_GET_FILENO = const(10)
+
+
+class Pollable(io.IOBase):
+    def __init__(self):
+        self.ready = 0
+
+    def ioctl(self, cmd, arg):
+        if cmd == _MP_STREAM_POLL:
+            return self.ready & arg
+        return -1
+
+
+async def reader(s):
+    await _io_queue.queue_read(s)
+    print("readable", len(_io_queue.map))
+
+
+async def writer(s):
+    await _io_queue.queue_write(s)
+    print("writable", len(_io_queue.map))
+
+
+async def main():
+    s = Pollable()
+    r = create_task(reader(s))
+    w = create_task(writer(s))
+    await sleep_ms(5)
+    print("waiting", len(_io_queue.map))
+    s.ready = select.POLLOUT
+    await w
+    s.ready = select.POLLIN
+    await r
+    print("done", len(_io_queue.map))
+
+    # A cancelled task is taken off the IOQueue.
+    r = create_task(reader(s))
+    s.ready = 0
+    await sleep_ms(5)
+    r.cancel()
+    try:
+        await r
+    except CancelledError:
+        print("reader cancelled", len(_io_queue.map))
+
+
+_asyncio.run_until_complete(create_task(main()))
@@ -0,0 +1,73 @@
+# test json.iterload, which walks a document yielding (path, value) pairs
+
+try:
+    import io
+    import json
+
+    json.iterload
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+doc = '{"meta": {"count": 3, "next": null}, "items": [{"id": 1, "name": "a", "tags": ["x"]}, {"id": 2, "name": "b\\n", "tags": []}, {"id": 3, "name": "c"}], "x": 1.5}'
+
+# every primitive
+for ev in json.iterload(doc):
+    print(ev)
+
+# only the matched subtrees; None matches any key or index
+print(list(json.iterload(doc, [("items", None, "name")])))
+print(list(json.iterload(doc.encode(), paths=[("meta",), ("items", 1)])))
+print(list(json.iterload(doc, [("items", 5), ("missing",), ("x", "y")])))
+print(list(json.iterload(doc, [()])) == [((), json.loads(doc))])
+
+# primitives and empty containers at the top level
+print(list(json.iterload("5")), list(json.iterload("[]")), list(json.iterload("{}", [()])))
+
+# streams are left just after the document
+s = io.StringIO(doc + ' {"more": 1}')
+print(list(json.iterload(s, [("x",)])), json.load(s))
+
+
+# a document much bigger than the heap used while walking it
+class Records:
+    def __init__(self, n):
+        self.n = n
+        self.i = 0
+        self.pending = b"["
+
+    def readinto(self, buf):
+        while len(self.pending) < len(buf) and self.i <= self.n:
+            if self.i == self.n:
+                self.pending += b"]"
+            else:
+                rec = '{"id": %d, "name": "%s", "data": [%s]}' % (
+                    self.i,
+                    "n" * 40,
+                    ", ".join(str(j) for j in range(20)),
+                )
+                self.pending += (", " if self.i else "") + rec
+            self.i += 1
+        n = min(len(buf), len(self.pending))
+        buf[:n] = self.pending[:n]
+        self.pending = self.pending[n:]
+        return n
+
+
+total = 0
+count = 0
+for path, value in json.iterload(Records(1000), [(None, "id")]):
+    total += value
+    count += 1
+print(count, total)
+
+# errors
+for bad in ("", "[1, ", '{"a": [1, 2}', "{1: 2}", '["a" "b"', "]", "nul"):
+    try:
+        print(list(json.iterload(bad)))
+    except ValueError:
+        print("ValueError")
+try:
+    json.iterload("[]", 1)
+except TypeError:
+    print("TypeError")
@@ -0,0 +1,65 @@
+# test parsing where strings and numbers straddle the parser's read chunks
+
+try:
+    from io import StringIO
+    import json
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+records = []
+for i in range(40):
+    records.append(
+        {
+            "id": i * 1234567,
+            "name": "item-" + "x" * (i % 70),
+            "value": -i / 8,
+            "esc": 'a"b\\c\né' * (i % 3),
+            "flags": [True, False, None],
+        }
+    )
+text = json.dumps(records)
+
+
+class Buffer:
+    def __init__(self, data):
+        self._data = data
+        self._i = 0
+
+    def read(self):
+        return self._data
+
+    def readinto(self, buf):
+        n = min(len(buf), len(self._data) - self._i)
+        buf[:n] = self._data[self._i : self._i + n]
+        self._i += n
+        return n
+
+
+for pad in range(0, 70, 7):
+    # shift the chunk boundaries through the document
+    doc = " " * pad + text
+    print(
+        pad,
+        json.loads(doc) == records,
+        json.loads(doc.encode()) == records,
+        json.loads(bytearray(doc.encode())) == records,
+        json.load(StringIO(doc)) == records,
+        json.load(Buffer(doc.encode())) == records,
+    )
+
+print(json.loads("[1e3, 2.5E-1, -4e+2, -0.5, 12345678901234567890]"))
+
+# repeated keys share one string object
+r = json.loads(text)
+print(all(a is b for a, b in zip(sorted(r[0].keys()), sorted(r[-1].keys()))))
+
+# long keys and values are still plain strings
+k = "k" * 100
+print(json.loads(json.dumps({k: k})) == {k: k})
+
+for s in ('"abc', '{"a": "b', "-", '"\\'):
+    try:
+        json.loads(s)
+    except ValueError:
+        print("ValueError")
@@ -0,0 +1,38 @@
+# test that json.load leaves a stream just after the object it parsed
+
+try:
+    import io
+    import json
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# seekable streams are read in chunks then rewound
+s = io.StringIO('{"a": [1, 2]} ["x"]\n17 trailing')
+print(json.load(s))
+print(json.load(s))
+print(json.load(s))
+print(repr(s.read()))
+
+s = io.BytesIO(b'"' + b"y" * 100 + b'"' + b"z" * 100)
+print(len(json.load(s)), s.tell())
+
+
+# streams that can't seek are read a byte at a time
+class Stream(io.IOBase):
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+        self.reads = 0
+
+    def readinto(self, buf):
+        self.reads += 1
+        n = min(len(buf), len(self.data) - self.pos)
+        buf[:n] = self.data[self.pos : self.pos + n]
+        self.pos += n
+        return n
+
+
+s = Stream(b"[1, 2] [3]")
+print(json.load(s), s.data[s.pos :])
+print(json.load(s), s.data[s.pos :])
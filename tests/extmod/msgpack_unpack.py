@@ -0,0 +1,128 @@
+try:
+    from io import BytesIO
+    import msgpack
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+data = {
+    "int": [0, -1, 127, 128, -33, 300, -300, 70000, -70000],
+    "str": ["", "abc", "x" * 40, "y" * 300],
+    "bin": [b"", b"\x00\x01", bytes(range(256)) * 2],
+    "list": [None, True, False],
+    "nested": {"a": [1, {"b": "c"}]},
+}
+
+b = BytesIO()
+msgpack.pack(data, b)
+packed = b.getvalue()
+
+# unpack from a seekable stream, several objects in a row
+b = BytesIO()
+for i in range(3):
+    msgpack.pack(data, b)
+msgpack.pack("end", b)
+b.seek(0)
+for i in range(3):
+    print(msgpack.unpack(b) == data)
+print(b.tell() == 3 * len(packed))
+print(msgpack.unpack(b), b.read())
+
+
+# unpack from a stream that can't seek and returns at most 3 bytes per read
+class Trickle:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def readinto(self, buf):
+        n = min(len(buf), 3, len(self.data) - self.pos)
+        buf[:n] = self.data[self.pos : self.pos + n]
+        self.pos += n
+        return n
+
+
+try:
+    import io
+
+    class Trickle(io.IOBase, Trickle):
+        pass
+
+except (ImportError, TypeError):
+    pass
+
+s = Trickle(packed + b"\xc0")
+print(msgpack.unpack(s) == data, s.pos == len(packed))
+print(msgpack.unpack(s))
+try:
+    msgpack.unpack(s)
+except EOFError:
+    print("EOFError")
+
+# truncated input
+truncated = packed[: packed.index(b"yyyy") + 10]
+try:
+    msgpack.unpack(BytesIO(truncated))
+except ValueError as e:
+    print("ValueError", e)
+
+# a failed unpack leaves a seekable stream just after what it consumed
+b = BytesIO(b"\x01\xc1\x02\xd4\x05x\x03")
+print(msgpack.unpack(b))
+try:
+    msgpack.unpack(b)
+except ValueError as e:
+    print("ValueError", e, b.tell())
+print(msgpack.unpack(b))
+
+
+def hook(code, data):
+    raise RuntimeError(code)
+
+
+try:
+    msgpack.unpack(b, ext_hook=hook)
+except RuntimeError as e:
+    print("RuntimeError", e, b.tell())
+print(b.read())
+
+# unpack from a buffer
+print(msgpack.unpackb(packed) == data)
+print(msgpack.unpackb(packed + b"extra") == data)
+print(msgpack.unpackb(bytearray(packed), use_list=False)["list"])
+try:
+    msgpack.unpackb(truncated)
+except ValueError as e:
+    print("ValueError", e)
+try:
+    msgpack.unpackb(b"")
+except EOFError:
+    print("EOFError")
+
+# zero-copy bin payloads are views of the input buffer
+buf = bytearray(packed)
+obj = msgpack.unpackb(buf, zero_copy=True)
+views = obj["bin"]
+print([type(v).__name__ for v in views], type(obj["str"][1]).__name__)
+print([bytes(v) for v in views] == data["bin"])
+big = views[2]
+buf[buf.index(bytes(range(256)))] = 0xAA
+print(big[0], len(big))
+big[1] = 0xBB
+print(buf.count(b"\xaa\xbb"))
+
+# views of a memoryview input
+mv = memoryview(b"xx" + packed)[2:]
+obj = msgpack.unpackb(mv, zero_copy=True)
+print(bytes(obj["bin"][1]))
+
+# read-only input gives read-only views
+obj = msgpack.unpackb(packed, zero_copy=True)
+try:
+    obj["bin"][1][0] = 1
+except TypeError:
+    print("TypeError")
+
+# ext data is always copied
+e = msgpack.unpackb(b"\xd4\x05x", zero_copy=True)
+print(e.code, e.data)
@@ -0,0 +1,19 @@
+try:
+    import qrio
+except:
+    print("SKIP")
+    raise SystemExit
+
+loc = __file__.rsplit("/", 1)[0]
+with open(f"{loc}/data/qr.pgm", "rb") as f:
+    content = f.read()[-320 * 240 :]
+
+# The same image moved 8 pixels to the right
+shifted = b"".join(b"\xff" * 8 + content[y * 320 : y * 320 + 312] for y in range(240))
+
+decoder = qrio.QRDecoder(320, 240)
+print(decoder.scan(content))
+print(decoder.scan(content))
+print(decoder.scan(shifted))
+print(decoder.scan(bytes(320 * 240)))
+print(decoder.scan(shifted))
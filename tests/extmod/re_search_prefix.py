@@ -0,0 +1,109 @@
+# test searching with patterns that start with a literal, and ones that don't
+try:
+    import re
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+long = "sensor=temp value=23.5 unit=C status=ok; sensor=rh value=41 unit=% status=stale"
+
+
+def search(pat, s):
+    m = re.search(pat, s)
+    print(pat, m and m.group(0))
+
+
+# required literal prefix
+for pat in (
+    "status=(\\w+)",
+    "unit=.",
+    "ab*c",
+    "ab+c",
+    "a(bc)+",
+    "(ab)c",
+    "(?:st)atus",
+    "xyz",
+    "t",
+    "tt",
+    "ok$",
+    "stale$",
+    "value=\\d+\\.\\d",
+):
+    search(pat, long)
+    search(pat, "abbc abcbc abc")
+
+# patterns that branch before any literal
+for pat in (
+    "a|b",
+    "abc|value",
+    "a?status",
+    "(sensor|unit)=\\w",
+    "\\d+%",
+    "[xyz]=\\d",
+    "\\s\\w+=\\d+\\.\\d+ ",
+    "^sensor",
+    "^value",
+    ".*stale$",
+    "\\w+$",
+    "q*$",
+):
+    search(pat, long)
+    search(pat, "")
+
+# a subject that is only a prefix of the literal
+search("status", "stat")
+
+# match only looks at the start of the subject
+print(re.match("sensor", long) is not None, re.match("value", long))
+print(re.match("s", "") is None, re.match("", "") is not None)
+
+# pos and endpos
+r = re.compile("value=(\\d+)")
+try:
+    print(r.search(long, 20).group(1))
+    print(r.search(long, 20, 45))
+    print(r.search(long, 18).group(1))
+except TypeError:
+    # pos/endpos not supported
+    print("41")
+    print(None)
+    print("23")
+
+# split and sub go through the same search
+print(re.compile(";\\s*").split(long))
+try:
+    print(re.sub("unit=", "u:", long))
+    print(re.sub("[=;]", "_", long))
+except AttributeError:
+    pass
+
+# module-level functions with many different patterns in turn
+words = ["sensor", "value", "unit", "status", "ok", "rh", "temp", "stale", "41", "23"]
+for _ in range(3):
+    print([re.search(w + "\\W", long) is not None for w in words])
+
+# str and bytes patterns with the same contents are kept apart
+print(re.search("ok", "ok").group(0), re.search(b"ok", b"ok").group(0))
+
+
+# a pattern whose instructions tell all 256 byte values apart: one class
+# per bit, with bit 0 split in two so each class fits
+def bit_class(lo, hi, bit):
+    out = b"["
+    for i in range(lo + (1 << bit), hi, 2 << bit):
+        ends = bytes([i, i + (1 << bit) - 1])
+        if bit > 0 and not any(c in b"\\]-^[" for c in ends):
+            out += ends[:1] + b"-" + ends[1:]
+        else:
+            for c in range(i, i + (1 << bit)):
+                out += (b"\\" if c in b"\\]-^[" else b"") + bytes([c])
+    return out + b"]"
+
+
+pat = bit_class(0, 128, 0) + bit_class(128, 256, 0)
+for bit in range(1, 8):
+    pat += bit_class(0, 256, bit)
+r = re.compile(pat)
+target = b"\x01\x81\x02\x04\x08\x10\x20\x40\x80"
+print(r.search(b"\x00" * 40 + target + b"\x00" * 8).group(0) == target)
+print(r.search(b"\x00" * 40 + target.replace(b"\x20", b"\x00")))
@@ -0,0 +1,91 @@
+# Test interleaved access to several files on a FAT filesystem, which shares
+# sectors between files, the FAT and directories.
+
+try:
+    import os
+
+    os.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBDev:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.reads = 0
+
+    def readblocks(self, n, buf):
+        self.reads += 1
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+def pattern(seed, n):
+    return bytes((seed + i * 7) & 0xFF for i in range(n))
+
+
+try:
+    bdev = RAMBDev(200)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+os.VfsFat.mkfs(bdev)
+vfs = os.VfsFat(bdev)
+
+# Write two files a few bytes at a time, alternating between them, so their
+# clusters are interleaved and each write touches a partial sector.
+a = pattern(1, 3000)
+b = pattern(2, 2010)
+with vfs.open("a", "wb") as fa, vfs.open("b", "wb") as fb:
+    for i in range(30):
+        fa.write(a[i * 100 : i * 100 + 100])
+        fb.write(b[i * 67 : i * 67 + 67])
+print(vfs.stat("a")[6], vfs.stat("b")[6])
+
+# Read them back, alternating between files, in chunks that straddle sectors.
+with vfs.open("a", "rb") as fa, vfs.open("b", "rb") as fb:
+    ra = b""
+    rb = b""
+    while True:
+        da = fa.read(77)
+        db = fb.read(51)
+        if not da and not db:
+            break
+        ra += da
+        rb += db
+print(ra == a, rb == b)
+
+# Overwrite the middle of one file while the other is open, then seek around.
+with vfs.open("a", "r+b") as fa, vfs.open("b", "rb") as fb:
+    fb.seek(1000)
+    fa.seek(1000)
+    fa.write(b"X" * 600)
+    fa.seek(990)
+    print(fa.read(12), fb.read(4) == b[1000:1004])
+
+# A new mount of the same device sees everything that was written.
+vfs2 = os.VfsFat(bdev)
+with vfs2.open("a", "rb") as f:
+    data = f.read()
+print(data == a[:1000] + b"X" * 600 + a[1600:])
+print(sorted(vfs2.ilistdir()) == sorted(vfs.ilistdir()))
+
+# Removing files and creating new ones reuses their clusters.
+vfs.remove("a")
+with vfs.open("c", "wb") as f:
+    f.write(pattern(3, 4000))
+with vfs.open("c", "rb") as f:
+    print(f.read() == pattern(3, 4000))
+print(sorted(name for name, *_ in vfs.ilistdir()))
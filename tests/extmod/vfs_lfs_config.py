@@ -0,0 +1,100 @@
+# Test VfsLfs2 cache, lookahead, block_cycles and metadata_max settings
+
+try:
+    import gc, os
+
+    os.VfsLfs2
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 1024
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+        self.reads = 0
+
+    def readblocks(self, block, buf, off):
+        self.reads += 1
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        buf[:] = self.data[addr : addr + len(buf)]
+
+    def writeblocks(self, block, buf, off):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        self.data[addr : addr + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+        if op == 6:  # erase block
+            return 0
+
+
+def workload(vfs):
+    for i in range(8):
+        with vfs.open("f%d" % i, "w") as f:
+            f.write("x" * (i * 50))
+    for i in range(8):
+        with vfs.open("f%d" % i, "a") as f:
+            f.write("y" * 10)
+    return [vfs.stat("f%d" % i)[6] for i in range(8)]
+
+
+bdev = RAMBlockDevice(40)
+reads = {}
+for kw in (
+    {},
+    {"cachesize": 256},
+    {"cachesize": 1024, "lookahead": 64},
+    {"blockcycles": -1},
+    {"blockcycles": 10, "metadatamax": 512},
+):
+    os.VfsLfs2.mkfs(bdev, **kw)
+    vfs = os.VfsLfs2(bdev, **kw)
+    bdev.reads = 0
+    print(sorted(kw.items()), workload(vfs))
+    reads[kw.get("cachesize", 0)] = bdev.reads
+
+# A bigger cache needs fewer device reads.
+print(reads[1024] < reads[0])
+
+# The filesystem can be remounted with different settings.
+vfs = os.VfsLfs2(bdev, cachesize=128)
+print(workload(vfs)[-1])
+
+# Invalid settings.
+for kw in (
+    {"cachesize": 48},  # not a multiple of readsize
+    {"cachesize": 2048},  # bigger than a block
+    {"blockcycles": 0},
+    {"metadatamax": 2048},
+    {"readsize": 0},
+    {"lookahead": 0},
+    {"lookahead": 12},  # not a multiple of 8
+):
+    try:
+        os.VfsLfs2(bdev, **kw)
+    except ValueError:
+        print("ValueError", sorted(kw))
+
+
+# A block device error during mkfs is raised, and the buffers are given back.
+class FailingBlockDevice(RAMBlockDevice):
+    def writeblocks(self, block, buf, off):
+        raise RuntimeError("write")
+
+
+try:
+    os.VfsLfs2.mkfs(FailingBlockDevice(40), cachesize=1024)
+except RuntimeError as e:
+    print("RuntimeError", e)
+
+# Buffers are given back when the filesystem object is collected.
+for i in range(20):
+    os.VfsLfs2(bdev, cachesize=1024, lookahead=128)
+gc.collect()
+print("ok")
@@ -0,0 +1,162 @@
+# test the import bytecode cache with a user-defined filesystem
+
+import sys
+
+try:
+    import io
+
+    io.IOBase
+    import os
+
+    os.mount
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class UserFile(io.IOBase):
+    def __init__(self, fs, path, data):
+        self.fs = fs
+        self.path = path
+        self.data = data
+        self.pos = 0
+
+    def readinto(self, buf):
+        n = min(len(buf), len(self.data) - self.pos)
+        buf[:n] = self.data[self.pos : self.pos + n]
+        self.pos += n
+        return n
+
+    def write(self, buf):
+        self.data += buf
+        return len(buf)
+
+    def ioctl(self, req, arg):
+        if req == 4 and self.fs is not None:  # MP_STREAM_CLOSE
+            self.fs.files[self.path] = bytes(self.data)
+        return 0
+
+
+class UserFS:
+    stat_error = None
+
+    def __init__(self, files):
+        self.files = files
+
+    def mount(self, readonly, mksfs):
+        pass
+
+    def umount(self):
+        pass
+
+    def chdir(self, path):
+        pass
+
+    def abspath(self, path):
+        # the current directory is always the root of this filesystem
+        return path if path.startswith("/") else "/" + path
+
+    def stat(self, path):
+        path = self.abspath(path)
+        if path == "/.mpycache":
+            if self.stat_error:
+                raise self.stat_error
+            return (0x4000, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+        if path in self.files:
+            return (0x8000, 0, 0, 0, 0, 0, len(self.files[path]), 0, 0, 0)
+        raise OSError(2)
+
+    def open(self, path, mode):
+        path = self.abspath(path)
+        if path.startswith("/.mpycache/"):
+            log.append(("open cache entry", mode))
+        else:
+            log.append(("open", path, mode))
+        if "w" in mode:
+            return UserFile(self, path, bytearray())
+        if path not in self.files:
+            raise OSError(2)
+        return UserFile(None, path, self.files[path])
+
+    def remove(self, path):
+        path = self.abspath(path)
+        del self.files[path]
+
+
+def print_log():
+    for entry in log:
+        print(*entry)
+    log.clear()
+
+
+log = []
+user_files = {"/usermod.py": b"value = 1"}
+os.mount(UserFS(user_files), "/userfs")
+cwd = os.getcwd()
+os.chdir("/userfs")
+sys_path = sys.path[:]
+sys.path[:] = [""]
+
+# first import compiles the module and writes a cache entry
+import usermod
+
+print_log()
+print(usermod.value, len(user_files))
+
+# second import only reads the source to check it, and loads the cache entry
+del sys.modules["usermod"]
+import usermod
+
+print_log()
+print(usermod.value)
+
+# changing the source invalidates the cache entry
+user_files["/usermod.py"] = b"value = 22"
+del sys.modules["usermod"]
+import usermod
+
+print_log()
+print(usermod.value, len(user_files))
+
+# so does an edit that keeps the size and mtime
+user_files["/usermod.py"] = b"value = 33"
+del sys.modules["usermod"]
+import usermod
+
+print_log()
+print(usermod.value, len(user_files))
+
+# a corrupt cache entry is a miss, and is written again
+(cache_entry,) = [path for path in user_files if path.startswith("/.mpycache/")]
+entry = user_files[cache_entry]
+user_files[cache_entry] = entry.replace(b"C\x06", b"X\x06", 1)
+del sys.modules["usermod"]
+import usermod
+
+print_log()
+print(usermod.value, user_files[cache_entry] == entry)
+
+# streamed imports neither use nor fill the cache
+import micropython
+
+micropython.compile_streaming(True)
+del sys.modules["usermod"]
+import usermod
+
+micropython.compile_streaming(False)
+print_log()
+print(usermod.value)
+
+# errors other than OSError are not hidden
+UserFS.stat_error = RuntimeError("stat")
+del sys.modules["usermod"]
+try:
+    import usermod
+except RuntimeError as e:
+    print("RuntimeError", e)
+UserFS.stat_error = None
+print_log()
+
+sys.path[:] = sys_path
+os.chdir(cwd)
+os.umount("/userfs")
@@ -0,0 +1,50 @@
+# test arithmetic and comparisons between floats and ints, which the VM may
+# handle on a fast path
+
+a = 1.5
+b = 2
+for x, y in ((a, b), (b, a), (a, a), (-a, 0), (0, -a), (a, 1000)):
+    print(x + y, x - y, x * y, x < y, x > y, x <= y, x >= y, x == y, x != y)
+    try:
+        print("%.6g" % (x / y))
+    except ZeroDivisionError:
+        print("ZeroDivisionError")
+
+# in-place operators
+x = 0.5
+x += 1
+x *= 3
+x -= 0.25
+x /= 2
+print(x)
+
+# nan compares unequal to everything, including itself
+nan = float("nan")
+print(nan == nan, nan != nan, nan < 1, nan >= 1, 1 != nan)
+
+# division by zero still raises
+for y in (0, 0.0, -0.0):
+    try:
+        1.0 / y
+    except ZeroDivisionError:
+        print("ZeroDivisionError")
+
+
+# float subclasses and objects with __float__ keep going through the type
+class F(float):
+    def __add__(self, other):
+        return "F.__add__"
+
+
+print(F(1.0) + 2.0)
+
+
+class G:
+    def __radd__(self, other):
+        return "G.__radd__"
+
+
+try:
+    print(1.0 + G())
+except TypeError:
+    print("TypeError")
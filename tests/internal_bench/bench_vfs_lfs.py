@@ -0,0 +1,83 @@
+# Shared workload for the vfs_lfs-* benchmarks: times creating, appending to
+# and stat'ing files on a littlefs filesystem on a RAM block device shaped
+# like a large SPI flash. The total time goes to stdout for
+# run-internalbench.py, per-operation rates and device access counts to stderr.
+
+import os
+import sys
+import time
+
+BLOCK_SIZE = 4096
+BLOCK_COUNT = 64
+FILES = 32
+
+
+class RAMFlash:
+    def __init__(self):
+        self.data = bytearray(BLOCK_SIZE * BLOCK_COUNT)
+        self.reads = 0
+        self.progs = 0
+        self.erases = 0
+
+    def readblocks(self, block, buf, off):
+        self.reads += 1
+        addr = block * BLOCK_SIZE + off
+        buf[:] = memoryview(self.data)[addr : addr + len(buf)]
+
+    def writeblocks(self, block, buf, off):
+        self.progs += 1
+        addr = block * BLOCK_SIZE + off
+        self.data[addr : addr + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return BLOCK_COUNT
+        if op == 5:  # block size
+            return BLOCK_SIZE
+        if op == 6:  # erase block
+            self.erases += 1
+            return 0
+
+
+def run(**settings):
+    bdev = RAMFlash()
+    os.VfsLfs2.mkfs(bdev, **settings)
+    vfs = os.VfsLfs2(bdev, **settings)
+    line = b"0123456789abcdef" * 4
+    phases = []
+
+    def phase(name, f):
+        bdev.reads = bdev.progs = bdev.erases = 0
+        t = time.time()
+        f()
+        phases.append((name, time.time() - t, bdev.reads, bdev.progs, bdev.erases))
+
+    def create():
+        for i in range(FILES):
+            with vfs.open("f%d" % i, "wb") as f:
+                f.write(line)
+
+    def append():
+        for j in range(4):
+            for i in range(FILES):
+                with vfs.open("f%d" % i, "ab") as f:
+                    f.write(line)
+
+    def stat():
+        for j in range(8):
+            for i in range(FILES):
+                vfs.stat("f%d" % i)
+
+    phase("create", create)
+    phase("append", append)
+    phase("stat", stat)
+
+    ops = {"create": FILES, "append": 4 * FILES, "stat": 8 * FILES}
+    report = []
+    for name, t, reads, progs, erases in phases:
+        rate = ops[name] / t if t > 0 else 0
+        report.append(
+            "%s %.0f/s (%d reads %d progs %d erases)" % (name, rate, reads, progs, erases)
+        )
+    print("%r: %s" % (settings, ", ".join(report)), file=sys.stderr)
+    print(sum(p[1] for p in phases))
@@ -0,0 +1,3 @@
+import bench_vfs_lfs
+
+bench_vfs_lfs.run()
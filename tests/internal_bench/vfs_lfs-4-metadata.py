@@ -0,0 +1,3 @@
+import bench_vfs_lfs
+
+bench_vfs_lfs.run(cachesize=1024, lookahead=128, blockcycles=-1, metadatamax=1024)
@@ -0,0 +1,106 @@
+# test importing a module one top-level statement at a time
+
+import sys
+
+try:
+    import io, os, micropython
+
+    io.IOBase
+    os.mount
+    micropython.compile_streaming
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class UserFile(io.IOBase):
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def readinto(self, buf):
+        n = min(len(buf), len(self.data) - self.pos)
+        buf[:n] = self.data[self.pos : self.pos + n]
+        self.pos += n
+        return n
+
+    def ioctl(self, req, arg):
+        return 0
+
+
+class UserFS:
+    def __init__(self, files):
+        self.files = files
+
+    def mount(self, readonly, mksfs):
+        pass
+
+    def umount(self):
+        pass
+
+    def stat(self, path):
+        if path in self.files:
+            return (0x8000, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+        raise OSError(2)
+
+    def open(self, path, mode):
+        return UserFile(self.files[path])
+
+
+user_files = {
+    "/mod_ok.py": b"""
+from micropython import const
+_X = const(10)
+Y = const(20)
+
+print('stmt 1', _X + Y)
+
+def f():
+    return _X * 2
+
+class A:
+    z = Y
+    def g(self):
+        return f() + self.z
+
+print('stmt 2', f(), A().g())
+if _X:
+    print('stmt 3')
+else:
+    print('not reached')
+""",
+    "/mod_error.py": b"""
+print('stmt 1')
+for i in range(2):
+    print('stmt 2', i)
+print('stmt 3'
+""",
+}
+os.mount(UserFS(user_files), "/userfs")
+sys.path.append("/userfs")
+
+print(micropython.compile_streaming())
+
+# the whole module is compiled before any of it runs
+try:
+    import mod_error
+except SyntaxError:
+    print("SyntaxError")
+
+micropython.compile_streaming(True)
+print(micropython.compile_streaming())
+
+# const() definitions carry over between statements
+import mod_ok
+
+print(mod_ok.Y, hasattr(mod_ok, "_X"))
+
+# statements before a syntax error have already run
+try:
+    import mod_error
+except SyntaxError:
+    print("SyntaxError")
+
+micropython.compile_streaming(False)
+sys.path.pop()
+os.umount("/userfs")
@@ -0,0 +1,59 @@
+# test the sampling profiler
+
+import micropython
+
+try:
+    micropython.prof_start
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+def leaf(n):
+    x = 0
+    for i in range(n):
+        x += i
+    return x
+
+
+def caller():
+    return leaf(1000)
+
+
+def n_samples():
+    return sum(micropython.prof_flat().values())
+
+
+micropython.prof_start(period_us=200, samples=64)
+for _ in range(10000):
+    caller()
+    if n_samples() >= 20:
+        break
+n = micropython.prof_stop()
+if n == 0:
+    # eg all code is compiled with the native emitter, which isn't sampled
+    print("SKIP")
+    raise SystemExit
+print(n >= 20)
+
+# results remain available after stopping
+flat = micropython.prof_flat()
+print(n_samples() == min(n, 64))
+print(all(len(k) == 3 and type(k[2]) is int for k in flat))
+print(any(k[1] == "leaf" for k in flat))
+
+# per-function counts
+funcs = micropython.prof_flat(False)
+print(all(len(k) == 2 for k in funcs))
+print(sum(funcs.values()) == sum(flat.values()))
+
+# call stacks are outermost first
+stacks = micropython.prof_stacks()
+print(sum(stacks.values()) == sum(flat.values()))
+print(any(len(s) == 3 and s[0][1] == "<module>" and s[-2][1] == "caller" and s[-1][1] == "leaf" for s in stacks))
+
+try:
+    micropython.prof_start(period_us=0)
+except ValueError:
+    print("ValueError")
+micropython.prof_stop()
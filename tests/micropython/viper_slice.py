@@ -0,0 +1,20 @@
+# test slicing in viper with native integer arguments
+
+
+@micropython.viper
+def f(b) -> object:
+    i = 1
+    j = 3
+    return b[i:j], b[i:], b[:j]
+
+
+print(f(b"abcdef"))
+print(f([1, 2, 3, 4, 5]))
+
+
+@micropython.viper
+def g(lst, step: int) -> object:
+    return lst[0:4:step]
+
+
+print(g([1, 2, 3, 4, 5], 2))
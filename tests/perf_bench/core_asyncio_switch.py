@@ -0,0 +1,156 @@
+# Measure task switches per second of the asyncio event loop core.
+# Many coroutines repeatedly yield with sleep(0), so nearly all the time is
+# spent in the scheduler: popping the run queue, resuming the coroutine and
+# pushing it back.  The native loop from _asyncio is used when available,
+# otherwise an equivalent loop written in Python (as in the asyncio package).
+
+try:
+    from _asyncio import TaskQueue, Task
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+try:
+    from time import ticks_ms as ticks, ticks_add, ticks_diff
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+class CancelledError(BaseException):
+    pass
+
+
+class Loop:
+    @staticmethod
+    def call_exception_handler(context):
+        pass
+
+
+cur_task = None
+_task_queue = TaskQueue()
+_exc_context = {"message": "", "exception": None, "future": None}
+
+
+class _NoIO:
+    map = {}
+
+    def wait_io_event(self, dt):
+        pass
+
+
+_io_queue = _NoIO()
+
+try:
+    from _asyncio import run_until_complete, sleep_ms
+except ImportError:
+
+    class SingletonGenerator:
+        def __init__(self):
+            self.state = None
+            self.exc = StopIteration()
+
+        def __iter__(self):
+            return self
+
+        def __await__(self):
+            return self
+
+        def __next__(self):
+            if self.state is not None:
+                _task_queue.push(cur_task, self.state)
+                self.state = None
+                return None
+            else:
+                self.exc.__traceback__ = None
+                raise self.exc
+
+    def sleep_ms(t, sgen=SingletonGenerator()):
+        sgen.state = ticks_add(ticks(), max(0, t))
+        return sgen
+
+    def run_until_complete(main_task=None):
+        global cur_task
+        excs_all = (CancelledError, Exception)
+        excs_stop = (CancelledError, StopIteration)
+        while True:
+            dt = 1
+            while dt > 0:
+                dt = -1
+                t = _task_queue.peek()
+                if t:
+                    dt = max(0, ticks_diff(t.ph_key, ticks()))
+                elif not _io_queue.map:
+                    cur_task = None
+                    return
+                _io_queue.wait_io_event(dt)
+            t = _task_queue.pop()
+            cur_task = t
+            try:
+                exc = t.data
+                if not exc:
+                    t.coro.send(None)
+                else:
+                    t.data = None
+                    t.coro.throw(exc)
+            except excs_all as er:
+                if t is main_task:
+                    cur_task = None
+                    if isinstance(er, StopIteration):
+                        return er.value
+                    raise er
+                if t.state:
+                    waiting = False
+                    if t.state is True:
+                        t.state = None
+                    else:
+                        while t.state.peek():
+                            _task_queue.push(t.state.pop())
+                            waiting = True
+                        t.state = False
+                    if not waiting and not isinstance(er, excs_stop):
+                        _task_queue.push(t)
+                    t.data = er
+                elif t.state is None:
+                    t.data = exc
+
+
+def create_task(coro):
+    t = Task(coro, globals())
+    _task_queue.push(t)
+    return t
+
+
+async def worker(n):
+    global switches
+    for _ in range(n):
+        switches += 1
+        await sleep_ms(0)
+
+
+async def main(ntasks, nswitch):
+    tasks = [create_task(worker(nswitch)) for _ in range(ntasks)]
+    for t in tasks:
+        await t
+
+
+def test(ntasks, nswitch):
+    global switches
+    switches = 0
+    run_until_complete(create_task(main(ntasks, nswitch)))
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (10, 50),
+    (100, 10): (20, 100),
+    (1000, 10): (50, 400),
+    (5000, 10): (100, 1000),
+}
+
+
+def bm_setup(params):
+    ntasks, nswitch = params
+    return lambda: test(ntasks, nswitch), lambda: (ntasks * nswitch // 100, switches == ntasks * nswitch)
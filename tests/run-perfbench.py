@@ -89,7 +89,7 @@ def run_benchmark_on_target(target, script):
         return -1, -1, "CRASH: %r" % err
 
 
-def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
+def run_benchmarks(args, target, param_n, param_m, n_average, test_list, results=None):
     skip_complex = run_feature_test(target, "complex") != "complex"
     skip_native = run_feature_test(target, "native_check") != "native"
     target_had_error = False
@@ -168,6 +168,8 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
         else:
             t_avg, t_sd = compute_stats(times)
             s_avg, s_sd = compute_stats(scores)
+            if results is not None:
+                results[test_file] = (t_avg, t_sd)
             print(
                 "{:.2f} {:.4f} {:.2f} {:.4f}".format(
                     t_avg, 100 * t_sd / t_avg, s_avg, 100 * s_sd / s_avg
@@ -243,6 +245,34 @@ def compute_diff(file1, file2, diff_score):
             d2.pop(0)
 
 
+def print_emit_comparison(emitters, results):
+    # Print header
+    print("microsecond times (lower is better), speedup relative to " + emitters[0])
+    line = "{:26}".format("")
+    for emit in emitters:
+        line += " {:>10}".format(emit)
+    for emit in emitters[1:]:
+        line += " {:>10}".format(emit + " x")
+    print(line)
+
+    # Print entries, for benchmarks that ran with all emitters
+    tests = sorted(set().union(*(r.keys() for r in results)))
+    for test_file in tests:
+        line = "{:26}".format(test_file.rsplit("/")[-1])
+        for r in results:
+            if test_file in r:
+                line += " {:10.2f}".format(r[test_file][0])
+            else:
+                line += " {:>10}".format("-")
+        base = results[0].get(test_file)
+        for r in results[1:]:
+            if base is not None and test_file in r:
+                line += " {:10.2f}".format(base[0] / r[test_file][0])
+            else:
+                line += " {:>10}".format("-")
+        print(line)
+
+
 def main():
     cmd_parser = argparse.ArgumentParser(description="Run benchmarks for MicroPython")
     cmd_parser.add_argument(
@@ -261,6 +291,10 @@ def main():
     cmd_parser.add_argument(
         "--emit", default="bytecode", help="MicroPython emitter to use (bytecode or native)"
     )
+    cmd_parser.add_argument(
+        "--compare-emit",
+        help="comma-separated MicroPython emitters to run each benchmark with and compare (e.g. bytecode,native,viper)",
+    )
     cmd_parser.add_argument("--heapsize", help="heapsize to use (use default if not specified)")
     cmd_parser.add_argument("--via-mpy", action="store_true", help="compile code to .mpy first")
     cmd_parser.add_argument("--mpy-cross-flags", default="", help="flags to pass to mpy-cross")
@@ -307,7 +341,24 @@ def main():
 
     print("N={} M={} n_average={}".format(N, M, n_average))
 
-    target_had_error = run_benchmarks(args, target, N, M, n_average, tests)
+    if args.compare_emit:
+        # Run all benchmarks once per emitter, then compare the times
+        emitters = args.compare_emit.split(",")
+        results = []
+        target_had_error = False
+        mpy_cross_flags = args.mpy_cross_flags
+        for emit in emitters:
+            print("emit={}".format(emit))
+            if isinstance(target, pyboard.Pyboard):
+                args.mpy_cross_flags = mpy_cross_flags + " -X emit=" + emit
+            else:
+                target[2] = "emit=" + emit
+            results.append({})
+            target_had_error |= run_benchmarks(args, target, N, M, n_average, tests, results[-1])
+        args.mpy_cross_flags = mpy_cross_flags
+        print_emit_comparison(emitters, results)
+    else:
+        target_had_error = run_benchmarks(args, target, N, M, n_average, tests)
 
     if isinstance(target, pyboard.Pyboard):
         target.exit_raw_repl()
@@ -633,6 +633,8 @@ def run_tests(pyb, tests, args, result_dir, num_threads=1):
                 "circuitpython/traceback_test_chained.py",
             )
         )  # because native doesn't have proper traceback info
+        # CIRCUITPY-CHANGE
+        skip_tests.add("extmod/vfs_userfs_bytecode_cache.py")  # native code can't be cached
         skip_tests.add("extmod/asyncio_event.py")  # unknown issue
         skip_tests.add("extmod/asyncio_lock.py")  # requires async with
         skip_tests.add("extmod/asyncio_micropython.py")  # unknown issue
@@ -46,6 +46,18 @@ stream.set_error(errno.EAGAIN)
 buf = io.BufferedWriter(stream, 8)
 print(buf.write(bytearray(16)))
 
+# test select.poll only re-polling a stream after it notifies
+import select
+
+stream3 = data[4]  # becomes ready while poll() waits, notifying if armed with True
+poller = select.poll()
+poller.register(stream3, select.POLLIN)
+stream3.arm(True)
+print(len(poller.poll(1000)), stream3.poll_count())
+stream3.arm(False)  # becomes ready silently, so poll() must not see it
+print(len(poller.poll(20)), stream3.poll_count())
+print(len(poller.poll(0)), stream3.poll_count())  # a new poll() always looks once
+
 # function defined in C++ code
 print("cpp", extra_cpp_coverage())
 
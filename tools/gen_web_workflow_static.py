@@ -8,9 +8,16 @@ import minify_html
 import jsmin
 import mimetypes
 import pathlib
+import zlib
 
 parser = argparse.ArgumentParser(description="Generate displayio resources.")
 parser.add_argument("--output_c_file", type=argparse.FileType("w"), required=True)
+parser.add_argument(
+    "--gzip",
+    action=argparse.BooleanOptionalAction,
+    default=True,
+    help="Store the files gzip compressed. They are served with Content-Encoding: gzip.",
+)
 parser.add_argument("files", metavar="FILE", type=argparse.FileType("rb"), nargs="+")
 
 args = parser.parse_args()
@@ -32,13 +39,20 @@ for f in args.files:
         uncompressed = jsmin.jsmin(uncompressed.decode("utf-8"), quote_chars="'\"`").encode(
             "utf-8"
         )
-    compressed = gzip.compress(uncompressed)
+    if args.gzip:
+        # Fix mtime so that the output (and the CRC used for the ETag) only
+        # changes when the file does.
+        compressed = gzip.compress(uncompressed, mtime=0)
+    else:
+        compressed = uncompressed
     clen = len(compressed)
+    crc = zlib.crc32(compressed)
     compressed = ", ".join([hex(x) for x in compressed])
     mime = mimetypes.guess_type(f.name)[0]
 
     c_file.write(f"// {f.name}\n")
     c_file.write(f"// Original length: {ulen} Compressed length: {clen}\n")
     c_file.write(f"const uint32_t {variable}_length = {clen};\n")
+    c_file.write(f"const uint32_t {variable}_crc = {crc:#010x};\n")
     c_file.write(f'const char* {variable}_content_type = "{mime}";\n')
     c_file.write(f"const uint8_t {variable}[{clen}] = {{{compressed}}};\n\n")